@@ -224,6 +224,9 @@ void MainVisual::timeout()
     VisualNode *node = NULL;
     if (playing && gPlayer->getOutput())
     {
+        // pull pending samples from the output's lock-free tap; add()
+        // now runs here instead of in the audio thread
+        gPlayer->getOutput()->drainVisualData();
         long synctime = gPlayer->getOutput()->GetAudiotime();
         mutex()->lock();
         VisualNode *prev = NULL;
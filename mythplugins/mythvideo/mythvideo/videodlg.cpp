@@ -822,6 +822,21 @@ class VideoDialogPrivate
 
     typedef VideoDialog::VideoListPtr VideoListPtr;
 
+  public:
+    // Artwork filenames resolved for a tree node.  Hunting images for
+    // folder nodes can mean remote storage group checks, so the result
+    // is cached and replayed whenever the node's button scrolls back
+    // into view.
+    struct NodeImages
+    {
+        QString itemimage;
+        QString coverimage;
+        QString screenshot;
+        QString banner;
+        QString fanart;
+    };
+    typedef QMap<MythGenericTree *, NodeImages> NodeImageMap;
+
   public:
     VideoDialogPrivate(VideoListPtr videoList, VideoDialog::DialogType type,
                        VideoDialog::BrowseType browse) :
@@ -936,6 +951,8 @@ class VideoDialogPrivate
 
     QString m_lastTreeNodePath;
 
+    NodeImageMap m_nodeImages;
+
   private:
     parental_level_map m_rating_to_pl;
 };
@@ -1170,6 +1187,8 @@ bool VideoDialog::Create()
                 SLOT(handleSelect(MythUIButtonListItem *)));
         connect(m_videoButtonList, SIGNAL(itemSelected(MythUIButtonListItem *)),
                 SLOT(UpdateText(MythUIButtonListItem *)));
+        connect(m_videoButtonList, SIGNAL(itemVisible(MythUIButtonListItem *)),
+                SLOT(UpdateVisible(MythUIButtonListItem *)));
     }
 
     connect(&m_d->m_parentalLevel, SIGNAL(SigLevelChanged()),
@@ -1279,7 +1298,8 @@ void VideoDialog::loadData()
 
                 item->SetData(qVariantFromValue(*p));
 
-                UpdateItem(item);
+                // images wait until the item scrolls into view
+                UpdateItem(item, true);
 
                 if (*p == selectedNode)
                     m_videoButtonList->SetItemCurrent(item);
@@ -1290,11 +1310,14 @@ void VideoDialog::loadData()
     UpdatePosition();
 }
 
-/** \fn VideoDialog::UpdateItem(MythUIButtonListItem *item)
+/** \fn VideoDialog::UpdateItem(MythUIButtonListItem *item, bool deferImages)
  *  \brief Update the visible representation of a MythUIButtonListItem.
+ *
+ *  With deferImages set the artwork hunt is left to UpdateVisible(),
+ *  so filling a large folder's list never stalls on image lookups.
  *  \return void.
  */
-void VideoDialog::UpdateItem(MythUIButtonListItem *item)
+void VideoDialog::UpdateItem(MythUIButtonListItem *item, bool deferImages)
 {
     if (!item)
         return;
@@ -1324,47 +1347,11 @@ void VideoDialog::UpdateItem(MythUIButtonListItem *item)
     else
         item->SetText(metadata ? metadata->GetTitle() : node->getString());
 
-    QString coverimage = GetCoverImage(node);
-    QString screenshot = GetScreenshot(node);
-    QString banner     = GetBanner(node);
-    QString fanart     = GetFanart(node);
-
-    if (!screenshot.isEmpty() && parent && metadata &&
-        ((QString::compare(parent->getString(),
-                            metadata->GetTitle(), Qt::CaseInsensitive) == 0) ||
-            parent->getString().startsWith(tr("Season"), Qt::CaseInsensitive)))
-    {
-        item->SetImage(screenshot);
-    }
-    else
-    {
-        if (coverimage.isEmpty())
-            coverimage = GetFirstImage(node, "Coverart");
-        item->SetImage(coverimage);
-    }
+    if (!deferImages)
+        UpdateItemImages(item, true);
 
     int nodeInt = node->getInt();
 
-    if (coverimage.isEmpty() && nodeInt == kSubFolder)
-        coverimage = GetFirstImage(node, "Coverart");
-
-    item->SetImage(coverimage, "coverart");
-
-    if (screenshot.isEmpty() && nodeInt == kSubFolder)
-        screenshot = GetFirstImage(node, "Screenshots");
-
-    item->SetImage(screenshot, "screenshot");
-
-    if (banner.isEmpty() && nodeInt == kSubFolder)
-        banner = GetFirstImage(node, "Banners");
-
-    item->SetImage(banner, "banner");
-
-    if (fanart.isEmpty() && nodeInt == kSubFolder)
-        fanart = GetFirstImage(node, "Fanart");
-
-    item->SetImage(fanart, "fanart");
-
     if (nodeInt == kSubFolder)
     {
         item->SetText(QString("%1").arg(node->visibleChildCount()), "childcount");
@@ -1383,12 +1370,96 @@ void VideoDialog::UpdateItem(MythUIButtonListItem *item)
         UpdateText(item);
 }
 
+/** \fn VideoDialog::UpdateVisible(MythUIButtonListItem *item)
+ *  \brief Fill in an item's artwork once it has scrolled into view.
+ *  \return void.
+ */
+void VideoDialog::UpdateVisible(MythUIButtonListItem *item)
+{
+    if (!item)
+        return;
+
+    UpdateItemImages(item);
+}
+
+/** \fn VideoDialog::UpdateItemImages(MythUIButtonListItem *item, bool refresh)
+ *  \brief Resolve and apply the artwork for a MythUIButtonListItem.
+ *
+ *  The hunt for folder artwork can mean remote storage group checks,
+ *  so the resolved filenames are cached per node; pass refresh to
+ *  force a new hunt after the underlying metadata has changed.
+ *  \return void.
+ */
+void VideoDialog::UpdateItemImages(MythUIButtonListItem *item, bool refresh)
+{
+    MythGenericTree *node = GetNodePtrFromButton(item);
+
+    if (!node)
+        return;
+
+    VideoDialogPrivate::NodeImageMap::iterator img =
+            m_d->m_nodeImages.find(node);
+
+    if (img == m_d->m_nodeImages.end() || refresh)
+    {
+        VideoDialogPrivate::NodeImages images;
+
+        VideoMetadata *metadata = GetMetadata(item);
+        MythGenericTree *parent = node->getParent();
+
+        images.coverimage = GetCoverImage(node);
+        images.screenshot = GetScreenshot(node);
+        images.banner     = GetBanner(node);
+        images.fanart     = GetFanart(node);
+
+        if (!images.screenshot.isEmpty() && parent && metadata &&
+            ((QString::compare(parent->getString(),
+                                metadata->GetTitle(), Qt::CaseInsensitive) == 0) ||
+                parent->getString().startsWith(tr("Season"), Qt::CaseInsensitive)))
+        {
+            images.itemimage = images.screenshot;
+        }
+        else
+        {
+            if (images.coverimage.isEmpty())
+                images.coverimage = GetFirstImage(node, "Coverart");
+            images.itemimage = images.coverimage;
+        }
+
+        int nodeInt = node->getInt();
+
+        if (images.coverimage.isEmpty() && nodeInt == kSubFolder)
+            images.coverimage = GetFirstImage(node, "Coverart");
+
+        if (images.screenshot.isEmpty() && nodeInt == kSubFolder)
+            images.screenshot = GetFirstImage(node, "Screenshots");
+
+        if (images.banner.isEmpty() && nodeInt == kSubFolder)
+            images.banner = GetFirstImage(node, "Banners");
+
+        if (images.fanart.isEmpty() && nodeInt == kSubFolder)
+            images.fanart = GetFirstImage(node, "Fanart");
+
+        img = m_d->m_nodeImages.insert(node, images);
+    }
+
+    item->SetImage(img->itemimage);
+    item->SetImage(img->coverimage, "coverart");
+    item->SetImage(img->screenshot, "screenshot");
+    item->SetImage(img->banner, "banner");
+    item->SetImage(img->fanart, "fanart");
+}
+
 /** \fn VideoDialog::fetchVideos()
  *  \brief Build the buttonlist/tree.
  *  \return void.
  */
 void VideoDialog::fetchVideos()
 {
+    // the tree may be rebuilt below, invalidating the cached artwork
+    // keyed on its nodes
+    m_d->m_nodeImages.clear();
+
     MythGenericTree *oldroot = m_d->m_rootNode;
     if (!m_d->m_treeLoaded)
     {
@@ -140,7 +140,8 @@ class VideoDialog : public MythScreenType
     void reloadAllData(bool);
     void reloadData();
     void refreshData();
-    void UpdateItem(MythUIButtonListItem *item);
+    void UpdateItem(MythUIButtonListItem *item, bool deferImages = false);
+    void UpdateVisible(MythUIButtonListItem *item);
 
   protected:
     void customEvent(QEvent *levent);
@@ -150,6 +151,7 @@ class VideoDialog : public MythScreenType
 
     virtual void loadData();
     void fetchVideos();
+    void UpdateItemImages(MythUIButtonListItem *item, bool refresh = false);
     QString RemoteImageCheck(QString host, QString filename);
     QString GetCoverImage(MythGenericTree *node);
     QString GetFirstImage(MythGenericTree *node, QString type,
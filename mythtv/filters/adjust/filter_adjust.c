@@ -189,6 +189,72 @@ static int adjustFilter (VideoFilter *vf, VideoFrame *frame, int field)
     return 0;
 }
 
+static int adjustSlice (VideoFilter *vf, VideoFrame *frame, int field,
+                        int slice_start, int slice_height)
+{
+    ThisFilter *filter = (ThisFilter *) vf;
+    int ytop = slice_start;
+    int ybot = slice_start + slice_height;
+    int vshift = (frame->codec == FMT_YV12) ? 1 : 0;
+    int ctop, cbot;
+
+    (void)field;
+
+    if (ybot > frame->height)
+        ybot = frame->height;
+    ctop = ytop >> vshift;
+    cbot = (ybot >= frame->height) ?
+        (frame->height >> vshift) : (ybot >> vshift);
+
+    {
+        unsigned char *ybeg = frame->buf + frame->offsets[0] +
+            (ytop * frame->pitches[0]);
+        unsigned char *yend = frame->buf + frame->offsets[0] +
+            (ybot * frame->pitches[0]);
+        unsigned char *ubeg = frame->buf + frame->offsets[1] +
+            (ctop * frame->pitches[1]);
+        unsigned char *uend = frame->buf + frame->offsets[1] +
+            (cbot * frame->pitches[1]);
+        unsigned char *vbeg = frame->buf + frame->offsets[2] +
+            (ctop * frame->pitches[2]);
+        unsigned char *vend = frame->buf + frame->offsets[2] +
+            (cbot * frame->pitches[2]);
+
+#if HAVE_MMX
+        if (filter->yfilt)
+            adjustRegionMMX(ybeg, yend, filter->ytable,
+                            &(filter->yshift), &(filter->yscale),
+                            &(filter->ymin), mm_cpool + 1, mm_cpool + 2);
+        else
+            adjustRegion(ybeg, yend, filter->ytable);
+
+        if (filter->cfilt)
+        {
+            adjustRegionMMX(ubeg, uend, filter->ctable,
+                            &(filter->cshift), &(filter->cscale),
+                            &(filter->cmin), mm_cpool + 3, mm_cpool + 4);
+            adjustRegionMMX(vbeg, vend, filter->ctable,
+                            &(filter->cshift), &(filter->cscale),
+                            &(filter->cmin), mm_cpool + 3, mm_cpool + 4);
+        }
+        else
+        {
+            adjustRegion(ubeg, uend, filter->ctable);
+            adjustRegion(vbeg, vend, filter->ctable);
+        }
+
+        if (filter->yfilt || filter->cfilt)
+            emms();
+
+#else /* HAVE_MMX */
+        adjustRegion(ybeg, yend, filter->ytable);
+        adjustRegion(ubeg, uend, filter->ctable);
+        adjustRegion(vbeg, vend, filter->ctable);
+#endif /* HAVE_MMX */
+    }
+    return 0;
+}
+
 static void fillTable(uint8_t *table, int in_min, int in_max, int out_min,
                 int out_max, float gamma)
 {
@@ -279,6 +345,7 @@ newAdjustFilter (VideoFrameType inpixfmt, VideoFrameType outpixfmt,
     if (ymin == -1)
     {
         filter->vf.filter = NULL;
+        filter->vf.filter_slice = NULL;
         filter->vf.cleanup = NULL;
         return (VideoFilter *) filter;
     }
@@ -296,6 +363,7 @@ newAdjustFilter (VideoFrameType inpixfmt, VideoFrameType outpixfmt,
 #endif
 
     filter->vf.filter = &adjustFilter;
+    filter->vf.filter_slice = &adjustSlice;
     filter->vf.cleanup = NULL;
     
     TF_INIT(filter);
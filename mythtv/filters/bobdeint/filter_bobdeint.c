@@ -126,6 +126,7 @@ static VideoFilter *new_filter(VideoFrameType inpixfmt,
     }
 
     filter->vf.filter = &bobDeintFilter;
+    filter->vf.filter_slice = NULL;
     filter->tmp_size = 0;
     filter->tmp_ptr = NULL;
     filter->state_size = 0;
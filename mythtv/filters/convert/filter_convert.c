@@ -143,6 +143,7 @@ newConvertFilter (VideoFrameType inpixfmt, VideoFrameType outpixfmt,
     }
     else if (inpixfmt == outpixfmt)
         filter->vf.filter = NULL;
+    filter->vf.filter_slice = NULL;
     filter->vf.cleanup = NULL;
     TF_INIT(filter);
     return (VideoFilter *) filter;
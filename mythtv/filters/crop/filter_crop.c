@@ -283,6 +283,7 @@ static VideoFilter *new_filter(VideoFrameType inpixfmt,
 
     filter->vf.cleanup = NULL;
     filter->vf.filter  = &crop;
+    filter->vf.filter_slice = NULL;
 
 #ifdef MMX
     if (mm_support() & FF_MM_MMX)
@@ -414,6 +414,7 @@ static VideoFilter *NewDenoise3DFilter(VideoFrameType inpixfmt,
     memset(filter, 0, sizeof(ThisFilter)); /*MS Windows doesn't like bzero()*/
 
     filter->vf.filter = &denoise3DFilter;
+    filter->vf.filter_slice = NULL;
     filter->vf.cleanup = &Denoise3DFilterCleanup;
     filter->filtfunc = &denoise;
 
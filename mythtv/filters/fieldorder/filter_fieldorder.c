@@ -216,6 +216,7 @@ static VideoFilter *FieldorderDeintFilter(VideoFrameType inpixfmt,
     AllocFilter(filter, *width, *height);
 
     filter->vf.filter = &FieldorderDeint;
+    filter->vf.filter_slice = NULL;
     filter->vf.cleanup = &CleanupFieldorderDeintFilter;
     return (VideoFilter *) filter;
 }
@@ -20,6 +20,7 @@ new_force_template (VideoFrameType inpixfmt, VideoFrameType outpixfmt,
     if (filter)
     {
         filter->filter = NULL;
+        filter->filter_slice = NULL;
         filter->cleanup = NULL;
     }
 
@@ -262,6 +262,7 @@ static VideoFilter* GreedyHDeintFilter(VideoFrameType inpixfmt,
 #endif
 
     filter->vf.filter = &GreedyHDeint;
+    filter->vf.filter_slice = NULL;
     filter->vf.cleanup = &CleanupGreedyHDeintFilter;
     return (VideoFilter *) filter;
 }
@@ -38,6 +38,35 @@ int invert(VideoFilter *vf, VideoFrame *frame, int field)
     return 0;
 }
 
+int invertSlice(VideoFilter *vf, VideoFrame *frame, int field,
+                int slice_start, int slice_height)
+{
+    int planes = (frame->codec == FMT_RGB24) ? 1 : 3;
+    int p;
+
+    (void)vf;
+    (void)field;
+
+    for (p = 0; p < planes; p++)
+    {
+        int vshift = (frame->codec == FMT_YV12 && p) ? 1 : 0;
+        int top    = slice_start >> vshift;
+        int rows   = (slice_start + slice_height >= frame->height) ?
+            (frame->height >> vshift) - top : (slice_height >> vshift);
+        unsigned char *buf = frame->buf + frame->offsets[p] +
+            (top * frame->pitches[p]);
+        int size = frame->pitches[p] * rows;
+
+        while (size--)
+        {
+            *buf = 255 - (*buf);
+            buf++;
+        }
+    }
+
+    return 0;
+}
+
 static VideoFilter *new_filter(VideoFrameType inpixfmt,
                                VideoFrameType outpixfmt,
                                int *width, int *height, char *options,
@@ -63,6 +92,7 @@ static VideoFilter *new_filter(VideoFrameType inpixfmt,
         return NULL;
     }
     filter->vf.filter = &invert;
+    filter->vf.filter_slice = &invertSlice;
     filter->vf.cleanup = NULL;
     TF_INIT(filter)
     return (VideoFilter *) filter;
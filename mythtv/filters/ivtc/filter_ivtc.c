@@ -239,6 +239,7 @@ static VideoFilter *NewIvtcFilter(VideoFrameType inpixfmt,
 
     pullup_init_context(c);
     filter->vf.filter = &IvtcFilter;
+    filter->vf.filter_slice = NULL;
     filter->vf.cleanup = &IvtcFilterCleanup;
     return (VideoFilter *) filter;
 }
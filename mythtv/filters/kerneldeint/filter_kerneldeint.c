@@ -587,6 +587,7 @@ static VideoFilter *NewKernelDeintFilter(VideoFrameType inpixfmt,
     TF_INIT(filter);
 
     filter->vf.filter  = &KernelDeint;
+    filter->vf.filter_slice = NULL;
     filter->vf.cleanup = &CleanupKernelDeintFilter;
 
     filter->frame = NULL;
@@ -347,6 +347,7 @@ static VideoFilter *new_filter(VideoFrameType inpixfmt,
     }
 
     filter->vf.filter = &linearBlendFilter;
+    filter->vf.filter_slice = NULL;
     filter->subfilter = &linearBlend;    /* Default, non accellerated */
     filter->mm_flags = mm_support();
     if (HAVE_MMX && filter->mm_flags & FF_MM_MMXEXT)
@@ -80,6 +80,7 @@ static VideoFilter *new_filter(VideoFrameType inpixfmt,
     }
 
     filter->vf.filter = &oneFieldFilter;
+    filter->vf.filter_slice = NULL;
     filter->bottom = 0;
     if (options != NULL && strstr(options, "bottom") != NULL)
         filter->bottom = 1;
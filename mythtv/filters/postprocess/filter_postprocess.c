@@ -5,6 +5,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
+#include <pthread.h>
 
 #include "mythconfig.h"
 
@@ -19,24 +20,83 @@
 
 //static const char FILTER_NAME[] = "PostProcess";
 
+#define MAX_PP_THREADS 8
+
+struct PPThread
+{
+    int       ready;
+    pthread_t id;
+    int       exists;
+};
+
 typedef struct ThisFilter
 {
     VideoFilter vf;
 
     pp_mode_t* mode;
     pp_context_t* context;
+    /* one context per slice; libpostproc contexts keep per-call
+     * temporaries, so the workers cannot share one */
+    pp_context_t* slice_context[MAX_PP_THREADS];
+
+    struct PPThread *threads;
+    VideoFrame *frame;
+    int         ready;
+    int         kill_threads;
+    int         actual_threads;
+    int         requested_threads;
+    pthread_mutex_t mutex;
+
     int width;
     int height;
-    int ysize;
-    int csize;
-    unsigned char* src[3];
-    unsigned char* dst[3];
-    int srcStride[3];
-    int dstStride[3];
     int eprint;
     TF_STRUCT;
 } ThisFilter;
 
+/* Slice boundaries sit on 16 row multiples so the 8x8 block passes
+ * and the macroblock sized QP lookup stay aligned in every slice. */
+static void pp_slice_bounds(int height, int slice, int total,
+                            int *start, int *end)
+{
+    *start = (slice * height / total) & ~15;
+    *end   = (slice == total - 1) ?
+        height : (((slice + 1) * height / total) & ~15);
+}
+
+static void pp_process_slice(ThisFilter *tf, VideoFrame *frame,
+                             int slice, int total)
+{
+    const uint8_t *src[3];
+    uint8_t *dst[3];
+    int strides[3];
+    int start, end;
+
+    pp_slice_bounds(frame->height, slice, total, &start, &end);
+    if (end <= start)
+        return;
+
+    strides[0] = frame->pitches[0];
+    strides[1] = frame->pitches[1];
+    strides[2] = frame->pitches[2];
+
+    dst[0] = frame->buf + frame->offsets[0] + start * strides[0];
+    dst[1] = frame->buf + frame->offsets[1] + (start >> 1) * strides[1];
+    dst[2] = frame->buf + frame->offsets[2] + (start >> 1) * strides[2];
+    src[0] = dst[0];
+    src[1] = dst[1];
+    src[2] = dst[2];
+
+    signed char *qp = (signed char *) frame->qscale_table;
+    if (qp)
+        qp += (start >> 4) * frame->qstride;
+
+    pp_postprocess(src, strides, dst, strides,
+                   frame->width, end - start,
+                   qp, qp ? frame->qstride : 0,
+                   tf->mode,
+                   (total > 1) ? tf->slice_context[slice] : tf->context,
+                   PP_FORMAT_420);
+}
 
 static int pp(VideoFilter *vf, VideoFrame *frame, int field)
 {
@@ -46,41 +106,83 @@ static int pp(VideoFilter *vf, VideoFrame *frame, int field)
 
     TF_START;
 
-    tf->src[0] = tf->dst[0] = frame->buf;
-    tf->src[1] = tf->dst[1] = frame->buf + tf->ysize;
-    tf->src[2] = tf->dst[2] = frame->buf + tf->ysize + tf->csize;
-
     if (frame->qscale_table == NULL)
         frame->qstride = 0;
 
-    tf->ysize = (frame->width) * (frame->height);
-    tf->csize = tf->ysize / 4;
+    if (tf->actual_threads < 2 ||
+        frame->width != tf->width || frame->height != tf->height)
+    {
+        pp_process_slice(tf, frame, 0, 1);
+    }
+    else
+    {
+        int i;
+        for (i = 0; i < tf->actual_threads; i++)
+            tf->threads[i].ready = 1;
+        tf->frame = frame;
+        tf->ready = tf->actual_threads;
+        i = 0;
+        while (tf->ready > 0 && i < 1000)
+        {
+            usleep(1000);
+            i++;
+        }
+        tf->frame = NULL;
+    }
 
-    tf->width = frame->width;
-    tf->height = frame->height;
+    TF_END(tf, "PostProcess: ");
+    return 0;
+}
 
-    tf->srcStride[0] = tf->ysize / (tf->height);
-    tf->srcStride[1] = tf->csize / (tf->height) * 2;
-    tf->srcStride[2] = tf->csize / (tf->height) * 2;
+static void *PPThread(void *args)
+{
+    ThisFilter *filter = (ThisFilter*)args;
 
-    tf->dstStride[0] = tf->ysize / (tf->height);
-    tf->dstStride[1] = tf->csize / (tf->height) * 2;
-    tf->dstStride[2] = tf->csize / (tf->height) * 2;
+    pthread_mutex_lock(&(filter->mutex));
+    int num = filter->actual_threads;
+    filter->actual_threads = num + 1;
+    pthread_mutex_unlock(&(filter->mutex));
 
-    pp_postprocess( (const uint8_t**)tf->src, tf->srcStride,
-                    tf->dst, tf->dstStride,
-                    frame->width, frame->height,
-                    (signed char *)(frame->qscale_table), frame->qstride,
-                    tf->mode, tf->context, PP_FORMAT_420);
+    while (!filter->kill_threads)
+    {
+        usleep(1000);
+        if (filter->ready &&
+            filter->frame != NULL &&
+            filter->threads[num].ready)
+        {
+            pp_process_slice(filter, filter->frame,
+                             num, filter->actual_threads);
 
-    TF_END(tf, "PostProcess: ");
-    return 0;
+            pthread_mutex_lock(&(filter->mutex));
+            filter->ready = filter->ready - 1;
+            filter->threads[num].ready = 0;
+            pthread_mutex_unlock(&(filter->mutex));
+        }
+    }
+    pthread_exit(NULL);
+    return NULL;
 }
 
 static void cleanup(VideoFilter *filter)
 {
-    pp_free_context(((ThisFilter*)filter)->context);
-    pp_free_mode(((ThisFilter*)filter)->mode);
+    ThisFilter *f = (ThisFilter*)filter;
+    int i;
+
+    if (f->threads != NULL)
+    {
+        f->kill_threads = 1;
+        for (i = 0; i < f->requested_threads; i++)
+            if (f->threads[i].exists)
+                pthread_join(f->threads[i].id, NULL);
+        free(f->threads);
+    }
+
+    for (i = 0; i < MAX_PP_THREADS; i++)
+        if (f->slice_context[i])
+            pp_free_context(f->slice_context[i]);
+
+    pp_free_context(f->context);
+    pp_free_mode(f->mode);
 }
 
 static VideoFilter *new_filter(VideoFrameType inpixfmt,
@@ -88,8 +190,8 @@ static VideoFilter *new_filter(VideoFrameType inpixfmt,
                                int *width, int *height, char *options,
                                int threads)
 {
-    (void) threads;
     ThisFilter *filter;
+    int i;
 
     if ( inpixfmt != FMT_YV12 || outpixfmt != FMT_YV12 )
         return NULL;
@@ -115,19 +217,111 @@ static VideoFilter *new_filter(VideoFrameType inpixfmt,
     if (filter->mode == NULL)
     {
         printf("%s", pp_help);
+        pp_free_context(filter->context);
         free(filter);
         return NULL;
     }
 
     filter->eprint = 0;
+    filter->width  = *width;
+    filter->height = *height;
 
     filter->vf.filter = &pp;
+    filter->vf.filter_slice = NULL;
     filter->vf.cleanup = &cleanup;
     TF_INIT(filter);
+
+    filter->frame = NULL;
+    filter->ready = 0;
+    filter->kill_threads = 0;
+    filter->actual_threads = 0;
+    filter->requested_threads = threads;
+    filter->threads = NULL;
+    memset(filter->slice_context, 0, sizeof(filter->slice_context));
+
+    if (filter->requested_threads > MAX_PP_THREADS)
+        filter->requested_threads = MAX_PP_THREADS;
+    // every slice must have at least one aligned block row
+    while (filter->requested_threads > 1 &&
+           (*height / filter->requested_threads) < 16)
+        filter->requested_threads--;
+
+    if (filter->requested_threads > 1)
+    {
+        for (i = 0; i < filter->requested_threads; i++)
+        {
+            int start, end;
+            pp_slice_bounds(*height, i, filter->requested_threads,
+                            &start, &end);
+            filter->slice_context[i] = pp_get_context(*width, end - start,
+                            PP_CPU_CAPS_MMX|PP_CPU_CAPS_MMX2|PP_CPU_CAPS_3DNOW);
+            if (filter->slice_context[i] == NULL)
+            {
+                printf("PostProc: failed to get slice context - "
+                       "falling back to existing, single thread.\n");
+                filter->requested_threads = 1;
+                break;
+            }
+        }
+    }
+
+    if (filter->requested_threads > 1)
+    {
+        filter->threads = (struct PPThread *)
+            calloc(filter->requested_threads, sizeof(struct PPThread));
+        if (filter->threads == NULL)
+        {
+            printf("PostProc: failed to allocate memory for threads - "
+                   "falling back to existing, single thread.\n");
+            filter->requested_threads = 1;
+        }
+    }
+
+    if (filter->requested_threads > 1)
+    {
+        pthread_mutex_init(&(filter->mutex), NULL);
+        int success = 0;
+        for (i = 0; i < filter->requested_threads; i++)
+        {
+            if (pthread_create(&(filter->threads[i].id), NULL,
+                               PPThread, (void*)filter) != 0)
+                filter->threads[i].exists = 0;
+            else
+            {
+                success++;
+                filter->threads[i].exists = 1;
+            }
+        }
+
+        if (success < filter->requested_threads)
+        {
+            printf("PostProc: only created %d of %d threads - "
+                   "falling back to existing, single thread.\n",
+                   success, filter->requested_threads);
+        }
+        else
+        {
+            int timeout = 0;
+            while (filter->actual_threads != filter->requested_threads)
+            {
+                timeout++;
+                if (timeout > 5000)
+                {
+                    printf("PostProc: waited too long for threads to start."
+                           "- continuing.\n");
+                    break;
+                }
+                usleep(1000);
+            }
+            printf("PostProc: Created %d threads (%d requested)\n",
+                   filter->actual_threads, filter->requested_threads);
+        }
+    }
+
     return (VideoFilter *)filter;
 }
 
-FmtConv FmtList[] = 
+FmtConv FmtList[] =
 {
     { FMT_YV12, FMT_YV12 },
     FMT_NULL
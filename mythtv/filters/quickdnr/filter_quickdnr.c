@@ -520,6 +520,7 @@ static VideoFilter *new_filter(VideoFrameType inpixfmt,
     }
 
     filter->vf.filter  = (double_threshold) ? &quickdnr2 : &quickdnr;
+    filter->vf.filter_slice = NULL;
 
 #ifdef MMX
     if (mm_support() > FF_MM_MMXEXT)
@@ -43,6 +43,25 @@ static const char *quality_string(int q)
     }
 }
 
+/*
+ * Pick the libsamplerate converter for a rate pair
+ *
+ * Integer ratio pairs (32k->48k, 96k->48k, ...) land on exact phases of
+ * the precomputed polyphase filter bank, so the short SINC_FASTEST bank
+ * is both cheap and clean for them. Fractional pairs such as 44.1k->48k
+ * interpolate between the table phases and keep the longer filters the
+ * quality setting asks for. Selecting QUALITY_HIGH forces the long sinc
+ * for everything.
+ */
+static int resampler_converter(int src_rate, int dest_rate, int quality)
+{
+    if (quality < QUALITY_HIGH && src_rate > 0 && dest_rate > 0 &&
+        ((dest_rate % src_rate == 0) || (src_rate % dest_rate == 0)))
+        return SRC_SINC_FASTEST;
+
+    return 2 - quality;
+}
+
 AudioOutputBase::AudioOutputBase(const AudioSettings &settings) :
     // protected
     channels(-1),               codec(CODEC_ID_NONE),
@@ -262,7 +281,8 @@ void AudioOutputBase::SetStretchFactorLocked(float lstretchfactor)
             processing = true;
             bytes_per_frame = source_channels *
                               AudioOutputSettings::SampleSize(FORMAT_FLT);
-            waud = raud = 0;
+            raud = 0;
+            waud = 0;
             reset_active.Ref();
         }
     }
@@ -388,7 +408,8 @@ void AudioOutputBase::Reconfigure(const AudioSettings &orig_settings)
     QMutexLocker lock(&audio_buflock);
     QMutexLocker lockav(&avsync_lock);
 
-    waud = raud = 0;
+    raud = 0;
+    waud = 0;
     reset_active.Clear();
     actually_paused = processing = false;
 
@@ -460,13 +481,18 @@ void AudioOutputBase::Reconfigure(const AudioSettings &orig_settings)
     if (need_resampler && src_quality > QUALITY_DISABLED)
     {
         int error;
+        int converter = resampler_converter(settings.samplerate, dest_rate,
+                                            src_quality);
         samplerate = dest_rate;
 
-        VBGENERAL(QString("Resampling from %1 kHz to %2 kHz with quality %3")
+        VBGENERAL(QString("Resampling from %1 kHz to %2 kHz with quality %3%4")
                 .arg(settings.samplerate/1000).arg(samplerate/1000)
-                .arg(quality_string(src_quality)));
+                .arg(quality_string(src_quality))
+                .arg((converter == SRC_SINC_FASTEST &&
+                      src_quality != QUALITY_LOW) ?
+                     " (integer ratio fast path)" : ""));
 
-        src_ctx = src_new(2-src_quality, source_channels, &error);
+        src_ctx = src_new(converter, source_channels, &error);
         if (error)
         {
             Error(QString("Error creating resampler: %1")
@@ -696,7 +722,7 @@ void AudioOutputBase::Reset()
     QMutexLocker lockav(&avsync_lock);
 
     audbuf_timecode = audiotime = frames_buffered = 0;
-    waud = raud;    // empty ring buffer
+    waud = (int)raud;   // empty ring buffer
     reset_active.Ref();
     current_seconds = -1;
     was_paused = !pauseaudio;
@@ -734,10 +760,15 @@ void AudioOutputBase::SetEffDsp(int dsprate)
  */
 inline int AudioOutputBase::audiolen()
 {
-    if (waud >= raud)
-        return waud - raud;
+    // take one snapshot of each cursor; the other thread may move its
+    // cursor between two reads and a mixed pair would give a bogus length
+    int lraud = raud;
+    int lwaud = waud;
+
+    if (lwaud >= lraud)
+        return lwaud - lraud;
     else
-        return kAudioRingBufferSize - (raud - waud);
+        return kAudioRingBufferSize - (lraud - lwaud);
 }
 
 /**
@@ -1112,6 +1143,18 @@ bool AudioOutputBase::AddFrames(void *in_buffer, int in_frames,
         return false; // would overflow
     }
 
+    // Fold the software volume into the downmix coefficients so the gain
+    // costs nothing extra; same volume mapping as AdjustVolume()
+    bool volume_fused = needs_downmix && internal_vol && SWVolume();
+    float fused_gain  = 1.0f;
+    if (volume_fused)
+    {
+        fused_gain  = volume / 100.0f;
+        fused_gain *= fused_gain;
+        if (music)
+            fused_gain *= 0.4f;
+    }
+
     int frames_remaining = in_frames;
     int frames_offset = 0;
     int frames_final = 0;
@@ -1140,7 +1183,8 @@ bool AudioOutputBase::AddFrames(void *in_buffer, int in_frames,
         // Perform downmix if necessary
         if (needs_downmix)
             if(AudioOutputDownmix::DownmixFrames(source_channels, channels,
-                                                 src_in, src_in, frames) < 0)
+                                                 src_in, src_in, frames,
+                                                 fused_gain) < 0)
                 VBERROR("Error occurred while downmixing");
 
         // Resample if necessary
@@ -1211,7 +1255,7 @@ bool AudioOutputBase::AddFrames(void *in_buffer, int in_frames,
             org_waud += nFrames * bpf;
         }
 
-        if (internal_vol && SWVolume())
+        if (internal_vol && SWVolume() && !volume_fused)
         {
             org_waud    = waud;
             int num     = len;
@@ -1277,7 +1321,9 @@ bool AudioOutputBase::AddFrames(void *in_buffer, int in_frames,
             org_waud = org_waud2;
         }
 
-        waud = org_waud;
+        // publish the write cursor only once the sample bytes are in the
+        // buffer, so the lockless output thread never reads a stale mix
+        waud.fetchAndStoreOrdered(org_waud);
     }
 
     SetAudiotime(frames_final, timecode);
@@ -1399,7 +1445,7 @@ void AudioOutputBase::OutputAudioLoop(void)
             {
                 WriteAudio(fragment, fragment_size);
                 if (!reset_active.TestAndDeref())
-                    raud = next_raud;
+                    raud.fetchAndStoreOrdered(next_raud);
             }
         }
 #ifdef AUDIOTSTESTING
@@ -1434,8 +1480,12 @@ int AudioOutputBase::GetAudioData(uchar *buffer, int size, bool full_buffer,
     int frag_size    = size;
     int written_size = size;
 
-    if (local_raud == NULL)
-        local_raud = &raud;
+    // callers without their own cursor stage through a local and have it
+    // published for them on the way out
+    int raud_now = raud;
+    bool commit_raud = (local_raud == NULL);
+    if (commit_raud)
+        local_raud = &raud_now;
 
     if (!full_buffer && (size > avail_size))
     {
@@ -1447,7 +1497,7 @@ int AudioOutputBase::GetAudioData(uchar *buffer, int size, bool full_buffer,
     if (!avail_size || (frag_size > avail_size))
         return 0;
 
-    int bdiff = kAudioRingBufferSize - raud;
+    int bdiff = kAudioRingBufferSize - *local_raud;
 
     int obytes = output_settings->SampleSize(output_format);
     bool fromFloats = processing && !enc && output_format != FORMAT_FLT;
@@ -1483,6 +1533,9 @@ int AudioOutputBase::GetAudioData(uchar *buffer, int size, bool full_buffer,
 
     *local_raud += frag_size;
 
+    if (commit_raud)
+        raud.fetchAndStoreOrdered(raud_now);
+
     // Mute individual channels through mono->stereo duplication
     MuteState mute_state = GetMuteState();
     if (written_size && channels > 1 &&
@@ -10,6 +10,7 @@ using namespace std;
 
 // Qt headers
 #include <QString>
+#include <QAtomicInt>
 #include <QMutex>
 #include <QWaitCondition>
 #include <QThread>
@@ -195,8 +196,11 @@ class AudioOutputBase : public AudioOutput, public QThread
 
     bool audio_thread_exists;
 
-    /* Writes to the audiobuffer, reconfigures and audiobuffer resets can only
-       take place while holding this lock */
+    /* Serializes the producer side of the audiobuffer - AddFrames,
+       reconfigures, resets and stretch factor changes - against each other
+       and the processing elements they share (resampler, upmixer,
+       soundstretch, encoder). The output thread never takes it; the
+       buffer handoff itself is the lock-free cursor protocol below */
     QMutex audio_buflock;
 
     /** must hold avsync_lock to read or write 'audiotime' and
@@ -206,8 +210,11 @@ class AudioOutputBase : public AudioOutput, public QThread
     // timecode of audio leaving the soundcard (same units as timecodes)
     int64_t audiotime;
 
-    /* Audio circular buffer */
-    int raud, waud;     /* read and write positions */
+    /* Audio circular buffer. Single producer (AddFrames), single consumer
+       (the output thread): each side stages its cursor in a local, then
+       publishes it with an ordered store once the sample bytes are in
+       place, so neither side needs a lock to move data */
+    QAtomicInt raud, waud;  /* read and write positions */
     // timecode of audio most recently placed into buffer
     int64_t audbuf_timecode;
     AsyncLooseLock reset_active;
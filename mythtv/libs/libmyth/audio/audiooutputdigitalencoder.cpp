@@ -46,7 +46,9 @@ AudioOutputDigitalEncoder::AudioOutputDigitalEncoder(void) :
     bytes_per_sample(0),
     av_context(NULL),
     outlen(0),
+    outoff(0),
     inlen(0),
+    inoff(0),
     one_frame_bytes(0)
 {
     in = (char *)(((long)&inbuf + 15) & ~15);
@@ -355,24 +357,44 @@ size_t AudioOutputDigitalEncoder::Encode(void *buf, int len, bool isFloat)
 {
     size_t outsize = 0;
 
+    // only compact the staging buffer when the tail has no room left for
+    // this chunk; encoding advances a read cursor instead of shifting the
+    // leftover samples down after every call
+    int appended = isFloat ? len >> 1 : len;
+    if (inoff && inoff + inlen + appended > INBUFSIZE)
+    {
+        memmove(in, in + inoff, inlen);
+        inoff = 0;
+    }
+
     if (isFloat)
-        inlen += AudioOutputUtil::fromFloat(FORMAT_S16, in + inlen, buf, len);
+        inlen += AudioOutputUtil::fromFloat(FORMAT_S16, in + inoff + inlen,
+                                            buf, len);
     else
     {
-        memcpy(in + inlen, buf, len);
+        memcpy(in + inoff + inlen, buf, len);
         inlen += len;
     }
 
     int frames = inlen / one_frame_bytes;
     int i = 0;
 
+    if (outoff &&
+        outoff + outlen + frames * MAX_AC3_FRAME_SIZE > OUTBUFSIZE)
+    {
+        memmove(out, out + outoff, outlen);
+        outoff = 0;
+    }
+
     while (i < frames)
     {
-        // put data in the correct spot for encode frame
+        // encode straight into the IEC958 payload position; encode_frame
+        // wraps the burst header around it in place
         outsize = avcodec_encode_audio(av_context,
-                                       ((uchar*)out) + outlen + 8,
-                                       OUTBUFSIZE - outlen - 8,
-                                       (short *)(in + i * one_frame_bytes));
+                                       ((uchar*)out) + outoff + outlen + 8,
+                                       OUTBUFSIZE - outoff - outlen - 8,
+                                       (short *)(in + inoff +
+                                                 i * one_frame_bytes));
         if (outsize < 0)
         {
             VERBOSE(VB_AUDIO, LOC_ERR + "AC-3 encode error");
@@ -381,7 +403,7 @@ size_t AudioOutputDigitalEncoder::Encode(void *buf, int len, bool isFloat)
 
         encode_frame(
             /*av_context->codec_id==CODEC_ID_DTS*/ false,
-            (uchar*)out + outlen, outsize
+            (uchar*)out + outoff + outlen, outsize
         );
 
 
@@ -390,14 +412,14 @@ size_t AudioOutputDigitalEncoder::Encode(void *buf, int len, bool isFloat)
         i++;
     }
 
-    memmove(in, in + i * one_frame_bytes, inlen);
+    inoff = inlen ? inoff + (int)(i * one_frame_bytes) : 0;
     return outlen;
 }
 
 void AudioOutputDigitalEncoder::GetFrames(void *ptr, int maxlen)
 {
     int len = std::min(maxlen, outlen);
-    memcpy(ptr, out, len);
+    memcpy(ptr, out + outoff, len);
     outlen -= len;
-    memmove(out, out + len, outlen);
+    outoff = outlen ? outoff + len : 0;
 }
@@ -30,7 +30,9 @@ class AudioOutputDigitalEncoder
     char            inbuf[INBUFSIZE+16];
     char            *in;
     int             outlen;
+    int             outoff;
     int             inlen;
+    int             inoff;
     size_t          one_frame_bytes;
 };
 
@@ -1,7 +1,39 @@
+#include "mythconfig.h"
 #include "audiooutputdownmix.h"
 
 #include "string.h"
 
+#if ARCH_X86
+static int has_sse2 = -1;
+
+// Check cpuid for SSE2 support on x86 / x86_64
+static inline bool sse_check()
+{
+    if (has_sse2 != -1)
+        return (bool)has_sse2;
+    __asm__(
+        // -fPIC - we may not clobber ebx/rbx
+#if ARCH_X86_64
+        "push       %%rbx               \n\t"
+#else
+        "push       %%ebx               \n\t"
+#endif
+        "mov        $1, %%eax           \n\t"
+        "cpuid                          \n\t"
+        "and        $0x4000000, %%edx   \n\t"
+        "shr        $26, %%edx          \n\t"
+#if ARCH_X86_64
+        "pop        %%rbx               \n\t"
+#else
+        "pop        %%ebx               \n\t"
+#endif
+        :"=d"(has_sse2)
+        ::"%eax","%ecx"
+    );
+    return (bool)has_sse2;
+}
+#endif //ARCH_x86
+
 /*
  SMPTE channel layout
  DUAL-MONO      L   R
@@ -132,22 +164,81 @@ static const float s51_matrix[2][8][6] =
 };
 
 int AudioOutputDownmix::DownmixFrames(int channels_in, int  channels_out,
-                                      float *dst, float *src, int frames)
+                                      float *dst, float *src, int frames,
+                                      float gain)
 {
     if (channels_in <= channels_out)
         return -1;
 
     if (channels_out == 2)
     {
-        float tmp;
         int index = channels_in - 1;
-        for (int n=0; n < frames; n++)
+        int n = 0;
+
+        /* Interleaved L/R coefficient columns, padded with zeros to eight
+           channels and pre-scaled by the gain, so the whole downmix is one
+           matrix pass whatever the source layout */
+        float coeffs[16];
+        for (int j = 0; j < 8; j++)
+        {
+            coeffs[2*j]   = j < channels_in ?
+                            stereo_matrix[index][j][0] * gain : 0.0f;
+            coeffs[2*j+1] = j < channels_in ?
+                            stereo_matrix[index][j][1] * gain : 0.0f;
+        }
+
+#if ARCH_X86
+        if (sse_check() && frames >= 16)
+        {
+            /* each iteration loads eight floats from the frame start, so
+               stop early enough that the loads stay inside the samples and
+               let the C loop mop up */
+            int loops = frames - (7 + channels_in) / channels_in;
+            n = loops;
+            long fbytes = channels_in * sizeof(float);
+
+            __asm__ volatile (
+                "movups     (%3), %%xmm4        \n\t"
+                "movups     16(%3), %%xmm5      \n\t"
+                "movups     32(%3), %%xmm6      \n\t"
+                "movups     48(%3), %%xmm7      \n\t"
+                "1:                             \n\t"
+                "movups     (%1), %%xmm0        \n\t"
+                "movups     16(%1), %%xmm2      \n\t"
+                "movaps     %%xmm0, %%xmm1      \n\t"
+                "unpcklps   %%xmm0, %%xmm0      \n\t"
+                "unpckhps   %%xmm1, %%xmm1      \n\t"
+                "movaps     %%xmm2, %%xmm3      \n\t"
+                "unpcklps   %%xmm2, %%xmm2      \n\t"
+                "unpckhps   %%xmm3, %%xmm3      \n\t"
+                "mulps      %%xmm4, %%xmm0      \n\t"
+                "mulps      %%xmm5, %%xmm1      \n\t"
+                "mulps      %%xmm6, %%xmm2      \n\t"
+                "mulps      %%xmm7, %%xmm3      \n\t"
+                "addps      %%xmm1, %%xmm0      \n\t"
+                "addps      %%xmm3, %%xmm2      \n\t"
+                "addps      %%xmm2, %%xmm0      \n\t"
+                "movaps     %%xmm0, %%xmm1      \n\t"
+                "movhlps    %%xmm0, %%xmm1      \n\t"
+                "addps      %%xmm1, %%xmm0      \n\t"
+                "movlps     %%xmm0, (%0)        \n\t"
+                "add        %2, %1              \n\t"
+                "add        $8, %0              \n\t"
+                "sub        $1, %%ecx           \n\t"
+                "jnz        1b                  \n\t"
+                :"+r"(dst), "+r"(src)
+                :"r"(fbytes), "r"(coeffs), "c"(loops)
+            );
+        }
+#endif //ARCH_X86
+        float tmp;
+        for (; n < frames; n++)
         {
             for (int i=0; i < channels_out; i++)
             {
                 tmp = 0.0f;
                 for (int j=0; j < channels_in; j++)
-                    tmp += src[j] * stereo_matrix[index][j][i];
+                    tmp += src[j] * coeffs[2*j + i];
                 *dst++ = tmp;
             }
             src += channels_in;
@@ -159,7 +250,11 @@ int AudioOutputDownmix::DownmixFrames(int channels_in, int  channels_out,
         int lenbytes = lensamples * sizeof(float);
         for (int n=0; n < frames; n++)
         {
-            memcpy(dst, src, lenbytes);
+            if (gain == 1.0f)
+                memcpy(dst, src, lenbytes);
+            else
+                for (int s=0; s < lensamples; s++)
+                    dst[s] = src[s] * gain;
             src += lensamples;
             dst += 4;
             //read value first, as src and dst can overlap
@@ -167,8 +262,8 @@ int AudioOutputDownmix::DownmixFrames(int channels_in, int  channels_out,
             float rs = src[1];
             float rls = src[2];
             float rrs = src[3];
-            *dst++ = ls * m3db + rls * m3db;    // LS = LS*-3dB + Rls*-3dB
-            *dst++ = rs * m3db + rrs * m3db;    // RS = RS*-3dB + Rrs*-3dB
+            *dst++ = (ls * m3db + rls * m3db) * gain; // LS = LS*-3dB + Rls*-3dB
+            *dst++ = (rs * m3db + rrs * m3db) * gain; // RS = RS*-3dB + Rrs*-3dB
             src += 4;
         }
     }
@@ -5,7 +5,8 @@ class AudioOutputDownmix
 {
 public:
     static int DownmixFrames(int channels_in, int  channels_out,
-                             float *dst, float *src, int frames);
+                             float *dst, float *src, int frames,
+                             float gain = 1.0f);
 };
 
 #endif
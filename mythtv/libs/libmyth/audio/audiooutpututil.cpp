@@ -160,7 +160,7 @@ static int fromFloat8(uchar *out, float *in, int len)
             "add        $64,    %1          \n\t"
             "packsswb   %%xmm3, %%xmm1      \n\t"
             "paddb      %%xmm0, %%xmm1      \n\t"
-            "movdqu     %%xmm1, (%0)        \n\t"
+            "movdqa     %%xmm1, (%0)        \n\t"
             "add        $16,    %0          \n\t"
             "sub        $1, %%ecx           \n\t"
             "jnz        1b                  \n\t"
@@ -259,8 +259,8 @@ static int fromFloat16(short *out, float *in, int len)
             "packssdw   %%xmm2, %%xmm1      \n\t"
             "packssdw   %%xmm4, %%xmm3      \n\t"
             "add        $64,    %1          \n\t"
-            "movdqu     %%xmm1, (%0)        \n\t"
-            "movdqu     %%xmm3, 16(%0)      \n\t"
+            "movdqa     %%xmm1, (%0)        \n\t"
+            "movdqa     %%xmm3, 16(%0)      \n\t"
             "add        $32,    %0          \n\t"
             "sub        $1, %%ecx           \n\t"
             "jnz        1b                  \n\t"
@@ -372,22 +372,22 @@ static int fromFloat32(AudioFormat format, int *out, float *in, int len)
             "pslld      %%xmm0, %%xmm1      \n\t"
             "minps      %%xmm5, %%xmm3      \n\t"
             "mulps      %%xmm7, %%xmm2      \n\t"
-            "movdqu     %%xmm1, (%0)        \n\t"
+            "movdqa     %%xmm1, (%0)        \n\t"
             "cvtps2dq   %%xmm2, %%xmm2      \n\t"
             "maxps      %%xmm6, %%xmm3      \n\t"
             "minps      %%xmm5, %%xmm4      \n\t"
             "pslld      %%xmm0, %%xmm2      \n\t"
             "mulps      %%xmm7, %%xmm3      \n\t"
             "maxps      %%xmm6, %%xmm4      \n\t"
-            "movdqu     %%xmm2, 16(%0)      \n\t"
+            "movdqa     %%xmm2, 16(%0)      \n\t"
             "cvtps2dq   %%xmm3, %%xmm3      \n\t"
             "mulps      %%xmm7, %%xmm4      \n\t"
             "pslld      %%xmm0, %%xmm3      \n\t"
             "cvtps2dq   %%xmm4, %%xmm4      \n\t"
-            "movdqu     %%xmm3, 32(%0)      \n\t"
+            "movdqa     %%xmm3, 32(%0)      \n\t"
             "pslld      %%xmm0, %%xmm4      \n\t"
             "add        $64,    %1          \n\t"
-            "movdqu     %%xmm4, 48(%0)      \n\t"
+            "movdqa     %%xmm4, 48(%0)      \n\t"
             "add        $64,    %0          \n\t"
             "sub        $1, %%ecx           \n\t"
             "jnz        1b                  \n\t"
@@ -420,13 +420,13 @@ static int fromFloatFLT(float *out, float *in, int len)
             "punpckldq  %%xmm6, %%xmm6      \n\t"
             "punpckldq  %%xmm7, %%xmm7      \n\t"
             "1:                             \n\t"
-            "movups     (%1), %%xmm1        \n\t"
-            "movups     16(%1), %%xmm2      \n\t"
+            "movaps     (%1), %%xmm1        \n\t"
+            "movaps     16(%1), %%xmm2      \n\t"
             "minps      %%xmm6, %%xmm1      \n\t"
-            "movups     32(%1), %%xmm3      \n\t"
+            "movaps     32(%1), %%xmm3      \n\t"
             "maxps      %%xmm7, %%xmm1      \n\t"
             "minps      %%xmm6, %%xmm2      \n\t"
-            "movups     48(%1), %%xmm4      \n\t"
+            "movaps     48(%1), %%xmm4      \n\t"
             "maxps      %%xmm7, %%xmm2      \n\t"
             "movups     %%xmm1, (%0)        \n\t"
             "minps      %%xmm6, %%xmm3      \n\t"
@@ -527,7 +527,50 @@ void AudioOutputUtil::MonoToStereo(void *dst, void *src, int samples)
 {
     float *d = (float *)dst;
     float *s = (float *)src;
-    for (int i = 0; i < samples; i++)
+    int i = 0;
+
+#if ARCH_X86
+    if (sse_check() && samples >= 16)
+    {
+        int loops = samples >> 4;
+        i = loops << 4;
+
+        __asm__ volatile (
+            "1:                             \n\t"
+            "movups     (%1), %%xmm1        \n\t"
+            "movups     16(%1), %%xmm3      \n\t"
+            "movaps     %%xmm1, %%xmm2      \n\t"
+            "movups     32(%1), %%xmm5      \n\t"
+            "unpcklps   %%xmm1, %%xmm1      \n\t"
+            "movaps     %%xmm3, %%xmm4      \n\t"
+            "unpckhps   %%xmm2, %%xmm2      \n\t"
+            "movups     48(%1), %%xmm7      \n\t"
+            "unpcklps   %%xmm3, %%xmm3      \n\t"
+            "movups     %%xmm1, (%0)        \n\t"
+            "movaps     %%xmm5, %%xmm6      \n\t"
+            "unpckhps   %%xmm4, %%xmm4      \n\t"
+            "movups     %%xmm2, 16(%0)      \n\t"
+            "unpcklps   %%xmm5, %%xmm5      \n\t"
+            "movups     %%xmm3, 32(%0)      \n\t"
+            "movaps     %%xmm7, %%xmm0      \n\t"
+            "unpckhps   %%xmm6, %%xmm6      \n\t"
+            "movups     %%xmm4, 48(%0)      \n\t"
+            "unpcklps   %%xmm7, %%xmm7      \n\t"
+            "movups     %%xmm5, 64(%0)      \n\t"
+            "unpckhps   %%xmm0, %%xmm0      \n\t"
+            "movups     %%xmm6, 80(%0)      \n\t"
+            "movups     %%xmm7, 96(%0)      \n\t"
+            "add        $64,    %1          \n\t"
+            "movups     %%xmm0, 112(%0)     \n\t"
+            "add        $128,   %0          \n\t"
+            "sub        $1, %%ecx           \n\t"
+            "jnz        1b                  \n\t"
+            :"+r"(d), "+r"(s)
+            :"c"(loops)
+        );
+    }
+#endif //ARCH_X86
+    for (; i < samples; i++)
     {
         *d++ = *s;
         *d++ = *s++;
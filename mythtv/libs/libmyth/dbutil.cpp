@@ -219,6 +219,14 @@ MythDBBackupStatus DBUtil::BackupDB(QString &filename)
                                       "not exist: %1").arg(backupScript));
         backupScript = QString::null;
     }
+    else if (gCoreContext->GetNumSetting("BackupDBIncremental", 0))
+    {
+        // Incremental backups are handled by the internal backup code,
+        // so bypass the backup script.
+        VERBOSE(VB_FILE, "Incremental database backups enabled, "
+                         "not using the backup script.");
+        backupScript = QString::null;
+    }
 
     bool result = false;
     MSqlQuery query(MSqlQuery::InitCon());
@@ -446,6 +454,41 @@ QStringList DBUtil::GetTables(const QStringList &engines)
     return result;
 }
 
+/** \fn DBUtil::GetTableChecksums(void)
+ *  \brief Retrieves a live checksum for every table in the database.
+ *
+ *   Used by the incremental backup code to detect which tables have
+ *   changed since the previous backup.  Tables whose storage engine
+ *   cannot provide a checksum get an empty value, which the caller
+ *   treats as always-changed.
+ *
+ *  \return QMap of "database.table" to checksum
+ */
+QMap<QString,QString> DBUtil::GetTableChecksums(void)
+{
+    QMap<QString,QString> checksums;
+
+    const QStringList tables = GetTables();
+    if (tables.empty())
+        return checksums;
+
+    MSqlQuery query(MSqlQuery::InitCon());
+    if (!query.isConnected())
+        return checksums;
+
+    QString sql = QString("CHECKSUM TABLE %1;").arg(tables.join(", "));
+    if (!query.exec(sql))
+    {
+        MythDB::DBError("DBUtil Checksumming Tables", query);
+        return checksums;
+    }
+
+    while (query.next())
+        checksums[query.value(0).toString()] = query.value(1).toString();
+
+    return checksums;
+}
+
 /** \fn DBUtil::CreateBackupFilename(QString prefix, QString extension)
  *  \brief Creates a filename to use for the filename.
  *
@@ -635,28 +678,47 @@ bool DBUtil::DoBackup(const QString &backupScript, QString &filename)
     return true;
 }
 
+/// \brief Returns the path of the gzip binary, or an empty string if
+///        gzip is not installed.
+static QString find_gzip(void)
+{
+    if (QFile::exists("/bin/gzip"))
+        return "/bin/gzip";
+    if (QFile::exists("/usr/bin/gzip"))
+        return "/usr/bin/gzip";
+    return "";
+}
+
 /** \fn DBUtil::DoBackup(QString&)
  *  \brief Creates a backup of the database.
  *
  *   This fallback function is used only if the database backup script cannot
- *   be found.
+ *   be found.  The dump is streamed through gzip, so the data only has to be
+ *   written to disk once and the dump and compression run in parallel.
  */
 bool DBUtil::DoBackup(QString &filename)
 {
+    if (gCoreContext->GetNumSetting("BackupDBIncremental", 0))
+    {
+        if (DoBackupIncremental(filename))
+            return true;
+
+        VERBOSE(VB_IMPORTANT, "Incremental database backup failed. "
+                              "Falling back to a full backup.");
+    }
+
     DatabaseParams dbParams = gCoreContext->GetDatabaseParams();
     QString     dbSchemaVer = gCoreContext->GetSetting("DBSchemaVer");
     QString backupDirectory = GetBackupDirectory();
 
     QString command;
-    QString compressCommand("");
+    QString compressCommand = find_gzip();
     QString extension = ".sql";
-    if (QFile::exists("/bin/gzip"))
-        compressCommand = "/bin/gzip";
-    else if (QFile::exists("/usr/bin/gzip"))
-        compressCommand = "/usr/bin/gzip";
-    else
+    if (compressCommand.isEmpty())
         VERBOSE(VB_IMPORTANT, "Neither /bin/gzip nor /usr/bin/gzip exist. "
                               "The database backup will be uncompressed.");
+    else
+        extension += ".gz";
 
     QString backupFilename = CreateBackupFilename(
         dbParams.dbName + "-" + dbSchemaVer, extension);
@@ -676,10 +738,21 @@ bool DBUtil::DoBackup(QString &filename)
                       " --user='%4' --add-drop-table --add-locks"
                       " --allow-keywords --complete-insert"
                       " --extended-insert --lock-tables --no-create-db --quick"
-                      " '%5' > '%6' 2>/dev/null")
+                      " '%5'")
                       .arg(tempExtraConfFile).arg(dbParams.dbHostName)
                       .arg(portArg).arg(dbParams.dbUserName)
-                      .arg(dbParams.dbName).arg(backupPathname);
+                      .arg(dbParams.dbName);
+
+    if (compressCommand.isEmpty())
+        command += QString(" > '%1' 2>/dev/null").arg(backupPathname);
+    else
+    {
+        // The shell reports the exit status of the last command in a
+        // pipe, so remove the output file if mysqldump fails and let
+        // the existence check below catch the error.
+        command = QString("{ %1 2>/dev/null || rm -f '%2'; } | %3 > '%2'")
+            .arg(command).arg(backupPathname).arg(compressCommand);
+    }
 
     VERBOSE(VB_FILE, QString("Backing up database with command: '%1'")
             .arg(command));
@@ -691,7 +764,7 @@ bool DBUtil::DoBackup(QString &filename)
     QByteArray tmpfile = tempExtraConfFile.toLocal8Bit();
     unlink(tmpfile.constData());
 
-    if (status)
+    if (status || !QFile::exists(backupPathname))
     {
         VERBOSE(VB_IMPORTANT, LOC_ERR +
                 QString("Error backing up database: '%1' (%2)")
@@ -700,27 +773,197 @@ bool DBUtil::DoBackup(QString &filename)
         return false;
     }
 
-    if (compressCommand != "")
+    VERBOSE(VB_IMPORTANT, "Database Backup complete.");
+
+    filename = backupPathname;
+    return true;
+}
+
+/** \fn DBUtil::DoBackupIncremental(QString&)
+ *  \brief Creates a backup, re-dumping only the tables that have changed.
+ *
+ *   Keeps a cache directory with one compressed dump per table, and uses
+ *   CHECKSUM TABLE to find the tables that changed since the last backup,
+ *   re-dumping only those.  The backup file is then assembled by
+ *   concatenating the per-table dumps -- concatenated gzip streams are
+ *   themselves a valid gzip stream, so the result is a normal full backup
+ *   that existing restore tools understand.
+ *
+ *   Because each table is dumped separately, the backup is not a
+ *   consistent snapshot across tables, which is why this mode is only
+ *   used when the BackupDBIncremental setting is enabled.
+ */
+bool DBUtil::DoBackupIncremental(QString &filename)
+{
+    DatabaseParams dbParams = gCoreContext->GetDatabaseParams();
+    QString     dbSchemaVer = gCoreContext->GetSetting("DBSchemaVer");
+    QString backupDirectory = GetBackupDirectory();
+
+    QString compressCommand = find_gzip();
+    if (compressCommand.isEmpty())
+    {
+        VERBOSE(VB_IMPORTANT, "Neither /bin/gzip nor /usr/bin/gzip exist. "
+                              "Unable to create an incremental backup.");
+        return false;
+    }
+
+    QMap<QString,QString> checksums = GetTableChecksums();
+    if (checksums.isEmpty())
+        return false;
+
+    QDir cacheDir(backupDirectory + "/" + dbParams.dbName + "-incremental");
+    if (!cacheDir.exists() && !cacheDir.mkpath(cacheDir.path()))
     {
-        VERBOSE(VB_IMPORTANT, "Compressing database backup file.");
-        compressCommand += " " + backupPathname;
-        status = myth_system(compressCommand, kMSDontBlockInputDevs);
+        VERBOSE(VB_IMPORTANT, LOC_ERR +
+                QString("Unable to create backup cache directory '%1'")
+                .arg(cacheDir.path()));
+        return false;
+    }
 
-        if (status)
+    // Checksums recorded when the cached dumps were made.  A missing or
+    // unreadable file just means every table gets re-dumped.
+    QMap<QString,QString> lastChecksums;
+    QFile checksumFile(cacheDir.path() + "/checksums.txt");
+    if (checksumFile.open(QIODevice::ReadOnly))
+    {
+        while (!checksumFile.atEnd())
         {
-            VERBOSE(VB_IMPORTANT,
-                   "Compression failed, backup file will remain uncompressed.");
+            QString line = QString(checksumFile.readLine()).trimmed();
+            if (!line.isEmpty())
+                lastChecksums[line.section(' ', 0, 0)] =
+                    line.section(' ', 1, 1);
+        }
+        checksumFile.close();
+    }
+
+    QString privateinfo = QString(
+        "[client]\npassword=%1\n[mysqldump]\npassword=%2\n")
+        .arg(dbParams.dbPassword).arg(dbParams.dbPassword);
+    QString tempExtraConfFile = QString::null;
+    if (!CreateTemporaryDBConf(privateinfo, tempExtraConfFile))
+        return false;
+
+    QString portArg = "";
+    if (dbParams.dbPort > 0)
+        portArg = QString(" --port='%1'").arg(dbParams.dbPort);
+
+    uint dumped = 0;
+    bool ok = true;
+    QMap<QString,QString>::const_iterator it = checksums.begin();
+    for (; it != checksums.end() && ok; ++it)
+    {
+        QString table = it.key().section('.', -1, -1);
+        QString cacheFile = cacheDir.path() + "/" + table + ".sql.gz";
+
+        if (!it.value().isEmpty() &&
+            (it.value() == lastChecksums.value(it.key())) &&
+            QFile::exists(cacheFile))
+        {
+            continue;
+        }
+
+        QString command = QString(
+            "{ mysqldump --defaults-extra-file='%1' --host='%2'%3"
+            " --user='%4' --add-drop-table --add-locks"
+            " --allow-keywords --complete-insert"
+            " --extended-insert --lock-tables --no-create-db --quick"
+            " '%5' '%6' 2>/dev/null || rm -f '%7'; } | %8 > '%7'")
+            .arg(tempExtraConfFile).arg(dbParams.dbHostName)
+            .arg(portArg).arg(dbParams.dbUserName)
+            .arg(dbParams.dbName).arg(table)
+            .arg(cacheFile).arg(compressCommand);
+
+        VERBOSE(VB_FILE, QString("Backing up table with command: '%1'")
+                .arg(command));
+
+        uint status = myth_system(command, kMSDontBlockInputDevs);
+
+        if (status || !QFile::exists(cacheFile))
+        {
+            VERBOSE(VB_IMPORTANT, LOC_ERR +
+                    QString("Error backing up table: '%1' (%2)")
+                    .arg(it.key()).arg(status));
+            ok = false;
         }
         else
+            dumped++;
+    }
+
+    QByteArray tmpfile = tempExtraConfFile.toLocal8Bit();
+    unlink(tmpfile.constData());
+
+    if (!ok)
+        return false;
+
+    if (checksumFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        for (it = checksums.begin(); it != checksums.end(); ++it)
         {
-            backupPathname += ".gz";
+            QString line = QString("%1 %2\n").arg(it.key()).arg(it.value());
+            checksumFile.write(line.toLocal8Bit());
+        }
+        checksumFile.close();
+    }
+    else
+    {
+        // Without up to date checksums every table would be re-dumped on
+        // the next run, which is safe, just slow.
+        VERBOSE(VB_IMPORTANT, LOC_ERR +
+                QString("Unable to write '%1'").arg(checksumFile.fileName()));
+    }
+
+    QString backupFilename = CreateBackupFilename(
+        dbParams.dbName + "-" + dbSchemaVer, ".sql.gz");
+    QString backupPathname = backupDirectory + "/" + backupFilename;
+
+    VERBOSE(VB_IMPORTANT, QString("Backing up database to file: '%1'")
+            .arg(backupPathname));
+
+    QFile outFile(backupPathname);
+    if (!outFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        VERBOSE(VB_IMPORTANT, LOC_ERR +
+                QString("Unable to write '%1'").arg(backupPathname));
+        return false;
+    }
+
+    for (it = checksums.begin(); it != checksums.end() && ok; ++it)
+    {
+        QString table = it.key().section('.', -1, -1);
+        QFile inFile(cacheDir.path() + "/" + table + ".sql.gz");
+        if (!inFile.open(QIODevice::ReadOnly))
+        {
+            VERBOSE(VB_IMPORTANT, LOC_ERR +
+                    QString("Unable to read '%1'").arg(inFile.fileName()));
+            ok = false;
+            break;
+        }
 
-            VERBOSE(VB_IMPORTANT, QString("Database Backup filename: '%1'")
-                    .arg(backupPathname));
+        while (!inFile.atEnd())
+        {
+            QByteArray data = inFile.read(65536);
+            if (outFile.write(data) != data.size())
+            {
+                VERBOSE(VB_IMPORTANT, LOC_ERR +
+                        QString("Error writing '%1'").arg(backupPathname));
+                ok = false;
+                break;
+            }
         }
+        inFile.close();
     }
+    outFile.close();
 
-    VERBOSE(VB_IMPORTANT, "Database Backup complete.");
+    if (!ok)
+    {
+        QFile::remove(backupPathname);
+        filename = "__FAILED__";
+        return false;
+    }
+
+    VERBOSE(VB_IMPORTANT,
+            QString("Database Backup complete. Re-dumped %1 of %2 tables.")
+            .arg(dumped).arg(checksums.size()));
 
     filename = backupPathname;
     return true;
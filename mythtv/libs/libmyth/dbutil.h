@@ -2,6 +2,7 @@
 #define DBUTIL_H_
 
 #include <QStringList>
+#include <QMap>
 
 #include "mythexp.h"
 #include "mythdbcon.h"
@@ -61,6 +62,7 @@ class MPUBLIC DBUtil
 
     static QStringList GetTables(const QStringList &engines = QStringList());
     static QStringList CheckRepairStatus(MSqlQuery &query);
+    static QMap<QString,QString> GetTableChecksums(void);
 
     QString CreateBackupFilename(QString prefix = "mythconverg",
                                  QString extension = ".sql");
@@ -68,6 +70,7 @@ class MPUBLIC DBUtil
 
     bool DoBackup(const QString &backupScript, QString &filename);
     bool DoBackup(QString &filename);
+    bool DoBackupIncremental(QString &filename);
 
     QString m_versionString;
 
@@ -360,22 +360,31 @@ bool MythContextPrivate::FindDatabase(const bool prompt, const bool noPrompt)
     LoadDatabaseSettings();
 
 
-    // 2. If the user isn't forcing up the chooser UI, look for a default
-    //    backend in config.xml, then test DB settings we've got so far:
+    // 2. If the user isn't forcing up the chooser UI, test the DB
+    //    settings we've got so far, then fall back to discovery:
     if (!manualSelect)
     {
+        // Those settings are the last ones that worked (step 1 stores
+        // them on success), so try them optimistically before paying
+        // for a UPnP search; discovery is only needed when they have
+        // gone stale.
+        failure = TestDBconnection();
+        if (failure.isEmpty())
+            goto DBfound;
+
         // config.xml may contain a backend host UUID and PIN.
         // If so, try to AutoDiscover UPnP server, and use its DB settings:
 
         if (DefaultUPnP(failure))                // Probably a valid backend,
+        {
             autoSelect = manualSelect = false;   // so disable any further UPnP
-        else
-            if (failure.length())
-                VERBOSE(VB_IMPORTANT, failure);
 
-        failure = TestDBconnection();
-        if (failure.isEmpty())
-            goto DBfound;
+            failure = TestDBconnection();
+            if (failure.isEmpty())
+                goto DBfound;
+        }
+        else if (failure.length())
+            VERBOSE(VB_IMPORTANT, failure);
     }
 
 
@@ -445,9 +454,12 @@ bool MythContextPrivate::FindDatabase(const bool prompt, const bool noPrompt)
 
 DBfound:
     //VERBOSE(VB_GENERAL, "FindDatabase() - Success!");
+    // No ResetDatabase() here: every route to DBfound went through a
+    // successful TestDBconnection(), which already applied the params
+    // and left a freshly opened connection in the pool for the
+    // startup queries that follow.
     StoreConnectionInfo();
     EnableDBerrors();
-    ResetDatabase();
     DeleteUPnP();
     return true;
 
@@ -7,6 +7,8 @@
 #include "mythdirs.h"
 #include "mythcontext.h"
 #include "mythverbose.h"
+#include "mythdownloadmanager.h"
+#include "mythevent.h"
 
 #include "mythrssmanager.h"
 #include "netutils.h"
@@ -117,9 +119,7 @@ RSSSite::RSSSite(const QString& title,
                   const bool& download,
                   const QDateTime& updated) :
     QObject(),
-    m_lock(QMutex::Recursive),
-    m_reply(NULL),
-    m_manager(NULL)
+    m_lock(QMutex::Recursive)
 {
     m_title = title;
     m_image = image;
@@ -133,6 +133,7 @@ RSSSite::RSSSite(const QString& title,
 
 RSSSite::~RSSSite()
 {
+    GetMythDownloadManager()->removeListener(this);
 }
 
 void RSSSite::insertRSSArticle(ResultItem *item)
@@ -153,42 +154,41 @@ void RSSSite::retrieve(void)
     m_data.resize(0);
     m_articleList.clear();
     m_urlReq = QUrl(m_url);
-    m_manager = new QNetworkAccessManager();
 
-    m_reply = m_manager->get(QNetworkRequest(m_urlReq));
-
-    connect(m_manager, SIGNAL(finished(QNetworkReply*)), this,
-                       SLOT(slotCheckRedirect(QNetworkReply*)));
+    // Fetch through the shared download manager, which follows
+    // redirects itself and keeps a revalidating disk cache, so an
+    // unchanged feed costs a conditional GET instead of a fresh
+    // connection and a full transfer every update.
+    GetMythDownloadManager()->queueDownload(m_url, &m_data, this);
 }
 
-QUrl RSSSite::redirectUrl(const QUrl& possibleRedirectUrl,
-                               const QUrl& oldRedirectUrl) const
+void RSSSite::customEvent(QEvent *event)
 {
-    QUrl redirectUrl;
-    if(!possibleRedirectUrl.isEmpty() && possibleRedirectUrl != oldRedirectUrl)
-        redirectUrl = possibleRedirectUrl;
-    return redirectUrl;
-}
+    if ((MythEvent::Type)(event->type()) == MythEvent::MythEventMessage)
+    {
+        MythEvent *me = (MythEvent *)event;
+        QStringList tokens = me->Message().split(" ", QString::SkipEmptyParts);
 
-void RSSSite::slotCheckRedirect(QNetworkReply* reply)
-{
-    QVariant possibleRedirectUrl =
-         reply->attribute(QNetworkRequest::RedirectionTargetAttribute);
+        if (tokens.isEmpty())
+            return;
 
-    QUrl urlRedirectedTo = redirectUrl(possibleRedirectUrl.toUrl(),
-                                       urlRedirectedTo);
+        if (tokens[0] != "DOWNLOAD_FILE")
+            return;
+
+        QStringList args = me->ExtraDataList();
+
+        if ((tokens.size() != 2) || (tokens[1] != "FINISHED"))
+            return;
+
+        if (args[0] != m_url)
+            return;
+
+        if (args[4].toInt())
+            VERBOSE(VB_IMPORTANT, LOC_ERR +
+                    QString("Failed to download feed from '%1'").arg(m_url));
 
-    if(!urlRedirectedTo.isEmpty())
-    {
-        m_manager->get(QNetworkRequest(urlRedirectedTo));
-    }
-    else
-    {
-        m_data = m_reply->readAll();
         process();
     }
-
-    reply->deleteLater();
 }
 
 ResultItem::resultList RSSSite::GetVideoList(void) const
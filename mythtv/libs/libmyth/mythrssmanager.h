@@ -12,12 +12,10 @@ using namespace std;
 #include <QDateTime>
 #include <QByteArray>
 #include <QVariant>
-#include <QNetworkReply>
+#include <QUrl>
 
 #include "rssparse.h"
 
-#include "mythhttppool.h"
-
 class RSSSite;
 class MPUBLIC RSSSite : public QObject
 {
@@ -72,10 +70,11 @@ class MPUBLIC RSSSite : public QObject
     void stop(void);
     void process(void);
 
-  private:
+  protected:
+    // Receives DOWNLOAD_FILE events from the MythDownloadManager
+    virtual void customEvent(QEvent *event);
 
-    QUrl redirectUrl(const QUrl& possibleRedirectUrl,
-                     const QUrl& oldRedirectUrl) const;
+  private:
 
     QString     m_title;
     QString     m_image;
@@ -94,12 +93,6 @@ class MPUBLIC RSSSite : public QObject
 
     ResultItem::resultList m_articleList;
 
-    QNetworkReply          *m_reply;
-    QNetworkAccessManager  *m_manager;
-
-  private slots:
-    void slotCheckRedirect(QNetworkReply* reply);
-
   signals:
 
     void finished(RSSSite *item);
@@ -5,6 +5,7 @@
 //
 
 #include <algorithm>
+#include <cstring>
 using namespace std;
 
 #include <QCoreApplication>
@@ -30,11 +31,13 @@ QEvent::Type OutputEvent::Error =
 OutputListeners::OutputListeners()
 {
     bufsize=0;
+    vis_ring=NULL;
 }
 
 
 OutputListeners::~OutputListeners()
 {
+    delete[] vis_ring;
 }
 
 
@@ -46,38 +49,80 @@ void OutputListeners::error(const QString &e)
 
 void OutputListeners::addVisual(MythTV::Visual *v)
 {
+    QMutexLocker locker(&mtx);
+    // keep the ring around once allocated; freeing it here would race
+    // against a producer mid-publish
+    if (!vis_ring)
+        vis_ring = new VisualFrame[kVisualFrames];
     Visuals::iterator it = std::find(visuals.begin(), visuals.end(), v);
     if (it == visuals.end())
         visuals.push_back(v);
+    vis_attached.fetchAndStoreOrdered((int)visuals.size());
 }
 
 void OutputListeners::removeVisual(MythTV::Visual *v)
 {
+    QMutexLocker locker(&mtx);
     Visuals::iterator it = std::find(visuals.begin(), visuals.end(), v);
     if (it != visuals.end())
         visuals.erase(it);
+    vis_attached.fetchAndStoreOrdered((int)visuals.size());
 }
 
 void OutputListeners::dispatchVisual(uchar *buffer, unsigned long b_len,
                         unsigned long written, int chan, int prec)
 {
-    if (! buffer)
+    if (!buffer || !vis_attached)
        return;
 
-    Visuals::iterator it = visuals.begin();
-    for (; it != visuals.end(); ++it)
+    // lock-free single producer: if the consumers have fallen behind,
+    // drop the block - the tap is cosmetic and must never stall audio
+    int in   = vis_in;
+    int next = (in + 1) % kVisualFrames;
+    if (next == (int)vis_out)
+        return;
+
+    VisualFrame *f = &vis_ring[in];
+    f->len  = (b_len > (unsigned long)kVisualDataSize) ?
+              kVisualDataSize : (int)b_len;
+    f->len -= f->len % (chan * (prec >> 3));
+    f->chan = chan;
+    f->prec = prec;
+    f->written = written;
+    memcpy(f->data, buffer, f->len);
+    vis_in.fetchAndStoreOrdered(next);
+}
+
+void OutputListeners::drainVisualData()
+{
+    if (!vis_ring)
+        return;
+
+    QMutexLocker locker(&mtx);
+    int out = vis_out;
+    while (out != (int)vis_in)
     {
-        QMutexLocker locker((*it)->mutex());
-        (*it)->add(buffer, b_len, written, chan, prec);
+        VisualFrame *f = &vis_ring[out];
+        Visuals::iterator it = visuals.begin();
+        for (; it != visuals.end(); ++it)
+        {
+            QMutexLocker vislock((*it)->mutex());
+            (*it)->add(f->data, f->len, f->written, f->chan, f->prec);
+        }
+        out = (out + 1) % kVisualFrames;
+        vis_out.fetchAndStoreOrdered(out);
     }
 }
 
 void OutputListeners::prepareVisuals()
 {
+    QMutexLocker locker(&mtx);
+    // drop anything still queued from before the reset
+    vis_out.fetchAndStoreOrdered((int)vis_in);
     Visuals::iterator it = visuals.begin();
     for (; it != visuals.end(); ++it)
     {
-        QMutexLocker locker((*it)->mutex());
+        QMutexLocker vislock((*it)->mutex());
         (*it)->prepare();
     }
 }
@@ -16,6 +16,7 @@ using namespace std;
 
 #include <QMutex>
 #include <QList>
+#include <QAtomicInt>
 
 #include "mythobservable.h"
 
@@ -104,6 +105,11 @@ public:
     void addVisual(MythTV::Visual *);
     void removeVisual(MythTV::Visual *);
 
+    /// Fan any pending sample snapshots out to the attached visuals.
+    /// Called by the visual consumers from their own thread, at their
+    /// own rate; the audio thread only ever publishes into the tap.
+    void drainVisualData();
+
     QMutex *mutex() { return &mtx; }
 
     void setBufferSize(unsigned int sz) { bufsize = sz; }
@@ -116,9 +122,31 @@ protected:
     void prepareVisuals();
 
 private:
+    static const int kVisualFrames   = 32;
+    static const int kVisualDataSize = 4096;
+
+    // One slot of the visualisation tap; the producer truncates each
+    // block to kVisualDataSize, plenty for the 512 samples a visual uses
+    struct VisualFrame
+    {
+        int           len;
+        int           chan;
+        int           prec;
+        unsigned long written;
+        uchar         data[kVisualDataSize];
+    };
+
     QMutex       mtx;
     Visuals      visuals;
 
+    /* Side-channel sample tap. Single producer (the audio thread in
+       dispatchVisual), single consumer (drainVisualData): slot cursors
+       are published with ordered stores so neither side takes a lock,
+       and full slots are simply dropped */
+    VisualFrame *vis_ring;      // allocated on first addVisual
+    QAtomicInt   vis_attached;  // nonzero while any visual is registered
+    QAtomicInt   vis_in, vis_out;
+
     unsigned int bufsize;
 };
 
@@ -19,6 +19,8 @@ using namespace std;
 #include <QFile>
 #include <QFileInfo>
 #include <QDir>
+#include <QSqlDriver>
+#include <QSqlField>
 
 // MythTV headers
 #include "programinfo.h"
@@ -148,6 +150,7 @@ ProgramInfo::ProgramInfo(void) :
     sortTitle(),
 
     // Private
+    detailsLoaded(true),
     inUseForWhat(),
     positionMapDBReplacement(NULL)
 {
@@ -222,6 +225,7 @@ ProgramInfo::ProgramInfo(const ProgramInfo &other) :
     sortTitle(other.sortTitle),
 
     // Private
+    detailsLoaded(other.detailsLoaded),
     inUseForWhat(),
     positionMapDBReplacement(other.positionMapDBReplacement)
 {
@@ -234,6 +238,34 @@ ProgramInfo::ProgramInfo(uint _chanid, const QDateTime &_recstartts) :
     LoadProgramFromRecorded(_chanid, _recstartts);
 }
 
+ProgramInfo::ProgramInfo(uint _chanid, const QDateTime &_recstartts,
+                         const QDateTime &_recendts,
+                         const QDateTime &_startts,
+                         const QDateTime &_endts,
+                         const QString &_title,
+                         const QString &_recgroup,
+                         const QString &_hostname,
+                         const QString &_basename,
+                         uint64_t _filesize) :
+    positionMapDBReplacement(NULL)
+{
+    clear();
+
+    chanid     = _chanid;
+    recstartts = _recstartts;
+    recendts   = _recendts;
+    startts    = _startts;
+    endts      = _endts;
+    title      = _title;
+    recgroup   = _recgroup;
+    hostname   = _hostname;
+    filesize   = _filesize;
+    recstatus  = rsRecorded;
+    SetPathname(_basename);
+
+    detailsLoaded = false;
+}
+
 ProgramInfo::ProgramInfo(
     const QString &_title,
     const QString &_subtitle,
@@ -351,6 +383,7 @@ ProgramInfo::ProgramInfo(
     sortTitle(),
 
     // Private
+    detailsLoaded(true),
     inUseForWhat(),
     positionMapDBReplacement(NULL)
 {
@@ -454,6 +487,7 @@ ProgramInfo::ProgramInfo(
     sortTitle(),
 
     // Private
+    detailsLoaded(true),
     inUseForWhat(),
     positionMapDBReplacement(NULL)
 {
@@ -558,6 +592,7 @@ ProgramInfo::ProgramInfo(
     sortTitle(),
 
     // Private
+    detailsLoaded(true),
     inUseForWhat(),
     positionMapDBReplacement(NULL)
 {
@@ -691,6 +726,7 @@ ProgramInfo::ProgramInfo(
     sortTitle(),
 
     // Private
+    detailsLoaded(true),
     inUseForWhat(),
     positionMapDBReplacement(NULL)
 {
@@ -918,6 +954,7 @@ void ProgramInfo::clone(const ProgramInfo &other,
     findid = other.findid;
     programflags = other.programflags;
     properties = other.properties;
+    detailsLoaded = other.detailsLoaded;
 
     if (!ignore_non_serialized_data)
     {
@@ -953,6 +990,8 @@ void ProgramInfo::clone(const ProgramInfo &other,
 
     sortTitle.detach();
     inUseForWhat.detach();
+
+    DirtySerializedCache();
 }
 
 void ProgramInfo::clear(void)
@@ -1025,8 +1064,11 @@ void ProgramInfo::clear(void)
     availableStatus = asAvailable;
 
     // Private
+    detailsLoaded = true;
     inUseForWhat.clear();
     positionMapDBReplacement = NULL;
+
+    DirtySerializedCache();
 }
 
 /** \fn ProgramInfo::~ProgramInfo()
@@ -1107,11 +1149,26 @@ bool ProgramInfo::ExtractKeyFromPathname(
 /** \fn ProgramInfo::ToStringList(QStringList&) const
  *  \brief Serializes ProgramInfo into a QStringList which can be passed
  *         over a socket.
+ *
+ *   The backend serializes the same unchanged ProgramInfo many times
+ *   (event broadcasts, recording list replies), so the result is kept
+ *   in serializedCache; as long as no field is modified subsequent
+ *   calls just bump a reference count per string. Every method that
+ *   writes a serialized field must call DirtySerializedCache().
+ *
  *  \sa FromStringList(QStringList::const_iterator&,
                        QStringList::const_iterator)
  */
-void ProgramInfo::ToStringList(QStringList &list) const
+void ProgramInfo::ToStringList(QStringList &outlist) const
 {
+    if (!serializedCache.isEmpty() && CacheSerializedForm())
+    {
+        outlist += serializedCache;
+        return;
+    }
+
+    QStringList list;
+
     STR_TO_LIST(title);        // 0
     STR_TO_LIST(subtitle);     // 1
     STR_TO_LIST(description);  // 2
@@ -1158,6 +1215,11 @@ void ProgramInfo::ToStringList(QStringList &list) const
 
     INT_TO_LIST(year);              // 40
 /* do not forget to update the NUMPROGRAMLINES defines! */
+
+    if (CacheSerializedForm())
+        serializedCache = list;
+
+    outlist += list;
 }
 
 // QStringList::const_iterator it = list.begin()+offset;
@@ -1201,6 +1263,8 @@ bool ProgramInfo::FromStringList(QStringList::const_iterator &it,
     QString listerror = LOC + "FromStringList, not enough items in list.";
     QString ts;
 
+    QStringList::const_iterator listbeg = it;
+
     uint      origChanid     = chanid;
     QDateTime origRecstartts = recstartts;
 
@@ -1263,6 +1327,22 @@ bool ProgramInfo::FromStringList(QStringList::const_iterator &it,
         positionMapDBReplacement = NULL;
     }
 
+    detailsLoaded = true;
+
+    // Prime the serialization cache with the strings we were handed,
+    // so an unmodified round trip through ToStringList() costs a
+    // reference count bump per field instead of re-converting every
+    // number and date. ToStringList() substitutes "Default" for empty
+    // group names, so we can't reuse a list which lacks them.
+    DirtySerializedCache();
+    if (CacheSerializedForm() &&
+        !recgroup.isEmpty() && !playgroup.isEmpty() &&
+        !storagegroup.isEmpty())
+    {
+        for (QStringList::const_iterator p = listbeg; p != it; ++p)
+            serializedCache.push_back(*p);
+    }
+
     return true;
 }
 
@@ -1608,6 +1688,8 @@ bool ProgramInfo::LoadProgramFromRecorded(
         positionMapDBReplacement = NULL;
     }
 
+    DirtySerializedCache();
+
     title        = query.value(0).toString();
     subtitle     = query.value(1).toString();
     description  = query.value(2).toString();
@@ -1722,9 +1804,26 @@ bool ProgramInfo::LoadProgramFromRecorded(
     /**/// inUseForWhat
     /**/// postitionMapDBReplacement
 
+    detailsLoaded = true;
+
     return true;
 }
 
+/** \brief Loads the remaining fields of an index-only recording.
+ *
+ *   Records created by LoadIndexFromRecorded() carry only the fields
+ *   needed to identify, sort and filter a recording; everything else
+ *   is loaded from the database on the first call to this method.
+ *  \return true if the full record is available.
+ */
+bool ProgramInfo::LoadFullDetails(void)
+{
+    if (detailsLoaded)
+        return true;
+
+    return LoadProgramFromRecorded(chanid, recstartts);
+}
+
 /** \fn ProgramInfo::GetRecordingTypeRecPriority(RecordingType)
  *  \brief Returns recording priority change needed due to RecordingType.
  */
@@ -1870,6 +1969,7 @@ void ProgramInfo::SetPathname(const QString &pn) const
 {
     pathname = pn;
     pathname.detach();
+    DirtySerializedCache();
 
     ProgramInfoType pit = kProgramInfoTypeVideoFile;
     if (chanid)
@@ -2131,6 +2231,7 @@ void ProgramInfo::SaveBookmark(uint64_t frame)
     }
 
     set_flag(programflags, FL_BOOKMARK, is_valid);
+    DirtySerializedCache();
 
     SendUpdateEvent();
 }
@@ -2324,6 +2425,7 @@ void ProgramInfo::SaveWatched(bool watched)
     }
 
     set_flag(programflags, FL_WATCHED, watched);
+    DirtySerializedCache();
     SendUpdateEvent();
 }
 
@@ -2375,6 +2477,7 @@ void ProgramInfo::SaveEditing(bool edit)
     set_flag(programflags, FL_REALLYEDITING, edit);
     set_flag(programflags, FL_EDITING, ((programflags & FL_REALLYEDITING) ||
                                         (programflags & COMM_FLAG_PROCESSING)));
+    DirtySerializedCache();
 
     SendUpdateEvent();
 }
@@ -2398,6 +2501,7 @@ void ProgramInfo::SaveDeletePendingFlag(bool deleteFlag)
         MythDB::DBError("SaveDeletePendingFlag", query);
 
     set_flag(programflags, FL_DELETEPENDING, deleteFlag);
+    DirtySerializedCache();
 
     if (!deleteFlag)
         SendAddedEvent();
@@ -2554,6 +2658,7 @@ void ProgramInfo::SaveTranscodeStatus(TranscodingStatus trans)
         MythDB::DBError("Transcoded status update", query);
 
     set_flag(programflags, FL_TRANSCODED, TRANSCODING_COMPLETE == trans);
+    DirtySerializedCache();
     SendUpdateEvent();
 }
 
@@ -2579,6 +2684,7 @@ void ProgramInfo::SaveCommFlagged(CommFlagStatus flag)
     set_flag(programflags, FL_COMMPROCESSING, COMM_FLAG_PROCESSING == flag);
     set_flag(programflags, FL_EDITING, ((programflags & FL_REALLYEDITING) ||
                                         (programflags & COMM_FLAG_PROCESSING)));
+    DirtySerializedCache();
     SendUpdateEvent();
 }
 
@@ -2604,6 +2710,7 @@ void ProgramInfo::SavePreserve(bool preserveEpisode)
         UpdateLastDelete(false);
 
     set_flag(programflags, FL_PRESERVED, preserveEpisode);
+    DirtySerializedCache();
 
     SendUpdateEvent();
 }
@@ -2631,6 +2738,7 @@ void ProgramInfo::SaveAutoExpire(AutoExpireType autoExpire, bool updateDelete)
         UpdateLastDelete(true);
 
     set_flag(programflags, FL_AUTOEXP, (uint)autoExpire);
+    DirtySerializedCache();
 
     SendUpdateEvent();
 }
@@ -2733,6 +2841,48 @@ void ProgramInfo::QueryCommBreakList(frm_dir_map_t &frames) const
     QueryMarkupMap(frames, MARK_COMM_END, true);
 }
 
+/// Rows per multi-row INSERT in insert_markup_rows(void)
+static const int kMarkupInsertChunkSize = 1000;
+
+/** \brief Formats a value as a literal for inclusion in a query,
+ *         quoting and escaping via the SQL driver.
+ *  \sa MSqlEscapeAsAQuery(QString&,MSqlBindings&)
+ */
+static QString format_markup_value(MSqlQuery &query, const QVariant &value)
+{
+    QSqlField field("", value.type());
+    if (value.isNull())
+        field.clear();
+    else
+        field.setValue(value);
+    return query.driver()->formatValue(field);
+}
+
+/** \brief Inserts the "(...)" tuples in rows with multi-row INSERTs,
+ *         kMarkupInsertChunkSize rows per statement.
+ *
+ *   The seek table for a two hour HD recording runs to tens of
+ *   thousands of rows, and sending them one INSERT at a time spends
+ *   nearly all of its time on per-statement overhead. The markup and
+ *   seek tables are MyISAM, so batching rows into the statement
+ *   itself is what eliminates the round trips; transaction framing
+ *   would buy us nothing there.
+ */
+static void insert_markup_rows(MSqlQuery &query, const QString &insert,
+                               const QStringList &rows,
+                               const QString &error_label)
+{
+    for (int i = 0; i < rows.size(); i += kMarkupInsertChunkSize)
+    {
+        QStringList chunk = rows.mid(i, kMarkupInsertChunkSize);
+        if (!query.exec(insert + chunk.join(",") + ";"))
+        {
+            MythDB::DBError(error_label, query);
+            return;
+        }
+    }
+}
+
 void ProgramInfo::ClearMarkupMap(
     MarkTypes type, int64_t min_frame, int64_t max_frame) const
 {
@@ -2805,12 +2955,26 @@ void ProgramInfo::SaveMarkupMap(
         return;
     }
 
+    QString insert;
+    QString rowprefix;
+    if (IsVideo())
+    {
+        insert = "INSERT INTO filemarkup (filename, mark, type) VALUES ";
+        rowprefix = format_markup_value(query, videoPath) + ",";
+    }
+    else // if (IsRecording())
+    {
+        insert = "INSERT INTO recordedmarkup"
+                 " (chanid, starttime, mark, type) VALUES ";
+        rowprefix = QString("%1,%2,")
+            .arg(chanid).arg(format_markup_value(query, recstartts));
+    }
+
+    QStringList rows;
     frm_dir_map_t::const_iterator it;
     for (it = marks.begin(); it != marks.end(); ++it)
     {
         uint64_t frame = it.key();
-        int mark_type;
-        QString querystr;
 
         if ((min_frame >= 0) && (frame < (uint64_t)min_frame))
             continue;
@@ -2818,28 +2982,13 @@ void ProgramInfo::SaveMarkupMap(
         if ((max_frame >= 0) && (frame > (uint64_t)max_frame))
             continue;
 
-        mark_type = (type != MARK_ALL) ? type : *it;
+        int mark_type = (type != MARK_ALL) ? type : *it;
 
-        if (IsVideo())
-        {
-            query.prepare("INSERT INTO filemarkup (filename, mark, type)"
-                          " VALUES ( :PATH , :MARK , :TYPE );");
-            query.bindValue(":PATH", videoPath);
-        }
-        else // if (IsRecording())
-        {
-            query.prepare("INSERT INTO recordedmarkup"
-                          " (chanid, starttime, mark, type)"
-                          " VALUES ( :CHANID , :STARTTIME , :MARK , :TYPE );");
-            query.bindValue(":CHANID", chanid);
-            query.bindValue(":STARTTIME", recstartts);
-        }
-        query.bindValue(":MARK", (quint64)frame);
-        query.bindValue(":TYPE", mark_type);
-
-        if (!query.exec())
-            MythDB::DBError("SaveMarkupMap inserting", query);
+        rows.push_back(QString("(%1%2,%3)")
+                       .arg(rowprefix).arg((quint64)frame).arg(mark_type));
     }
+
+    insert_markup_rows(query, insert, rows, "SaveMarkupMap inserting");
 }
 
 void ProgramInfo::QueryMarkupMap(
@@ -3116,25 +3265,24 @@ void ProgramInfo::SavePositionMap(
     if (!query.exec())
         MythDB::DBError("position map clear", query);
 
+    QString insert;
+    QString rowprefix;
     if (IsVideo())
     {
-        query.prepare(
-            "INSERT INTO "
-            "filemarkup (filename, mark, type, offset) "
-            "VALUES ( :PATH , :MARK , :TYPE , :OFFSET )");
-        query.bindValue(":PATH", videoPath);
+        insert = "INSERT INTO "
+                 "filemarkup (filename, mark, type, offset) VALUES ";
+        rowprefix = format_markup_value(query, videoPath) + ",";
     }
     else // if (IsRecording())
     {
-        query.prepare(
-            "INSERT INTO "
-            "recordedseek (chanid, starttime, mark, type, offset) "
-            " VALUES ( :CHANID , :STARTTIME , :MARK , :TYPE , :OFFSET )");
-        query.bindValue(":CHANID",    chanid);
-        query.bindValue(":STARTTIME", recstartts);
+        insert = "INSERT INTO "
+                 "recordedseek (chanid, starttime, mark, type, offset) "
+                 "VALUES ";
+        rowprefix = QString("%1,%2,")
+            .arg(chanid).arg(format_markup_value(query, recstartts));
     }
-    query.bindValue(":TYPE", type);
 
+    QStringList rows;
     frm_pos_map_t::iterator it;
     for (it = posMap.begin(); it != posMap.end(); ++it)
     {
@@ -3146,17 +3294,12 @@ void ProgramInfo::SavePositionMap(
         if ((max_frame >= 0) && (frame > (uint64_t)max_frame))
             continue;
 
-        uint64_t offset = *it;
-
-        query.bindValue(":MARK",   (quint64)frame);
-        query.bindValue(":OFFSET", (quint64)offset);
-
-        if (!query.exec())
-        {
-            MythDB::DBError("position map insert", query);
-            break;
-        }
+        rows.push_back(QString("(%1%2,%3,%4)")
+                       .arg(rowprefix).arg((quint64)frame)
+                       .arg(type).arg((quint64)*it));
     }
+
+    insert_markup_rows(query, insert, rows, "position map insert");
 }
 
 void ProgramInfo::SavePositionMapDelta(
@@ -3176,44 +3319,38 @@ void ProgramInfo::SavePositionMapDelta(
 
     MSqlQuery query(MSqlQuery::InitCon());
 
+    QString insert;
+    QString rowprefix;
     if (IsVideo())
     {
-        query.prepare(
-            "INSERT INTO "
-            "filemarkup (filename, mark, type, offset) "
-            "VALUES ( :PATH , :MARK , :TYPE , :OFFSET )");
-        query.bindValue(":PATH", StorageGroup::GetRelativePathname(pathname));
+        insert = "INSERT INTO "
+                 "filemarkup (filename, mark, type, offset) VALUES ";
+        rowprefix = format_markup_value(
+            query, StorageGroup::GetRelativePathname(pathname)) + ",";
     }
     else if (IsRecording())
     {
-        query.prepare(
-            "INSERT INTO "
-            "recordedseek (chanid, starttime, mark, type, offset) "
-            " VALUES ( :CHANID , :STARTTIME , :MARK , :TYPE , :OFFSET )");
-        query.bindValue(":CHANID",    chanid);
-        query.bindValue(":STARTTIME", recstartts);
+        insert = "INSERT INTO "
+                 "recordedseek (chanid, starttime, mark, type, offset) "
+                 "VALUES ";
+        rowprefix = QString("%1,%2,")
+            .arg(chanid).arg(format_markup_value(query, recstartts));
     }
     else
     {
         return;
     }
-    query.bindValue(":TYPE", type);
 
+    QStringList rows;
     frm_pos_map_t::iterator it;
     for (it = posMap.begin(); it != posMap.end(); ++it)
     {
-        uint64_t frame  = it.key();
-        uint64_t offset = *it;
-
-        query.bindValue(":MARK",   (quint64)frame);
-        query.bindValue(":OFFSET", (quint64)offset);
-
-        if (!query.exec())
-        {
-            MythDB::DBError("delta position map insert", query);
-            break;
-        }
+        rows.push_back(QString("(%1%2,%3,%4)")
+                       .arg(rowprefix).arg((quint64)it.key())
+                       .arg(type).arg((quint64)*it));
     }
+
+    insert_markup_rows(query, insert, rows, "delta position map insert");
 }
 
 /// \brief Store aspect ratio of a frame in the recordedmark table
@@ -3390,6 +3527,7 @@ void ProgramInfo::SaveResolutionProperty(VideoProperty vid_flags)
     videoproperties |= (uint16_t) vid_flags;
     properties &= ~(0x1F<<6);
     properties |= videoproperties<<6;
+    DirtySerializedCache();
 
     SendUpdateEvent();
 }
@@ -3442,7 +3580,10 @@ bool ProgramInfo::IsFileReadable(void) const
         return true;
 
     if (!IsMythStream())
+    {
         pathname = GetPlaybackURL(true, false);
+        DirtySerializedCache();
+    }
 
     if (IsMythStream())
         return RemoteCheckFile(this);
@@ -3653,7 +3794,10 @@ void ProgramInfo::MarkAsInUse(bool inuse, QString usedFor)
     }
 
     if (pathname == GetBasename())
+    {
         pathname = GetPlaybackURL(false, true);
+        DirtySerializedCache();
+    }
 
     QString recDir = DiscoverRecordingDirectory();
 
@@ -3746,6 +3890,7 @@ void ProgramInfo::MarkAsInUse(bool inuse, QString usedFor)
         else
             programflags |= FL_INUSEOTHER;
     }
+    DirtySerializedCache();
     SendUpdateEvent();
 }
 
@@ -4317,6 +4462,177 @@ bool LoadFromRecorded(
     return true;
 }
 
+/** \fn LoadFromRecorded(ProgramList&,const QString&,const MSqlBindings&)
+ *  \brief Load a filtered list of recordings in a single query.
+ *
+ *  Unlike the full variant above this does not adjust the in use or
+ *  commercial flagging state of the loaded programs, it simply unpacks
+ *  the rows matching the additional sql clauses.
+ */
+bool LoadFromRecorded(
+    ProgramList &destination, const QString &sql, const MSqlBindings &bindings)
+{
+    destination.clear();
+
+    QString querystr = ProgramInfo::kFromRecordedQuery + sql;
+
+    MSqlQuery query(MSqlQuery::InitCon());
+    query.prepare(querystr);
+    MSqlBindings::const_iterator it;
+    for (it = bindings.begin(); it != bindings.end(); ++it)
+    {
+        if (querystr.contains(it.key()))
+            query.bindValue(it.key(), it.value());
+    }
+
+    if (!query.exec())
+    {
+        MythDB::DBError("ProgramList::FromRecorded", query);
+        return false;
+    }
+
+    while (query.next())
+    {
+        const uint chanid = query.value(4).toUInt();
+        QString channum  = QString("#%1").arg(chanid);
+        QString chansign = channum;
+        QString channame = channum;
+        QString chanfilt;
+        if (!query.value(5).toString().isEmpty())
+        {
+            channum  = query.value(5).toString();
+            chansign = query.value(6).toString();
+            channame = query.value(7).toString();
+            chanfilt = query.value(8).toString();
+        }
+
+        QString hostname = query.value(13).toString();
+        if (hostname.isEmpty())
+            hostname = gCoreContext->GetHostName();
+
+        uint flags = 0;
+
+        set_flag(flags, FL_CHANCOMMFREE,
+                 query.value(27).toInt() == COMM_DETECT_COMMFREE);
+        set_flag(flags, FL_COMMFLAG,
+                 query.value(28).toInt() == COMM_FLAG_DONE);
+        set_flag(flags, FL_COMMPROCESSING ,
+                 query.value(28).toInt() == COMM_FLAG_PROCESSING);
+        set_flag(flags, FL_REPEAT,        query.value(29).toBool());
+        set_flag(flags, FL_TRANSCODED,
+                 query.value(31).toInt() == TRANSCODING_COMPLETE);
+        set_flag(flags, FL_DELETEPENDING, query.value(32).toBool());
+        set_flag(flags, FL_PRESERVED,     query.value(33).toBool());
+        set_flag(flags, FL_CUTLIST,       query.value(34).toBool());
+        set_flag(flags, FL_AUTOEXP,       query.value(35).toBool());
+        set_flag(flags, FL_REALLYEDITING, query.value(36).toBool());
+        set_flag(flags, FL_BOOKMARK,      query.value(37).toBool());
+        set_flag(flags, FL_WATCHED,       query.value(38).toBool());
+        set_flag(flags, FL_EDITING,
+                 (flags & FL_REALLYEDITING) ||
+                 (flags & COMM_FLAG_PROCESSING));
+
+        destination.push_back(
+            new ProgramInfo(
+                query.value(0).toString(),
+                query.value(1).toString(),
+                query.value(2).toString(),
+                query.value(3).toString(),
+
+                chanid, channum, chansign, channame, chanfilt,
+
+                query.value(9).toString(), query.value(10).toString(),
+
+                query.value(12).toString(),
+
+                hostname, query.value(11).toString(),
+
+                query.value(15).toString(), query.value(16).toString(),
+
+                query.value(14).toInt(),
+
+                query.value(17).toULongLong(),
+
+                query.value(18).toDateTime(), query.value(19).toDateTime(),
+                query.value(21).toDateTime(), query.value(22).toDateTime(),
+
+                query.value(20).toDouble(),
+
+                query.value(23).toUInt(),
+                query.value(24).toDate(),
+                query.value(25).toDateTime(),
+
+                rsRecorded,
+
+                query.value(26).toUInt(),
+
+                RecordingDupInType(query.value(43).toInt()),
+                RecordingDupMethodType(query.value(44).toInt()),
+
+                query.value(42).toUInt(),
+
+                flags,
+                query.value(39).toUInt(),
+                query.value(40).toUInt(),
+                query.value(41).toUInt()));
+    }
+
+    return true;
+}
+
+/** \fn LoadIndexFromRecorded(ProgramList&,bool)
+ *  \brief Load a slim index of all recordings in a single query.
+ *
+ *   Only the fields needed to identify, sort and filter recordings
+ *   are read; ProgramInfo::LoadFullDetails() hydrates the rest of a
+ *   record on first use.  This keeps a pass over a large recorded
+ *   table cheap when the caller will only touch a few records.
+ */
+bool LoadIndexFromRecorded(
+    ProgramList &destination, bool possiblyInProgressRecordingsOnly)
+{
+    destination.clear();
+
+    QString thequery =
+        "SELECT chanid,   starttime, endtime,  progstart, "
+        "       progend,  title,     recgroup, hostname,  "
+        "       basename, filesize "
+        "FROM recorded ";
+    if (possiblyInProgressRecordingsOnly)
+        thequery += "WHERE endtime >= NOW() AND starttime <= NOW() ";
+
+    MSqlQuery query(MSqlQuery::InitCon());
+    query.prepare(thequery);
+
+    if (!query.exec())
+    {
+        MythDB::DBError("ProgramList::IndexFromRecorded", query);
+        return false;
+    }
+
+    while (query.next())
+    {
+        QString hostname = query.value(7).toString();
+        if (hostname.isEmpty())
+            hostname = gCoreContext->GetHostName();
+
+        destination.push_back(
+            new ProgramInfo(
+                query.value(0).toUInt(),
+                query.value(1).toDateTime(),
+                query.value(2).toDateTime(),
+                query.value(3).toDateTime(),
+                query.value(4).toDateTime(),
+                query.value(5).toString(),
+                query.value(6).toString(),
+                hostname,
+                query.value(8).toString(),
+                query.value(9).toULongLong()));
+    }
+
+    return true;
+}
+
 QString SkipTypeToString(int flags)
 {
     if (COMM_DETECT_COMMFREE == flags)
@@ -74,6 +74,17 @@ class MPUBLIC ProgramInfo
     ProgramInfo(const ProgramInfo &other);
     /// Constructs a ProgramInfo from data in 'recorded' table
     ProgramInfo(uint chanid, const QDateTime &recstartts);
+    /// Constructs an index-only ProgramInfo from 'recorded' table data,
+    /// the remaining fields are hydrated by LoadFullDetails() on first use
+    ProgramInfo(uint chanid, const QDateTime &recstartts,
+                const QDateTime &recendts,
+                const QDateTime &startts,
+                const QDateTime &endts,
+                const QString &title,
+                const QString &recgroup,
+                const QString &hostname,
+                const QString &basename,
+                uint64_t filesize);
     /// Constructs a ProgramInfo from data in 'recorded' table
     ProgramInfo(const QString &title,
                 const QString &subtitle,
@@ -272,6 +283,12 @@ class MPUBLIC ProgramInfo
     bool IsSameRecording(const ProgramInfo &other) const
         { return chanid == other.chanid && recstartts == other.recstartts; }
 
+    // Lazy loading of 'recorded' table data
+    /// Returns false for an index-only record whose remaining fields
+    /// have not been loaded from the database yet.
+    bool HasFullDetails(void) const { return detailsLoaded; }
+    bool LoadFullDetails(void);
+
     // Quick gets
     /// Creates a unique string that can be used to identify an
     /// existing recording.
@@ -433,43 +450,71 @@ class MPUBLIC ProgramInfo
                      QString grp = "\"") const;
 
     // Quick sets
-    void SetTitle(const QString &t) { title = t; title.detach(); }
+    void SetTitle(const QString &t)
+        { title = t; title.detach(); DirtySerializedCache(); }
     void SetProgramInfoType(ProgramInfoType t)
-        { programflags &= ~FL_TYPEMASK; programflags |= ((uint32_t)t<<16); }
+    {
+        programflags &= ~FL_TYPEMASK; programflags |= ((uint32_t)t<<16);
+        DirtySerializedCache();
+    }
+    void SetProgramFlags(uint32_t flags)
+        { programflags = flags; DirtySerializedCache(); }
     void SetPathname(const QString&) const;
-    void SetChanID(uint _chanid) { chanid = _chanid; }
-    void SetScheduledStartTime(const QDateTime &dt) { startts      = dt;    }
-    void SetScheduledEndTime(  const QDateTime &dt) { endts        = dt;    }
-    void SetRecordingStartTime(const QDateTime &dt) { recstartts   = dt;    }
-    void SetRecordingEndTime(  const QDateTime &dt) { recendts     = dt;    }
-    void SetRecordingGroup(const QString &group)    { recgroup     = group; }
-    void SetPlaybackGroup( const QString &group)    { playgroup    = group; }
-    void SetHostname(      const QString &host)     { hostname     = host;  }
-    void SetStorageGroup(  const QString &group)    { storagegroup = group; }
-    void SetFilesize(      uint64_t       sz)       { filesize     = sz;    }
-    void SetSeriesID(      const QString &id)       { seriesid     = id;    }
-    void SetProgramID(     const QString &id)       { programid    = id;    }
-    void SetCategoryType(  const QString &type)     { catType      = type;  }
-    void SetRecordingPriority(int priority)       { recpriority = priority; }
-    void SetRecordingPriority2(int priority)     { recpriority2 = priority; }
-    void SetRecordingRuleID(uint id)                { recordid     = id;    }
-    void SetSourceID(uint id)                       { sourceid     = id;    }
-    void SetInputID( uint id)                       { inputid      = id;    }
-    void SetCardID(  uint id)                       { cardid       = id;    }
+    void SetChanID(uint _chanid)
+        { chanid = _chanid; DirtySerializedCache(); }
+    void SetScheduledStartTime(const QDateTime &dt)
+        { startts      = dt;    DirtySerializedCache(); }
+    void SetScheduledEndTime(  const QDateTime &dt)
+        { endts        = dt;    DirtySerializedCache(); }
+    void SetRecordingStartTime(const QDateTime &dt)
+        { recstartts   = dt;    DirtySerializedCache(); }
+    void SetRecordingEndTime(  const QDateTime &dt)
+        { recendts     = dt;    DirtySerializedCache(); }
+    void SetRecordingGroup(const QString &group)
+        { recgroup     = group; DirtySerializedCache(); }
+    void SetPlaybackGroup( const QString &group)
+        { playgroup    = group; DirtySerializedCache(); }
+    void SetHostname(      const QString &host)
+        { hostname     = host;  DirtySerializedCache(); }
+    void SetStorageGroup(  const QString &group)
+        { storagegroup = group; DirtySerializedCache(); }
+    void SetFilesize(      uint64_t       sz)
+        { filesize     = sz;    DirtySerializedCache(); }
+    void SetSeriesID(      const QString &id)
+        { seriesid     = id;    DirtySerializedCache(); }
+    void SetProgramID(     const QString &id)
+        { programid    = id;    DirtySerializedCache(); }
+    void SetCategoryType(  const QString &type)
+        { catType      = type;  DirtySerializedCache(); }
+    void SetRecordingPriority(int priority)
+        { recpriority  = priority;  DirtySerializedCache(); }
+    void SetRecordingPriority2(int priority)
+        { recpriority2 = priority;  DirtySerializedCache(); }
+    void SetRecordingRuleID(uint id)
+        { recordid     = id;    DirtySerializedCache(); }
+    void SetSourceID(uint id)
+        { sourceid     = id;    DirtySerializedCache(); }
+    void SetInputID( uint id)
+        { inputid      = id;    DirtySerializedCache(); }
+    void SetCardID(  uint id)
+        { cardid       = id;    DirtySerializedCache(); }
     void SetReactivated(bool reactivate)
     {
         programflags &= ~FL_REACTIVATE;
         programflags |= (reactivate) ? FL_REACTIVATE : 0;
+        DirtySerializedCache();
     }
     void SetEditing(bool editing)
     {
         programflags &= ~FL_EDITING;
         programflags |= (editing) ? FL_EDITING : 0;
+        DirtySerializedCache();
     }
     void SetFlagging(bool flagging)
     {
         programflags &= ~FL_COMMFLAG;
         programflags |= (flagging) ? FL_COMMFLAG : 0;
+        DirtySerializedCache();
     }
     /// \brief If "ignore" is true GetBookmark() will return 0, otherwise
     ///        GetBookmark() will return the bookmark position if it exists.
@@ -477,9 +522,12 @@ class MPUBLIC ProgramInfo
     {
         programflags &= ~FL_IGNOREBOOKMARK;
         programflags |= (ignore) ? FL_IGNOREBOOKMARK : 0;
+        DirtySerializedCache();
     }
-    void SetRecordingStatus(RecStatusType status) { recstatus = status; }
-    void SetRecordingRuleType(RecordingType type) { rectype   = type;   }
+    void SetRecordingStatus(RecStatusType status)
+        { recstatus = status; DirtySerializedCache(); }
+    void SetRecordingRuleType(RecordingType type)
+        { rectype   = type;   DirtySerializedCache(); }
     void SetPositionMapDBReplacement(PMapDBReplacement *pmap)
         { positionMapDBReplacement = pmap; }
 
@@ -589,6 +637,15 @@ class MPUBLIC ProgramInfo
     bool FromStringList(QStringList::const_iterator &it,
                         QStringList::const_iterator  end);
 
+    /// \brief Discards the pre-serialized form, call after any write
+    ///        to a serialized field. \sa ToStringList(QStringList&) const
+    void DirtySerializedCache(void) const { serializedCache.clear(); }
+
+    /// Subclasses that write the serialized fields directly rather
+    /// than through the Set methods must return false here, otherwise
+    /// ToStringList() may serve stale data.
+    virtual bool CacheSerializedForm(void) const { return true; }
+
     static void QueryMarkupMap(
         const QString &video_pathname,
         frm_dir_map_t&, MarkTypes type, bool merge = false);
@@ -670,9 +727,15 @@ class MPUBLIC ProgramInfo
     static const QString kFromRecordedQuery;
 
   protected:
+    /// False for an index-only record created by LoadIndexFromRecorded()
+    /// until LoadFullDetails() hydrates the remaining fields.
+    bool detailsLoaded;
     QString inUseForWhat;
     PMapDBReplacement *positionMapDBReplacement;
 
+    /// Pre-serialized form filled in by ToStringList(), empty when stale.
+    mutable QStringList serializedCache;
+
     static QMutex staticDataLock;
     static ProgramInfoUpdater *updater;
 };
@@ -698,6 +761,15 @@ MPUBLIC bool LoadFromRecorded(
     const QMap<QString,bool> &isJobRunning,
     const QMap<QString, ProgramInfo*> &recMap);
 
+MPUBLIC bool LoadFromRecorded(
+    ProgramList        &destination,
+    const QString      &sql,
+    const MSqlBindings &bindings);
+
+MPUBLIC bool LoadIndexFromRecorded(
+    ProgramList        &destination,
+    bool                possiblyInProgressRecordingsOnly);
+
 template<typename TYPE>
 bool LoadFromScheduler(
     AutoDeleteDeque<TYPE*> &destination,
@@ -28,7 +28,56 @@ vector<ProgramInfo *> *RemoteGetRecordedList(bool deltype)
         delete info;
         return NULL;
     }
- 
+
+    return info;
+}
+
+/** \brief Fetches one page of the recording list with server side
+ *         filtering.
+ *
+ *  Asks the backend for \e count recordings starting at \e offset of
+ *  those matching \e recgroup and \e title (either may be empty to
+ *  match everything); \e total is set to the number of recordings
+ *  matching the filters. Requires a backend with paged
+ *  QUERY_RECORDINGS support.
+ */
+vector<ProgramInfo *> *RemoteGetRecordedList(
+    bool deltype, uint offset, uint count,
+    const QString &recgroup, const QString &title, uint &total)
+{
+    QString str = "QUERY_RECORDINGS ";
+    str += (deltype) ? "Delete" : "Play";
+
+    QStringList strlist(str);
+    strlist << QString::number(offset);
+    strlist << QString::number(count);
+    strlist << recgroup;
+    strlist << title;
+
+    total = 0;
+
+    if (!gCoreContext->SendReceiveStringList(strlist) || strlist.size() < 2)
+        return NULL;
+
+    total = strlist[0].toUInt();
+    int numrecordings = strlist[1].toInt();
+
+    vector<ProgramInfo *> *info = new vector<ProgramInfo *>;
+    if (numrecordings <= 0)
+        return info;
+
+    if (numrecordings * NUMPROGRAMLINES + 2 > (int)strlist.size())
+    {
+        VERBOSE(VB_IMPORTANT, "RemoteGetRecordedList() "
+                "list size appears to be incorrect.");
+        delete info;
+        return NULL;
+    }
+
+    QStringList::const_iterator it = strlist.begin() + 2;
+    for (int i = 0; i < numrecordings; i++)
+        info->push_back(new ProgramInfo(it, strlist.end()));
+
     return info;
 }
 
@@ -31,6 +31,9 @@ class MPUBLIC FileSystemInfo
 };
 
 MPUBLIC vector<ProgramInfo *> *RemoteGetRecordedList(bool deltype);
+MPUBLIC vector<ProgramInfo *> *RemoteGetRecordedList(
+    bool deltype, uint offset, uint count,
+    const QString &recgroup, const QString &title, uint &total);
 MPUBLIC vector<FileSystemInfo> RemoteGetFreeSpace(void);
 MPUBLIC bool RemoteGetLoad(float load[3]);
 MPUBLIC bool RemoteGetUptime(time_t &uptime);
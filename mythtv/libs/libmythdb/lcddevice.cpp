@@ -56,6 +56,11 @@ extern "C" {
 
 static QString LOC = "lcddevice: ";
 
+// High rate updates (progress bars, LEDs) are coalesced and sent as one
+// batch at most this often, so idle playback only wakes the server a few
+// times a second instead of once per widget change.
+static const int kUpdateTimeMS = 250;
+
 LCD::LCD()
     : QObject(),
       socket(NULL),                 socketLock(QMutex::Recursive),
@@ -63,6 +68,7 @@ LCD::LCD()
       bConnected(false),
 
       retryTimer(new QTimer(this)), LEDTimer(new QTimer(this)),
+      updateTimer(new QTimer(this)),
 
       lcd_width(0),                 lcd_height(0),
 
@@ -95,6 +101,9 @@ LCD::LCD()
 
     connect(retryTimer, SIGNAL(timeout()),   this, SLOT(restartConnection()));
     connect(LEDTimer,   SIGNAL(timeout()),   this, SLOT(outputLEDs()));
+
+    updateTimer->setSingleShot(true);
+    connect(updateTimer, SIGNAL(timeout()),  this, SLOT(flushUpdates()));
 }
 
 bool LCD::m_enabled = false;
@@ -248,24 +257,78 @@ void LCD::sendToServer(const QString &someText)
     QTextStream os(socket);
     os.setCodec(QTextCodec::codecForName("ISO 8859-1"));
 
-    last_command = someText;
+    // Anything still queued for the next update batch was generated
+    // before this command, so it goes out first, in the same write.
+    QString payload = takePendingUpdates();
+    if (payload.isEmpty())
+        payload = someText;
+    else
+        payload += '\n' + someText;
+
+    last_command = payload;
 
     if (bConnected)
     {
-        VERBOSE(VB_NETWORK|VB_EXTRA, QString(LOC + "Sending to Server: %1").arg(someText));
+        VERBOSE(VB_NETWORK|VB_EXTRA, QString(LOC + "Sending to Server: %1").arg(payload));
 
         // Just stream the text out the socket
-        os << someText << "\n";
+        os << payload << "\n";
     }
     else
     {
         // Buffer this up in the hope that the connection will open soon
 
-        send_buffer += someText;
+        send_buffer += payload;
         send_buffer += '\n';
     }
 }
 
+void LCD::queueUpdate(const QString &key, const QString &someText)
+{
+    QMutexLocker locker(&socketLock);
+
+    // Only the latest value of each update command is kept, and the
+    // whole batch goes to the server at most once per update interval.
+    pending_updates[key] = someText;
+
+    if (!updateTimer->isActive())
+        updateTimer->start(kUpdateTimeMS);
+}
+
+QString LCD::takePendingUpdates(void)
+{
+    QMutexLocker locker(&socketLock);
+
+    updateTimer->stop();
+
+    QString batch;
+    QMap<QString, QString>::iterator it = pending_updates.begin();
+    for (; it != pending_updates.end(); ++it)
+    {
+        // Drop updates that would not change anything on the display.
+        if (last_updates.value(it.key()) == it.value())
+            continue;
+
+        if (!batch.isEmpty())
+            batch += '\n';
+        batch += it.value();
+
+        last_updates[it.key()] = it.value();
+    }
+    pending_updates.clear();
+
+    return batch;
+}
+
+void LCD::flushUpdates()
+{
+    QMutexLocker locker(&socketLock);
+
+    QString batch = takePendingUpdates();
+    if (!batch.isEmpty())
+        sendToServer(batch);
+}
+
 void LCD::restartConnection()
 {
     // Reset the flag
@@ -387,6 +450,10 @@ void LCD::init()
     bConnected = true;
     lcd_ready = true;
 
+    // the (possibly restarted) server's widget state is unknown, so
+    // nothing can be skipped as a duplicate
+    last_updates.clear();
+
     // send buffer if there's anything in there
     if (send_buffer.length() > 0)
     {
@@ -425,7 +492,7 @@ void LCD::setSpeakerLEDs(enum LCDSpeakerSet speaker, bool on)
     lcd_ledmask &= ~SPEAKER_MASK;
     if (on)
         lcd_ledmask |= speaker;
-    sendToServer(QString("UPDATE_LEDS %1").arg(lcd_ledmask));
+    queueUpdate("UPDATE_LEDS", QString("UPDATE_LEDS %1").arg(lcd_ledmask));
 }
 
 void LCD::setAudioFormatLEDs(enum LCDAudioFormatSet acodec, bool on)
@@ -437,7 +504,7 @@ void LCD::setAudioFormatLEDs(enum LCDAudioFormatSet acodec, bool on)
     if (on)
         lcd_ledmask |= (acodec & AUDIO_MASK);
 
-    sendToServer(QString("UPDATE_LEDS %1").arg(lcd_ledmask));
+    queueUpdate("UPDATE_LEDS", QString("UPDATE_LEDS %1").arg(lcd_ledmask));
 }
 
 void LCD::setVideoFormatLEDs(enum LCDVideoFormatSet vcodec, bool on)
@@ -449,7 +516,7 @@ void LCD::setVideoFormatLEDs(enum LCDVideoFormatSet vcodec, bool on)
     if (on)
         lcd_ledmask |= (vcodec & VIDEO_MASK);
 
-    sendToServer(QString("UPDATE_LEDS %1").arg(lcd_ledmask));
+    queueUpdate("UPDATE_LEDS", QString("UPDATE_LEDS %1").arg(lcd_ledmask));
 }
 
 void LCD::setVideoSrcLEDs(enum LCDVideoSourceSet vsrc, bool on)
@@ -459,7 +526,7 @@ void LCD::setVideoSrcLEDs(enum LCDVideoSourceSet vsrc, bool on)
     lcd_ledmask &= ~VSRC_MASK;
     if (on)
         lcd_ledmask |=  vsrc;
-    sendToServer(QString("UPDATE_LEDS %1").arg(lcd_ledmask));
+    queueUpdate("UPDATE_LEDS", QString("UPDATE_LEDS %1").arg(lcd_ledmask));
 }
 
 void LCD::setFunctionLEDs(enum LCDFunctionSet func, bool on)
@@ -469,7 +536,7 @@ void LCD::setFunctionLEDs(enum LCDFunctionSet func, bool on)
     lcd_ledmask &= ~FUNC_MASK;
     if (on)
         lcd_ledmask |=  func;
-    sendToServer(QString("UPDATE_LEDS %1").arg(lcd_ledmask));
+    queueUpdate("UPDATE_LEDS", QString("UPDATE_LEDS %1").arg(lcd_ledmask));
 }
 
 void LCD::setVariousLEDs(enum LCDVariousFlags various, bool on)
@@ -485,7 +552,7 @@ void LCD::setVariousLEDs(enum LCDVariousFlags various, bool on)
         if (various == VARIOUS_SPDIF)
             lcd_ledmask &= ~SPDIF_MASK;
     }
-    sendToServer(QString("UPDATE_LEDS %1").arg(lcd_ledmask));
+    queueUpdate("UPDATE_LEDS", QString("UPDATE_LEDS %1").arg(lcd_ledmask));
 }
 
 void LCD::setTunerLEDs(enum LCDTunerSet tuner, bool on)
@@ -495,7 +562,7 @@ void LCD::setTunerLEDs(enum LCDTunerSet tuner, bool on)
     lcd_ledmask &= ~TUNER_MASK;
     if (on)
         lcd_ledmask |=  tuner;
-    sendToServer(QString("UPDATE_LEDS %1").arg(lcd_ledmask));
+    queueUpdate("UPDATE_LEDS", QString("UPDATE_LEDS %1").arg(lcd_ledmask));
 }
 
 void LCD::setChannelProgress(float value)
@@ -504,7 +571,8 @@ void LCD::setChannelProgress(float value)
         return;
 
     value = std::min(std::max(0.0f, value), 1.0f);
-    sendToServer(QString("SET_CHANNEL_PROGRESS %1").arg(value));
+    queueUpdate("SET_CHANNEL_PROGRESS",
+                QString("SET_CHANNEL_PROGRESS %1").arg(value));
 }
 
 void LCD::setGenericProgress(float value)
@@ -513,7 +581,8 @@ void LCD::setGenericProgress(float value)
         return;
 
     value = std::min(std::max(0.0f, value), 1.0f);
-    sendToServer(QString("SET_GENERIC_PROGRESS 0 %1").arg(value));
+    queueUpdate("SET_GENERIC_PROGRESS",
+                QString("SET_GENERIC_PROGRESS 0 %1").arg(value));
 }
 
 void LCD::setGenericBusy()
@@ -521,6 +590,12 @@ void LCD::setGenericBusy()
     if (!lcd_ready || !lcd_showgeneric)
         return;
 
+    QMutexLocker locker(&socketLock);
+
+    // Sent directly since the server only animates the busy spinner
+    // when the message actually arrives.  Forget the last progress
+    // value so the next real update is not mistaken for a duplicate.
+    last_updates.remove("SET_GENERIC_PROGRESS");
     sendToServer("SET_GENERIC_PROGRESS 1 0.0");
 }
 
@@ -530,8 +605,9 @@ void LCD::setMusicProgress(QString time, float value)
         return;
 
     value = std::min(std::max(0.0f, value), 1.0f);
-    sendToServer("SET_MUSIC_PROGRESS " + quotedString(time) + ' ' + 
-            QString().setNum(value));    
+    queueUpdate("SET_MUSIC_PROGRESS",
+                "SET_MUSIC_PROGRESS " + quotedString(time) + ' ' +
+                QString().setNum(value));
 }
 
 void LCD::setMusicShuffle(int shuffle)
@@ -560,7 +636,8 @@ void LCD::setVolumeLevel(float value)
     else if (value > 1.0)
         value = 1.0;
 
-    sendToServer("SET_VOLUME_LEVEL " + QString().setNum(value));
+    queueUpdate("SET_VOLUME_LEVEL",
+                "SET_VOLUME_LEVEL " + QString().setNum(value));
 }
 
 void LCD::setupLEDs(int(*LedMaskFunc)(void))
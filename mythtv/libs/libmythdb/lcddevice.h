@@ -9,6 +9,7 @@
 #include <QDateTime>
 #include <QMutex>
 #include <QList>
+#include <QMap>
 
 #include "mythexp.h"
 #include "mythsocket_cb.h"
@@ -301,10 +302,13 @@ class MPUBLIC LCD : public QObject, public MythSocketCBs
     void restartConnection();      // Try to re-establish the connection to
                                    // LCDServer every 10 seconds
     void outputLEDs();
+    void flushUpdates();           // Send the coalesced high rate updates
 
   private:
     bool startLCDServer(void);
     void sendToServer(const QString &someText);
+    void queueUpdate(const QString &key, const QString &someText);
+    QString takePendingUpdates(void);
     void init();
     void handleKeyPress(QString key);
     QString quotedString(const QString &s);
@@ -324,10 +328,16 @@ class MPUBLIC LCD : public QObject, public MythSocketCBs
 
     QTimer *retryTimer;
     QTimer *LEDTimer;
+    QTimer *updateTimer;
 
     QString send_buffer;
     QString last_command;
 
+    // latest value of each coalesced update command, keyed on the
+    // command word, and what the server was last sent for each
+    QMap<QString, QString> pending_updates;
+    QMap<QString, QString> last_updates;
+
     int  lcd_width;
     int  lcd_height;
 
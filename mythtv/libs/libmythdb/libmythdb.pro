@@ -15,6 +15,7 @@ HEADERS += mythexp.h mythdbcon.h mythdb.h mythdbparams.h oldsettings.h
 HEADERS += mythverbose.h mythversion.h compat.h mythconfig.h
 HEADERS += mythobservable.h mythevent.h httpcomms.h mcodecs.h
 HEADERS += mythtimer.h mythsignalingtimer.h mythdirs.h exitcodes.h
+HEADERS += mythprofile.h mythlockfreequeue.h
 HEADERS += lcddevice.h mythstorage.h remotefile.h decodeencode.h
 HEADERS += mythcorecontext.h mythsystem.h mythlocale.h storagegroup.h
 HEADERS += mythcoreutil.h mythdownloadmanager.h mythtranslation.h
@@ -23,7 +24,7 @@ HEADERS += unzip.h unzip_p.h zipentry_p.h iso639.h iso3166.h
 SOURCES += mythsocket.cpp mythsocketthread.cpp msocketdevice.cpp
 SOURCES += mythdbcon.cpp mythdb.cpp oldsettings.cpp mythverbose.cpp
 SOURCES += mythobservable.cpp mythevent.cpp httpcomms.cpp mcodecs.cpp
-SOURCES += mythdirs.cpp mythsignalingtimer.cpp
+SOURCES += mythdirs.cpp mythsignalingtimer.cpp mythprofile.cpp
 SOURCES += lcddevice.cpp mythstorage.cpp remotefile.cpp decodeencode.cpp
 SOURCES += mythcorecontext.cpp mythsystem.cpp mythlocale.cpp storagegroup.cpp
 SOURCES += mythcoreutil.cpp mythdownloadmanager.cpp mythtranslation.cpp
@@ -41,6 +42,7 @@ inc.files  = mythverbose.h mythdbcon.h mythdbparams.h mythexp.h mythdb.h
 inc.files += compat.h mythversion.h mythconfig.h mythconfig.mak
 inc.files += mythobservable.h mythevent.h httpcomms.h mcodecs.h
 inc.files += mythtimer.h lcddevice.h exitcodes.h mythdirs.h mythstorage.h
+inc.files += mythprofile.h mythlockfreequeue.h
 inc.files += mythsocket.h mythsocket_cb.h msocketdevice.h
 inc.files += mythcorecontext.h mythsystem.h storagegroup.h
 inc.files += mythcoreutil.h mythlocale.h mythdownloadmanager.h
@@ -724,6 +724,17 @@ QString MythCoreContext::GetSettingOnHost(const QString &key,
     return d->m_database->GetSettingOnHost(key, host, defaultval);
 }
 
+bool MythCoreContext::GetSettings(QMap<QString,QString> &_key_value_pairs)
+{
+    return d->m_database->GetSettings(_key_value_pairs);
+}
+
+bool MythCoreContext::GetSettingsOnHost(QMap<QString,QString> &_key_value_pairs,
+                                        const QString &host)
+{
+    return d->m_database->GetSettingsOnHost(_key_value_pairs, host);
+}
+
 int MythCoreContext::GetNumSettingOnHost(const QString &key,
                                          const QString &host,
                                          int defaultval)
@@ -928,7 +939,10 @@ bool MythCoreContext::CheckProtoVersion(MythSocket *socket, uint timeout_ms,
     if (!socket)
         return false;
 
-    QStringList strlist(QString("MYTH_PROTO_VERSION %1 %2")
+    // The trailing tokens offer the binary string list encoding and
+    // deflate compression of large payloads; old backends ignore the
+    // extra tokens and reply with a plain ACCEPT.
+    QStringList strlist(QString("MYTH_PROTO_VERSION %1 %2 BINARY DEFLATE")
                         .arg(MYTH_PROTO_VERSION).arg(MYTH_PROTO_TOKEN));
     socket->writeStringList(strlist);
 
@@ -961,8 +975,22 @@ bool MythCoreContext::CheckProtoVersion(MythSocket *socket, uint timeout_ms,
     }
     else if (strlist[0] == "ACCEPT")
     {
-        VERBOSE(VB_IMPORTANT, QString("Using protocol version %1")
-                               .arg(MYTH_PROTO_VERSION));
+        bool binary  = false;
+        bool deflate = false;
+        for (int i = 2; i < strlist.size(); i++)
+        {
+            binary  |= (strlist[i] == "BINARY");
+            deflate |= (strlist[i] == "DEFLATE");
+        }
+        if (binary)
+            socket->setBinaryMode(true);
+        if (deflate)
+            socket->setCompressedMode(true);
+
+        VERBOSE(VB_IMPORTANT, QString("Using protocol version %1%2%3")
+                               .arg(MYTH_PROTO_VERSION)
+                               .arg(binary ? " (binary string lists)" : "")
+                               .arg(deflate ? " (deflate)" : ""));
         return true;
     }
 
@@ -1094,11 +1122,27 @@ MythPrivRequest MythCoreContext::popPrivRequest()
     return ret_val;
 }
 
+/// Returns a non-empty coalescing key for the high-rate idempotent
+/// notifications; mythfilldatabase and recordings in progress can
+/// produce storms of these, and posting another copy to a listener
+/// which has not yet consumed an identical one is pointless.
+static QString coalesce_key(const MythEvent &event)
+{
+    const QString &msg = event.Message();
+    if (msg.startsWith("SCHEDULE_CHANGE") ||
+        msg.startsWith("RECORDING_LIST_CHANGE") ||
+        msg.startsWith("UPDATE_FILE_SIZE "))
+    {
+        return msg + "\n" + event.ExtraDataList().join("\n");
+    }
+    return QString();
+}
+
 void MythCoreContext::dispatch(const MythEvent &event)
 {
     VERBOSE(VB_NETWORK, QString("MythEvent: %1").arg(event.Message()));
 
-    MythObservable::dispatch(event);
+    MythObservable::dispatch(event, coalesce_key(event));
 }
 
 void MythCoreContext::dispatchNow(const MythEvent &event)
@@ -147,6 +147,9 @@ class MPUBLIC MythCoreContext : public MythObservable, public MythSocketCBs
                             int defaultval = 0);
     double GetFloatSettingOnHost(const QString &key, const QString &host,
                                  double defaultval = 0.0);
+    bool GetSettings(QMap<QString,QString> &_key_value_pairs);
+    bool GetSettingsOnHost(QMap<QString,QString> &_key_value_pairs,
+                           const QString &host);
 
     void SetSetting(const QString &key, const QString &newValue);
 
@@ -5,6 +5,8 @@ using namespace std;
 #include <QReadWriteLock>
 #include <QHash>
 #include <QSqlError>
+#include <QAtomicInt>
+#include <QThreadStorage>
 
 #include "mythdb.h"
 #include "mythdbcon.h"
@@ -59,12 +61,28 @@ struct SingleSetting
 
 typedef QHash<QString,QString> SettingsMap;
 
+/** \brief A thread's private copy of settings it has looked up.
+ *
+ *   Valid for a single settings cache generation; any write to the
+ *   settings bumps the generation, which makes each thread start
+ *   over with an empty map on its next lookup.
+ */
+class ThreadSettingsCache
+{
+  public:
+    ThreadSettingsCache() : generation(-1) {}
+    int         generation;
+    SettingsMap map;
+};
+
 class MythDBPrivate
 {
   public:
     MythDBPrivate();
    ~MythDBPrivate();
 
+    SettingsMap *GetThreadSettingsCache(void);
+
     DatabaseParams  m_DBparams;  ///< Current database host & WOL details
     QString m_localhostname;
     MDBManager m_dbmanager;
@@ -76,6 +94,10 @@ class MythDBPrivate
 
     QReadWriteLock settingsCacheLock;
     volatile bool useSettingsCache;
+    /// Bumped by every settings write; invalidates the per-thread caches
+    QAtomicInt settingsCacheGeneration;
+    /// Per-thread caches probed without taking settingsCacheLock
+    QThreadStorage<ThreadSettingsCache*> threadSettingsCache;
     /// Permanent settings in the DB and overridden settings
     SettingsMap settingsCache;
     /// Overridden this session only
@@ -105,6 +127,39 @@ MythDBPrivate::~MythDBPrivate()
     delete m_settings;
 }
 
+/** \brief Returns the calling thread's private settings cache,
+ *         or NULL when the settings cache is disabled.
+ *
+ *   The returned map is only ever touched by the calling thread, so
+ *   lookups in it need no lock; the settings are read-mostly and hit
+ *   constantly (the player polls some settings per frame), so this
+ *   keeps those reads off settingsCacheLock entirely. Writers just
+ *   bump settingsCacheGeneration, which throws away each thread's
+ *   copy on its next lookup.
+ */
+SettingsMap *MythDBPrivate::GetThreadSettingsCache(void)
+{
+    if (!useSettingsCache)
+        return NULL;
+
+    ThreadSettingsCache *tsc = threadSettingsCache.localData();
+    if (!tsc)
+    {
+        tsc = new ThreadSettingsCache();
+        threadSettingsCache.setLocalData(tsc);
+    }
+
+    int generation = (int)settingsCacheGeneration;
+    if (tsc->generation != generation)
+    {
+        tsc->map.clear();
+        tsc->map.reserve(settings_reserve);
+        tsc->generation = generation;
+    }
+
+    return &tsc->map;
+}
+
 MythDB::MythDB()
 {
     d = new MythDBPrivate();
@@ -328,6 +383,19 @@ QString MythDB::GetSetting(const QString &_key, const QString &defaultval)
     QString key = _key.toLower();
     QString value;
 
+    // Lock-free fast path via the calling thread's own cache.
+    SettingsMap *tcache = d->GetThreadSettingsCache();
+    if (tcache)
+    {
+        SettingsMap::const_iterator it = tcache->find(key);
+        if (it != tcache->end())
+        {
+            value = *it;
+            value.detach();
+            return value;
+        }
+    }
+
     d->settingsCacheLock.lockForRead();
     if (d->useSettingsCache)
     {
@@ -336,6 +404,9 @@ QString MythDB::GetSetting(const QString &_key, const QString &defaultval)
         {
             value = *it;
             d->settingsCacheLock.unlock();
+            value.detach();
+            if (tcache)
+                (*tcache)[key] = value;
             return value;
         }
     }
@@ -403,6 +474,8 @@ QString MythDB::GetSetting(const QString &_key, const QString &defaultval)
         if (d->settingsCache.find(key) == d->settingsCache.end())
             d->settingsCache[key] = value;
         d->settingsCacheLock.unlock();
+        if (tcache)
+            (*tcache)[key] = value;
     }
 
     return value;
@@ -531,6 +604,140 @@ bool MythDB::GetSettings(QMap<QString,QString> &_key_value_pairs)
     return true;
 }
 
+/** \brief Like GetSettings(), but for another host's settings.
+ *
+ *  Fetches all the requested keys with one query and fills the
+ *  settings cache, so a burst of GetSettingOnHost() calls afterwards
+ *  costs no further round trips.  Keys without a row keep the value
+ *  the caller put in the map.
+ */
+bool MythDB::GetSettingsOnHost(QMap<QString,QString> &_key_value_pairs,
+                               const QString &_host)
+{
+    QString host = _host.toLower();
+
+    QMap<QString,bool> done;
+    typedef QMap<QString,QString>::iterator KVIt;
+    KVIt kvit = _key_value_pairs.begin();
+    for (; kvit != _key_value_pairs.end(); ++kvit)
+        done[kvit.key().toLower()] = false;
+
+    QMap<QString,bool>::iterator dit = done.begin();
+    kvit = _key_value_pairs.begin();
+
+    {
+        uint done_cnt = 0;
+        d->settingsCacheLock.lockForRead();
+        if (d->useSettingsCache)
+        {
+            for (; kvit != _key_value_pairs.end(); ++dit, ++kvit)
+            {
+                SettingsMap::const_iterator it =
+                    d->settingsCache.find(host + ' ' + dit.key());
+                if (it != d->settingsCache.end())
+                {
+                    *kvit = *it;
+                    *dit = true;
+                    done_cnt++;
+                }
+            }
+        }
+        else
+        {
+            for (; kvit != _key_value_pairs.end(); ++dit, ++kvit)
+            {
+                SettingsMap::const_iterator it =
+                    d->overriddenSettings.find(host + ' ' + dit.key());
+                if (it != d->overriddenSettings.end())
+                {
+                    *kvit = *it;
+                    *dit = true;
+                    done_cnt++;
+                }
+            }
+        }
+        d->settingsCacheLock.unlock();
+
+        // Avoid extra work if everything was in the caches and
+        // also don't try to access the DB if ignoreDatabase is set
+        if (((uint)done.size()) == done_cnt || d->ignoreDatabase)
+            return true;
+    }
+
+    dit = done.begin();
+    kvit = _key_value_pairs.begin();
+
+    QString keylist("");
+    QMap<QString,KVIt> keymap;
+    for (; kvit != _key_value_pairs.end(); ++dit, ++kvit)
+    {
+        if (*dit)
+            continue;
+
+        QString key = dit.key();
+        if (!key.contains("'"))
+        {
+            keylist += QString("'%1',").arg(key);
+            keymap[key] = kvit;
+        }
+        else
+        {   // hopefully no one actually uses quotes for in a settings key.
+            // but in case they do, just get that value inefficiently..
+            *kvit = GetSettingOnHost(key, host, *kvit);
+        }
+    }
+
+    if (keylist.isEmpty())
+        return true;
+
+    keylist = keylist.left(keylist.length() - 1);
+
+    MSqlQuery query(MSqlQuery::InitCon());
+    if (!query.exec(
+            QString(
+                "SELECT value, data "
+                "FROM settings "
+                "WHERE hostname = '%1' AND "
+                "      value IN (%2)")
+            .arg(host).arg(keylist)))
+    {
+        if (!d->suppressDBMessages)
+            DBError("GetSettingsOnHost", query);
+        return false;
+    }
+
+    while (query.next())
+    {
+        QString key = query.value(0).toString().toLower();
+        QMap<QString,KVIt>::const_iterator it = keymap.find(key);
+        if (it != keymap.end())
+            **it = query.value(1).toString();
+    }
+
+    if (d->useSettingsCache)
+    {
+        d->settingsCacheLock.lockForWrite();
+        QMap<QString,KVIt>::const_iterator it = keymap.begin();
+        for (; it != keymap.end(); ++it)
+        {
+            QString myKey = host + ' ' + it.key();
+            QString value = **it;
+
+            // another thread may have inserted a value into the cache
+            // while we did not have the lock, check first then save
+            if (d->settingsCache.find(myKey) == d->settingsCache.end())
+            {
+                myKey.squeeze();
+                value.squeeze();
+                d->settingsCache[myKey] = value;
+            }
+        }
+        d->settingsCacheLock.unlock();
+    }
+
+    return true;
+}
+
 
 int MythDB::GetNumSetting(const QString &key, int defaultval)
 {
@@ -577,6 +784,19 @@ QString MythDB::GetSettingOnHost(const QString &_key, const QString &_host,
     QString value = defaultval;
     QString myKey = host + ' ' + key;
 
+    // Lock-free fast path via the calling thread's own cache.
+    SettingsMap *tcache = d->GetThreadSettingsCache();
+    if (tcache)
+    {
+        SettingsMap::const_iterator it = tcache->find(myKey);
+        if (it != tcache->end())
+        {
+            value = *it;
+            value.detach();
+            return value;
+        }
+    }
+
     d->settingsCacheLock.lockForRead();
     if (d->useSettingsCache)
     {
@@ -585,6 +805,9 @@ QString MythDB::GetSettingOnHost(const QString &_key, const QString &_host,
         {
             value = *it;
             d->settingsCacheLock.unlock();
+            value.detach();
+            if (tcache)
+                (*tcache)[myKey] = value;
             return value;
         }
     }
@@ -633,6 +856,8 @@ QString MythDB::GetSettingOnHost(const QString &_key, const QString &_host,
         if (d->settingsCache.find(myKey) == d->settingsCache.end())
             d->settingsCache[myKey] = value;
         d->settingsCacheLock.unlock();
+        if (tcache)
+            (*tcache)[myKey] = value;
     }
 
     return value;
@@ -775,6 +1000,8 @@ void MythDB::OverrideSettingForSession(
     d->settingsCache[mk]      = mv;
     d->settingsCache[mk2]     = mv;
     d->settingsCacheLock.unlock();
+
+    d->settingsCacheGeneration.fetchAndAddOrdered(1);
 }
 
 static void clear(
@@ -832,6 +1059,8 @@ void MythDB::ClearSettingsCache(const QString &_key)
     }
 
     d->settingsCacheLock.unlock();
+
+    d->settingsCacheGeneration.fetchAndAddOrdered(1);
 }
 
 void MythDB::ActivateSettingsCache(bool activate)
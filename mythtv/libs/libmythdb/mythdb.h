@@ -43,6 +43,8 @@ class MPUBLIC MythDB
                            const QString &host);
 
     bool GetSettings(QMap<QString,QString> &_key_value_pairs);
+    bool GetSettingsOnHost(QMap<QString,QString> &_key_value_pairs,
+                           const QString &_host);
 
     QString GetSetting(     const QString &key, const QString &defaultval);
     int     GetNumSetting(  const QString &key, int            defaultval);
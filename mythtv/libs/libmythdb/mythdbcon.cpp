@@ -4,19 +4,24 @@
 // Qt
 #include <QVector>
 #include <QSqlDriver>
-#include <QSemaphore>
 #include <QSqlError>
 #include <QSqlField>
 #include <QSqlRecord>
+#include <QThread>
 
 // MythTV
 #include "compat.h"
 #include "mythdbcon.h"
 #include "mythdb.h"
 #include "mythverbose.h"
+#include "mythprofile.h"
 
 static const uint kPurgeTimeout = 60 * 60;
 
+/// Largest number of distinct statements cached per connection before
+/// the cache is discarded and rebuilt.
+static const int kPreparedCacheLimit = 100;
+
 MSqlDatabase::MSqlDatabase(const QString &name)
 {
     m_name = name;
@@ -35,6 +40,7 @@ MSqlDatabase::~MSqlDatabase()
 {
     if (m_db.isOpen())
     {
+        ClearPreparedCache();
         m_db.close();
         m_db = QSqlDatabase();  // forces a destroy and must be done before
                                 // removeDatabase() so that connections
@@ -173,6 +179,7 @@ bool MSqlDatabase::KickDatabase()
 
         if (i == 0)
         {
+            ClearPreparedCache();
             m_db.close();
             m_db.open();
         }
@@ -187,6 +194,7 @@ bool MSqlDatabase::KickDatabase()
 
 bool MSqlDatabase::Reconnect()
 {
+    ClearPreparedCache();
     m_db.close();
     m_db.open();
 
@@ -197,6 +205,43 @@ bool MSqlDatabase::Reconnect()
     return open;
 }
 
+/** \brief Copies a statement this connection has already prepared
+ *         into target.
+ *
+ *   The copy shares the prepared handle with the cache entry.
+ *   QSqlQuery::prepare() detaches a shared handle, so preparing a
+ *   different statement on the target later does not disturb the
+ *   cached one.
+ *
+ *  \return true if a cached prepared statement was found.
+ */
+bool MSqlDatabase::GetCachedPrepared(const QString &query, QSqlQuery &target)
+{
+    QHash<QString, QSqlQuery>::const_iterator it =
+        m_preparedCache.find(query);
+    if (it == m_preparedCache.end())
+        return false;
+
+    target = *it;
+    return true;
+}
+
+void MSqlDatabase::CachePrepared(const QString &query,
+                                 const QSqlQuery &prepared)
+{
+    if (m_preparedCache.size() >= kPreparedCacheLimit)
+        m_preparedCache.clear();
+
+    m_preparedCache.insert(query, prepared);
+}
+
+/// \brief Drops all cached prepared statements, must be called before
+///        this connection is closed or reopened.
+void MSqlDatabase::ClearPreparedCache(void)
+{
+    m_preparedCache.clear();
+}
+
 // -----------------------------------------------------------------------
 
 
@@ -205,41 +250,44 @@ MDBManager::MDBManager()
 {
     m_nextConnID = 0;
     m_connCount = 0;
-
-    m_sem = new QSemaphore(20);
-
-    m_schedCon = NULL;
-    m_DDCon = NULL;
 }
 
 MDBManager::~MDBManager()
 {
-    while (!m_pool.isEmpty())
-        delete m_pool.takeFirst();
-    delete m_sem;
+    QHash<QThread*, QList<MSqlDatabase*> >::iterator pit = m_pool.begin();
+    for (; pit != m_pool.end(); ++pit)
+    {
+        while (!(*pit).isEmpty())
+            delete (*pit).takeFirst();
+    }
+
+    QHash<QThread*, MSqlDatabase*>::iterator it = m_schedCons.begin();
+    for (; it != m_schedCons.end(); ++it)
+        delete *it;
 
-    delete m_schedCon;
-    delete m_DDCon;
+    for (it = m_DDCons.begin(); it != m_DDCons.end(); ++it)
+        delete *it;
 }
 
 MSqlDatabase *MDBManager::popConnection()
 {
     PurgeIdleConnections();
 
-    m_sem->acquire();
     m_lock.lock();
 
     MSqlDatabase *db;
+    QList<MSqlDatabase*> &list = m_pool[QThread::currentThread()];
 
-    if (m_pool.isEmpty())
+    if (list.isEmpty())
     {
         db = new MSqlDatabase("DBManager" + QString::number(m_nextConnID++));
         ++m_connCount;
+        MYTH_PROFILE_COUNT("db_connections_opened", 1);
         VERBOSE(VB_IMPORTANT,
                 QString("New DB connection, total: %1").arg(m_connCount));
     }
     else
-        db = m_pool.takeLast();
+        db = list.takeLast();
 
     m_lock.unlock();
 
@@ -255,11 +303,10 @@ void MDBManager::pushConnection(MSqlDatabase *db)
     if (db)
     {
         db->m_lastDBKick = QDateTime::currentDateTime();
-        m_pool.prepend(db);
+        m_pool[QThread::currentThread()].prepend(db);
     }
 
     m_lock.unlock();
-    m_sem->release();
 
     PurgeIdleConnections();
 }
@@ -269,54 +316,58 @@ void MDBManager::PurgeIdleConnections(void)
     QMutexLocker locker(&m_lock);
 
     QDateTime now = QDateTime::currentDateTime();
-    QList<MSqlDatabase*>::iterator it = m_pool.begin();
 
     uint purgedConnections = 0, totalConnections = 0;
     MSqlDatabase *newDb = NULL;
-    while (it != m_pool.end())
+    QHash<QThread*, QList<MSqlDatabase*> >::iterator pit = m_pool.begin();
+    for (; pit != m_pool.end(); ++pit)
     {
-        totalConnections++;
-        if ((*it)->m_lastDBKick.secsTo(now) <= (int)kPurgeTimeout)
+        QList<MSqlDatabase*>::iterator it = (*pit).begin();
+        while (it != (*pit).end())
         {
-            ++it;
-            continue;
-        }
+            totalConnections++;
+            if ((*it)->m_lastDBKick.secsTo(now) <= (int)kPurgeTimeout)
+            {
+                ++it;
+                continue;
+            }
 
-        // This connection has not been used in the kPurgeTimeout
-        // seconds close it.
-        MSqlDatabase *entry = *it;
-        it = m_pool.erase(it);
-        --m_connCount;
-        purgedConnections++;
-
-        // Qt's MySQL driver apparently keeps track of the number of
-        // open DB connections, and when it hits 0, calls
-        // my_thread_global_end().  The mysql library then assumes the
-        // application is ending and that all threads that created DB
-        // connections have already exited.  This is rarely true, and
-        // may result in the mysql library pausing 5 seconds and
-        // printing a message like "Error in my_thread_global_end(): 1
-        // threads didn't exit".  This workaround simply creates an
-        // extra DB connection before all pooled connections are
-        // purged so that my_thread_global_end() won't be called.
-        if (it == m_pool.end() &&
-            purgedConnections > 0 &&
-            totalConnections == purgedConnections)
-        {
-            newDb = new MSqlDatabase("DBManager" +
-                                     QString::number(m_nextConnID++));
-            ++m_connCount;
-            VERBOSE(VB_IMPORTANT,
-                    QString("New DB connection, total: %1").arg(m_connCount));
-            newDb->m_lastDBKick = QDateTime::currentDateTime();
+            // This connection has not been used in the kPurgeTimeout
+            // seconds close it.  This also collects the connections
+            // of threads that have exited.
+            MSqlDatabase *entry = *it;
+            it = (*pit).erase(it);
+            --m_connCount;
+            purgedConnections++;
+
+            VERBOSE(VB_DATABASE, "Deleting idle DB connection...");
+            delete entry;
+            VERBOSE(VB_DATABASE, "Done deleting idle DB connection.");
         }
+    }
 
-        VERBOSE(VB_DATABASE, "Deleting idle DB connection...");
-        delete entry;
-        VERBOSE(VB_DATABASE, "Done deleting idle DB connection.");
+    // Qt's MySQL driver apparently keeps track of the number of
+    // open DB connections, and when it hits 0, calls
+    // my_thread_global_end().  The mysql library then assumes the
+    // application is ending and that all threads that created DB
+    // connections have already exited.  This is rarely true, and
+    // may result in the mysql library pausing 5 seconds and
+    // printing a message like "Error in my_thread_global_end(): 1
+    // threads didn't exit".  This workaround simply creates an
+    // extra DB connection before all pooled connections are
+    // purged so that my_thread_global_end() won't be called.
+    if (purgedConnections > 0 &&
+        totalConnections == purgedConnections &&
+        m_schedCons.isEmpty() && m_DDCons.isEmpty())
+    {
+        newDb = new MSqlDatabase("DBManager" +
+                                 QString::number(m_nextConnID++));
+        ++m_connCount;
+        VERBOSE(VB_IMPORTANT,
+                QString("New DB connection, total: %1").arg(m_connCount));
+        newDb->m_lastDBKick = QDateTime::currentDateTime();
+        m_pool[QThread::currentThread()].push_front(newDb);
     }
-    if (newDb)
-        m_pool.push_front(newDb);
 
     if (purgedConnections)
     {
@@ -328,28 +379,35 @@ void MDBManager::PurgeIdleConnections(void)
 
 MSqlDatabase *MDBManager::getSchedCon()
 {
-    if (!m_schedCon)
+    QMutexLocker locker(&m_lock);
+
+    MSqlDatabase *&db = m_schedCons[QThread::currentThread()];
+    if (!db)
     {
-        m_schedCon = new MSqlDatabase("SchedCon");
+        db = new MSqlDatabase("SchedCon" + QString::number(m_nextConnID++));
         VERBOSE(VB_IMPORTANT, "New DB scheduler connection");
     }
 
-    m_schedCon->OpenDatabase();
+    db->OpenDatabase();
 
-    return m_schedCon;
+    return db;
 }
 
 MSqlDatabase *MDBManager::getDDCon()
 {
-    if (!m_DDCon)
+    QMutexLocker locker(&m_lock);
+
+    MSqlDatabase *&db = m_DDCons[QThread::currentThread()];
+    if (!db)
     {
-        m_DDCon = new MSqlDatabase("DataDirectCon");
+        db = new MSqlDatabase("DataDirectCon" +
+                              QString::number(m_nextConnID++));
         VERBOSE(VB_IMPORTANT, "New DB DataDirect connection");
     }
 
-    m_DDCon->OpenDatabase();
+    db->OpenDatabase();
 
-    return m_DDCon;
+    return db;
 }
 
 // Dangerous. Should only be used when the database connection has errored?
@@ -358,16 +416,18 @@ void MDBManager::CloseDatabases()
 {
     m_lock.lock();
 
-    QList<MSqlDatabase*>::const_iterator it = m_pool.begin();
-    MSqlDatabase *db;
-
-    while (it != m_pool.end())
+    QHash<QThread*, QList<MSqlDatabase*> >::iterator pit = m_pool.begin();
+    for (; pit != m_pool.end(); ++pit)
     {
-        db = *it;
-        VERBOSE(VB_IMPORTANT,
-                "Closing DB connection named '" + db->m_name + '\'');
-        db->m_db.close();
-        ++it;
+        QList<MSqlDatabase*>::const_iterator it = (*pit).begin();
+        for (; it != (*pit).end(); ++it)
+        {
+            MSqlDatabase *db = *it;
+            VERBOSE(VB_IMPORTANT,
+                    "Closing DB connection named '" + db->m_name + '\'');
+            db->ClearPreparedCache();
+            db->m_db.close();
+        }
     }
 
     m_lock.unlock();
@@ -400,6 +460,10 @@ MSqlQuery::MSqlQuery(const MSqlQueryInfo &qi)
 
 MSqlQuery::~MSqlQuery()
 {
+    // Free any fetched result data now; the statement itself may live
+    // on in the connection's prepared statement cache.
+    finish();
+
     if (m_returnConnection)
     {
         MDBManager *dbmanager = GetMythDB()->GetDBManager();
@@ -493,6 +557,8 @@ bool MSqlQuery::exec()
 
     bool result = QSqlQuery::exec();
 
+    MYTH_PROFILE_COUNT("db_queries", 1);
+
     // if the query failed with "MySQL server has gone away"
     // Close and reopen the database connection and retry the query if it
     // connects again
@@ -537,6 +603,8 @@ bool MSqlQuery::exec(const QString &query)
 
     bool result = QSqlQuery::exec(query);
 
+    MYTH_PROFILE_COUNT("db_queries", 1);
+
     // if the query failed with "MySQL server has gone away"
     // Close and reopen the database connection and retry the query if it
     // connects again
@@ -600,6 +668,12 @@ bool MSqlQuery::prepare(const QString& query)
         return false;
     }
 
+    // Reuse a statement this connection has already prepared.  The
+    // backend executes the same few statement shapes over and over,
+    // and each fresh prepare() costs a round trip to the server.
+    if (m_db->GetCachedPrepared(query, *this))
+        return true;
+
     bool ok = QSqlQuery::prepare(query);
 
     // if the prepare failed with "MySQL server has gone away"
@@ -614,6 +688,9 @@ bool MSqlQuery::prepare(const QString& query)
         VERBOSE(VB_IMPORTANT, MythDB::DBErrorMessage(QSqlQuery::lastError()));
     }
 
+    if (ok)
+        m_db->CachePrepared(query, *this);
+
     return ok;
 }
 
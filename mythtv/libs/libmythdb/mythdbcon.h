@@ -8,10 +8,12 @@
 #include <QDateTime>
 #include <QMutex>
 #include <QList>
+#include <QHash>
 
 #include "mythexp.h"
 
 class QSemaphore;
+class QThread;
 
 /// \brief QSqlDatabase wrapper, used by MSqlQuery. Do not use directly.
 class MPUBLIC MSqlDatabase
@@ -29,11 +31,17 @@ class MPUBLIC MSqlDatabase
     QString GetConnectionName(void) const { return m_name; }
     QSqlDatabase db(void) const { return m_db; }
     bool Reconnect(void);
+    bool GetCachedPrepared(const QString &query, QSqlQuery &target);
+    void CachePrepared(const QString &query, const QSqlQuery &prepared);
+    void ClearPreparedCache(void);
 
   private:
     QString m_name;
     QSqlDatabase m_db;
     QDateTime m_lastDBKick;
+    /// Statements already prepared on this connection, keyed by the
+    /// query text. \sa MSqlQuery::prepare(const QString&)
+    QHash<QString, QSqlQuery> m_preparedCache;
 };
 
 /// \brief DB connection pool, used by MSqlQuery. Do not use directly.
@@ -55,14 +63,18 @@ class MPUBLIC MDBManager
     MSqlDatabase *getDDCon(void);
 
   private:
-    QList<MSqlDatabase*> m_pool;
+    /// Connections are thread-affine: each thread pops from and
+    /// pushes to its own list, so pool traffic from one thread never
+    /// contends with another beyond the brief list manipulation, and
+    /// a QSqlDatabase is only ever used from the thread it was
+    /// created on.
+    QHash<QThread*, QList<MSqlDatabase*> > m_pool; // protected by m_lock
     QMutex m_lock;
-    QSemaphore *m_sem;
     int m_nextConnID;
     int m_connCount;
 
-    MSqlDatabase *m_schedCon;
-    MSqlDatabase *m_DDCon;
+    QHash<QThread*, MSqlDatabase*> m_schedCons; // protected by m_lock
+    QHash<QThread*, MSqlDatabase*> m_DDCons;    // protected by m_lock
 };
 
 /// \brief MSqlDatabase Info, used by MSqlQuery. Do not use directly.
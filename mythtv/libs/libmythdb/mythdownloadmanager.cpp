@@ -180,6 +180,11 @@ void MythDownloadManager::run(void)
     m_diskCache->setCacheDirectory(GetConfDir() + "/Cache-" +
                                    gCoreContext->GetAppName() + "-" +
                                    gCoreContext->GetHostName());
+    // Qt's default cap is 50MB, too small to keep a nightly metadata
+    // and artwork refresh cached between runs.  Cached entries are
+    // revalidated with If-Modified-Since/ETag, so growing the cache
+    // trades disk for repeated transfers of unchanged resources.
+    m_diskCache->setMaximumCacheSize(100 * 1024 * 1024);
     m_manager->setCache(m_diskCache);
 
 
@@ -335,6 +340,27 @@ void MythDownloadManager::queueDownload(const QString &url,
     queueItem(url, NULL, dest, NULL, caller, false, reload);
 }
 
+/** \fn MythDownloadManager::queueDownload(const QString &url,
+                                           QByteArray *data,
+                                           QObject *caller,
+                                           const bool reload)
+ *  \brief Adds a url to the download queue, storing the result in memory.
+ *  \param url      URI to download.
+ *  \param data     Location to store download data
+ *  \param caller   QObject to receive event notifications.
+ *  \param reload   Whether to force reloading of the URL or not
+ */
+void MythDownloadManager::queueDownload(const QString &url,
+                                        QByteArray *data,
+                                        QObject *caller,
+                                        const bool reload)
+{
+    VERBOSE(VB_FILE+VB_EXTRA, LOC + QString("queueDownload('%1', '%2', %3)")
+            .arg(url).arg((long long)data).arg((long long)caller));
+
+    queueItem(url, NULL, QString(), data, caller, false, reload);
+}
+
 /** \fn MythDownloadManager::queueDownload(QNetworkRequest &request,
                                            QByteArray *data,
                                            QObject *caller)
@@ -33,6 +33,8 @@ class MPUBLIC MythDownloadManager : public QThread
     void preCache(const QString &url);
     void queueDownload(const QString &url, const QString &dest,
                        QObject *caller, const bool reload = false);
+    void queueDownload(const QString &url, QByteArray *data,
+                       QObject *caller, const bool reload = false);
     void queueDownload(QNetworkRequest *req, QByteArray *data,
                        QObject *caller);
     bool download(const QString &url, const QString &dest,
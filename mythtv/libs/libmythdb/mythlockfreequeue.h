@@ -0,0 +1,189 @@
+// -*- Mode: c++ -*-
+
+#ifndef MYTH_LOCK_FREE_QUEUE_H
+#define MYTH_LOCK_FREE_QUEUE_H
+
+#include <QAtomicInt>
+#include <QMutex>
+#include <QString>
+#include <QWaitCondition>
+
+template<typename T>
+inline T myth_lfq_init(const T*) { return (T)(0); }
+template<>
+inline QString myth_lfq_init(const QString*) { return QString(); }
+
+/** \class MythLockFreeQueue
+ *  \brief Bounded queue for inter-thread handoff without a mutex.
+ *
+ *  A companion to MythDeque for producer/consumer pairs hot enough
+ *  that a mutex acquisition per item shows up in profiles.  Every
+ *  slot of the ring carries a sequence counter (this is Dmitry
+ *  Vyukov's bounded MPMC queue), so an enqueue or dequeue is one
+ *  compare-and-swap on the ring index plus a release store on the
+ *  slot; producers and consumers never block one another and any
+ *  number of each is safe.
+ *
+ *  The capacity is fixed at construction.  enqueue() returns false
+ *  when the ring is full and the caller decides whether to drop or
+ *  fall back; dequeue() mirrors MythDeque and returns a default
+ *  constructed value when the queue is empty.  There is deliberately
+ *  no clear(), find() or remove() -- users that reset or inspect a
+ *  queue from a third thread need a mutex anyway and are better off
+ *  with MythDeque.
+ */
+template<typename T>
+class MythLockFreeQueue
+{
+  public:
+    /// Capacity is rounded up to the next power of two.
+    MythLockFreeQueue(uint capacity) :
+        m_enqueue_pos(0), m_dequeue_pos(0), m_sleepers(0)
+    {
+        m_capacity = 1;
+        while (m_capacity < capacity)
+            m_capacity <<= 1;
+        m_mask = m_capacity - 1;
+
+        m_cells = new Cell[m_capacity];
+        for (uint i = 0; i < m_capacity; i++)
+            m_cells[i].sequence = (int)i;
+    }
+
+    ~MythLockFreeQueue()
+    {
+        delete [] m_cells;
+    }
+
+    /// \brief Adds item to the back of the queue. O(1).
+    ///        Returns false, without blocking, when the queue is full.
+    bool enqueue(T d)
+    {
+        Cell *cell;
+        int pos = (int)m_enqueue_pos;
+        for (;;)
+        {
+            cell = &m_cells[(uint)pos & m_mask];
+            int dif = cell->sequence.fetchAndAddAcquire(0) - pos;
+            if (!dif)
+            {
+                if (m_enqueue_pos.testAndSetRelaxed(pos, pos + 1))
+                    break;
+                pos = (int)m_enqueue_pos;
+            }
+            else if (dif < 0)
+            {
+                return false; // a full lap behind the consumer
+            }
+            else
+            {
+                pos = (int)m_enqueue_pos; // lost the race, reload
+            }
+        }
+
+        cell->data = d;
+        cell->sequence.fetchAndStoreRelease(pos + 1);
+
+        // Only sleeping consumers cost a mutex round trip, see
+        // WaitForData().
+        if (m_sleepers.fetchAndAddOrdered(0))
+        {
+            QMutexLocker locker(&m_wait_lock);
+            m_wait.wakeAll();
+        }
+
+        return true;
+    }
+
+    /// \brief Removes item from the front of the queue and returns a
+    ///        copy, or a default constructed value when the queue is
+    ///        empty. O(1), never blocks.
+    T dequeue(void)
+    {
+        Cell *cell;
+        int pos = (int)m_dequeue_pos;
+        for (;;)
+        {
+            cell = &m_cells[(uint)pos & m_mask];
+            int dif = cell->sequence.fetchAndAddAcquire(0) - (pos + 1);
+            if (!dif)
+            {
+                if (m_dequeue_pos.testAndSetRelaxed(pos, pos + 1))
+                    break;
+                pos = (int)m_dequeue_pos;
+            }
+            else if (dif < 0)
+            {
+                T *dummy = NULL;
+                return myth_lfq_init(dummy); // empty
+            }
+            else
+            {
+                pos = (int)m_dequeue_pos;
+            }
+        }
+
+        T item = cell->data;
+        cell->data = myth_lfq_init((T*)(NULL)); // drop the slot's copy
+        cell->sequence.fetchAndStoreRelease(pos + (int)m_capacity);
+        return item;
+    }
+
+    /// \brief Waits until the queue is non empty or time_ms has
+    ///        passed, returns true when data is available.
+    bool WaitForData(unsigned long time_ms)
+    {
+        QMutexLocker locker(&m_wait_lock);
+        if (!isEmpty())
+            return true;
+
+        // Producers only take m_wait_lock while this is set; the
+        // recheck after the full barrier catches an enqueue that read
+        // the flag just before we raised it.
+        m_sleepers.fetchAndAddOrdered(1);
+        if (!isEmpty())
+        {
+            m_sleepers.fetchAndAddOrdered(-1);
+            return true;
+        }
+
+        m_wait.wait(&m_wait_lock, time_ms);
+        m_sleepers.fetchAndAddOrdered(-1);
+        return !isEmpty();
+    }
+
+    /// \brief Returns true when no items are queued.  Exact only if
+    ///        the producers or the consumers are quiescent.
+    bool isEmpty(void) const
+        { return (int)m_dequeue_pos == (int)m_enqueue_pos; }
+
+    /// \brief Returns the number of queued items, with the same
+    ///        caveat as isEmpty().
+    uint count(void) const
+        { return (uint)((int)m_enqueue_pos - (int)m_dequeue_pos); }
+
+    /// \brief Returns the capacity the constructor's argument was
+    ///        rounded up to.
+    uint capacity(void) const { return m_capacity; }
+
+  private:
+    MythLockFreeQueue(const MythLockFreeQueue&);            // not copyable
+    MythLockFreeQueue &operator=(const MythLockFreeQueue&); // not copyable
+
+    struct Cell
+    {
+        QAtomicInt sequence;
+        T          data;
+    };
+
+    Cell          *m_cells;
+    uint           m_capacity;
+    uint           m_mask;
+    QAtomicInt     m_enqueue_pos;
+    QAtomicInt     m_dequeue_pos;
+    QAtomicInt     m_sleepers;
+    QMutex         m_wait_lock;
+    QWaitCondition m_wait;
+};
+
+#endif // MYTH_LOCK_FREE_QUEUE_H
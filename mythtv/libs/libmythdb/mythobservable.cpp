@@ -1,9 +1,42 @@
 #include <QCoreApplication>
 #include <QObject>
 #include <QMutex>
+#include <QHash>
 
 #include "mythobservable.h"
 
+/// Bookkeeping for dispatch() coalescing, keyed on listener and
+/// coalesce key. Counts are decremented from the event destructor,
+/// which Qt runs once the event has been delivered or discarded.
+/// This is static so it can safely outlive any observable which
+/// still has events in flight.
+static QMutex coalesce_lock;
+static QHash<QString,int> coalesce_pending;
+
+/** \class CoalescedMythEvent
+ *  \brief MythEvent that clears its pending mark once delivered.
+ *
+ *  Note that this only carries the message and extra data, so only
+ *  plain MythEvents may be dispatched with a coalesce key.
+ */
+class CoalescedMythEvent : public MythEvent
+{
+  public:
+    CoalescedMythEvent(const MythEvent &event, const QString &key) :
+        MythEvent(event.Message(), event.ExtraDataList()), m_key(key) { }
+
+    virtual ~CoalescedMythEvent()
+    {
+        QMutexLocker locker(&coalesce_lock);
+        QHash<QString,int>::iterator it = coalesce_pending.find(m_key);
+        if ((it != coalesce_pending.end()) && (--(*it) <= 0))
+            coalesce_pending.erase(it);
+    }
+
+  private:
+    QString m_key;
+};
+
 /** \class MythObservable
  *  \brief Superclass for making an object have a set of listeners
  *
@@ -83,6 +116,48 @@ void MythObservable::dispatch(const MythEvent &event)
         QCoreApplication::postEvent(*it, event.clone());
 }
 
+/** \brief Dispatch an event to all listeners, coalescing duplicates
+ *
+ *  Same as dispatch(const MythEvent&), except that a listener which
+ *  still has an undelivered event with the same coalesce key does not
+ *  get another copy posted. This keeps a high rate of identical
+ *  notifications from piling up in the queue of a listener that is
+ *  slow to service them, without ever delaying delivery; it must only
+ *  be used for events where a duplicate carries no new information.
+ *
+ *  \param event       plain MythEvent to dispatch.
+ *  \param coalesceKey key identifying duplicates, empty to disable
+ *                     coalescing.
+ */
+void MythObservable::dispatch(const MythEvent &event,
+                              const QString &coalesceKey)
+{
+    if (coalesceKey.isEmpty())
+    {
+        dispatch(event);
+        return;
+    }
+
+    QMutexLocker locker(m_lock);
+
+    QSet<QObject*>::const_iterator it = m_listeners.begin();
+    for (; it != m_listeners.end() ; ++it)
+    {
+        QString key = QString("%1\n%2")
+            .arg((quintptr)(*it)).arg(coalesceKey);
+
+        {
+            QMutexLocker pending(&coalesce_lock);
+            QHash<QString,int>::iterator cit = coalesce_pending.find(key);
+            if ((cit != coalesce_pending.end()) && (*cit > 0))
+                continue; // identical event still undelivered, skip
+            coalesce_pending[key] = 1;
+        }
+
+        QCoreApplication::postEvent(*it, new CoalescedMythEvent(event, key));
+    }
+}
+
 /** \brief Dispatch an event to all listeners
  *
  *  This sends an event using the current thread, this is
@@ -18,6 +18,7 @@ class MPUBLIC MythObservable
     void removeListener(QObject *listener);
 
     void dispatch(const MythEvent &event);
+    void dispatch(const MythEvent &event, const QString &coalesceKey);
     void dispatchNow(const MythEvent &event) MDEPRECATED;
 
     bool hasListeners(void) { return !m_listeners.isEmpty(); }
@@ -0,0 +1,171 @@
+#include <cstdlib>  // for getenv()
+
+#include <QList>
+#include <QMutexLocker>
+
+#include "mythprofile.h"
+#include "compat.h"  // for gettimeofday() on Windows
+
+// All zones register here so the status queries can walk them.  Zones
+// are function-local statics, so they live until the process exits.
+static QMutex zone_registry_lock;
+static QList<MythProfileZone*> zone_registry;
+
+bool MythProfileZone::s_enabled = getenv("MYTH_PROFILE") != NULL;
+
+static quint64 now_usecs(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (quint64)tv.tv_sec * 1000000ULL + tv.tv_usec;
+}
+
+MythProfileZone::MythProfileZone(const QString &name) :
+    m_name(name)
+{
+    reset();
+
+    QMutexLocker locker(&zone_registry_lock);
+    zone_registry.append(this);
+}
+
+MythProfileZone::~MythProfileZone()
+{
+    QMutexLocker locker(&zone_registry_lock);
+    zone_registry.removeAll(this);
+}
+
+void MythProfileZone::reset(void)
+{
+    QMutexLocker locker(&m_lock);
+
+    m_count   = 0;
+    m_totalUs = 0;
+    m_minUs   = 0;
+    m_maxUs   = 0;
+    for (int i = 0; i < kNumBuckets; i++)
+        m_buckets[i] = 0;
+}
+
+void MythProfileZone::AddSample(quint64 usecs)
+{
+    // bucket i holds samples in [2^i, 2^(i+1)) microseconds
+    int bucket = 0;
+    while ((usecs >> (bucket + 1)) && (bucket < kNumBuckets - 1))
+        bucket++;
+
+    QMutexLocker locker(&m_lock);
+
+    m_count++;
+    m_totalUs += usecs;
+    if ((m_count == 1) || (usecs < m_minUs))
+        m_minUs = usecs;
+    if (usecs > m_maxUs)
+        m_maxUs = usecs;
+    m_buckets[bucket]++;
+}
+
+QString MythProfileZone::getReportLine(void) const
+{
+    QMutexLocker locker(&m_lock);
+
+    if (!m_count)
+        return QString("%1 count 0").arg(m_name);
+
+    QString line = QString("%1 count %2 total %3us avg %4us min %5us max %6us")
+        .arg(m_name).arg(m_count).arg(m_totalUs)
+        .arg(m_totalUs / m_count).arg(m_minUs).arg(m_maxUs);
+
+    // print the histogram up to the last occupied bucket, each entry
+    // is labelled with the bucket's upper bound
+    int last = kNumBuckets - 1;
+    while (last > 0 && !m_buckets[last])
+        last--;
+
+    for (int i = 0; i <= last; i++)
+        line += QString(" <%1us:%2").arg(1 << (i + 1)).arg(m_buckets[i]);
+
+    return line;
+}
+
+QString MythProfileZone::GetReport(void)
+{
+    QMutexLocker locker(&zone_registry_lock);
+
+    QString report;
+    QList<MythProfileZone*>::const_iterator it = zone_registry.begin();
+    for (; it != zone_registry.end(); ++it)
+    {
+        if (!report.isEmpty())
+            report += '\n';
+        report += (*it)->getReportLine();
+    }
+
+    return report;
+}
+
+void MythProfileZone::ResetAll(void)
+{
+    QMutexLocker locker(&zone_registry_lock);
+
+    QList<MythProfileZone*>::const_iterator it = zone_registry.begin();
+    for (; it != zone_registry.end(); ++it)
+        (*it)->reset();
+}
+
+static QMutex counter_registry_lock;
+static QList<MythProfileCounter*> counter_registry;
+
+MythProfileCounter::MythProfileCounter(const QString &name) :
+    m_name(name), m_value(0)
+{
+    QMutexLocker locker(&counter_registry_lock);
+    counter_registry.append(this);
+}
+
+MythProfileCounter::~MythProfileCounter()
+{
+    QMutexLocker locker(&counter_registry_lock);
+    counter_registry.removeAll(this);
+}
+
+void MythProfileCounter::Add(quint64 amount)
+{
+    QMutexLocker locker(&m_lock);
+    m_value += amount;
+}
+
+QString MythProfileCounter::GetReport(void)
+{
+    QMutexLocker locker(&counter_registry_lock);
+
+    QString report;
+    QList<MythProfileCounter*>::const_iterator it = counter_registry.begin();
+    for (; it != counter_registry.end(); ++it)
+    {
+        QMutexLocker value_locker(&(*it)->m_lock);
+
+        if (!report.isEmpty())
+            report += '\n';
+        report += QString("%1 %2").arg((*it)->m_name).arg((*it)->m_value);
+    }
+
+    return report;
+}
+
+MythProfileScope::MythProfileScope(MythProfileZone &zone) :
+    m_zone(zone), m_startUs(0)
+{
+    if (MythProfileZone::IsEnabled())
+        m_startUs = now_usecs();
+}
+
+MythProfileScope::~MythProfileScope()
+{
+    // samples started before collection was turned on are dropped,
+    // their start time was never taken
+    if (m_startUs && MythProfileZone::IsEnabled())
+        m_zone.AddSample(now_usecs() - m_startUs);
+}
+
+/* vim: set expandtab tabstop=4 shiftwidth=4: */
@@ -0,0 +1,112 @@
+#ifndef MYTHPROFILE_H_
+#define MYTHPROFILE_H_
+
+#include <QMutex>
+#include <QString>
+
+#include "mythexp.h"
+
+/** \class MythProfileZone
+ *  \brief Aggregated timing statistics for one named hot path.
+ *
+ *  Zones are normally created through the MYTH_PROFILE_SCOPE macro,
+ *  which times the rest of the enclosing scope with a MythProfileScope.
+ *  Each zone keeps a count, total, minimum, maximum and a power of two
+ *  histogram of the sample times, all in microseconds.
+ *
+ *  Collection is off by default and costs a single boolean test per
+ *  scope until it is turned on with SetEnabled(), the MYTH_PROFILE
+ *  environment variable, or one of the status queries ("query profile"
+ *  on the frontend network control socket, QUERY_PROFILE in the
+ *  backend protocol).
+ */
+class MPUBLIC MythProfileZone
+{
+  public:
+    MythProfileZone(const QString &name);
+    ~MythProfileZone();
+
+    void AddSample(quint64 usecs);
+
+    static void SetEnabled(bool enable) { s_enabled = enable; }
+    static bool IsEnabled(void) { return s_enabled; }
+
+    /// Returns one formatted line per zone, for the status queries.
+    static QString GetReport(void);
+    /// Zeroes the statistics collected so far in every zone.
+    static void ResetAll(void);
+
+    // 1us .. ~2s in power of two steps, slower samples land in the
+    // last bucket
+    enum { kNumBuckets = 21 };
+
+  private:
+    QString getReportLine(void) const;
+    void reset(void);
+
+    QString        m_name;
+    mutable QMutex m_lock;
+    quint64        m_count;
+    quint64        m_totalUs;
+    quint64        m_minUs;
+    quint64        m_maxUs;
+    quint64        m_buckets[kNumBuckets];
+
+    static bool s_enabled;
+};
+
+/** \class MythProfileCounter
+ *  \brief A named counter maintained passively on the path it describes.
+ *
+ *  Unlike the zones, counters are always on; an update is just a
+ *  locked 64 bit add, cheap enough for per-write and per-query paths.
+ *  Reading them (the backend's Metrics endpoint, see httpstatus.cpp)
+ *  costs nothing beyond formatting, so they are suitable for scraping
+ *  every few seconds.  Use through the MYTH_PROFILE_COUNT macro.
+ */
+class MPUBLIC MythProfileCounter
+{
+  public:
+    MythProfileCounter(const QString &name);
+    ~MythProfileCounter();
+
+    void Add(quint64 amount);
+
+    /// Returns one "name value" line per counter.
+    static QString GetReport(void);
+
+  private:
+    QString        m_name;
+    mutable QMutex m_lock;
+    quint64        m_value;
+};
+
+/// Times the scope it lives in and adds the result to a zone,
+/// see the MYTH_PROFILE_SCOPE macro.
+class MPUBLIC MythProfileScope
+{
+  public:
+    MythProfileScope(MythProfileZone &zone);
+    ~MythProfileScope();
+
+  private:
+    MythProfileZone &m_zone;
+    quint64          m_startUs; // 0 when collection was off at entry
+};
+
+/// Declares a static profile zone and times the rest of the
+/// enclosing scope under the given name.
+#define MYTH_PROFILE_SCOPE(name) \
+    static MythProfileZone myth_prof_zone(name); \
+    MythProfileScope myth_prof_scope(myth_prof_zone)
+
+/// Adds an amount to the named counter.
+#define MYTH_PROFILE_COUNT(name, amount) \
+    do { \
+        static MythProfileCounter myth_prof_counter(name); \
+        myth_prof_counter.Add(amount); \
+    } while (0)
+
+#endif
+
+/* vim: set expandtab tabstop=4 shiftwidth=4: */
@@ -1,5 +1,6 @@
 // ANSI C
 #include <cstdlib>
+#include <cstring>
 #include <cassert>
 #include <cerrno>
 
@@ -14,6 +15,7 @@
 #include <QByteArray>
 #include <QHostInfo>
 #include <QMap>
+#include <QtEndian>
 
 // MythTV
 #include "mythsocketthread.h"
@@ -21,6 +23,7 @@
 #include "mythtimer.h"
 #include "mythsocket.h"
 #include "mythverbose.h"
+#include "mythprofile.h"
 
 #define SLOC(a) QString("MythSocket(%1:%2): ")\
                     .arg((quint64)a, 0, 16).arg(a->socket())
@@ -30,10 +33,39 @@ const uint MythSocket::kSocketBufferSize = 128000;
 const uint MythSocket::kShortTimeout = kMythSocketShortTimeout;
 const uint MythSocket::kLongTimeout  = kMythSocketLongTimeout;
 
+/** The binary string list encoding replaces the "[]:[]"-joined UTF-8
+ *  blob inside the usual 8 byte ASCII size framing with:
+ *
+ *    8 byte magic, quint32 field count, then per field a quint32
+ *    byte length followed by that many UTF-8 bytes.
+ *
+ *  All integers are little-endian. The magic contains a NUL so it can
+ *  never collide with the first token of a joined text payload, which
+ *  lets readStringList() accept either encoding unconditionally;
+ *  writing it requires negotiation (see setBinaryMode()).
+ */
+static const char kBinaryListMagic[8] = {
+    'M', 'y', 't', 'h', 'B', 'L', '1', '\0' };
+
+/** Compressed payloads wrap either encoding above in another 8 byte
+ *  magic followed by the output of qCompress(), i.e. zlib deflate
+ *  behind a 4 byte expected-size prefix. As with the binary list
+ *  magic the NUL makes reads self-describing; writing compressed
+ *  requires negotiation (see setCompressedMode()). Guide data and
+ *  recording lists shrink 5-10x, which is what makes WAN frontends
+ *  usable, but small control messages aren't worth the CPU.
+ */
+static const char kCompressedListMagic[8] = {
+    'M', 'y', 't', 'h', 'Z', 'L', '1', '\0' };
+
+/// Payloads smaller than this are never compressed.
+static const int kCompressThreshold = 4096;
+
 MythSocketThread *MythSocket::s_readyread_thread = new MythSocketThread();
 
 MythSocket::MythSocket(int socket, MythSocketCBs *cb)
     : MSocketDevice(MSocketDevice::Stream),            m_cb(cb),
+      m_binary_mode(false),   m_compressed_mode(false),
       m_useReadyReadCallback(true),
       m_state(Idle),         m_addr(),                 m_port(0),
       m_ref_count(0),        m_notifyread(false)
@@ -267,8 +299,69 @@ qint64 MythSocket::writeBlock(const char *data, quint64 len)
     return rval;
 }
 
+QByteArray MythSocket::EncodeStringList(const QStringList &list)
+{
+    QByteArray payload;
+    payload.reserve(sizeof(kBinaryListMagic) + 4 + (list.size() * 16));
+    payload.append(kBinaryListMagic, sizeof(kBinaryListMagic));
+
+    quint32 tmp = qToLittleEndian((quint32) list.size());
+    payload.append((const char*) &tmp, 4);
+
+    QStringList::const_iterator it = list.begin();
+    for (; it != list.end(); ++it)
+    {
+        QByteArray utf8 = (*it).toUtf8();
+        tmp = qToLittleEndian((quint32) utf8.length());
+        payload.append((const char*) &tmp, 4);
+        payload.append(utf8);
+    }
+
+    return payload;
+}
+
+bool MythSocket::IsBinaryList(const QByteArray &payload)
+{
+    return (payload.length() >= (int)(sizeof(kBinaryListMagic) + 4)) &&
+        !memcmp(payload.constData(), kBinaryListMagic,
+                sizeof(kBinaryListMagic));
+}
+
+bool MythSocket::IsCompressedList(const QByteArray &payload)
+{
+    return (payload.length() > (int)sizeof(kCompressedListMagic)) &&
+        !memcmp(payload.constData(), kCompressedListMagic,
+                sizeof(kCompressedListMagic));
+}
+
+bool MythSocket::DecodeStringList(const QByteArray &payload, QStringList &list)
+{
+    const char *data = payload.constData();
+    const char *end  = data + payload.length();
+    data += sizeof(kBinaryListMagic);
+
+    quint32 count = qFromLittleEndian<quint32>((const uchar*) data);
+    data += 4;
+
+    for (quint32 i = 0; i < count; i++)
+    {
+        if ((end - data) < 4)
+            return false;
+        quint32 len = qFromLittleEndian<quint32>((const uchar*) data);
+        data += 4;
+        if ((quint32)(end - data) < len)
+            return false;
+        list.push_back(QString::fromUtf8(data, len));
+        data += len;
+    }
+
+    return true;
+}
+
 bool MythSocket::writeStringList(QStringList &list)
 {
+    MYTH_PROFILE_COUNT("socket_messages_sent", 1);
+
     if (list.size() <= 0)
     {
         VERBOSE(VB_IMPORTANT, LOC +
@@ -283,30 +376,70 @@ bool MythSocket::writeStringList(QStringList &list)
         return false;
     }
 
-    QString str = list.join("[]:[]");
-    if (str.isEmpty())
+    QByteArray utf8;
+    if (m_binary_mode)
     {
-        VERBOSE(VB_IMPORTANT, LOC +
-                "writeStringList: Error, joined null string.");
-        return false;
+        utf8 = EncodeStringList(list);
     }
+    else
+    {
+        QString str = list.join("[]:[]");
+        if (str.isEmpty())
+        {
+            VERBOSE(VB_IMPORTANT, LOC +
+                    "writeStringList: Error, joined null string.");
+            return false;
+        }
+        utf8 = str.toUtf8();
+    }
+
+    int uncompressed_size = 0;
+    if (m_compressed_mode && (utf8.length() >= kCompressThreshold))
+    {
+        QByteArray compressed;
+        compressed.append(kCompressedListMagic, sizeof(kCompressedListMagic));
+        compressed.append(qCompress(utf8));
 
-    QByteArray utf8 = str.toUtf8();
-    int size = utf8.length();
+        // deflate can grow incompressible data, keep whichever is smaller
+        if (compressed.length() < utf8.length())
+        {
+            uncompressed_size = utf8.length();
+            utf8 = compressed;
+        }
+    }
+
+    // 8 byte length header.  The body is written straight out of
+    // utf8 below rather than being copied once more just to prepend
+    // the header -- that copy dominated large QUERY_RECORDINGS style
+    // responses.
+    QByteArray header = QByteArray::number(utf8.length());
+    header += "        ";
+    header.truncate(8);
+
+    int size = header.length() + utf8.length();
     int written = 0;
     int written_since_timer_restart = 0;
 
-    QByteArray payload;
-    payload = payload.setNum(size);
-    payload += "        ";
-    payload.truncate(8);
-    payload += utf8;
-    size = payload.length();
-
     if (VERBOSE_LEVEL_CHECK(VB_NETWORK))
     {
-        QString msg = QString("write -> %1 %2")
-            .arg(socket(), 2).arg(payload.data());
+        QString msg;
+        if (uncompressed_size)
+        {
+            msg = QString("write -> %1 compressed list, %2 -> %3 bytes")
+                .arg(socket(), 2).arg(uncompressed_size).arg(utf8.length());
+        }
+        else if (m_binary_mode)
+        {
+            msg = QString("write -> %1 binary list, %2 fields, %3 bytes")
+                .arg(socket(), 2).arg(list.size()).arg(utf8.length());
+        }
+        else
+        {
+            msg = QString("write -> %1 %2%3")
+                .arg(socket(), 2).arg(header.data())
+                .arg(QString::fromUtf8(utf8.constData(),
+                                       qMin(96, utf8.length())));
+        }
 
         if (!VERBOSE_LEVEL_CHECK(VB_EXTRA) && msg.length() > 88)
         {
@@ -329,7 +462,23 @@ bool MythSocket::writeStringList(QStringList &list)
             return false;
         }
 
-        int temp = writeBlock(payload.data() + written, size);
+        // The header and body are kept as two spans, resume wherever
+        // the last partial write stopped.
+        const char *chunk;
+        int avail;
+        if (written < header.length())
+        {
+            chunk = header.constData() + written;
+            avail = header.length() - written;
+        }
+        else
+        {
+            int off = written - header.length();
+            chunk = utf8.constData() + off;
+            avail = utf8.length() - off;
+        }
+
+        int temp = writeBlock(chunk, avail);
         if (temp > 0)
         {
             written += temp;
@@ -481,6 +630,8 @@ bool MythSocket::writeData(const char *data, quint64 len)
 
 bool MythSocket::readStringList(QStringList &list, uint timeoutMS)
 {
+    MYTH_PROFILE_COUNT("socket_messages_received", 1);
+
     list.clear();
 
     if (state() != Connected)
@@ -620,18 +771,56 @@ bool MythSocket::readStringList(QStringList &list, uint timeoutMS)
         }
     }
 
-    QString str = QString::fromUtf8(utf8.data());
+    utf8.truncate(read);
 
-    QByteArray payload;
-    payload = payload.setNum(str.length());
-    payload += "        ";
-    payload.truncate(8);
-    payload += str;
+    if (IsCompressedList(utf8))
+    {
+        // compressed payloads identify themselves, so no negotiation
+        // is needed on the read side
+        QByteArray expanded = qUncompress(
+            (const uchar*) utf8.constData() + sizeof(kCompressedListMagic),
+            utf8.length() - sizeof(kCompressedListMagic));
+        if (expanded.isEmpty())
+        {
+            VERBOSE(VB_IMPORTANT, LOC +
+                    "readStringList: Error, malformed compressed payload.");
+            close();
+            return false;
+        }
+
+        VERBOSE(VB_NETWORK, LOC +
+                QString("read  <- %1 compressed list, %2 -> %3 bytes")
+                .arg(socket(), 2).arg(read).arg(expanded.length()));
+
+        utf8 = expanded;
+        read = utf8.length();
+    }
+
+    if (IsBinaryList(utf8))
+    {
+        // binary encoded payloads identify themselves, so no
+        // negotiation is needed on the read side
+        if (!DecodeStringList(utf8, list))
+        {
+            VERBOSE(VB_IMPORTANT, LOC +
+                    "readStringList: Error, malformed binary list.");
+            close();
+            return false;
+        }
+
+        VERBOSE(VB_NETWORK, LOC +
+                QString("read  <- %1 binary list, %2 fields, %3 bytes")
+                .arg(socket(), 2).arg(list.size()).arg(read));
+
+        m_notifyread = false;
+        s_readyread_thread->WakeReadyReadThread();
+        return true;
+    }
 
     if (VERBOSE_LEVEL_CHECK(VB_NETWORK))
     {
-        QString msg = QString("read  <- %1 %2").arg(socket(), 2)
-            .arg(payload.data());
+        QString msg = QString("read  <- %1 [%2] %3").arg(socket(), 2)
+            .arg(read).arg(utf8.data());
 
         if (!VERBOSE_LEVEL_CHECK(VB_EXTRA) && msg.length() > 88)
         {
@@ -641,7 +830,23 @@ bool MythSocket::readStringList(QStringList &list, uint timeoutMS)
         VERBOSE(VB_NETWORK, LOC + msg);
     }
 
-    list = str.split("[]:[]");
+    // Tokenize the "[]:[]" separated fields directly out of the
+    // receive buffer, converting each slice from UTF-8 on its own.
+    // The separator is pure ASCII so the byte level search is exact,
+    // and this skips the whole-payload QString and the per-token
+    // copies QString::split() would make on top of it -- on a large
+    // QUERY_RECORDINGS response that is most of the parse time.
+    const char *data = utf8.constData();
+    int pos = 0;
+    while (pos <= read)
+    {
+        int sep = utf8.indexOf("[]:[]", pos);
+        int end = (sep < 0) ? read : sep;
+        list.push_back(QString::fromUtf8(data + pos, end - pos));
+        if (sep < 0)
+            break;
+        pos = sep + 5;
+    }
 
     m_notifyread = false;
     s_readyread_thread->WakeReadyReadThread();
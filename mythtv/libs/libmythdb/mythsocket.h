@@ -60,6 +60,18 @@ class MPUBLIC MythSocket : public MSocketDevice
     bool readData(char *data, quint64 len);
     bool writeData(const char *data, quint64 len);
 
+    /// Enables the binary string list encoding on this socket.
+    /// Only do this once the peer has negotiated it, see
+    /// MythCoreContext::CheckProtoVersion().
+    void setBinaryMode(bool on) { m_binary_mode = on; }
+    bool binaryMode(void) const { return m_binary_mode; }
+
+    /// Enables deflate compression of large outgoing payloads.
+    /// Only do this once the peer has negotiated it, see
+    /// MythCoreContext::CheckProtoVersion().
+    void setCompressedMode(bool on) { m_compressed_mode = on; }
+    bool compressedMode(void) const { return m_compressed_mode; }
+
     bool connect(const QHostAddress &addr, quint16 port);
     bool connect(const QString &host, quint16 port);
 
@@ -75,7 +87,14 @@ class MPUBLIC MythSocket : public MSocketDevice
 
     void  setState(const State state);
 
+    static QByteArray EncodeStringList(const QStringList &list);
+    static bool DecodeStringList(const QByteArray &payload, QStringList &list);
+    static bool IsBinaryList(const QByteArray &payload);
+    static bool IsCompressedList(const QByteArray &payload);
+
     MythSocketCBs  *m_cb;
+    bool            m_binary_mode;
+    bool            m_compressed_mode;
     bool            m_useReadyReadCallback;
     State           m_state;
     QHostAddress    m_addr;
@@ -11,9 +11,13 @@
 #ifndef USING_MINGW
 #include <sys/select.h> // for select
 #endif
+#ifdef __linux__
+#include <sys/epoll.h>  // for epoll_*
+#endif
 #include <sys/types.h>  // for fnctl
 #include <fcntl.h>      // for fnctl
 #include <errno.h>      // for checking errno
+#include <cstring>      // for memset
 
 #ifndef O_NONBLOCK
 #define O_NONBLOCK 0 /* not actually supported in MINGW */
@@ -35,7 +39,7 @@ static void setup_pipe(int mypipe[2], long flags[2]);
 const uint MythSocketThread::kShortWait = 100;
 
 MythSocketThread::MythSocketThread()
-    : QThread(), m_readyread_run(false)
+    : QThread(), m_readyread_run(false), m_epollfd(-1)
 {
     for (int i = 0; i < 2; i++)
     {
@@ -191,6 +195,53 @@ void MythSocketThread::run(void)
 
     QMutexLocker locker(&m_readyread_lock);
     m_readyread_started_wait.wakeAll();
+
+#ifdef __linux__
+    // Prefer epoll when we have a wakeup pipe; each pass through the
+    // select() loop below rebuilds the fd_set from every socket, which
+    // gets expensive on a master backend with dozens of frontend and
+    // encoder connections.
+    if (m_readyread_pipe[0] >= 0)
+    {
+        m_epollfd = epoll_create(64);
+        if (m_epollfd >= 0)
+        {
+            struct epoll_event ev;
+            memset(&ev, 0, sizeof(ev));
+            ev.events = EPOLLIN;
+            ev.data.ptr = NULL; // marks the wakeup pipe
+            if (epoll_ctl(m_epollfd, EPOLL_CTL_ADD,
+                          m_readyread_pipe[0], &ev) == 0)
+            {
+                RunEpoll();
+                ::close(m_epollfd);
+                m_epollfd = -1;
+                VERBOSE(VB_SOCKET,
+                        "MythSocketThread: readyread thread exit");
+                return;
+            }
+            VERBOSE(VB_SOCKET, "MythSocketThread: failed to watch the "
+                    "wakeup pipe, using select" + ENO);
+            ::close(m_epollfd);
+            m_epollfd = -1;
+        }
+        else
+        {
+            VERBOSE(VB_SOCKET, "MythSocketThread: epoll_create failed, "
+                    "using select" + ENO);
+        }
+    }
+#endif // __linux__
+
+    RunSelect();
+
+    VERBOSE(VB_SOCKET, "MythSocketThread: readyread thread exit");
+}
+
+/// \brief Readiness loop built on select(), used where epoll is not
+///        available. Called with m_readyread_lock held.
+void MythSocketThread::RunSelect(void)
+{
     while (m_readyread_run)
     {
         VERBOSE(VB_SOCKET|VB_EXTRA, "ProcessAddRemoveQueues");
@@ -371,10 +422,232 @@ void MythSocketThread::run(void)
         m_readyread_lock.lock();
         VERBOSE(VB_SOCKET|VB_EXTRA, "Reacquired ready read lock");
     }
+}
 
-    VERBOSE(VB_SOCKET, "MythSocketThread: readyread thread exit");
+#ifdef __linux__
+
+/** \brief Readiness loop built on epoll, used on Linux.
+ *
+ *  The interest set lives in the kernel, so a pass through this loop
+ *  costs O(ready sockets) instead of the O(all sockets) fd_set
+ *  rebuild RunSelect() does. Where RunSelect() simply leaves a locked
+ *  socket, or one whose data has not been consumed yet, out of the
+ *  fd_set, this loop removes it from the epoll set via DisarmEpoll()
+ *  and adds it back once its m_notifyread flag clears; the wake from
+ *  readStringList() triggers the rearm pass.
+ *
+ *  Called with m_readyread_lock held.
+ */
+void MythSocketThread::RunEpoll(void)
+{
+    while (m_readyread_run)
+    {
+        VERBOSE(VB_SOCKET|VB_EXTRA, "ProcessAddRemoveQueues (epoll)");
+
+        ProcessAddRemoveQueuesEpoll();
+
+        // Rearm sockets that were disarmed while their data waited
+        // to be consumed.
+        QSet<MythSocket*>::iterator dit = m_readyread_disarmed.begin();
+        while (dit != m_readyread_disarmed.end())
+        {
+            MythSocket *sock = *dit;
+            if (!sock->TryLock(false))
+            {
+                ++dit;
+                continue;
+            }
+
+            if (sock->socket() < 0 ||
+                sock->state() != MythSocket::Connected)
+            {
+                // nothing left to watch, the consumer saw the close
+                dit = m_readyread_disarmed.erase(dit);
+            }
+            else if (!sock->m_notifyread)
+            {
+                struct epoll_event ev;
+                memset(&ev, 0, sizeof(ev));
+                ev.events = EPOLLIN;
+                ev.data.ptr = sock;
+                if (epoll_ctl(m_epollfd, EPOLL_CTL_ADD,
+                              sock->socket(), &ev) < 0)
+                {
+                    VERBOSE(VB_SOCKET, SLOC(sock) +
+                            "failed to rearm socket" + ENO);
+                }
+                dit = m_readyread_disarmed.erase(dit);
+            }
+            else
+            {
+                ++dit;
+            }
+            sock->Unlock(false);
+        }
+
+        // While anything is disarmed, time out of the wait in case
+        // the wake that should rearm it beat us to the pipe.
+        int timeout = m_readyread_disarmed.isEmpty() ? -1 : (int)kShortWait;
+
+        // DownRef() can delete the socket, and the destructor calls
+        // back into RemoveFromReadyRead(), so it must not run under
+        // the ready read lock.
+        QList<MythSocket*> downref_list = m_readyread_downref_list;
+        m_readyread_downref_list.clear();
+
+        m_readyread_lock.unlock();
+
+        uint downref_tm = 0;
+        if (!downref_list.empty())
+        {
+            VERBOSE(VB_SOCKET|VB_EXTRA, "Deleting stale sockets");
+
+            QTime dtm = QTime::currentTime();
+            QList<MythSocket*>::const_iterator it = downref_list.begin();
+            for (; it != downref_list.end(); ++it)
+                (*it)->DownRef();
+            downref_tm = dtm.elapsed();
+        }
+
+        VERBOSE(VB_SOCKET|VB_EXTRA, "Waiting on epoll..");
+
+        struct epoll_event events[64];
+        int nevents = epoll_wait(m_epollfd, events, 64, timeout);
+
+        if (nevents < 0)
+        {
+            if (EINTR != errno)
+                VERBOSE(VB_SOCKET,
+                        "MythSocketThread: epoll_wait returned error" + ENO);
+            m_readyread_lock.lock();
+            m_readyread_wait.wait(&m_readyread_lock, kShortWait);
+            continue;
+        }
+
+        VERBOSE(VB_SOCKET|VB_EXTRA, "Processing ready reads");
+
+        QMap<uint,uint> timers;
+        QTime tm = QTime::currentTime();
+
+        for (int i = 0; i < nevents && m_readyread_run; i++)
+        {
+            if (!events[i].data.ptr)
+            {
+                // wakeup pipe
+                char dummy[128];
+                int ret = ::read(m_readyread_pipe[0], dummy, 128);
+                if (ret < 0)
+                {
+                    VERBOSE(VB_SOCKET|VB_EXTRA,
+                            "Strange.. failed to read event pipe");
+                }
+                continue;
+            }
+
+            MythSocket *sock = (MythSocket*) events[i].data.ptr;
+            if (!sock->TryLock(false))
+            {
+                // Locked by another thread; disarm so the still
+                // readable descriptor can't spin us, the rearm pass
+                // picks it up again.
+                DisarmEpoll(sock);
+                continue;
+            }
+
+            int socket = sock->socket();
+            if (socket >= 0 &&
+                sock->state() == MythSocket::Connected &&
+                !sock->m_notifyread)
+            {
+                QTime rrtm = QTime::currentTime();
+                ReadyToBeRead(sock);
+                timers[socket] = rrtm.elapsed();
+            }
+
+            // Disarm until the data is consumed, so the descriptor
+            // doesn't wake us again before then.
+            if (sock->m_notifyread &&
+                sock->state() == MythSocket::Connected)
+            {
+                DisarmEpoll(sock);
+            }
+
+            sock->Unlock(false);
+        }
+
+        if (VERBOSE_LEVEL_CHECK(VB_SOCKET|VB_EXTRA))
+        {
+            QString rep = QString("Total read time: %1ms, on sockets")
+                .arg(tm.elapsed());
+            QMap<uint,uint>::const_iterator it = timers.begin();
+            for (; it != timers.end(); ++it)
+                rep += QString(" {%1,%2ms}").arg(it.key()).arg(*it);
+            if (downref_tm)
+                rep += QString(" {downref, %1ms}").arg(downref_tm);
+
+            VERBOSE(VB_SOCKET|VB_EXTRA, QString("MythSocketThread: ") + rep);
+        }
+
+        m_readyread_lock.lock();
+        VERBOSE(VB_SOCKET|VB_EXTRA, "Reacquired ready read lock");
+    }
+}
+
+/// \brief Same as ProcessAddRemoveQueues(), but keeps the epoll
+///        interest set in sync with m_readyread_list.
+void MythSocketThread::ProcessAddRemoveQueuesEpoll(void)
+{
+    while (!m_readyread_dellist.empty())
+    {
+        MythSocket *sock = m_readyread_dellist.front();
+        m_readyread_dellist.pop_front();
+
+        if (m_readyread_list.removeAll(sock))
+        {
+            if (sock->socket() >= 0)
+                epoll_ctl(m_epollfd, EPOLL_CTL_DEL, sock->socket(), NULL);
+            m_readyread_disarmed.remove(sock);
+            m_readyread_downref_list.push_back(sock);
+        }
+    }
+
+    while (!m_readyread_addlist.empty())
+    {
+        MythSocket *sock = m_readyread_addlist.front();
+        m_readyread_addlist.pop_front();
+        m_readyread_list.push_back(sock);
+
+        struct epoll_event ev;
+        memset(&ev, 0, sizeof(ev));
+        ev.events = EPOLLIN;
+        ev.data.ptr = sock;
+        if (sock->socket() < 0 ||
+            epoll_ctl(m_epollfd, EPOLL_CTL_ADD, sock->socket(), &ev) < 0)
+        {
+            VERBOSE(VB_SOCKET, SLOC(sock) +
+                    "failed to add socket to epoll" + ENO);
+        }
+    }
+}
+
+/** \brief Takes a socket out of the epoll set until its data is
+ *         consumed.
+ *
+ *  The descriptor is removed completely rather than masked, so a
+ *  hangup on a socket with unconsumed data can't wake us in a loop.
+ */
+void MythSocketThread::DisarmEpoll(MythSocket *sock)
+{
+    if (m_readyread_disarmed.contains(sock))
+        return;
+
+    if (sock->socket() >= 0)
+        epoll_ctl(m_epollfd, EPOLL_CTL_DEL, sock->socket(), NULL);
+    m_readyread_disarmed.insert(sock);
 }
 
+#endif // __linux__
+
 #ifdef USING_MINGW
 static void setup_pipe(int[2], long[2]) {}
 #else
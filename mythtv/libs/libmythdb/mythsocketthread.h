@@ -5,6 +5,7 @@
 #include <QThread>
 #include <QMutex>
 #include <QList>
+#include <QSet>
 
 class MythSocket;
 class MythSocketThread : public QThread
@@ -22,7 +23,11 @@ class MythSocketThread : public QThread
     void RemoveFromReadyRead(MythSocket *sock);
 
   private:
+    void RunSelect(void);
     void ProcessAddRemoveQueues(void);
+    void RunEpoll(void);
+    void ProcessAddRemoveQueuesEpoll(void);
+    void DisarmEpoll(MythSocket *sock);
     void ReadyToBeRead(MythSocket *sock);
     void CloseReadyReadPipe(void) const;
 
@@ -39,6 +44,11 @@ class MythSocketThread : public QThread
     QList<MythSocket*> m_readyread_addlist;
     QList<MythSocket*> m_readyread_downref_list;
 
+    /// epoll descriptor, -1 when using the select() fallback
+    int                m_epollfd;
+    /// sockets removed from the epoll set until their data is consumed
+    QSet<MythSocket*>  m_readyread_disarmed;
+
     static const uint kShortWait;
 };
 
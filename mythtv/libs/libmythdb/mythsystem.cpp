@@ -368,6 +368,21 @@ void myth_system_post_flags(uint &flags)
 
 #ifndef USING_MINGW
 #define MAX_BUFLEN 1024
+
+/* Reports an error from the child half of the vfork below.  Sharing the
+ * parent's address space rules out iostreams (they may take locks held
+ * by a suspended parent thread), so write straight to stderr. */
+static void child_error(const char *locerr, const char *msg)
+{
+    ssize_t unused;
+    unused = write(2, locerr, strlen(locerr));
+    unused = write(2, msg, strlen(msg));
+    const char *err = strerror(errno);
+    unused = write(2, err, strlen(err));
+    unused = write(2, "\n", 1);
+    (void)unused;
+}
+
 pid_t myth_system_fork(const QString &command, uint &result)
 {
     char cmdargs[MAX_BUFLEN];
@@ -382,19 +397,28 @@ pid_t myth_system_fork(const QString &command, uint &result)
 
     VERBOSE(VB_GENERAL | VB_EXTRA, QString("Launching: %1") .arg(cmdargs));
 
-    pid_t child = fork();
+    /* vfork() instead of fork().  fork() has to duplicate the page tables
+     * of the calling process, so launching a channel change script or
+     * user job from a backend with a multi-GB resident set stalls for as
+     * long as that copy takes and doubles the overcommit charge for the
+     * duration.  vfork() borrows the parent's address space until the
+     * exec, making the launch cost independent of our size.  The child
+     * below only uses async-signal-safe calls (close/open/dup2/execl/
+     * _exit) before the exec, which both vfork and the VERBOSE locking
+     * note already require. */
+    pid_t child = vfork();
 
     if (child < 0)
     {
-        /* Fork failed, still in parent */
-        VERBOSE(VB_GENERAL | VB_EXTRA, (LOC_ERR + "fork() failed because %1")
+        /* vfork failed, still in parent */
+        VERBOSE(VB_GENERAL | VB_EXTRA, (LOC_ERR + "vfork() failed because %1")
                 .arg(strerror(errno)));
         result = GENERIC_EXIT_NOT_OK;
         return -1;
     }
     else if (child == 0)
     {
-        /* Child - NOTE: it is not safe to use VERBOSE between the fork and
+        /* Child - NOTE: it is not safe to use VERBOSE between the vfork and
          * execl calls in the child.  It causes occasional locking issues that
          * cause deadlocked child processes. */
 
@@ -409,28 +433,26 @@ pid_t myth_system_fork(const QString &command, uint &result)
             // Note: dup2() will close old stdin descriptor.
             if (dup2(fd, 0) < 0)
             {
-                // Can't use VERBOSE due to locking fun.
-                cerr << locerr 
-                     << "Cannot redirect /dev/null to standard input,"
-                        "\n\t\t\tfailed to duplicate file descriptor: "
-                     << strerror(errno) << endl;
+                // Can't use VERBOSE or iostreams in the vfork child.
+                child_error(locerr,
+                            "Cannot redirect /dev/null to standard input,"
+                            "\n\t\t\tfailed to duplicate file descriptor: ");
             }
             close(fd);
         }
         else
         {
-            // Can't use VERBOSE due to locking fun.
-            cerr << locerr 
-                 << "Cannot redirect /dev/null to standard input, failed to "
-                    "open: " << strerror(errno) << endl;
+            // Can't use VERBOSE or iostreams in the vfork child.
+            child_error(locerr, "Cannot redirect /dev/null to standard "
+                                "input, failed to open: ");
         }
 
         /* Run command */
         execl("/bin/sh", "sh", "-c", cmdargs, (char *)0);
         if (errno)
         {
-            // Can't use VERBOSE due to locking fun.
-            cerr << locerr << "execl() failed: " << strerror(errno) << endl;
+            // Can't use VERBOSE or iostreams in the vfork child.
+            child_error(locerr, "execl() failed: ");
         }
 
         /* Failed to exec */
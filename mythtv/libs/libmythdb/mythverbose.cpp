@@ -1,8 +1,16 @@
+#include <cstdlib>  // for atexit()
+#include <iostream>
+
+#include <QAtomicInt>
+#include <QCoreApplication>
 #include <QMutex>
+#include <QMutexLocker>
 #include <QStringList>
+#include <QThread>
 #include <QtDebug>
 
 #include "mythverbose.h"
+#include "mythlockfreequeue.h"
 
 #define GENERIC_EXIT_OK                             0
 #define GENERIC_EXIT_INVALID_CMDLINE              252
@@ -18,6 +26,115 @@ unsigned int userDefaultValueInt = verboseDefaultInt;
 QString      userDefaultValueStr = QString(verboseDefaultStr);
 bool         haveUserDefaultValues = false;
 
+/** \class VerboseWriteThread
+ *  \brief Writes queued VERBOSE messages to the console.
+ *
+ *  The VERBOSE macro formats each message in the calling thread and
+ *  queues the finished line via verbose_queue_print().  This thread
+ *  does the actual console writes, so callers are never stalled
+ *  behind a slow terminal, pipe or log file.  The handoff is a
+ *  MythLockFreeQueue, so logging threads do not contend on a mutex
+ *  either; when the queue overflows the line is dropped and counted,
+ *  and the writer reports the drops once it has caught up.
+ */
+class VerboseWriteThread : public QThread
+{
+  public:
+    virtual void run(void);
+};
+
+// 4096 lines soaks up multi-second console stalls at typical -v
+// levels before anything is dropped.
+static const uint kVerboseQueueSize = 4096;
+
+static VerboseWriteThread *verbose_thread      = NULL;
+static qint64              verbose_thread_pid  = 0;
+static bool                verbose_thread_stop = false;
+static MythLockFreeQueue<QString> verbose_queue(kVerboseQueueSize);
+static QAtomicInt          verbose_dropped(0);
+
+void VerboseWriteThread::run(void)
+{
+    QByteArray line;
+
+    while (!verbose_thread_stop || !verbose_queue.isEmpty())
+    {
+        // VERBOSE always prepends a timestamp, so a null return can
+        // only mean the queue is empty.
+        QString msg = verbose_queue.dequeue();
+        if (msg.isNull())
+        {
+            int dropped = verbose_dropped.fetchAndStoreRelaxed(0);
+            if (dropped)
+                std::cout << "WARNING: " << dropped
+                          << " messages dropped, console too slow"
+                          << std::endl;
+
+            if (!verbose_thread_stop)
+                verbose_queue.WaitForData(250);
+            continue;
+        }
+
+        // One write() per line, so output from code that still
+        // prints to the console directly can not end up in the
+        // middle of a message.
+        line = msg.toLocal8Bit();
+        line.append('\n');
+        std::cout.write(line.constData(), line.size());
+
+        if (verbose_queue.isEmpty())
+            std::cout.flush();
+    }
+    std::cout.flush();
+}
+
+/// atexit() handler, drains any still queued messages before the
+/// process goes away.
+static void verbose_queue_flush(void)
+{
+    QMutexLocker locker(&verbose_mutex);
+
+    // After a fork() the writer thread only exists in the parent,
+    // waiting for it here would hang the child forever.
+    if (!verbose_thread ||
+        (verbose_thread_pid != QCoreApplication::applicationPid()))
+    {
+        return;
+    }
+
+    // The writer notices within one WaitForData() timeout.
+    verbose_thread_stop = true;
+    verbose_thread->wait();
+}
+
+void verbose_queue_print(const QString &line)
+{
+    // verbose_mutex is only taken for the first message and for the
+    // first message after a fork(); the steady state is one lock free
+    // enqueue.
+    qint64 pid = QCoreApplication::applicationPid();
+    if (!verbose_thread || (verbose_thread_pid != pid))
+    {
+        QMutexLocker locker(&verbose_mutex);
+        if (!verbose_thread || (verbose_thread_pid != pid))
+        {
+            // fork() does not duplicate the writer thread into the
+            // child, so start a fresh one; the parent's QThread
+            // object is intentionally leaked since it still believes
+            // its thread is running.
+            VerboseWriteThread *thread = new VerboseWriteThread();
+            verbose_thread_stop = false;
+            thread->start();
+            verbose_thread_pid = pid;
+            verbose_thread     = thread;
+            atexit(verbose_queue_flush);
+        }
+    }
+
+    if (!verbose_queue.enqueue(line))
+        verbose_dropped.fetchAndAddRelaxed(1);
+}
+
 int parse_verbose_arg(QString arg)
 {
     QString option;
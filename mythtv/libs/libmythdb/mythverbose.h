@@ -115,117 +115,77 @@ enum VerboseMask
 extern MPUBLIC unsigned int print_verbose_messages;
 #ifdef __cplusplus
   extern MPUBLIC QMutex verbose_mutex;
+  /// Queues an already formatted message line for the VERBOSE
+  /// writer thread, see mythverbose.cpp.
+  MPUBLIC void verbose_queue_print(const QString &line);
 #endif
 
 // Helper for checking verbose flags outside of VERBOSE macro
 #define VERBOSE_LEVEL_NONE        (print_verbose_messages == 0)
 #define VERBOSE_LEVEL_CHECK(mask) ((print_verbose_messages & (mask)) == (mask))
 
-// 1. A non-locking one, used in C or Objective C src, or standalone libraries,
-// 2. A mutex-locked one, which may deadlock, and
-// 3. A mutex-locked one, which should be deadlock safe.
-// If MYTHCONTEXT_H_ is not defined, we assume the first type,
-// otherwise DEBUG determines the second or third
-
-
-#ifndef MYTHCONTEXT_H_
-    #ifdef  __cplusplus
-        #ifdef WIN32
-            #define VERBOSE(mask, ...)                        \
-                do {                                                 \
-                    if (VERBOSE_LEVEL_CHECK(mask))                   \
-                    {                                                \
-                        QDateTime dtmp = QDateTime::currentDateTime(); \
-                        QString dtime = dtmp.toString("yyyy-MM-dd hh:mm:ss.zzz"); \
-                        verbose_mutex.lock(); \
-                        std::cout << dtime.toLocal8Bit().constData() << " " \
-                             << QString(__VA_ARGS__).toLocal8Bit().constData() << std::endl; \
-                        verbose_mutex.unlock(); \
-                    }                                                \
-               } while (0)
-
-        #else
-                #define VERBOSE(mask,args...)                        \
-                do {                                                 \
-                    if (VERBOSE_LEVEL_CHECK(mask))                   \
-                    {                                                \
-                        QDateTime dtmp = QDateTime::currentDateTime(); \
-                        QString dtime = dtmp.toString("yyyy-MM-dd hh:mm:ss.zzz"); \
-                        verbose_mutex.lock(); \
-                        std::cout << dtime.toLocal8Bit().constData() << " " \
-                             << QString(args).toLocal8Bit().constData() << std::endl; \
-                        verbose_mutex.unlock(); \
-                    }                                                \
-               } while (0)
-        #endif
+// 1. A direct one, used in C src, which prints from the calling thread, and
+// 2. A queued one for C++, which formats the message in the calling thread
+//    and hands the finished line to a writer thread for the console write,
+//    so a caller is never stalled behind a slow terminal, pipe or log file.
+// Since the writes happen off the calling thread, using VERBOSE while
+// another VERBOSE is in progress cannot deadlock.
+
+
+#ifdef  __cplusplus
+    #ifdef WIN32
+        #define VERBOSE(mask, ...)                           \
+            do {                                             \
+                if (VERBOSE_LEVEL_CHECK(mask))               \
+                {                                            \
+                    QDateTime dtmp = QDateTime::currentDateTime(); \
+                    QString dtime = dtmp.toString("yyyy-MM-dd hh:mm:ss.zzz"); \
+                    QTextStream ssMsg(&dtime);               \
+                    ssMsg << " " << __VA_ARGS__;             \
+                    verbose_queue_print(*ssMsg.string());    \
+                }                                            \
+            } while (0)
+
     #else
-        #if HAVE_GETTIMEOFDAY
-            #define VERBOSEDATE                              \
-            {                                                \
-                struct tm      *tp;                          \
-                struct timeval  tv;                          \
-                gettimeofday(&tv, NULL);                     \
-                tp = localtime(&tv.tv_sec);                  \
-                printf("%4d-%02d-%02d %2d:%02d:%02d.%03d ",  \
-                       1900+tp->tm_year, 1+tp->tm_mon,       \
-                       tp->tm_mday, tp->tm_hour, tp->tm_min, \
-                       tp->tm_sec, (int)(tv.tv_usec/10000)); \
-            }
-        #else
-            #define VERBOSEDATE ;
-        #endif
         #define VERBOSE(mask,args...)                        \
-        do { \
-            if (VERBOSE_LEVEL_CHECK(mask))                   \
-            {                                                \
-                VERBOSEDATE                                  \
-                printf(args);                                \
-                putchar('\n');                               \
-            } \
-        } while (0)
+            do {                                             \
+                if (VERBOSE_LEVEL_CHECK(mask))               \
+                {                                            \
+                    QDateTime dtmp = QDateTime::currentDateTime(); \
+                    QString dtime = dtmp.toString("yyyy-MM-dd hh:mm:ss.zzz"); \
+                    QTextStream ssMsg(&dtime);               \
+                    ssMsg << " " << args;                    \
+                    verbose_queue_print(*ssMsg.string());    \
+                }                                            \
+            } while (0)
     #endif
-
-#elif defined(DEBUG) // && MYTHCONTEXT_H_
-
-    // The verbose_mutex lock is a recursive lock so it is possible (while
-    // not recommended) to use a VERBOSE macro within another VERBOSE macro.
-    // But waiting for another thread to do something is not safe within a
-    // VERBOSE macro, since those threads may wish to use the VERBOSE macro
-    // and this will cause a deadlock.
-
-    #define VERBOSE(mask,args...) \
-        do { \
-            if (VERBOSE_LEVEL_CHECK(mask))                   \
-            { \
-                QDateTime dtmp = QDateTime::currentDateTime(); \
-                QString dtime = dtmp.toString("yyyy-MM-dd hh:mm:ss.zzz"); \
-                verbose_mutex.lock(); \
-                std::cout << dtime.toLocal8Bit().constData() << " " \
-                     << QString(args).toLocal8Bit().constData() << std::endl; \
-                verbose_mutex.unlock(); \
-            } \
-        } while (0)
-
-#else // MYTHCONTEXT_H_ && !DEBUG
-
-    // use a slower non-deadlockable version in release builds
-
-    #define VERBOSE(mask,args...) \
-        do { \
-            if (VERBOSE_LEVEL_CHECK(mask))                   \
-            { \
-                QDateTime dtmp = QDateTime::currentDateTime(); \
-                QString dtime = dtmp.toString("yyyy-MM-dd hh:mm:ss.zzz"); \
-                QTextStream ssMsg(&dtime);                  \
-                ssMsg << " " << args;                                   \
-                verbose_mutex.lock();                      \
-                std::cout << ssMsg.string()->toLocal8Bit().constData() << \
-                    std::endl; \
-                verbose_mutex.unlock();                    \
-            } \
-        } while (0)
-
-#endif // MYTHCONTEXT_H_, DEBUG
+#else
+    #if HAVE_GETTIMEOFDAY
+        #define VERBOSEDATE                              \
+        {                                                \
+            struct tm      *tp;                          \
+            struct timeval  tv;                          \
+            gettimeofday(&tv, NULL);                     \
+            tp = localtime(&tv.tv_sec);                  \
+            printf("%4d-%02d-%02d %2d:%02d:%02d.%03d ",  \
+                   1900+tp->tm_year, 1+tp->tm_mon,       \
+                   tp->tm_mday, tp->tm_hour, tp->tm_min, \
+                   tp->tm_sec, (int)(tv.tv_usec/10000)); \
+        }
+    #else
+        #define VERBOSEDATE ;
+    #endif
+    #define VERBOSE(mask,args...)                        \
+    do { \
+        if (VERBOSE_LEVEL_CHECK(mask))                   \
+        {                                                \
+            VERBOSEDATE                                  \
+            printf(args);                                \
+            putchar('\n');                               \
+        } \
+    } while (0)
+
+#endif // __cplusplus
 
 
 #ifdef  __cplusplus
@@ -22,15 +22,20 @@ RemoteFile::RemoteFile(const QString &_path, bool write, bool useRA,
     lock(QMutex::NonRecursive),
     controlSock(NULL),    sock(NULL),
     query("QUERY_FILETRANSFER %1"),
-    writemode(write)
+    writemode(write),     pipelineWindow(1)
 {
     if (writemode)
     {
         usereadahead = false;
         timeout_ms = -1;
     }
-    else if (possibleAuxiliaryFiles)
-        possibleauxfiles = *possibleAuxiliaryFiles;
+    else
+    {
+        pipelineWindow = max(
+            1, gCoreContext->GetNumSetting("RemoteFileRequestWindow", 2));
+        if (possibleAuxiliaryFiles)
+            possibleauxfiles = *possibleAuxiliaryFiles;
+    }
 
     if (!path.isEmpty())
         Open();
@@ -196,6 +201,7 @@ void RemoteFile::Close(void)
     strlist << "DONE";
 
     lock.lock();
+    DrainRequests();
     controlSock->writeStringList(strlist);
     if (!controlSock->readStringList(strlist, true))
     {
@@ -355,6 +361,48 @@ void RemoteFile::Reset(void)
     }
 }
 
+/** \fn RemoteFile::DrainRequests(void)
+ *  \brief Consumes the data and replies of any REQUEST_BLOCKs still
+ *         in flight.
+ *
+ *   Must be called with 'lock' held before any other exchange on the
+ *   control socket (seeks, timeouts, DONE), since replies on it are
+ *   strictly ordered behind the outstanding block requests.
+ */
+void RemoteFile::DrainRequests(void)
+{
+    if (pendingRequests.isEmpty())
+        return;
+
+    char *trash = new char[16 * 1024];
+
+    while (!pendingRequests.isEmpty())
+    {
+        pendingRequests.takeFirst();
+
+        QStringList strlist;
+        if (!controlSock || !controlSock->readStringList(strlist, true) ||
+            strlist.empty())
+        {
+            pendingRequests.clear();
+            break;
+        }
+
+        int bytes = strlist[0].toInt();
+        while (sock && bytes > 0)
+        {
+            if (sock->waitForMore(100) <= 0)
+                break;
+            int ret = sock->readBlock(trash, min(bytes, 16 * 1024));
+            if (ret <= 0)
+                break;
+            bytes -= ret;
+        }
+    }
+
+    delete [] trash;
+}
+
 long long RemoteFile::Seek(long long pos, int whence, long long curpos)
 {
     lock.lock();
@@ -370,6 +418,8 @@ long long RemoteFile::Seek(long long pos, int whence, long long curpos)
     if (!controlSock->isOpen() || controlSock->error())
         return 0;
 
+    DrainRequests();
+
     QStringList strlist( QString(query).arg(recordernum) );
     strlist << "SEEK";
     encodeLongLong(strlist, pos);
@@ -496,32 +546,53 @@ int RemoteFile::Read(void *data, int size)
     if (!controlSock->isOpen() || controlSock->error())
         return -1;
 
-    if (sock->bytesAvailable() > 0)
+    if (pendingRequests.isEmpty())
     {
-        VERBOSE(VB_NETWORK,
-                "RemoteFile::Read(): Read socket not empty to start!");
-        while (sock->waitForMore(5) > 0)
+        // with requests in flight the sockets are expected to have
+        // data pending, so only clean up stale bytes when idle
+        if (sock->bytesAvailable() > 0)
         {
-            int avail = sock->bytesAvailable();
-            char *trash = new char[avail + 1];
-            sock->readBlock(trash, avail);
-            delete [] trash;
+            VERBOSE(VB_NETWORK,
+                    "RemoteFile::Read(): Read socket not empty to start!");
+            while (sock->waitForMore(5) > 0)
+            {
+                int avail = sock->bytesAvailable();
+                char *trash = new char[avail + 1];
+                sock->readBlock(trash, avail);
+                delete [] trash;
+            }
         }
-    }
 
-    if (controlSock->bytesAvailable() > 0)
+        if (controlSock->bytesAvailable() > 0)
+        {
+            VERBOSE(VB_NETWORK,
+                    "RemoteFile::Read(): Control socket not empty to start!");
+            QStringList tempstrlist;
+            controlSock->readStringList(tempstrlist);
+        }
+    }
+    else if (pendingRequests.front() != size)
     {
-        VERBOSE(VB_NETWORK,
-                "RemoteFile::Read(): Control socket not empty to start!");
-        QStringList tempstrlist;
-        controlSock->readStringList(tempstrlist);
+        // pipelining assumes the request size repeats; when the
+        // caller changes it, finish the old requests the slow way
+        DrainRequests();
     }
 
-    QStringList strlist( QString(query).arg(recordernum) );
-    strlist << "REQUEST_BLOCK";
-    strlist << QString::number(size);
-    controlSock->writeStringList(strlist);
+    // Top up the request window. The first read of a sequential run
+    // sends pipelineWindow requests, after that each read sends one,
+    // so the backend is filling the pipe while we consume the oldest
+    // block. A window of 1 gives the classic request/wait behavior.
+    QStringList strlist;
+    while ((int)pendingRequests.size() < pipelineWindow)
+    {
+        strlist = QStringList( QString(query).arg(recordernum) );
+        strlist << "REQUEST_BLOCK";
+        strlist << QString::number(size);
+        controlSock->writeStringList(strlist);
+        pendingRequests.append(size);
+    }
 
+    pendingRequests.removeFirst();
     sent = size;
 
     int waitms = 10;
@@ -548,7 +619,9 @@ int RemoteFile::Read(void *data, int size)
                 waitms += 20;
         }
 
-        if (controlSock->bytesAvailable() > 0)
+        // Read at most one reply here; any replies queued behind it
+        // belong to the other requests still in pendingRequests.
+        if (!response && controlSock->bytesAvailable() > 0)
         {
             controlSock->readStringList(strlist, true);
             sent = strlist[0].toInt(); // -1 on backend error
@@ -570,6 +643,13 @@ int RemoteFile::Read(void *data, int size)
         }
     }
 
+    if (error || sent < 0)
+    {
+        // the stream position is unknown after an error; forget the
+        // other requests and let the next read resync the sockets
+        pendingRequests.clear();
+    }
+
     VERBOSE(VB_NETWORK, QString("Read(): reqd=%1, rcvd=%2, rept=%3, error=%4")
                                 .arg(size).arg(recv).arg(sent).arg(error));
 
@@ -611,6 +691,8 @@ void RemoteFile::SetTimeout(bool fast)
     if (!controlSock->isOpen() || controlSock->error())
         return;
 
+    DrainRequests();
+
     QStringList strlist( QString(query).arg(recordernum) );
     strlist << "SET_TIMEOUT";
     strlist << QString::number((int)fast);
@@ -56,6 +56,7 @@ class MPUBLIC RemoteFile
 
   private:
     MythSocket     *openSocket(bool control);
+    void            DrainRequests(void);
 
     QString         path;
     bool            usereadahead;
@@ -72,6 +73,12 @@ class MPUBLIC RemoteFile
 
     bool            writemode;
 
+    /// max REQUEST_BLOCKs in flight on the data socket; 1 disables
+    /// pipelining and gives the classic request/wait behavior
+    int             pipelineWindow;
+    /// sizes of the REQUEST_BLOCKs currently in flight, oldest first
+    QList<int>      pendingRequests;
+
     QStringList     possibleauxfiles;
     QStringList     auxfiles;
 };
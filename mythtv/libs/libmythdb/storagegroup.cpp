@@ -1,3 +1,4 @@
+#include <QDateTime>
 #include <QDir>
 #include <QFile>
 #include <QRegExp>
@@ -22,6 +23,15 @@ QMap<QString, QString> StorageGroup::m_builtinGroups;
 QMutex                 StorageGroup::s_groupToUseLock;
 QHash<QString,QString> StorageGroup::s_groupToUseCache;
 
+QMutex                 StorageGroup::s_dirCacheLock;
+QHash<QString,QString> StorageGroup::s_dirCache;
+QHash<QString,uint>    StorageGroup::s_dirCacheMissTime;
+
+/// How long a cached FindRecordingDir() miss stays valid, in seconds.
+/// Misses are common during deletes, but a recording that is still
+/// being copied into place must not stay invisible for long.
+const uint kDirCacheMissTimeout = 15;
+
 const QStringList StorageGroup::kSpecialGroups = QStringList()
     << "LiveTV"
 //    << "Thumbnails"
@@ -540,6 +550,53 @@ QString StorageGroup::FindRecordingDir(QString filename)
     QString result = "";
     QFileInfo checkFile("");
 
+    QString cacheKey = QString("%1:%2:%3")
+        .arg(m_groupname).arg(m_hostname).arg(filename);
+    cacheKey.detach();
+
+    // Check the cache first.  A hit costs at most one stat() instead
+    // of one per candidate directory, which matters when directories
+    // live on automounted NFS shares.
+    bool cacheHit = false;
+    QString cachedDir;
+    s_dirCacheLock.lock();
+    QHash<QString,QString>::const_iterator it = s_dirCache.find(cacheKey);
+    if (it != s_dirCache.end())
+    {
+        cachedDir = *it;
+        cachedDir.detach();
+        cacheHit = true;
+        if (cachedDir.isEmpty() &&
+            ((QDateTime::currentDateTime().toTime_t() -
+              s_dirCacheMissTime.value(cacheKey)) >= kDirCacheMissTimeout))
+        {
+            // Cached miss has expired, search again.
+            s_dirCache.remove(cacheKey);
+            s_dirCacheMissTime.remove(cacheKey);
+            cacheHit = false;
+        }
+    }
+    s_dirCacheLock.unlock();
+
+    if (cacheHit)
+    {
+        if (cachedDir.isEmpty())
+        {
+            VERBOSE(VB_FILE, LOC + QString("FindRecordingDir: Cached miss "
+                    "for '%1'").arg(filename));
+            return cachedDir;
+        }
+
+        // Revalidate with a single stat() in case the file has been
+        // deleted or moved since the entry was cached.
+        checkFile.setFile(cachedDir + "/" + filename);
+        if (checkFile.exists() || checkFile.isSymLink())
+            return cachedDir;
+
+        QMutexLocker locker(&s_dirCacheLock);
+        s_dirCache.remove(cacheKey);
+    }
+
     int curDir = 0;
     while (curDir < m_dirlist.size())
     {
@@ -551,6 +608,9 @@ QString StorageGroup::FindRecordingDir(QString filename)
         {
             QString tmp = m_dirlist[curDir];
             tmp.detach();
+
+            QMutexLocker locker(&s_dirCacheLock);
+            s_dirCache[cacheKey] = tmp;
             return tmp;
         }
 
@@ -581,6 +641,16 @@ QString StorageGroup::FindRecordingDir(QString filename)
         result = (tmpFile.isEmpty()) ? result : tmpFile;
     }
 
+    if (result.isEmpty())
+    {
+        // Remember the miss so repeated lookups for the same missing
+        // file don't re-stat every directory until the entry expires.
+        QMutexLocker locker(&s_dirCacheLock);
+        s_dirCache[cacheKey] = result;
+        s_dirCacheMissTime[cacheKey] =
+            QDateTime::currentDateTime().toTime_t();
+    }
+
     result.detach();
     return result;
 }
@@ -778,6 +848,18 @@ void StorageGroup::ClearGroupToUseCache(void)
     s_groupToUseCache.clear();
 }
 
+/** \fn StorageGroup::ClearDirCache(void)
+ *  \brief Flushes the cached results of FindRecordingDir().
+ *
+ *   Should be called whenever the Storage Group configuration changes.
+ */
+void StorageGroup::ClearDirCache(void)
+{
+    QMutexLocker locker(&s_dirCacheLock);
+    s_dirCache.clear();
+    s_dirCacheMissTime.clear();
+}
+
 QString StorageGroup::GetGroupToUse(
     const QString &host, const QString &sgroup)
 {
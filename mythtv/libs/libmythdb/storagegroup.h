@@ -50,6 +50,8 @@ class MPUBLIC StorageGroup
     static QString GetGroupToUse(
         const QString &host, const QString &sgroup);
 
+    static void ClearDirCache(void);
+
   private:
     static void    StaticInit(void);
     static bool    m_staticInitDone;
@@ -64,6 +66,10 @@ class MPUBLIC StorageGroup
 
     static QMutex                 s_groupToUseLock;
     static QHash<QString,QString> s_groupToUseCache;
+
+    static QMutex                 s_dirCacheLock;
+    static QHash<QString,QString> s_dirCache;
+    static QHash<QString,uint>    s_dirCacheMissTime;
 };
 
 #endif
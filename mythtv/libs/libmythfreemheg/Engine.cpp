@@ -50,6 +50,11 @@ MHEngine::MHEngine(MHContext *context): m_Context(context)
     m_Interacting = 0;
 }
 
+MHParseCacheEntry::~MHParseCacheEntry()
+{
+    delete m_pTree;
+}
+
 MHEngine::~MHEngine()
 {
     while (!m_ApplicationStack.isEmpty())
@@ -58,6 +63,9 @@ MHEngine::~MHEngine()
        delete m_EventQueue.dequeue();
     while (!m_ExternContentTable.isEmpty())
         delete m_ExternContentTable.takeFirst();
+    QMap<QString, MHParseCacheEntry*>::iterator it = m_ParseCache.begin();
+    for (; it != m_ParseCache.end(); ++it)
+        delete *it;
 }
 
 // Check for external content every 2 seconds.
@@ -145,36 +153,59 @@ int MHEngine::RunAll()
 
 
 // Convert the parse tree for an application or scene into an object node.
-MHGroup *MHEngine::ParseProgram(QByteArray &text)
+// The parse trees are cached by carousel path: applications revisit the
+// same scenes again and again and decoding the ASN1 is the expensive
+// part of a transition.  Initialise() only reads the tree, so a cached
+// tree can be converted into a fresh object any number of times.
+MHGroup *MHEngine::ParseProgram(QByteArray &text, const QString &csPath)
 {
     if (text.size() == 0) return NULL;
-    // Look at the first byte to decide whether this is text or binary.  Binary
-    // files will begin with 0xA0 or 0xA1, text files with white space, comment ('/')
-    // or curly bracket.
-    // This is only there for testing: all downloaded objects will be in ASN1
-    unsigned char ch = text[0];
-    MHParseBase *parser = NULL;
-    MHParseNode *pTree = NULL;
-    MHGroup *pRes = NULL;
-    if (ch >= 128) parser = new MHParseBinary(text);
-    else parser = new MHParseText(text);
 
-    try {
-        // Parse the binary or text.
-        pTree = parser->Parse();
+    MHParseCacheEntry *pEntry = m_ParseCache.value(csPath, NULL);
+    if (pEntry == NULL || pEntry->m_Contents != text)
+    {
+        // Not seen before, or the carousel is sending a new version.
+        // Look at the first byte to decide whether this is text or binary.  Binary
+        // files will begin with 0xA0 or 0xA1, text files with white space, comment ('/')
+        // or curly bracket.
+        // This is only there for testing: all downloaded objects will be in ASN1
+        unsigned char ch = text[0];
+        MHParseBase *parser = NULL;
+        MHParseNode *pTree = NULL;
+        if (ch >= 128) parser = new MHParseBinary(text);
+        else parser = new MHParseText(text);
 
+        try {
+            // Parse the binary or text.
+            pTree = parser->Parse();
+            delete(parser);
+        }
+        catch (...) {
+            delete(parser);
+            delete(pTree);
+            throw;
+        }
+
+        if (pEntry == NULL) {
+            pEntry = new MHParseCacheEntry;
+            m_ParseCache.insert(csPath, pEntry);
+        }
+        delete pEntry->m_pTree;
+        pEntry->m_pTree = pTree;
+        pEntry->m_Contents = text;
+    }
+
+    MHParseNode *pTree = pEntry->m_pTree;
+    MHGroup *pRes = NULL;
+    try {
         switch (pTree->GetTagNo()) { // The parse node should be a tagged item.
         case C_APPLICATION: pRes = new MHApplication; break;
         case C_SCENE: pRes = new MHScene; break;
         default: pTree->Failure("Expected Application or Scene"); // throws exception.
         }
         pRes->Initialise(pTree, this); // Convert the parse tree.
-        delete(pTree);
-        delete(parser);
     }
     catch (...) {
-        delete(parser);
-        delete(pTree);
         delete(pRes);
         throw;
     }
@@ -211,7 +242,7 @@ bool MHEngine::Launch(const MHObjectRef &target, bool fIsSpawn)
                 delete m_ApplicationStack.pop(); // Pop and delete the current app.
         }
 
-        MHApplication *pProgram = (MHApplication*)ParseProgram(text);
+        MHApplication *pProgram = (MHApplication*)ParseProgram(text, csPath);
 
         if ((__mhlogoptions & MHLogScenes) && __mhlogStream != 0) { // Print it so we know what's going on.
             pProgram->PrintMe(__mhlogStream, 0);
@@ -284,7 +315,7 @@ void MHEngine::TransitionToScene(const MHObjectRef &target)
     if (! m_Context->GetCarouselData(csPath, text)) return;
 
     // Parse and run the file.
-    MHGroup *pProgram = ParseProgram(text);
+    MHGroup *pProgram = ParseProgram(text, csPath);
     if (pProgram->m_fIsApp) MHERROR("Expected a scene");
     // Clear the action queue of anything pending.
     m_ActionStack.clear();
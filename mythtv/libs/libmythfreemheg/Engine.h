@@ -34,6 +34,7 @@
 #include <QRect>
 #include <QRegion>
 #include <QList>
+#include <QMap>
 #include <QStack>
 #include <QQueue>
 
@@ -57,6 +58,19 @@ public:
     MHOwnPtrSequence <MHUnion> m_Data;
 };
 
+class MHParseNode;
+
+// Entry in the parse tree cache.  The raw carousel data is kept
+// alongside the tree so that a new version of the object replaces
+// the cached copy.  See MHEngine::ParseProgram.
+class MHParseCacheEntry {
+public:
+    MHParseCacheEntry(): m_pTree(NULL) {}
+    ~MHParseCacheEntry();
+    QByteArray   m_Contents;
+    MHParseNode *m_pTree;
+};
+
 // Entry in the pending external content list.
 class MHExternContent {
 public:
@@ -157,7 +171,7 @@ public:
 
 protected:
     void CheckLinks(const MHObjectRef &sourceRef, enum EventType ev, const MHUnion &un);
-    MHGroup *ParseProgram(QByteArray &text);
+    MHGroup *ParseProgram(QByteArray &text, const QString &csPath);
     void DrawRegion(QRegion toDraw, int nStackPos);
 
     QRegion m_redrawRegion; // The accumulation of repaints when the screen is locked.
@@ -189,6 +203,12 @@ protected:
     QList<MHExternContent*> m_ExternContentTable;
     void CheckContentRequests();
 
+    // Cached parse trees of application and scene objects, keyed by
+    // carousel path.  Red button applications revisit the same scenes
+    // repeatedly and decoding the ASN1 is the expensive part of a
+    // transition.
+    QMap<QString, MHParseCacheEntry*> m_ParseCache;
+
     MHOwnPtrSequence <MHPSEntry> m_PersistentStore;
 
     bool m_fInTransition; // If we get a TransitionTo, Quit etc during OnStartUp and OnCloseDown we ignore them.
@@ -16,6 +16,7 @@ along with this program; if not, write to the Free Software
 Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
 */
 
+#include "mythconfig.h"
 #include "el_processor.h"
 #include <cstdlib>
 #include <cstring>
@@ -43,6 +44,228 @@ static const float PI = 3.141592654;
 static const float epsilon = 0.000001;
 static const float center_level = 0.5*sqrt(0.5);
 
+#if ARCH_X86
+static int has_sse2 = -1;
+
+// Check cpuid for SSE2 support on x86 / x86_64
+static inline bool sse_check()
+{
+    if (has_sse2 != -1)
+        return (bool)has_sse2;
+    __asm__(
+        // -fPIC - we may not clobber ebx/rbx
+#if ARCH_X86_64
+        "push       %%rbx               \n\t"
+#else
+        "push       %%ebx               \n\t"
+#endif
+        "mov        $1, %%eax           \n\t"
+        "cpuid                          \n\t"
+        "and        $0x4000000, %%edx   \n\t"
+        "shr        $26, %%edx          \n\t"
+#if ARCH_X86_64
+        "pop        %%rbx               \n\t"
+#else
+        "pop        %%ebx               \n\t"
+#endif
+        :"=d"(has_sse2)
+        ::"%eax","%ecx"
+    );
+    return (bool)has_sse2;
+}
+#endif //ARCH_X86
+
+/*
+ The band processing below runs once per channel per block over thousands
+ of bins, so the simple elementwise loops get SSE versions, four floats
+ at a time, with a C tail for the remainder. None of the buffers involved
+ have an alignment guarantee, hence the unaligned loads/stores. */
+
+// dst[i] = src[i] * win[i]
+static void vector_mul(float *dst, const float *src, const float *win,
+                       unsigned n)
+{
+    unsigned i = 0;
+
+#if ARCH_X86
+    if (sse_check() && n >= 16)
+    {
+        int loops = n >> 4;
+        i = loops << 4;
+
+        __asm__ volatile (
+            "1:                             \n\t"
+            "movups     (%1), %%xmm1        \n\t"
+            "movups     16(%1), %%xmm2      \n\t"
+            "movups     (%2), %%xmm5        \n\t"
+            "movups     32(%1), %%xmm3      \n\t"
+            "mulps      %%xmm5, %%xmm1      \n\t"
+            "movups     16(%2), %%xmm6      \n\t"
+            "movups     48(%1), %%xmm4      \n\t"
+            "mulps      %%xmm6, %%xmm2      \n\t"
+            "movups     32(%2), %%xmm7      \n\t"
+            "movups     %%xmm1, (%0)        \n\t"
+            "mulps      %%xmm7, %%xmm3      \n\t"
+            "movups     48(%2), %%xmm5      \n\t"
+            "movups     %%xmm2, 16(%0)      \n\t"
+            "mulps      %%xmm5, %%xmm4      \n\t"
+            "movups     %%xmm3, 32(%0)      \n\t"
+            "add        $64,    %1          \n\t"
+            "movups     %%xmm4, 48(%0)      \n\t"
+            "add        $64,    %2          \n\t"
+            "add        $64,    %0          \n\t"
+            "sub        $1, %%ecx           \n\t"
+            "jnz        1b                  \n\t"
+            :"+r"(dst), "+r"(src), "+r"(win)
+            :"c"(loops)
+        );
+    }
+#endif //ARCH_X86
+    for (; i < n; i++)
+        *dst++ = *src++ * *win++;
+}
+
+// dst[2i] = sig[2i] * flt[i]; dst[2i+1] = sig[2i+1] * flt[i]
+static void vector_complex_mul(float *dst, const float *sig, const float *flt,
+                               unsigned n)
+{
+    unsigned i = 0;
+
+#if ARCH_X86
+    if (sse_check() && n >= 8)
+    {
+        int loops = n >> 3;
+        i = loops << 3;
+
+        __asm__ volatile (
+            "1:                             \n\t"
+            "movups     (%2), %%xmm0        \n\t"
+            "movups     16(%2), %%xmm5      \n\t"
+            "movaps     %%xmm0, %%xmm1      \n\t"
+            "movups     (%1), %%xmm2        \n\t"
+            "unpcklps   %%xmm0, %%xmm0      \n\t"
+            "movaps     %%xmm5, %%xmm6      \n\t"
+            "movups     16(%1), %%xmm3      \n\t"
+            "unpckhps   %%xmm1, %%xmm1      \n\t"
+            "mulps      %%xmm0, %%xmm2      \n\t"
+            "movups     32(%1), %%xmm4      \n\t"
+            "unpcklps   %%xmm5, %%xmm5      \n\t"
+            "mulps      %%xmm1, %%xmm3      \n\t"
+            "movups     %%xmm2, (%0)        \n\t"
+            "movups     48(%1), %%xmm7      \n\t"
+            "unpckhps   %%xmm6, %%xmm6      \n\t"
+            "mulps      %%xmm5, %%xmm4      \n\t"
+            "movups     %%xmm3, 16(%0)      \n\t"
+            "mulps      %%xmm6, %%xmm7      \n\t"
+            "movups     %%xmm4, 32(%0)      \n\t"
+            "add        $32,    %2          \n\t"
+            "movups     %%xmm7, 48(%0)      \n\t"
+            "add        $64,    %1          \n\t"
+            "add        $64,    %0          \n\t"
+            "sub        $1, %%ecx           \n\t"
+            "jnz        1b                  \n\t"
+            :"+r"(dst), "+r"(sig), "+r"(flt)
+            :"c"(loops)
+        );
+    }
+#endif //ARCH_X86
+    for (; i < n; i++)
+    {
+        *dst++ = *sig++ * *flt;
+        *dst++ = *sig++ * *flt++;
+    }
+}
+
+// t[i] += w[i] * c[2i] - overlap add of the real part of a complex array
+static void vector_overlap_add(float *t, const float *w, const float *c,
+                               unsigned n)
+{
+    unsigned i = 0;
+
+#if ARCH_X86
+    if (sse_check() && n >= 8)
+    {
+        int loops = n >> 3;
+        i = loops << 3;
+
+        __asm__ volatile (
+            "1:                             \n\t"
+            "movups     (%2), %%xmm1        \n\t"
+            "movups     16(%2), %%xmm2      \n\t"
+            "movups     32(%2), %%xmm3      \n\t"
+            "shufps     $0x88, %%xmm2, %%xmm1 \n\t"
+            "movups     48(%2), %%xmm4      \n\t"
+            "movups     (%1), %%xmm5        \n\t"
+            "shufps     $0x88, %%xmm4, %%xmm3 \n\t"
+            "movups     16(%1), %%xmm6      \n\t"
+            "mulps      %%xmm5, %%xmm1      \n\t"
+            "movups     (%0), %%xmm7        \n\t"
+            "mulps      %%xmm6, %%xmm3      \n\t"
+            "movups     16(%0), %%xmm0      \n\t"
+            "addps      %%xmm7, %%xmm1      \n\t"
+            "addps      %%xmm0, %%xmm3      \n\t"
+            "movups     %%xmm1, (%0)        \n\t"
+            "add        $64,    %2          \n\t"
+            "movups     %%xmm3, 16(%0)      \n\t"
+            "add        $32,    %1          \n\t"
+            "add        $32,    %0          \n\t"
+            "sub        $1, %%ecx           \n\t"
+            "jnz        1b                  \n\t"
+            :"+r"(t), "+r"(w), "+r"(c)
+            :"c"(loops)
+        );
+    }
+#endif //ARCH_X86
+    for (; i < n; i++)
+    {
+        *t++ += *w++ * *c;
+        c += 2;
+    }
+}
+
+// t[i] = w[i] * c[2i] - windowed real part of a complex array
+static void vector_window_stride2(float *t, const float *w, const float *c,
+                                  unsigned n)
+{
+    unsigned i = 0;
+
+#if ARCH_X86
+    if (sse_check() && n >= 8)
+    {
+        int loops = n >> 3;
+        i = loops << 3;
+
+        __asm__ volatile (
+            "1:                             \n\t"
+            "movups     (%2), %%xmm1        \n\t"
+            "movups     16(%2), %%xmm2      \n\t"
+            "movups     32(%2), %%xmm3      \n\t"
+            "shufps     $0x88, %%xmm2, %%xmm1 \n\t"
+            "movups     48(%2), %%xmm4      \n\t"
+            "movups     (%1), %%xmm5        \n\t"
+            "shufps     $0x88, %%xmm4, %%xmm3 \n\t"
+            "movups     16(%1), %%xmm6      \n\t"
+            "mulps      %%xmm5, %%xmm1      \n\t"
+            "add        $64,    %2          \n\t"
+            "mulps      %%xmm6, %%xmm3      \n\t"
+            "movups     %%xmm1, (%0)        \n\t"
+            "add        $32,    %1          \n\t"
+            "movups     %%xmm3, 16(%0)      \n\t"
+            "add        $32,    %0          \n\t"
+            "sub        $1, %%ecx           \n\t"
+            "jnz        1b                  \n\t"
+            :"+r"(t), "+r"(w), "+r"(c)
+            :"c"(loops)
+        );
+    }
+#endif //ARCH_X86
+    for (; i < n; i++)
+    {
+        *t++ = *w++ * *c;
+        c += 2;
+    }
+}
+
 // private implementation of the surround decoder
 class decoder_impl {
 public:
@@ -238,23 +461,10 @@ private:
         // 1. scale the input by the window function; this serves a dual purpose:
         // - first it improves the FFT resolution b/c boundary discontinuities (and their frequencies) get removed
         // - second it allows for smooth blending of varying filters between the blocks
-        {
-            float* pWnd = &wnd[0];
-            float* pLt = &lt[0];
-            float* pRt = &rt[0];
-            float* pIn0 = input1[0];
-            float* pIn1 = input1[1];
-            for (unsigned k=0;k<halfN;k++) {
-                *pLt++ = *pIn0++ * *pWnd;
-                *pRt++ = *pIn1++ * *pWnd++;
-            }
-            pIn0 = input2[0];
-            pIn1 = input2[1];
-            for (unsigned k=0;k<halfN;k++) {
-                *pLt++ = *pIn0++ * *pWnd;
-                *pRt++ = *pIn1++ * *pWnd++;
-            }
-        }
+        vector_mul(&lt[0],     input1[0], &wnd[0],     halfN);
+        vector_mul(&rt[0],     input1[1], &wnd[0],     halfN);
+        vector_mul(&lt[halfN], input2[0], &wnd[halfN], halfN);
+        vector_mul(&rt[halfN], input2[1], &wnd[halfN], halfN);
 
 #ifdef USE_FFTW3
         // ... and tranform it into the frequency domain
@@ -427,10 +637,8 @@ private:
     void apply_filter(cfloat *signal, float *flt, float *target) {
         // filter the signal
         unsigned f;
-        for (f=0;f<=halfN;f++) {
-            src[f][0] = signal[f].real() * flt[f];
-            src[f][1] = signal[f].imag() * flt[f];
-        }
+        vector_complex_mul(&src[0][0], reinterpret_cast<const float*>(signal),
+                           flt, halfN + 1);
 #ifdef USE_FFTW3
         // transform into time domain
         fftwf_execute(store);
@@ -458,20 +666,11 @@ private:
         ff_fft_permute(fftContextReverse, (FFTComplex*)&src[0]);
         ff_fft_calc(fftContextReverse, (FFTComplex*)&src[0]);
 
-        float* pT1   = &target[current_buf*halfN];
-        float* pWnd1 = &wnd[0];
-        float* pDst1 = &src[0][0];
-        float* pT2   = &target[(current_buf^1)*halfN];
-        float* pWnd2 = &wnd[halfN];
-        float* pDst2 = &src[halfN][0];
-        // add the result to target, windowed
-        for (unsigned int k=0;k<halfN;k++)
-        {
-            // 1st part is overlap add
-            *pT1++ += *pWnd1++ * *pDst1; pDst1 += 2;
-            // 2nd part is set as has no history
-            *pT2++  = *pWnd2++ * *pDst2; pDst2 += 2;
-        }
+        // 1st part is overlap add, 2nd part is set as has no history
+        vector_overlap_add(&target[current_buf*halfN], &wnd[0],
+                           &src[0][0], halfN);
+        vector_window_stride2(&target[(current_buf^1)*halfN], &wnd[halfN],
+                              &src[halfN][0], halfN);
 #endif
     }
 
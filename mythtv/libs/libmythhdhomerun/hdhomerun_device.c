@@ -42,6 +42,7 @@ struct hdhomerun_device_t {
 	uint32_t device_id;
 	unsigned int tuner;
 	uint32_t lockkey;
+	size_t video_buffer_size;
 	char name[32];
 	char model[32];
 };
@@ -360,7 +361,12 @@ struct hdhomerun_video_sock_t *hdhomerun_device_get_video_sock(struct hdhomerun_
 		return hd->vs;
 	}
 
-	hd->vs = hdhomerun_video_create(hd->multicast_port, VIDEO_DATA_BUFFER_SIZE_1S * 2, hd->dbg);
+	size_t buffer_size = hd->video_buffer_size;
+	if (buffer_size == 0) {
+		buffer_size = VIDEO_DATA_BUFFER_SIZE_1S * 2;
+	}
+
+	hd->vs = hdhomerun_video_create(hd->multicast_port, buffer_size, hd->dbg);
 	if (!hd->vs) {
 		hdhomerun_debug_printf(hd->dbg, "hdhomerun_device_get_video_sock: failed to create video object\n");
 		return NULL;
@@ -1038,6 +1044,17 @@ int hdhomerun_device_wait_for_lock(struct hdhomerun_device_t *hd, struct hdhomer
 	}
 }
 
+int hdhomerun_device_set_video_buffer_size(struct hdhomerun_device_t *hd, size_t buffer_size)
+{
+	if (hd->vs) {
+		hdhomerun_debug_printf(hd->dbg, "hdhomerun_device_set_video_buffer_size: video socket already created\n");
+		return -1;
+	}
+
+	hd->video_buffer_size = buffer_size;
+	return 1;
+}
+
 int hdhomerun_device_stream_start(struct hdhomerun_device_t *hd)
 {
 	hdhomerun_device_get_video_sock(hd);
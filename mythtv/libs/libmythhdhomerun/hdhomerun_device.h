@@ -221,7 +221,13 @@ extern LIBTYPE int hdhomerun_device_wait_for_lock(struct hdhomerun_device_t *hd,
  * The buffer can losslessly store 1 second of data, however a more typical call rate would be every 15ms.
  *
  * The hdhomerun_device_stream_stop function tells the device to stop streaming data.
+ *
+ * The hdhomerun_device_set_video_buffer_size function sets the size of the buffer used to store
+ * stream data between the calls to hdhomerun_device_stream_recv. It must be called before
+ * streaming is started for the first time; if it is not called a default of 2 seconds of
+ * buffer is used.
  */
+extern LIBTYPE int hdhomerun_device_set_video_buffer_size(struct hdhomerun_device_t *hd, size_t buffer_size);
 extern LIBTYPE int hdhomerun_device_stream_start(struct hdhomerun_device_t *hd);
 extern LIBTYPE uint8_t *hdhomerun_device_stream_recv(struct hdhomerun_device_t *hd, size_t max_size, size_t *pactual_size);
 extern LIBTYPE void hdhomerun_device_stream_flush(struct hdhomerun_device_t *hd);
@@ -25,6 +25,40 @@ QEvent::Type ImageDLEvent::kEventType =
 QEvent::Type ThumbnailDLEvent::kEventType =
     (QEvent::Type) QEvent::registerEventType();
 
+// Maximum number of simultaneous artwork fetches.  A freshly scanned
+// library can queue hundreds of lookups, each with several full size
+// images; a small pool keeps that from serializing on the network
+// without flooding the grabber sites.
+static const int kMaxDownloadThreads = 4;
+
+// Pulls work off the parent's queues until both are empty.  Thumbnails
+// are what the user is looking at right now, so each worker drains
+// those before picking up the next full size artwork lookup.
+class ImageDownloadThread : public QThread
+{
+  public:
+    ImageDownloadThread(MetadataImageDownload *parent) : m_parent(parent) {}
+
+    void run(void)
+    {
+        while (true)
+        {
+            ThumbnailData *thumb;
+            while ((thumb = m_parent->moreThumbs()) != NULL)
+                m_parent->downloadThumb(thumb);
+
+            MetadataLookup *lookup = m_parent->moreDownloads();
+            if (!lookup)
+                break;
+
+            m_parent->downloadArtwork(lookup);
+        }
+    }
+
+  private:
+    MetadataImageDownload *m_parent;
+};
+
 MetadataImageDownload::MetadataImageDownload(QObject *parent)
 {
     m_parent = parent;
@@ -71,176 +105,191 @@ void MetadataImageDownload::cancel()
 
 void MetadataImageDownload::run()
 {
-    // Always handle thumbnails first, they're higher priority.
-    ThumbnailData *thumb;
-    while ((thumb = moreThumbs()) != NULL)
+    // Fetch with a bounded pool of workers.  Each worker always drains
+    // the thumbnail queue before touching the full size artwork, so the
+    // items on screen stay ahead of any background prefetch.
+    QList<ImageDownloadThread*> threads;
+    for (int i = 0; i < kMaxDownloadThreads; i++)
     {
-        QString sFilename = getDownloadFilename(thumb->title, thumb->url);
-
-        bool exists = QFile::exists(sFilename);
-        if (!exists && !thumb->url.isEmpty())
-            GetMythDownloadManager()->download(thumb->url, sFilename);
+        ImageDownloadThread *thread = new ImageDownloadThread(this);
+        thread->start();
+        threads.append(thread);
+    }
 
-        // inform parent we have thumbnail ready for it
-        if (QFile::exists(sFilename) && m_parent)
-        {
-            VERBOSE(VB_GENERAL|VB_EXTRA,
-                    QString("Threaded Image Thumbnail Download: %1")
-                    .arg(sFilename));
-            thumb->url = sFilename;
-            QCoreApplication::postEvent(m_parent,
-                           new ThumbnailDLEvent(thumb));
-        }
-        else
-            delete thumb;
+    for (QList<ImageDownloadThread*>::iterator i = threads.begin();
+            i != threads.end(); ++i)
+    {
+        (*i)->wait();
+        delete *i;
     }
+}
+
+void MetadataImageDownload::downloadThumb(ThumbnailData *thumb)
+{
+    QString sFilename = getDownloadFilename(thumb->title, thumb->url);
+
+    bool exists = QFile::exists(sFilename);
+    if (!exists && !thumb->url.isEmpty())
+        GetMythDownloadManager()->download(thumb->url, sFilename);
 
-    MetadataLookup *lookup;
-    while ((lookup = moreDownloads()) != NULL)
+    // inform parent we have thumbnail ready for it
+    if (QFile::exists(sFilename) && m_parent)
     {
-        DownloadMap downloads = lookup->GetDownloads();
-        DownloadMap downloaded;
+        VERBOSE(VB_GENERAL|VB_EXTRA,
+                QString("Threaded Image Thumbnail Download: %1")
+                .arg(sFilename));
+        thumb->url = sFilename;
+        QCoreApplication::postEvent(m_parent,
+                       new ThumbnailDLEvent(thumb));
+    }
+    else
+        delete thumb;
+}
 
-        for (DownloadMap::iterator i = downloads.begin();
-                i != downloads.end(); ++i)
+void MetadataImageDownload::downloadArtwork(MetadataLookup *lookup)
+{
+    DownloadMap downloads = lookup->GetDownloads();
+    DownloadMap downloaded;
+
+    for (DownloadMap::iterator i = downloads.begin();
+            i != downloads.end(); ++i)
+    {
+        ArtworkType type = i.key();
+        ArtworkInfo info = i.value();
+        QString filename = getDownloadFilename( type, lookup,
+                               info.url );
+        if (lookup->GetHost().isEmpty())
         {
-            ArtworkType type = i.key();
-            ArtworkInfo info = i.value();
-            QString filename = getDownloadFilename( type, lookup,
-                                   info.url );
-            if (lookup->GetHost().isEmpty())
+            QString path = getLocalWritePath(lookup->GetType(), type);
+            QDir dirPath(path);
+            if (!dirPath.exists())
+                if (!dirPath.mkpath(path))
+                {
+                    VERBOSE(VB_GENERAL,
+                         QString("Metadata Image Download: Unable to create "
+                                 "path %1, aborting download.").arg(path));
+                    continue;
+                }
+            QString finalfile = path + "/" + filename;
+            QString oldurl = info.url;
+            info.url = finalfile;
+            if (!QFile::exists(finalfile) || lookup->GetAllowOverwrites())
             {
-                QString path = getLocalWritePath(lookup->GetType(), type);
-                QDir dirPath(path);
-                if (!dirPath.exists())
-                    if (!dirPath.mkpath(path))
-                    {
-                        VERBOSE(VB_GENERAL,
-                             QString("Metadata Image Download: Unable to create "
-                                     "path %1, aborting download.").arg(path));
-                        continue;
-                    }
-                QString finalfile = path + "/" + filename;
-                QString oldurl = info.url;
-                info.url = finalfile;
-                if (!QFile::exists(finalfile) || lookup->GetAllowOverwrites())
+                QFile dest_file(finalfile);
+                if (dest_file.exists())
                 {
-                    QFile dest_file(finalfile);
-                    if (dest_file.exists())
-                    {
-                        QFileInfo fi(finalfile);
-                        GetMythUI()->RemoveFromCacheByFile(fi.fileName());
-                        dest_file.remove();
-                    }
+                    QFileInfo fi(finalfile);
+                    GetMythUI()->RemoveFromCacheByFile(fi.fileName());
+                    dest_file.remove();
+                }
 
-                    VERBOSE(VB_GENERAL,
-                         QString("Metadata Image Download: %1 ->%2")
-                         .arg(oldurl).arg(finalfile));
-                    QByteArray *download = new QByteArray();
-                    GetMythDownloadManager()->download(oldurl, download);
-
-                    QImage testImage;
-                    bool didLoad = testImage.loadFromData(*download);
-                    if (!didLoad)
-                    {
-                        VERBOSE(VB_IMPORTANT,QString("Tried to write %1, "
-                                "but it appears to be an HTML redirect "
-                                "(filesize %2).")
-                                .arg(oldurl).arg(download->size()));
-                        delete download;
-                        download = NULL;
-                        continue;
-                    }
+                VERBOSE(VB_GENERAL,
+                     QString("Metadata Image Download: %1 ->%2")
+                     .arg(oldurl).arg(finalfile));
+                QByteArray *download = new QByteArray();
+                GetMythDownloadManager()->download(oldurl, download);
+
+                QImage testImage;
+                bool didLoad = testImage.loadFromData(*download);
+                if (!didLoad)
+                {
+                    VERBOSE(VB_IMPORTANT,QString("Tried to write %1, "
+                            "but it appears to be an HTML redirect "
+                            "(filesize %2).")
+                            .arg(oldurl).arg(download->size()));
+                    delete download;
+                    download = NULL;
+                    continue;
+                }
 
-                    if (dest_file.open(QIODevice::WriteOnly))
+                if (dest_file.open(QIODevice::WriteOnly))
+                {
+                    off_t size = dest_file.write(*download, download->size());
+                    if (size != download->size())
                     {
-                        off_t size = dest_file.write(*download, download->size());
-                        if (size != download->size())
-                        {
-                            VERBOSE(VB_IMPORTANT,
-                            QString("Image Download: Error Writing Image "
-                                    "to file: %1").arg(finalfile));
-                        }
-                        else
-                            downloaded.insert(type, info);
+                        VERBOSE(VB_IMPORTANT,
+                        QString("Image Download: Error Writing Image "
+                                "to file: %1").arg(finalfile));
                     }
-
-                    delete download;
+                    else
+                        downloaded.insert(type, info);
                 }
-                else
-                    downloaded.insert(type, info);
+
+                delete download;
             }
             else
+                downloaded.insert(type, info);
+        }
+        else
+        {
+            QString path = getStorageGroupURL(type, lookup->GetHost());
+            QString finalfile = path + filename;
+            QString oldurl = info.url;
+            info.url = finalfile;
+            if (!RemoteFile::Exists(finalfile) || lookup->GetAllowOverwrites())
             {
-                QString path = getStorageGroupURL(type, lookup->GetHost());
-                QString finalfile = path + filename;
-                QString oldurl = info.url;
-                info.url = finalfile;
-                if (!RemoteFile::Exists(finalfile) || lookup->GetAllowOverwrites())
+
+                if (RemoteFile::Exists(finalfile))
                 {
+                    QFileInfo fi(finalfile);
+                    GetMythUI()->RemoveFromCacheByFile(fi.fileName());
+                    RemoteFile::DeleteFile(finalfile);
+                }
 
-                    if (RemoteFile::Exists(finalfile))
-                    {
-                        QFileInfo fi(finalfile);
-                        GetMythUI()->RemoveFromCacheByFile(fi.fileName());
-                        RemoteFile::DeleteFile(finalfile);
-                    }
+                VERBOSE(VB_GENERAL,
+                    QString("Metadata Image Download: %1 -> %2")
+                    .arg(oldurl).arg(finalfile));
+                QByteArray *download = new QByteArray();
+                GetMythDownloadManager()->download(oldurl, download);
 
-                    VERBOSE(VB_GENERAL,
-                        QString("Metadata Image Download: %1 -> %2")
-                        .arg(oldurl).arg(finalfile));
-                    QByteArray *download = new QByteArray();
-                    GetMythDownloadManager()->download(oldurl, download);
-
-                    QImage testImage;
-                    bool didLoad = testImage.loadFromData(*download);
-                    if (!didLoad)
-                    {
-                        VERBOSE(VB_IMPORTANT,QString("Tried to write %1, "
-                                "but it appears to be an HTML redirect "
-                                "or corrupt file (filesize %2).")
-                                .arg(oldurl).arg(download->size()));
-                        delete download;
-                        download = NULL;
-                        continue;
-                    }
+                QImage testImage;
+                bool didLoad = testImage.loadFromData(*download);
+                if (!didLoad)
+                {
+                    VERBOSE(VB_IMPORTANT,QString("Tried to write %1, "
+                            "but it appears to be an HTML redirect "
+                            "or corrupt file (filesize %2).")
+                            .arg(oldurl).arg(download->size()));
+                    delete download;
+                    download = NULL;
+                    continue;
+                }
 
-                    RemoteFile *outFile = new RemoteFile(finalfile, true);
-                    if (!outFile->isOpen())
+                RemoteFile *outFile = new RemoteFile(finalfile, true);
+                if (!outFile->isOpen())
+                {
+                    VERBOSE(VB_IMPORTANT,
+                        QString("Image Download: Failed to open "
+                                "remote file (%1) for write.  Does "
+                                "Storage Group Exist?")
+                                .arg(finalfile));
+                    delete outFile;
+                    outFile = NULL;
+                }
+                else
+                {
+                    off_t written = outFile->Write(*download,
+                                                   download->size());
+                    if (written != download->size())
                     {
                         VERBOSE(VB_IMPORTANT,
-                            QString("Image Download: Failed to open "
-                                    "remote file (%1) for write.  Does "
-                                    "Storage Group Exist?")
-                                    .arg(finalfile));
-                        delete outFile;
-                        outFile = NULL;
+                        QString("Image Download: Error Writing Image "
+                                "to file: %1").arg(finalfile));
                     }
                     else
-                    {
-                        off_t written = outFile->Write(*download,
-                                                       download->size());
-                        if (written != download->size())
-                        {
-                            VERBOSE(VB_IMPORTANT,
-                            QString("Image Download: Error Writing Image "
-                                    "to file: %1").arg(finalfile));
-                        }
-                        else
-                            downloaded.insert(type, info);
-                        delete outFile;
-                        outFile = NULL;
-                    }
-
-                    delete download;
+                        downloaded.insert(type, info);
+                    delete outFile;
+                    outFile = NULL;
                 }
-                else
-                    downloaded.insert(type, info);
+
+                delete download;
             }
+            else
+                downloaded.insert(type, info);
         }
-        lookup->SetDownloads(downloaded);
-        QCoreApplication::postEvent(m_parent, new ImageDLEvent(lookup));
     }
+    lookup->SetDownloads(downloaded);
+    QCoreApplication::postEvent(m_parent, new ImageDLEvent(lookup));
 }
 
 ThumbnailData* MetadataImageDownload::moreThumbs()
@@ -57,8 +57,12 @@ class MPUBLIC MetadataImageDownload : public QThread
 
   private:
 
+    friend class ImageDownloadThread;  // worker threads share our queues
+
     ThumbnailData*             moreThumbs();
     MetadataLookup*            moreDownloads();
+    void                       downloadThumb(ThumbnailData *thumb);
+    void                       downloadArtwork(MetadataLookup *lookup);
 
     QObject                   *m_parent;
     QList<MetadataLookup*>     m_downloadList;
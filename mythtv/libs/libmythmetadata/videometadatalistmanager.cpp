@@ -1,4 +1,4 @@
-#include <map>
+#include <QHash>
 
 #include "mythdb.h"
 #include "videometadatalistmanager.h"
@@ -10,8 +10,10 @@ class VideoMetadataListManagerImp
     typedef VideoMetadataListManager::metadata_list metadata_list;
 
   private:
-    typedef std::map<unsigned int, metadata_list::iterator> int_to_meta;
-    typedef std::map<QString, metadata_list::iterator> string_to_meta;
+    // Hash indexes over the list; the list itself stays a std::list so
+    // that held iterators survive insertions and unrelated erases.
+    typedef QHash<unsigned int, metadata_list::iterator> int_to_meta;
+    typedef QHash<QString, metadata_list::iterator> string_to_meta;
 
   public:
     void setList(metadata_list &list)
@@ -20,12 +22,14 @@ class VideoMetadataListManagerImp
         m_file_map.clear();
         m_meta_list.swap(list);
 
+        m_id_map.reserve(m_meta_list.size());
+        m_file_map.reserve(m_meta_list.size());
+
         for (metadata_list::iterator p = m_meta_list.begin();
              p != m_meta_list.end(); ++p)
         {
-            m_id_map.insert(int_to_meta::value_type((*p)->GetID(), p));
-            m_file_map.insert(
-                    string_to_meta::value_type((*p)->GetFilename(), p));
+            m_id_map.insert((*p)->GetID(), p);
+            m_file_map.insert((*p)->GetFilename(), p);
         }
     }
 
@@ -40,7 +44,7 @@ class VideoMetadataListManagerImp
         string_to_meta::const_iterator p = m_file_map.find(file_name);
         if (p != m_file_map.end())
         {
-            return *(p->second);
+            return *(p.value());
         }
         return VideoMetadataPtr();
     }
@@ -50,7 +54,7 @@ class VideoMetadataListManagerImp
         int_to_meta::const_iterator p = m_id_map.find(db_id);
         if (p != m_id_map.end())
         {
-            return *(p->second);
+            return *(p.value());
         }
         return VideoMetadataPtr();
     }
@@ -74,7 +78,7 @@ class VideoMetadataListManagerImp
 
             if (im != m_id_map.end())
             {
-                metadata_list::iterator mdi = im->second;
+                metadata_list::iterator mdi = im.value();
                 (*mdi)->DeleteFromDatabase();
 
                 m_id_map.erase(im);
@@ -65,6 +65,53 @@ namespace
         image_ext m_image_ext;
         DirListType &m_video_files;
     };
+
+    struct CheckStruct
+    {
+        bool check;
+        QString host;
+    };
+
+    typedef std::map<QString, CheckStruct> FileCheckList;
+
+    // Scans a single storage directory.  One of these runs per
+    // configured directory, so separate (typically NFS) mounts are
+    // walked concurrently instead of back to back.
+    class VideoScanDirThread : public QThread
+    {
+      public:
+        VideoScanDirThread(const QString &directory,
+                           const QStringList &image_extensions,
+                           const FileAssociations::ext_ignore_list &ext_list,
+                           bool list_unknown) :
+            m_success(false), m_directory(directory),
+            m_imageExtensions(image_extensions), m_extList(ext_list),
+            m_listUnknown(list_unknown)
+        {
+        }
+
+        void run(void)
+        {
+            VERBOSE(VB_GENERAL, QString("buildFileList directory = %1")
+                    .arg(m_directory));
+
+            dirhandler<FileCheckList> dh(m_files, m_imageExtensions);
+            m_success = ScanVideoDirectory(m_directory, &dh, m_extList,
+                                           m_listUnknown);
+        }
+
+        bool IsSuccess(void) const { return m_success; }
+        const QString &GetDirectory(void) const { return m_directory; }
+        const FileCheckList &GetFileList(void) const { return m_files; }
+
+      private:
+        bool          m_success;
+        QString       m_directory;
+        QStringList   m_imageExtensions;
+        FileAssociations::ext_ignore_list m_extList;
+        bool          m_listUnknown;
+        FileCheckList m_files;
+    };
 }
 
 class VideoMetadataListManager;
@@ -106,27 +153,49 @@ class VideoScannerThread : public QThread
         FileCheckList fs_files;
         failedSGHosts.clear();
 
+        FileAssociations::ext_ignore_list ext_list;
+        FileAssociations::getFileAssociation().getExtensionIgnoreList(ext_list);
+
         if (m_HasGUI)
             SendProgressEvent(counter, (uint)m_directories.size(),
                               tr("Searching for video files"));
+
+        // Walk all storage directories in parallel; each is typically
+        // a separate mount, so the traversals don't compete for the
+        // same disk or NFS server.
+        std::vector<VideoScanDirThread*> scanners;
         for (QStringList::const_iterator iter = m_directories.begin();
              iter != m_directories.end(); ++iter)
         {
-            if (!buildFileList(*iter, imageExtensions, fs_files))
-            {
-                if (iter->startsWith("myth://"))
-                {
-                    QUrl sgurl = *iter;
-                    QString host = sgurl.host();
-                    QString path = sgurl.path();
+            VideoScanDirThread *scanner = new VideoScanDirThread(
+                *iter, imageExtensions, ext_list, m_ListUnknown);
+            scanner->start();
+            scanners.push_back(scanner);
+        }
 
-                    failedSGHosts.append(host);
+        for (uint i = 0; i < scanners.size(); i++)
+        {
+            VideoScanDirThread *scanner = scanners[i];
+            scanner->wait();
 
-                    VERBOSE(VB_GENERAL, QString("Failed to scan :%1:").arg(*iter));
-                }
+            if (scanner->IsSuccess())
+            {
+                fs_files.insert(scanner->GetFileList().begin(),
+                                scanner->GetFileList().end());
             }
+            else if (scanner->GetDirectory().startsWith("myth://"))
+            {
+                QUrl sgurl = scanner->GetDirectory();
+                failedSGHosts.append(sgurl.host());
+
+                VERBOSE(VB_GENERAL, QString("Failed to scan :%1:")
+                        .arg(scanner->GetDirectory()));
+            }
+
             if (m_HasGUI)
                 SendProgressEvent(++counter);
+
+            delete scanner;
         }
 
         PurgeList db_remove;
@@ -158,14 +227,7 @@ class VideoScannerThread : public QThread
 
   private:
 
-    struct CheckStruct
-    {
-        bool check;
-        QString host;
-    };
-
     typedef std::vector<std::pair<unsigned int, QString> > PurgeList;
-    typedef std::map<QString, CheckStruct> FileCheckList;
 
     void removeOrphans(unsigned int id, const QString &filename)
     {
@@ -312,18 +374,6 @@ class VideoScannerThread : public QThread
         return ret;
     }
 
-    bool buildFileList(const QString &directory,
-                                        const QStringList &imageExtensions,
-                                        FileCheckList &filelist)
-    {
-        VERBOSE(VB_GENERAL, QString("buildFileList directory = %1").arg(directory));
-        FileAssociations::ext_ignore_list ext_list;
-        FileAssociations::getFileAssociation().getExtensionIgnoreList(ext_list);
-
-        dirhandler<FileCheckList> dh(filelist, imageExtensions);
-        return ScanVideoDirectory(directory, &dh, ext_list, m_ListUnknown);
-    }
-
     void SendProgressEvent(uint progress, uint total = 0,
             QString messsage = QString())
     {
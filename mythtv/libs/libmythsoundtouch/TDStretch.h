@@ -246,6 +246,7 @@ public:
         virtual void overlapMulti(float *output, const float *input) const;
 #endif
         double calcCrossCorrStereo(const float *mixingPos, const float *compare) const;
+        double calcCrossCorrMono(const float *mixingPos, const float *compare) const;
         virtual void overlapStereo(float *output, const float *input) const;
     };
 
@@ -260,6 +261,7 @@ public:
         double calcCrossCorrMulti(const float *mixingPos, const float *compare) const;
 #endif
         double calcCrossCorrStereo(const float *mixingPos, const float *compare) const;
+        double calcCrossCorrMono(const float *mixingPos, const float *compare) const;
     };
 
 #endif /// ALLOW_SSE3
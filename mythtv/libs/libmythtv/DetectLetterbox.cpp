@@ -6,11 +6,15 @@
 #include "videoouttypes.h"
 #include "mythcorecontext.h"
 
+/// How many frames per second Detect() actually scans
+static const int kDetectionsPerSecond = 4;
+
 DetectLetterbox::DetectLetterbox(MythPlayer* const player)
 {
     int dbAdjustFill = gCoreContext->GetNumSetting("AdjustFill", 0);
     isDetectLetterbox = dbAdjustFill >= kAdjustFill_AutoDetect_DefaultOff;
     firstFrameChecked = 0;
+    detectLetterboxNextUntestedFrame = 0;
     detectLetterboxDefaultMode = (AdjustFillMode) max((int) kAdjustFill_Off,
                                  dbAdjustFill - kAdjustFill_AutoDetect_DefaultOff);
     detectLetterboxSwitchFrame = -1;
@@ -85,6 +89,17 @@ void DetectLetterbox::Detect(VideoFrame *frame)
         return;
     }
 
+    // The bars only move on the timescale of program content, so there
+    // is no need to scan every frame; a few samples per second keeps
+    // the cost off the frame path. Seeking (in either direction) lands
+    // outside the expected window and restarts the schedule.
+    const int sampleInterval =
+        max(1, (int) (m_player->GetFrameRate() / kDetectionsPerSecond));
+    if (frameNumber < detectLetterboxNextUntestedFrame &&
+        detectLetterboxNextUntestedFrame - frameNumber <= sampleInterval)
+        return;
+    detectLetterboxNextUntestedFrame = frameNumber + sampleInterval;
+
     if (m_player->GetVideoAspect() > 1.5)
     {
         if (detectLetterboxDetectedMode != detectLetterboxDefaultMode)
@@ -129,34 +144,38 @@ void DetectLetterbox::Detect(VideoFrame *frame)
              detectionLine < NUMBER_OF_DETECTION_LINES;
              detectionLine++)
         {
-            int Y = buf[offsets[0] +  y     * pitches[0] +  xPos[detectionLine]];
-            int U = buf[offsets[1] + (y>>1) * pitches[1] + (xPos[detectionLine]>>1)];
-            int V = buf[offsets[2] + (y>>1) * pitches[2] + (xPos[detectionLine]>>1)];
-            if ((!topHit[detectionLine]) &&
-                ( Y > averageY + THRESHOLD || Y < averageY - THRESHOLD ||
-                  U < 128 - 32 || U > 128 + 32 ||
-                  V < 128 - 32 || V > 128 + 32 ))
+            if (!topHit[detectionLine])
             {
-                topHit[detectionLine] = y;
-                topHits++;
-                if (!minTop)
-                    minTop = y;
-                maxTop = y;
+                int Y = buf[offsets[0] +  y     * pitches[0] +  xPos[detectionLine]];
+                int U = buf[offsets[1] + (y>>1) * pitches[1] + (xPos[detectionLine]>>1)];
+                int V = buf[offsets[2] + (y>>1) * pitches[2] + (xPos[detectionLine]>>1)];
+                if ( Y > averageY + THRESHOLD || Y < averageY - THRESHOLD ||
+                     U < 128 - 32 || U > 128 + 32 ||
+                     V < 128 - 32 || V > 128 + 32 )
+                {
+                    topHit[detectionLine] = y;
+                    topHits++;
+                    if (!minTop)
+                        minTop = y;
+                    maxTop = y;
+                }
             }
 
-            Y = buf[offsets[0] + (height-y-1     ) * pitches[0] + xPos[detectionLine]];
-            U = buf[offsets[1] + ((height-y-1) >> 1) * pitches[1] + (xPos[detectionLine]>>1)];
-            V = buf[offsets[2] + ((height-y-1) >> 1) * pitches[2] + (xPos[detectionLine]>>1)];
-            if ((!bottomHit[detectionLine]) &&
-                ( Y > averageY + THRESHOLD || Y < averageY - THRESHOLD ||
-                  U < 128 - 32 || U > 128 + 32 ||
-                  V < 128 - 32 || V > 128 + 32 ))
+            if (!bottomHit[detectionLine])
             {
-                bottomHit[detectionLine] = y;
-                bottomHits++;
-                if (!minBottom)
-                    minBottom = y;
-                maxBottom = y;
+                int Y = buf[offsets[0] + (height-y-1     ) * pitches[0] + xPos[detectionLine]];
+                int U = buf[offsets[1] + ((height-y-1) >> 1) * pitches[1] + (xPos[detectionLine]>>1)];
+                int V = buf[offsets[2] + ((height-y-1) >> 1) * pitches[2] + (xPos[detectionLine]>>1)];
+                if ( Y > averageY + THRESHOLD || Y < averageY - THRESHOLD ||
+                     U < 128 - 32 || U > 128 + 32 ||
+                     V < 128 - 32 || V > 128 + 32 )
+                {
+                    bottomHit[detectionLine] = y;
+                    bottomHits++;
+                    if (!minBottom)
+                        minBottom = y;
+                    maxBottom = y;
+                }
             }
         }
 
@@ -323,6 +342,7 @@ void DetectLetterbox::SetDetectLetterbox(bool detect)
     detectLetterboxSwitchFrame = -1;
     detectLetterboxDetectedMode = m_player->GetAdjustFill();
     firstFrameChecked = 0;
+    detectLetterboxNextUntestedFrame = 0;
 }
 
 bool DetectLetterbox::GetDetectLetterbox()
@@ -19,6 +19,7 @@ public:
 private:
     bool isDetectLetterbox;
     int firstFrameChecked;
+    long long detectLetterboxNextUntestedFrame; // Frame to scan next
 
     AdjustFillMode detectLetterboxDefaultMode;
     AdjustFillMode detectLetterboxDetectedMode; // Wich mode was last detected
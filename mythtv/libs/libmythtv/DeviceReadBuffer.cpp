@@ -488,6 +488,58 @@ uint DeviceReadBuffer::Read(unsigned char *buf, const uint count)
     return cnt;
 }
 
+/** \fn DeviceReadBuffer::WaitForReadSegments(unsigned char*&, uint&, unsigned char*&, uint&)
+ *  \brief Returns the ring segments holding captured data, without copying.
+ *
+ *   The data is returned as up to two segments since it may wrap
+ *   around the end of the ring. The segments remain valid, and are
+ *   not overwritten by the capture thread, until the caller releases
+ *   them with Discard(). Blocks like Read() until at least min_read
+ *   bytes are available.
+ *
+ *  \return total number of bytes in the two segments
+ */
+uint DeviceReadBuffer::WaitForReadSegments(unsigned char *&buf1, uint &len1,
+                                           unsigned char *&buf2, uint &len2)
+{
+    uint avail = WaitForUsed(min_read);
+
+    QMutexLocker locker(&lock);
+
+    avail = min((size_t) avail, used);
+
+    buf1 = readPtr;
+    buf2 = NULL;
+    len2 = 0;
+
+    size_t contig = endPtr - readPtr;
+    if (avail > contig)
+    {
+        len1 = contig;
+        buf2 = buffer;
+        len2 = avail - contig;
+    }
+    else
+    {
+        len1 = avail;
+    }
+
+    return len1 + len2;
+}
+
+/** \fn DeviceReadBuffer::Discard(uint)
+ *  \brief Releases 'len' bytes obtained via WaitForReadSegments()
+ *         back to the capture thread.
+ */
+void DeviceReadBuffer::Discard(uint len)
+{
+    QMutexLocker locker(&lock);
+    used    -= len;
+    readPtr += len;
+    if (readPtr >= endPtr)
+        readPtr = buffer + (readPtr - endPtr);
+}
+
 /** \fn DeviceReadBuffer::WaitForUnused(uint) const
  *  \param needed Number of bytes we want to write
  *  \return bytes available for writing
@@ -51,6 +51,11 @@ class DeviceReadBuffer
 
     uint Read(unsigned char *buf, uint count);
 
+    // Zero-copy interface; process data in the ring, then Discard() it.
+    uint WaitForReadSegments(unsigned char *&buf1, uint &len1,
+                             unsigned char *&buf2, uint &len2);
+    void Discard(uint len);
+
   private:
     static void *boot_ringbuffer(void *);
     void fill_ringbuffer(void);
@@ -1905,6 +1905,7 @@ int NuppelVideoRecorder::SpawnChildren(void)
 void NuppelVideoRecorder::KillChildren(void)
 {
     childrenLive = false;
+    writeWait.wakeAll();
 
     pthread_join(write_tid, NULL);
     pthread_join(audio_tid, NULL);
@@ -1979,6 +1980,7 @@ void NuppelVideoRecorder::BufferIt(unsigned char *buf, int len, bool forcekey)
     if (act_video_buffer >= video_buffer_count)
         act_video_buffer = 0; // cycle to begin of buffer
     videobuffer[act]->freeToEncode = 1; // set last to prevent race
+    writeWait.wakeAll();
     return;
 }
 
@@ -2450,6 +2452,7 @@ void NuppelVideoRecorder::doAudioThread(void)
         if (act_audio_buffer >= audio_buffer_count)
             act_audio_buffer = 0;
         audiobuffer[act]->freeToEncode = 1;
+        writeWait.wakeAll();
 
         act_audio_sample++;
     }
@@ -2633,6 +2636,7 @@ void NuppelVideoRecorder::FormatTeletextSubtitles(struct VBIData *vbidata)
     if (act_text_buffer >= text_buffer_count)
         act_text_buffer = 0;
     textbuffer[act]->freeToEncode = 1;
+    writeWait.wakeAll();
 }
 #else  // USING_V4L
 void NuppelVideoRecorder::FormatTeletextSubtitles(struct VBIData *vbidata) {}
@@ -2671,6 +2675,7 @@ void NuppelVideoRecorder::AddTextData(unsigned char *buf, int len,
     if (act_text_buffer >= text_buffer_count)
         act_text_buffer = 0;
     textbuffer[act]->freeToEncode = 1;
+    writeWait.wakeAll();
 }
 
 #ifdef USING_V4L
@@ -2979,7 +2984,11 @@ void NuppelVideoRecorder::doWriteThread(void)
             }
             default:
             {
-                usleep(100);
+                // nothing to do; sleep until a capture thread queues a
+                // buffer instead of polling for one every 100 usec.
+                // The timeout covers wakeups sent between our check of
+                // the buffers and this wait.
+                writeWait.wait(&mutex, 100);
                 break;
             }
         }
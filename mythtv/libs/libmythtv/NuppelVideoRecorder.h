@@ -187,6 +187,10 @@ class MPUBLIC NuppelVideoRecorder : public RecorderBase, public CC608Input
     vector<struct audbuffertype *> audiobuffer;
     vector<struct txtbuffertype *> textbuffer;
 
+    // woken whenever a buffer above is handed to the write thread, so
+    // it does not have to poll for work
+    QWaitCondition writeWait;
+
     int act_video_encode;
     int act_video_buffer;
 
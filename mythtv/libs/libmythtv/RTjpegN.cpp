@@ -28,6 +28,12 @@
 #include "RTjpegN.h"
 
 #ifdef MMX
+extern "C" {
+#include "libavcodec/avcodec.h"
+// from libavcodec/dsputil.h, which is not C++ clean
+int mm_support(void);
+}
+
 static mmx_t RTjpeg_ones;
 static mmx_t RTjpeg_half;
 static mmx_t RTjpeg_C4;
@@ -35,6 +41,19 @@ static mmx_t RTjpeg_C6;
 static mmx_t RTjpeg_C2mC6;
 static mmx_t RTjpeg_C2pC6;
 static mmx_t RTjpeg_zero;
+
+/* 8 element counterparts of the constants above for the SSE2 paths */
+typedef union {
+ long long q[2];
+ int16_t w[8];
+} sse_t __attribute__ ((aligned (16)));
+
+static sse_t RTjpeg_sse2_ones;
+static sse_t RTjpeg_sse2_half;
+static sse_t RTjpeg_sse2_C4;
+static sse_t RTjpeg_sse2_C6;
+static sse_t RTjpeg_sse2_C2mC6;
+static sse_t RTjpeg_sse2_C2pC6;
 #endif
 
 //#define SHOWBLOCK 1
@@ -536,6 +555,11 @@ void RTjpeg::Quant(int16_t *block, int32_t *qtbl)
  int i;
  mmx_t *bl, *ql;
 
+ if (use_sse2)
+ {
+  QuantSSE2(block, qtbl);
+  return;
+ }
 
  ql=(mmx_t *)qtbl;
  bl=(mmx_t *)block;
@@ -567,6 +591,44 @@ void RTjpeg::Quant(int16_t *block, int32_t *qtbl)
   movq_r2m(mm0, *(bl++));
  }
 }
+
+/* as above, but eight coefficients per iteration in the xmm registers */
+void RTjpeg::QuantSSE2(int16_t *block, int32_t *qtbl)
+{
+ int i;
+ sse_t *bl, *ql;
+
+
+ ql=(sse_t *)qtbl;
+ bl=(sse_t *)block;
+
+ movdqa_m2r(RTjpeg_sse2_ones, xmm6);
+ movdqa_m2r(RTjpeg_sse2_half, xmm7);
+
+ for(i=8; i; i--)
+ {
+  movdqa_m2r(*(ql++), xmm0); /* quant vals (8) */
+  movdqa_m2r(*bl, xmm2); /* block vals (8) */
+  movdqa_r2r(xmm0, xmm1);
+  movdqa_r2r(xmm2, xmm3);
+
+  punpcklwd_r2r(xmm6, xmm0); /*           1 qd ... 1 qa */
+  punpckhwd_r2r(xmm6, xmm1); /* 1 qh ... 1 qe */
+
+  punpcklwd_r2r(xmm7, xmm2); /*                   32767 bd ... 32767 ba */
+  punpckhwd_r2r(xmm7, xmm3); /* 32767 bh ... 32767 be */
+
+  pmaddwd_r2r(xmm2, xmm0); /*                         32767+bd*qd ... 32767+ba*qa */
+  pmaddwd_r2r(xmm3, xmm1); /* 32767+bh*qh ... 32767+be*qe */
+
+  psrad_i2r(16, xmm0);
+  psrad_i2r(16, xmm1);
+
+  packssdw_r2r(xmm1, xmm0);
+
+  movdqa_r2m(xmm0, *(bl++));
+ }
+}
 #else
 void RTjpeg::QuantInit()
 {
@@ -606,6 +668,205 @@ void RTjpeg::DctInit()
     }
 }
 
+#ifdef MMX
+/*
+ * SSE2 version of the MMX transform below.  An xmm register holds a
+ * whole 8 element row, so each 1D pass runs once over the block instead
+ * of twice over 4 column halves, at the cost of explicit transposes to
+ * keep the passes vertical.  The arithmetic, and so the precision, is
+ * exactly that of the MMX version.
+ */
+
+static inline void RTjpeg_sse2_transpose(sse_t *bl, sse_t *scratch)
+{
+ /* interleave rows 0-3 into transposed column pairs */
+ movdqa_m2r(*bl, xmm0);
+ movdqa_m2r(*(bl+1), xmm1);
+ movdqa_m2r(*(bl+2), xmm2);
+ movdqa_m2r(*(bl+3), xmm3);
+
+ movdqa_r2r(xmm0, xmm4);
+ punpcklwd_r2r(xmm1, xmm0);  /* m01:m00 pairs */
+ punpckhwd_r2r(xmm1, xmm4);
+ movdqa_r2r(xmm2, xmm5);
+ punpcklwd_r2r(xmm3, xmm2);  /* m31:m21 pairs */
+ punpckhwd_r2r(xmm3, xmm5);
+
+ movdqa_r2r(xmm0, xmm6);
+ punpckldq_r2r(xmm2, xmm0);  /* columns 0,1 of rows 0-3 */
+ punpckhdq_r2r(xmm2, xmm6);  /* columns 2,3 */
+ movdqa_r2r(xmm4, xmm7);
+ punpckldq_r2r(xmm5, xmm4);  /* columns 4,5 */
+ punpckhdq_r2r(xmm5, xmm7);  /* columns 6,7 */
+
+ movdqa_r2m(xmm7, *scratch);
+
+ /* the same for rows 4-7 */
+ movdqa_m2r(*(bl+4), xmm1);
+ movdqa_m2r(*(bl+5), xmm2);
+ movdqa_r2r(xmm1, xmm3);
+ punpcklwd_r2r(xmm2, xmm1);
+ punpckhwd_r2r(xmm2, xmm3);
+ movdqa_m2r(*(bl+6), xmm2);
+ movdqa_r2r(xmm2, xmm7);
+ punpcklwd_m2r(*(bl+7), xmm2);
+ punpckhwd_m2r(*(bl+7), xmm7);
+
+ movdqa_r2r(xmm1, xmm5);
+ punpckldq_r2r(xmm2, xmm1);  /* columns 0,1 of rows 4-7 */
+ punpckhdq_r2r(xmm2, xmm5);  /* columns 2,3 */
+ movdqa_r2r(xmm3, xmm2);
+ punpckldq_r2r(xmm7, xmm3);  /* columns 4,5 */
+ punpckhdq_r2r(xmm7, xmm2);  /* columns 6,7 */
+
+ /* splice the quadword halves into whole transposed rows */
+ movdqa_r2r(xmm0, xmm7);
+ punpcklqdq_r2r(xmm1, xmm0);
+ movdqa_r2m(xmm0, *bl);
+ punpckhqdq_r2r(xmm1, xmm7);
+ movdqa_r2m(xmm7, *(bl+1));
+
+ movdqa_r2r(xmm6, xmm0);
+ punpcklqdq_r2r(xmm5, xmm6);
+ movdqa_r2m(xmm6, *(bl+2));
+ punpckhqdq_r2r(xmm5, xmm0);
+ movdqa_r2m(xmm0, *(bl+3));
+
+ movdqa_r2r(xmm4, xmm1);
+ punpcklqdq_r2r(xmm3, xmm4);
+ movdqa_r2m(xmm4, *(bl+4));
+ punpckhqdq_r2r(xmm3, xmm1);
+ movdqa_r2m(xmm1, *(bl+5));
+
+ movdqa_m2r(*scratch, xmm7);
+ movdqa_r2r(xmm7, xmm0);
+ punpcklqdq_r2r(xmm2, xmm7);
+ movdqa_r2m(xmm7, *(bl+6));
+ punpckhqdq_r2r(xmm2, xmm0);
+ movdqa_r2m(xmm0, *(bl+7));
+}
+
+static inline void RTjpeg_sse2_dct_pass(sse_t *bl, sse_t *scratch)
+{
+ /* stage 1 */
+ movdqa_m2r(*bl, xmm0);
+ movdqa_r2r(xmm0, xmm7);
+ paddw_m2r(*(bl+7), xmm0);           // tmp00 = x0 + x7
+ psubw_m2r(*(bl+7), xmm7);           // tmp07 = x0 - x7
+ movdqa_r2m(xmm7, *(scratch+1));     // save tmp07
+
+ movdqa_m2r(*(bl+1), xmm1);
+ movdqa_r2r(xmm1, xmm6);
+ paddw_m2r(*(bl+6), xmm1);           // tmp01 = x1 + x6
+ psubw_m2r(*(bl+6), xmm6);           // tmp06 = x1 - x6
+ movdqa_r2m(xmm6, *scratch);         // save tmp06
+
+ movdqa_m2r(*(bl+2), xmm2);
+ movdqa_r2r(xmm2, xmm5);
+ paddw_m2r(*(bl+5), xmm2);           // tmp02 = x2 + x5
+ psubw_m2r(*(bl+5), xmm5);           // tmp05 = x2 - x5
+
+ movdqa_m2r(*(bl+3), xmm3);
+ movdqa_r2r(xmm3, xmm4);
+ paddw_m2r(*(bl+4), xmm3);           // tmp03 = x3 + x4
+ psubw_m2r(*(bl+4), xmm4);           // tmp04 = x3 - x4
+
+ /* stage 2, even part */
+ movdqa_r2r(xmm0, xmm7);
+ paddw_r2r(xmm3, xmm0);              // tmp10 = tmp00 + tmp03
+ psubw_r2r(xmm3, xmm7);              // tmp13 = tmp00 - tmp03
+ movdqa_r2r(xmm1, xmm6);
+ paddw_r2r(xmm2, xmm1);              // tmp11 = tmp01 + tmp02
+ psubw_r2r(xmm2, xmm6);              // tmp12 = tmp01 - tmp02
+
+ /* stage 3 */
+ movdqa_r2r(xmm0, xmm3);
+ paddw_r2r(xmm1, xmm0);              // y0 = tmp10 + tmp11
+ psubw_r2r(xmm1, xmm3);              // y4 = tmp10 - tmp11
+ movdqa_r2m(xmm0, *bl);              // save y0
+ movdqa_r2m(xmm3, *(bl+4));          // save y4
+
+ paddw_r2r(xmm7, xmm6);              // tmp12 + tmp13
+ psllw_i2r(2, xmm6);
+ pmulhw_m2r(RTjpeg_sse2_C4, xmm6);   // z1
+
+ movdqa_r2r(xmm7, xmm2);
+ paddw_r2r(xmm6, xmm7);              // y2 = tmp13 + z1
+ psubw_r2r(xmm6, xmm2);              // y6 = tmp13 - z1
+ movdqa_r2m(xmm7, *(bl+2));          // save y2
+ movdqa_r2m(xmm2, *(bl+6));          // save y6
+
+ /* odd part, stages 4 and 5 */
+ movdqa_m2r(*scratch, xmm6);         // load tmp06
+ movdqa_m2r(*(scratch+1), xmm7);     // load tmp07
+ paddw_r2r(xmm5, xmm4);              // tmp10 = tmp04 + tmp05
+ paddw_r2r(xmm6, xmm5);              // tmp11 = tmp05 + tmp06
+ paddw_r2r(xmm7, xmm6);              // tmp12 = tmp06 + tmp07
+
+ movdqa_r2r(xmm4, xmm0);
+ psubw_r2r(xmm6, xmm0);
+ psllw_i2r(2, xmm0);
+ pmulhw_m2r(RTjpeg_sse2_C6, xmm0);   // z5
+
+ psllw_i2r(2, xmm4);
+ pmulhw_m2r(RTjpeg_sse2_C2mC6, xmm4);
+ paddw_r2r(xmm0, xmm4);              // z2
+
+ psllw_i2r(2, xmm6);
+ pmulhw_m2r(RTjpeg_sse2_C2pC6, xmm6);
+ paddw_r2r(xmm0, xmm6);              // z4
+
+ psllw_i2r(2, xmm5);
+ pmulhw_m2r(RTjpeg_sse2_C4, xmm5);   // z3
+
+ movdqa_r2r(xmm7, xmm1);
+ paddw_r2r(xmm5, xmm7);              // z11 = tmp07 + z3
+ psubw_r2r(xmm5, xmm1);              // z13 = tmp07 - z3
+
+ /* stage 6 */
+ movdqa_r2r(xmm1, xmm2);
+ paddw_r2r(xmm4, xmm1);              // y5 = z13 + z2
+ psubw_r2r(xmm4, xmm2);              // y3 = z13 - z2
+ movdqa_r2m(xmm1, *(bl+5));          // save y5
+ movdqa_r2m(xmm2, *(bl+3));          // save y3
+
+ movdqa_r2r(xmm7, xmm3);
+ paddw_r2r(xmm6, xmm7);              // y1 = z11 + z4
+ psubw_r2r(xmm6, xmm3);              // y7 = z11 - z4
+ movdqa_r2m(xmm7, *(bl+1));          // save y1
+ movdqa_r2m(xmm3, *(bl+7));          // save y7
+}
+
+void RTjpeg::DctYSSE2(uint8_t *idata, int rskip)
+{
+ int i;
+ mmx_t *idata2 = (mmx_t *)idata;
+ sse_t *bl = (sse_t *)block;
+ sse_t *scratch = (sse_t *)ws;  /* only the C transform uses ws */
+
+
+ // first copy the input 8 bit to the destination 16 bits
+
+ pxor_r2r(xmm7, xmm7);
+
+ for (i = 0; i < 8; i++)
+ {
+  movq_m2r(*idata2, xmm0);
+  punpcklbw_r2r(xmm7, xmm0);
+  movdqa_r2m(xmm0, *(bl+i));
+
+  idata2 += rskip;
+ }
+
+ // rows, then columns, as in the C version
+
+ RTjpeg_sse2_transpose(bl, scratch);
+ RTjpeg_sse2_dct_pass(bl, scratch);
+ RTjpeg_sse2_transpose(bl, scratch);
+ RTjpeg_sse2_dct_pass(bl, scratch);
+}
+#endif
+
 void RTjpeg::DctY(uint8_t *idata, int rskip)
 {
 #ifndef MMX
@@ -713,6 +974,11 @@ void RTjpeg::DctY(uint8_t *idata, int rskip)
   register mmx_t *dataptr = (mmx_t *)block;
   mmx_t *idata2 = (mmx_t *)idata;
 
+  if (use_sse2)
+  {
+      DctYSSE2(idata, rskip);
+      return;
+  }
 
    // first copy the input 8 bit to the destination 16 bits
 
@@ -2814,6 +3080,19 @@ RTjpeg::RTjpeg(void)
     RTjpeg_C2mC6.q=(long long)0x22A322A322A322A3LL;
     RTjpeg_C2pC6.q=(long long)0x539F539F539F539FLL;
     RTjpeg_zero.q =(long long)0x0000000000000000LL;
+
+    RTjpeg_sse2_ones.q[0]  = RTjpeg_sse2_ones.q[1]  = RTjpeg_ones.q;
+    RTjpeg_sse2_half.q[0]  = RTjpeg_sse2_half.q[1]  = RTjpeg_half.q;
+    RTjpeg_sse2_C4.q[0]    = RTjpeg_sse2_C4.q[1]    = RTjpeg_C4.q;
+    RTjpeg_sse2_C6.q[0]    = RTjpeg_sse2_C6.q[1]    = RTjpeg_C6.q;
+    RTjpeg_sse2_C2mC6.q[0] = RTjpeg_sse2_C2mC6.q[1] = RTjpeg_C2mC6.q;
+    RTjpeg_sse2_C2pC6.q[0] = RTjpeg_sse2_C2pC6.q[1] = RTjpeg_C2pC6.q;
+
+    // operator new only promises 8 byte alignment on some 32 bit
+    // platforms, so make sure movdqa on the members cannot fault
+    use_sse2 = (mm_support() & FF_MM_SSE2) &&
+        !(((unsigned long)block | (unsigned long)lqt |
+           (unsigned long)cqt  | (unsigned long)ws) & 15);
 #else
     lmask = cmask = 0;
 #endif
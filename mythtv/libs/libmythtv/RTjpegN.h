@@ -104,6 +104,8 @@ private:
 
 #ifdef MMX
     int bcomp(int16_t *rblock, int16_t *old, mmx_t *mask);
+    void QuantSSE2(int16_t *block, int32_t *qtbl);
+    void DctYSSE2(uint8_t *idata, int rskip);
 #else
     int bcomp(int16_t *rblock, int16_t *old, uint16_t *mask);
 #endif
@@ -131,6 +133,7 @@ private:
 #ifdef MMX
     mmx_t lmask;
     mmx_t cmask;
+    int use_sse2;
 #else
     uint16_t lmask;
     uint16_t cmask;
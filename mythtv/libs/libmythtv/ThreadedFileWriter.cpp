@@ -9,14 +9,20 @@
 #include <unistd.h>
 #include <signal.h>
 #include <fcntl.h>
+#ifndef USING_MINGW
+#include <sys/uio.h>
+#endif
 
 // Qt headers
 #include <QString>
 
 // MythTV headers
 #include "ThreadedFileWriter.h"
+#include "diskwritescheduler.h"
 #include "compat.h"
+#include "mythcorecontext.h"
 #include "mythverbose.h"
+#include "mythprofile.h"
 #include "mythconfig.h" // gives us HAVE_POSIX_FADVISE
 
 #if HAVE_POSIX_FADVISE < 1
@@ -30,9 +36,11 @@ static int posix_fadvise(int, off_t, off_t, int) { return 0; }
 #define LOC QString("TFW: ")
 #define LOC_ERR QString("TFW, Error: ")
 
-const uint ThreadedFileWriter::TFW_DEF_BUF_SIZE   = 2*1024*1024;
-const uint ThreadedFileWriter::TFW_MAX_WRITE_SIZE = TFW_DEF_BUF_SIZE / 4;
-const uint ThreadedFileWriter::TFW_MIN_WRITE_SIZE = TFW_DEF_BUF_SIZE / 32;
+const uint ThreadedFileWriter::TFW_DEF_BUF_SIZE    = 2*1024*1024;
+const uint ThreadedFileWriter::TFW_MAX_WRITE_SIZE  = TFW_DEF_BUF_SIZE / 4;
+const uint ThreadedFileWriter::TFW_MIN_WRITE_SIZE  = TFW_DEF_BUF_SIZE / 32;
+const uint ThreadedFileWriter::TFW_DIRECT_ALIGN    = 4096;
+const uint ThreadedFileWriter::TFW_DIRECT_POOL_CNT = 4;
 
 /** \class ThreadedFileWriter
  *  \brief This class supports the writing of recordings to disk.
@@ -101,6 +109,86 @@ static uint safe_write(int fd, const void *data, uint sz, bool &ok)
     return tot;
 }
 
+#ifndef USING_MINGW
+/** \fn safe_writev(int, const struct iovec*, int, bool &ok)
+ *  \brief Writes multiple buffers to disk in a single syscall.
+ *
+ *   Same retry semantics as safe_write(), but gathers all the
+ *   segments with writev() so a wrapped ring buffer does not
+ *   cost two syscalls per write.
+ *
+ *  \param fd     File descriptor
+ *  \param iov    Segments to write, in order
+ *  \param iovcnt Number of segments
+ */
+static uint safe_writev(int fd, const struct iovec *iov, int iovcnt, bool &ok)
+{
+    int ret;
+    uint tot = 0;
+    uint sz  = 0;
+    uint errcnt = 0;
+
+    for (int i = 0; i < iovcnt; i++)
+        sz += iov[i].iov_len;
+
+    while (tot < sz)
+    {
+        // rebuild the remaining segments after any short write
+        struct iovec riov[2];
+        uint skip = tot;
+        int  n    = 0;
+        for (int i = 0; i < iovcnt && n < 2; i++)
+        {
+            if (skip >= iov[i].iov_len)
+            {
+                skip -= iov[i].iov_len;
+                continue;
+            }
+            riov[n].iov_base = (char*)iov[i].iov_base + skip;
+            riov[n].iov_len  = iov[i].iov_len - skip;
+            skip = 0;
+            n++;
+        }
+
+        ret = writev(fd, riov, n);
+        if (ret < 0)
+        {
+            if (errno == EAGAIN)
+            {
+                VERBOSE(VB_IMPORTANT, LOC + "safe_writev(): Got EAGAIN.");
+                continue;
+            }
+            if (errno == ENOSPC)
+            {
+                VERBOSE(VB_IMPORTANT, LOC + "safe_writev(): Got ENOSPC "
+                        "(No space left on device).");
+                errcnt = 10;
+                tot = 0;
+                break;
+            }
+            errcnt++;
+            VERBOSE(VB_IMPORTANT, LOC_ERR + "safe_writev(): File I/O " +
+                    QString(" errcnt: %1").arg(errcnt) + ENO);
+
+            if (errcnt == 3)
+                break;
+        }
+        else
+        {
+            tot += ret;
+        }
+
+        if (tot < sz)
+        {
+            VERBOSE(VB_IMPORTANT, LOC + "safe_writev(): funky usleep");
+            usleep(1000);
+        }
+    }
+    ok = (errcnt < 3);
+    return tot;
+}
+#endif // !USING_MINGW
+
 /** \fn ThreadedFileWriter::boot_writer(void*)
  *  \brief Thunk that runs ThreadedFileWriter::DiskLoop(void)
  */
@@ -137,11 +225,15 @@ ThreadedFileWriter::ThreadedFileWriter(const QString &fname,
     no_writes(false),                    flush(false),
     write_is_blocked(false),             in_dtor(false),
     ignore_writes(false),                tfw_min_write_size(0),
+    tfw_write_align(0),
     // buffer position state
     rpos(0),                             wpos(0),
     written(0),
     // buffer
-    buf(NULL),                           tfw_buf_size(0)
+    buf(NULL),                           tfw_buf_size(0),
+    // direct I/O
+    m_direct(false),
+    m_shared_sync(false)
 {
     filename.detach();
 }
@@ -159,7 +251,24 @@ bool ThreadedFileWriter::Open(void)
     else
     {
         QByteArray fname = filename.toLocal8Bit();
-        fd = open(fname.constData(), flags, mode);
+#ifdef O_DIRECT
+        // Opt-in: recording writes bypass the page cache so they don't
+        // evict data the frontends are streaming. Not all filesystems
+        // support O_DIRECT (e.g. NFS without directio), so fall back
+        // to buffered writes if the open fails.
+        if (gCoreContext->GetNumSetting("RecordingDirectIO", 0))
+        {
+            fd = open(fname.constData(), flags | O_DIRECT, mode);
+            if (fd >= 0)
+                m_direct = true;
+            else
+                VERBOSE(VB_IMPORTANT, LOC +
+                        QString("O_DIRECT open of '%1' failed, using "
+                                "buffered writes").arg(filename) + ENO);
+        }
+#endif
+        if (fd < 0)
+            fd = open(fname.constData(), flags, mode);
     }
 
     if (fd < 0)
@@ -180,6 +289,29 @@ bool ThreadedFileWriter::Open(void)
 
         tfw_buf_size = TFW_DEF_BUF_SIZE;
         tfw_min_write_size = TFW_MIN_WRITE_SIZE;
+        tfw_write_align =
+            gCoreContext->GetNumSetting("RecordingWriteAlignment", 0);
+
+#ifdef O_DIRECT
+        if (m_direct)
+        {
+            for (uint i = 0; i < TFW_DIRECT_POOL_CNT; i++)
+            {
+                void *dbuf = NULL;
+                if (posix_memalign(&dbuf, TFW_DIRECT_ALIGN,
+                                   TFW_MAX_WRITE_SIZE))
+                {
+                    VERBOSE(VB_IMPORTANT, LOC_ERR +
+                            "Failed to allocate aligned buffer pool");
+                    DisableDirectIO();
+                    while (!m_direct_bufs.empty())
+                        free(m_direct_bufs.takeFirst());
+                    break;
+                }
+                m_direct_bufs.append((char*)dbuf);
+            }
+        }
+#endif
 
         bool res = 0;
         res = pthread_create(&writer, NULL, boot_writer, this);
@@ -191,13 +323,29 @@ bool ThreadedFileWriter::Open(void)
             return false;
         }
 
-        res = pthread_create(&syncer, NULL, boot_syncer, this);
-        if (res)
+#ifndef USING_MINGW
+        // syncs for files on the same disk are coordinated by a shared
+        // per-device thread, so multiple recordings on one spindle
+        // flush back to back instead of interleaved
+        struct stat st;
+        if ((filename != "-") && (fstat(fd, &st) == 0) &&
+            gCoreContext->GetNumSetting("PerDiskSyncScheduler", 1))
         {
-            VERBOSE(VB_IMPORTANT, LOC_ERR +
-                    QString("Starting syncer thread. ") +
-                    safe_eno_to_string(res));
-            return false;
+            DiskWriteScheduler::Register((uint64_t)st.st_dev, this);
+            m_shared_sync = true;
+        }
+#endif
+
+        if (!m_shared_sync)
+        {
+            res = pthread_create(&syncer, NULL, boot_syncer, this);
+            if (res)
+            {
+                VERBOSE(VB_IMPORTANT, LOC_ERR +
+                        QString("Starting syncer thread. ") +
+                        safe_eno_to_string(res));
+                return false;
+            }
         }
 
         return true;
@@ -211,13 +359,19 @@ ThreadedFileWriter::~ThreadedFileWriter()
 {
     no_writes = true;
 
+    if (m_shared_sync)
+        DiskWriteScheduler::Unregister(this);
+
     if (fd >= 0)
     {
         Flush();
         in_dtor = true; /* tells child thread to exit */
 
-        bufferSyncWait.wakeAll();
-        pthread_join(syncer, NULL);
+        if (!m_shared_sync)
+        {
+            bufferSyncWait.wakeAll();
+            pthread_join(syncer, NULL);
+        }
 
         bufferHasData.wakeAll();
         pthread_join(writer, NULL);
@@ -230,6 +384,31 @@ ThreadedFileWriter::~ThreadedFileWriter()
         delete [] buf;
         buf = NULL;
     }
+
+    while (!m_direct_bufs.empty())
+        free(m_direct_bufs.takeFirst());
+}
+
+/** \fn ThreadedFileWriter::DisableDirectIO(void)
+ *  \brief Switches the file descriptor back to buffered writes.
+ *
+ *   Used when a transfer cannot satisfy the O_DIRECT alignment
+ *   constraints, e.g. the unaligned tail written during a flush
+ *   or a seek to an unaligned offset.
+ */
+void ThreadedFileWriter::DisableDirectIO(void)
+{
+#ifdef O_DIRECT
+    if (!m_direct)
+        return;
+
+    long fl = fcntl(fd, F_GETFL);
+    if (fl >= 0)
+        (void) fcntl(fd, F_SETFL, fl & ~O_DIRECT);
+    m_direct = false;
+
+    VERBOSE(VB_FILE, LOC + "Direct I/O disabled");
+#endif
 }
 
 /** \fn ThreadedFileWriter::Write(const void*, uint)
@@ -324,6 +503,8 @@ uint ThreadedFileWriter::Write(const void *data, uint count)
         }
     }
 
+    MYTH_PROFILE_COUNT("tfw_bytes_queued", count);
+
     return count;
 }
 
@@ -342,7 +523,14 @@ long long ThreadedFileWriter::Seek(long long pos, int whence)
 {
     Flush();
 
-    return lseek(fd, pos, whence);
+    long long ret = lseek(fd, pos, whence);
+
+    // O_DIRECT requires the file offset to stay aligned; a seek to
+    // an arbitrary offset means we can no longer guarantee that.
+    if (m_direct && (ret > 0) && (ret % TFW_DIRECT_ALIGN))
+        DisableDirectIO();
+
+    return ret;
 }
 
 /** \fn ThreadedFileWriter::Flush(void)
@@ -488,16 +676,75 @@ void ThreadedFileWriter::DiskLoop(void)
            the 10% that was free... */
         size = (size > TFW_MAX_WRITE_SIZE) ? TFW_MAX_WRITE_SIZE : size;
 
+        if (tfw_write_align && !flush && !in_dtor &&
+            (size >= tfw_write_align))
+        {
+            // trim writes to the configured alignment; the remainder
+            // is picked up by the next write
+            size -= size % tfw_write_align;
+        }
+
+        if (m_direct)
+        {
+            // O_DIRECT transfers must be alignment sized; hold back the
+            // unaligned tail until more data arrives. On the final flush
+            // the tail is written through the page cache instead.
+            uint aligned = size - (size % TFW_DIRECT_ALIGN);
+            if (aligned)
+            {
+                size = aligned;
+            }
+            else if (!flush && !in_dtor)
+            {
+                buflock.lock();
+                bufferHasData.wait(&buflock, 100);
+                buflock.unlock();
+                continue;
+            }
+            else
+            {
+                DisableDirectIO();
+            }
+        }
+
         bool write_ok;
         if (ignore_writes)
             ;
+        else if (m_direct)
+        {
+            // gather from the (possibly wrapped) ring into an aligned
+            // staging buffer; the ring itself is not aligned
+            char *dbuf = m_direct_bufs.takeFirst();
+            if ((trpos + size) > tfw_buf_size)
+            {
+                uint first_chunk_size = tfw_buf_size - trpos;
+                memcpy(dbuf, buf + trpos, first_chunk_size);
+                memcpy(dbuf + first_chunk_size, buf, size - first_chunk_size);
+            }
+            else
+            {
+                memcpy(dbuf, buf + trpos, size);
+            }
+            size = safe_write(fd, dbuf, size, write_ok);
+            m_direct_bufs.append(dbuf);
+        }
         else if ((trpos + size) > tfw_buf_size)
         {
+#ifndef USING_MINGW
+            // gather both segments of the wrapped ring into one syscall
+            struct iovec iov[2];
+            iov[0].iov_base = buf + trpos;
+            iov[0].iov_len  = tfw_buf_size - trpos;
+            iov[1].iov_base = buf;
+            iov[1].iov_len  = size - iov[0].iov_len;
+            size = safe_writev(fd, iov, 2, write_ok);
+#else
             int first_chunk_size  = tfw_buf_size - trpos;
             int second_chunk_size = size - first_chunk_size;
             size = safe_write(fd, buf + trpos, first_chunk_size, write_ok);
             if ((int)size == first_chunk_size && write_ok)
                 size += safe_write(fd, buf, second_chunk_size, write_ok);
+#endif
         }
         else
         {
@@ -533,6 +780,18 @@ void ThreadedFileWriter::DiskLoop(void)
             ignore_writes = true;
         }
 
+        if (!ignore_writes && !write_ok && m_direct)
+        {
+            // probably EINVAL from a filesystem that accepted the
+            // O_DIRECT open but rejects direct writes; retry the
+            // remainder through the page cache
+            DisableDirectIO();
+        }
+
+        // queued minus written gives the backlog across all writers
+        if (!ignore_writes)
+            MYTH_PROFILE_COUNT("tfw_bytes_written", size);
+
         if (written <= tfw_min_write_size)
         {
             written += size;
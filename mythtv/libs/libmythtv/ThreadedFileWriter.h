@@ -5,6 +5,7 @@
 #include <QWaitCondition>
 #include <QString>
 #include <QMutex>
+#include <QList>
 
 #include <pthread.h>
 #include <stdint.h>
@@ -39,6 +40,8 @@ class ThreadedFileWriter
     uint BufUsedPriv(void) const;
     uint BufFreePriv(void) const;
 
+    void DisableDirectIO(void);
+
   private:
     // file info
     QString         filename;
@@ -55,6 +58,7 @@ class ThreadedFileWriter
     bool            in_dtor;
     bool            ignore_writes;
     long long       tfw_min_write_size;
+    uint            tfw_write_align; ///< trim writes to this alignment, 0=off
 
     // buffer position state
     volatile uint   rpos;    ///< points to end of data written to disk
@@ -66,6 +70,14 @@ class ThreadedFileWriter
     char           *buf;
     unsigned long   tfw_buf_size;
 
+    // direct I/O
+    bool            m_direct;      ///< true if fd was opened with O_DIRECT
+    QList<char*>    m_direct_bufs; ///< pool of aligned staging buffers
+
+    /// true if syncs are driven by the shared DiskWriteScheduler
+    /// instead of our own syncer thread
+    bool            m_shared_sync;
+
     // threads
     pthread_t       writer;
     pthread_t       syncer;
@@ -84,6 +96,10 @@ class ThreadedFileWriter
     static const uint TFW_MAX_WRITE_SIZE;
     /// Minimum to write to disk in a single write, when not flushing buffer.
     static const uint TFW_MIN_WRITE_SIZE;
+    /// O_DIRECT transfer size and file offset alignment.
+    static const uint TFW_DIRECT_ALIGN;
+    /// Number of aligned staging buffers allocated for O_DIRECT writes.
+    static const uint TFW_DIRECT_POOL_CNT;
 };
 
 #endif
@@ -0,0 +1,188 @@
+// ANSI C headers
+#include <cerrno>
+
+// POSIX C headers
+#include <sys/types.h>
+#include <unistd.h>
+
+// MythTV headers
+#include "asyncreadengine.h"
+#include "mythverbose.h"
+#include "compat.h"
+#include "util.h"
+
+#define LOC      QString("AsyncReadEngine(%1): ").arg(m_fd)
+#define LOC_ERR  QString("AsyncReadEngine(%1) Error: ").arg(m_fd)
+
+const uint AsyncReadEngine::kDefaultWorkers = 4;
+const uint AsyncReadEngine::kMaxRequests    = 16;
+
+void AsyncReadWorker::run(void)
+{
+    m_parent->RunWorker();
+}
+
+AsyncReadEngine::AsyncReadEngine(int fd, uint num_workers) :
+    m_fd(fd), m_doRun(true), m_inFlight(0)
+{
+    num_workers = max(num_workers, 1U);
+    for (uint i = 0; i < num_workers; i++)
+    {
+        AsyncReadWorker *worker = new AsyncReadWorker(this);
+        worker->start();
+        m_workers.push_back(worker);
+    }
+}
+
+AsyncReadEngine::~AsyncReadEngine()
+{
+    m_lock.lock();
+    m_doRun = false;
+    m_workWait.wakeAll();
+    m_lock.unlock();
+
+    while (!m_workers.empty())
+    {
+        AsyncReadWorker *worker = m_workers.takeFirst();
+        worker->wait();
+        delete worker;
+    }
+
+    CancelAll();
+}
+
+/** \fn AsyncReadEngine::Submit(long long, void*, uint)
+ *  \brief Queues a positioned read of 'size' bytes at 'offset' into 'dest'.
+ *
+ *   The destination buffer must remain valid until the request has
+ *   been collected with CollectAll() or discarded with CancelAll().
+ *
+ *  \return false if the maximum request count is already queued.
+ */
+bool AsyncReadEngine::Submit(long long offset, void *dest, uint size)
+{
+    QMutexLocker locker(&m_lock);
+
+    if ((uint)(m_pending.size() + m_done.size()) + m_inFlight >= kMaxRequests)
+        return false;
+
+    AsyncReadRequest *req = new AsyncReadRequest;
+    req->offset = offset;
+    req->dest   = dest;
+    req->size   = size;
+    req->result = -1;
+
+    m_pending.push_back(req);
+    m_workWait.wakeOne();
+
+    return true;
+}
+
+/** \fn AsyncReadEngine::CollectAll(void)
+ *  \brief Waits for all outstanding requests and returns the number of
+ *         bytes read into the contiguous run starting at the lowest
+ *         submitted offset.
+ *
+ *   Requests complete out of order; a short read or error on one
+ *   request truncates the result at that request's offset, so the
+ *   caller can fall back to its normal sequential path for the rest.
+ */
+int AsyncReadEngine::CollectAll(void)
+{
+    QMutexLocker locker(&m_lock);
+
+    while (!m_pending.empty() || m_inFlight)
+        m_doneWait.wait(&m_lock, 100);
+
+    // order completions by offset; they finish out of order
+    QList<AsyncReadRequest*> sorted;
+    while (!m_done.empty())
+    {
+        AsyncReadRequest *req = m_done.takeFirst();
+        int i = 0;
+        while (i < sorted.size() && sorted[i]->offset < req->offset)
+            i++;
+        sorted.insert(i, req);
+    }
+
+    int tot = 0;
+    bool hole = false;
+    long long next_offset = sorted.empty() ? 0LL : sorted.front()->offset;
+    while (!sorted.empty())
+    {
+        AsyncReadRequest *req = sorted.takeFirst();
+        if (!hole && req->offset == next_offset)
+        {
+            tot += req->result;
+            next_offset = req->offset + req->result;
+            // a short read leaves a hole; the caller re-reads
+            // everything past it sequentially
+            hole = ((uint)req->result != req->size);
+        }
+        delete req;
+    }
+
+    return tot;
+}
+
+/** \fn AsyncReadEngine::CancelAll(void)
+ *  \brief Discards queued requests and waits out any in flight.
+ */
+void AsyncReadEngine::CancelAll(void)
+{
+    QMutexLocker locker(&m_lock);
+
+    while (!m_pending.empty())
+        delete m_pending.takeFirst();
+
+    while (m_inFlight)
+        m_doneWait.wait(&m_lock, 100);
+
+    while (!m_done.empty())
+        delete m_done.takeFirst();
+}
+
+void AsyncReadEngine::RunWorker(void)
+{
+    m_lock.lock();
+    while (m_doRun)
+    {
+        if (m_pending.empty())
+        {
+            m_workWait.wait(&m_lock, 100);
+            continue;
+        }
+
+        AsyncReadRequest *req = m_pending.takeFirst();
+        m_inFlight++;
+        m_lock.unlock();
+
+        uint tot = 0;
+        while (tot < req->size)
+        {
+            int ret = pread(m_fd, (char*)req->dest + tot,
+                            req->size - tot, req->offset + tot);
+            if (ret < 0)
+            {
+                if (EAGAIN == errno || EINTR == errno)
+                    continue;
+                VERBOSE(VB_IMPORTANT, LOC_ERR +
+                        QString("pread(%1@%2) failed")
+                        .arg(req->size).arg(req->offset) + ENO);
+                break;
+            }
+            if (ret == 0) // EOF
+                break;
+            tot += ret;
+        }
+        req->result = tot;
+
+        m_lock.lock();
+        m_inFlight--;
+        m_done.push_back(req);
+        m_doneWait.wakeAll();
+    }
+    m_lock.unlock();
+}
+
+/* vim: set expandtab tabstop=4 shiftwidth=4: */
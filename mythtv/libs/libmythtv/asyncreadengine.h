@@ -0,0 +1,78 @@
+// -*- Mode: c++ -*-
+
+#ifndef _ASYNC_READ_ENGINE_H_
+#define _ASYNC_READ_ENGINE_H_
+
+#include <QWaitCondition>
+#include <QThread>
+#include <QMutex>
+#include <QList>
+
+#include "mythexp.h"
+
+class AsyncReadEngine;
+
+class AsyncReadWorker : public QThread
+{
+  public:
+    AsyncReadWorker(AsyncReadEngine *parent) : m_parent(parent) {}
+    virtual void run(void); // QThread
+
+  private:
+    AsyncReadEngine *m_parent;
+};
+
+/** \class AsyncReadEngine
+ *  \brief Services positioned reads against a file descriptor with
+ *         several requests in flight at once.
+ *
+ *   The read ahead thread normally issues one blocking read() at a
+ *   time, so a single slow request (common on NFS mounted storage
+ *   groups) serializes all playback I/O. This engine splits a read
+ *   into multiple pread() requests serviced by a small worker pool,
+ *   so the requests overlap in the kernel and one stalled request
+ *   no longer holds up the rest of the block.
+ *
+ *   pread() never modifies the file descriptor offset, so the
+ *   engine can share the descriptor with the normal read path;
+ *   callers remain responsible for advancing the offset afterward.
+ */
+class MPUBLIC AsyncReadEngine
+{
+    friend class AsyncReadWorker;
+
+  public:
+    AsyncReadEngine(int fd, uint num_workers = kDefaultWorkers);
+    ~AsyncReadEngine();
+
+    bool Submit(long long offset, void *dest, uint size);
+    int  CollectAll(void);
+    void CancelAll(void);
+
+    static const uint kDefaultWorkers;
+    static const uint kMaxRequests;
+
+  private:
+    void RunWorker(void);
+
+    typedef struct AsyncReadRequest
+    {
+        long long offset;
+        void     *dest;
+        uint      size;
+        int       result;
+    } AsyncReadRequest;
+
+    int  m_fd;
+    bool m_doRun;                        // protected by m_lock
+    uint m_inFlight;                     // protected by m_lock
+    QList<AsyncReadRequest*> m_pending;  // protected by m_lock
+    QList<AsyncReadRequest*> m_done;     // protected by m_lock
+    QList<AsyncReadWorker*>  m_workers;
+
+    QMutex         m_lock;
+    QWaitCondition m_workWait;  ///< signalled when a request is queued
+    QWaitCondition m_doneWait;  ///< signalled when a request completes
+};
+
+#endif // _ASYNC_READ_ENGINE_H_
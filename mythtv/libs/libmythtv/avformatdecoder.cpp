@@ -22,6 +22,7 @@ using namespace std;
 #include "programinfo.h"
 #include "mythcorecontext.h"
 #include "mythdbcon.h"
+#include "mythprofile.h"
 #include "iso639.h"
 #include "mpegtables.h"
 #include "atscdescriptors.h"
@@ -57,7 +58,6 @@ extern "C" {
 extern "C" {
 #include "libavutil/avutil.h"
 #include "libavcodec/ac3_parser.h"
-extern const uint8_t *ff_find_start_code(const uint8_t *p, const uint8_t *end, uint32_t *state);
 extern void ff_read_frame_flush(AVFormatContext *s);
 #include "libavformat/avio.h"
 #include "libswscale/swscale.h"
@@ -915,6 +915,19 @@ int AvFormatDecoder::OpenFile(RingBuffer *rbuffer, bool novideo,
         return -1;
     }
 
+    // Streams produced by our own recorders are well behaved MPEG
+    // transport/program streams whose codec parameters show up within
+    // the first second, so don't let av_find_stream_info() read its
+    // default five seconds (tens of MB for HDTV) before playback can
+    // start. Anything that appears after the bounded probe is picked
+    // up by the streams_changed callback below. Foreign files keep
+    // the full probe.
+    if (livetv || watchingrecording ||
+        (m_playbackinfo && m_playbackinfo->IsRecording()))
+    {
+        ic->max_analyze_duration = AV_TIME_BASE;
+    }
+
     int ret = -1;
     {
         QMutexLocker locker(avcodeclock);
@@ -975,6 +988,12 @@ int AvFormatDecoder::OpenFile(RingBuffer *rbuffer, bool novideo,
                 gopset = true;
             }
         }
+        else
+        {
+            // imported file; a previous playback may have left a seek
+            // index sidecar behind that we can use instead
+            recordingHasPositionMap |= InstallSeekIndexPosMap();
+        }
     }
 
     // If watching pre-recorded television or video use ffmpeg duration
@@ -2762,7 +2781,8 @@ void AvFormatDecoder::MpegPreProcessPkt(AVStream *stream, AVPacket *pkt)
 
     while (bufptr < bufend)
     {
-        bufptr = ff_find_start_code(bufptr, bufend, &start_code_state);
+        bufptr = H264Parser::find_start_code(bufptr, bufend,
+                                             &start_code_state);
 
         if (ringBuffer->IsDVD() && (start_code_state == SEQ_END_CODE))
             ringBuffer->DVD()->NewSequence(true);
@@ -4054,6 +4074,8 @@ bool AvFormatDecoder::ProcessAudioPacket(AVStream *curstream, AVPacket *pkt,
 // documented in decoderbase.h
 bool AvFormatDecoder::GetFrame(DecodeType decodetype)
 {
+    MYTH_PROFILE_SCOPE("AvFormatDecoder::GetFrame");
+
     AVPacket *pkt = NULL;
     bool have_err = false;
 
@@ -169,9 +169,10 @@ uint64_t BDRingBuffer::Seek(uint64_t pos)
     VERBOSE(VB_PLAYBACK|VB_EXTRA, LOC + QString("Seeking to %1.")
                 .arg(pos));
 
+    QMutexLocker locker(&m_bdnavLock);
     bd_seek_time(bdnav, pos);
 
-    return GetReadPosition();
+    return bd_tell(bdnav);
 }
 
 void BDRingBuffer::GetDescForPos(QString &desc) const
@@ -346,6 +347,11 @@ bool BDRingBuffer::OpenFile(const QString &lfilename, uint retry_ms)
     rawbitrate      = 8000;
     CalcReadAheadThresh();
 
+    // libbluray follows the playlist across clip boundaries in
+    // bd_read(), so the read ahead thread keeps the upcoming
+    // clip's data buffered for the decoder.
+    startreadahead  = true;
+
     rwlock.unlock();
 
     return true;
@@ -353,6 +359,7 @@ bool BDRingBuffer::OpenFile(const QString &lfilename, uint retry_ms)
 
 long long BDRingBuffer::GetReadPosition(void) const
 {
+    QMutexLocker locker(&m_bdnavLock);
     if (bdnav)
         return bd_tell(bdnav);
     return 0;
@@ -409,17 +416,40 @@ bool BDRingBuffer::SwitchTitle(uint32_t index)
     if (!bdnav)
         return false;
 
+    // Keep the read ahead thread out of bdnav while we switch;
+    // it is not yet running when we are called from OpenFile().
+    bool resume = readaheadrunning;
+    if (resume)
+    {
+        Pause();
+        WaitForPause();
+    }
+
     if (m_currentTitleInfo)
         bd_free_title_info(m_currentTitleInfo);
 
     m_currentTitleInfo = bd_get_title_info(bdnav, index);
 
     if (!m_currentTitleInfo)
+    {
+        if (resume)
+            Unpause();
         return false;
+    }
 
     bd_select_title(bdnav, index);
 
-    return UpdateTitleInfo(index);
+    bool ret = UpdateTitleInfo(index);
+
+    if (resume)
+    {
+        // Drop any data buffered from the old title, the new
+        // title starts reading at position zero.
+        Reset(true, false, true);
+        Unpause();
+    }
+
+    return ret;
 }
 
 bool BDRingBuffer::SwitchPlaylist(uint32_t index)
@@ -497,6 +527,7 @@ bool BDRingBuffer::SwitchAngle(uint angle)
 
 uint64_t BDRingBuffer::GetTotalReadPosition(void)
 {
+    QMutexLocker locker(&m_bdnavLock);
     if (bdnav)
         return bd_get_title_size(bdnav);
     return 0;
@@ -504,9 +535,11 @@ uint64_t BDRingBuffer::GetTotalReadPosition(void)
 
 int BDRingBuffer::safe_read(void *data, uint sz)
 {
+    QMutexLocker locker(&m_bdnavLock);
+
+    int result = 0;
     if (m_is_hdmv_navigation)
     {
-        int result = 0;
         while (result == 0)
         {
             BD_EVENT event;
@@ -520,11 +553,16 @@ int BDRingBuffer::safe_read(void *data, uint sz)
     }
     else
     {
-        bd_read(bdnav, (unsigned char *)data, sz);
+        result = bd_read(bdnav, (unsigned char *)data, sz);
     }
 
+    // The read ahead thread needs a zero return to detect the
+    // end of the title, treat errors the same way.
+    if (result < 0)
+        result = 0;
+
     m_currentTime = bd_tell(bdnav);
-    return sz;
+    return result;
 }
 
 double BDRingBuffer::GetFrameRate(void)
@@ -4,6 +4,7 @@
 #define BD_BLOCK_SIZE 6144LL
 
 #include <QString>
+#include <QMutex>
 
 #include "libmythbluray/bluray.h"
 #include "libmythbluray/keys.h"
@@ -76,6 +77,9 @@ class MPUBLIC BDRingBuffer : public RingBuffer
 
   protected:
     BLURAY            *bdnav;
+    /// Serializes access to bdnav between the read ahead
+    /// thread and the player/decoder threads.
+    mutable QMutex     m_bdnavLock;
     bool               m_is_hdmv_navigation;
     uint32_t           m_numTitles;
     uint32_t           m_mainTitle; // Index number of main title
@@ -614,8 +614,15 @@ static void parse_cc_packet(CC708Reader* cb_cbs, CaptionPacket* pkt,
                 fprintf(stderr, "\n");
             }
 #endif
-            append_cc(cb_cbs, service_number,
-                      &pkt_buf[block_data_offset], block_size);
+            // when no 708 window is on screen we only track which
+            // services are present; the command/window processing
+            // (and its allocations) can wait until captions are
+            // actually enabled.
+            if (cb_cbs->enabled)
+            {
+                append_cc(cb_cbs, service_number,
+                          &pkt_buf[block_data_offset], block_size);
+            }
 
             last_seen[service_number] = time(NULL);
         }
@@ -679,32 +686,32 @@ ushort CCtableG1[0x60] =
 //          8           9           a           b
 //          c           d           e           f
     0xA0, // unicode non-breaking space
-                (uchar)'�', (uchar)'�', (uchar)'�', /* 0xa0-0xa3 */
-    (uchar)'�', (uchar)'�', (uchar)'�', (uchar)'�', /* 0xa4-0xa7 */
-    (uchar)'�', (uchar)'�', (uchar)'�', (uchar)'�', /* 0xa8-0xab */
-    (uchar)'�', (uchar)'�', (uchar)'�', (uchar)'�', /* 0xac-0xaf */
-    (uchar)'�', (uchar)'�', (uchar)'�', (uchar)'�', /* 0xb0-0xb3 */
-    (uchar)'�', (uchar)'�', (uchar)'�', (uchar)'�', /* 0xb4-0xb7 */
-    (uchar)'�', (uchar)'�', (uchar)'�', (uchar)'�', /* 0xb8-0xbb */
-    (uchar)'�', (uchar)'�', (uchar)'�', (uchar)'�', /* 0xbc-0xbf */
-
-    (uchar)'�', (uchar)'�', (uchar)'�', (uchar)'�', /* 0xc0-0xc3 */
-    (uchar)'�', (uchar)'�', (uchar)'�', (uchar)'�', /* 0xc4-0xc7 */
-    (uchar)'�', (uchar)'�', (uchar)'�', (uchar)'�', /* 0xc8-0xcb */
-    (uchar)'�', (uchar)'�', (uchar)'�', (uchar)'�', /* 0xcc-0xcf */
-    (uchar)'�', (uchar)'�', (uchar)'�', (uchar)'�', /* 0xd0-0xd3 */
-    (uchar)'�', (uchar)'�', (uchar)'�', (uchar)'�', /* 0xd4-0xd7 */
-    (uchar)'�', (uchar)'�', (uchar)'�', (uchar)'�', /* 0xd8-0xdb */
-    (uchar)'�', (uchar)'�', (uchar)'�', (uchar)'�', /* 0xdc-0xdf */
-
-    (uchar)'�', (uchar)'�', (uchar)'�', (uchar)'�', /* 0xe0-0xe3 */
-    (uchar)'�', (uchar)'�', (uchar)'�', (uchar)'�', /* 0xe4-0xe7 */
-    (uchar)'�', (uchar)'�', (uchar)'�', (uchar)'�', /* 0xe8-0xeb */
-    (uchar)'�', (uchar)'�', (uchar)'�', (uchar)'�', /* 0xec-0xef */
-    (uchar)'�', (uchar)'�', (uchar)'�', (uchar)'�', /* 0xf0-0xf3 */
-    (uchar)'�', (uchar)'�', (uchar)'�', (uchar)'�', /* 0xf4-0xf7 */
-    (uchar)'�', (uchar)'�', (uchar)'�', (uchar)'�', /* 0xf8-0xfb */
-    (uchar)'�', (uchar)'�', (uchar)'�', (uchar)'�', /* 0xfc-0xff */
+                (uchar)'\xa1', (uchar)'\xa2', (uchar)'\xa3', /* 0xa0-0xa3 */
+    (uchar)'\xa4', (uchar)'\xa5', (uchar)'\xa6', (uchar)'\xa7', /* 0xa4-0xa7 */
+    (uchar)'\xa8', (uchar)'\xa9', (uchar)'\xaa', (uchar)'\xab', /* 0xa8-0xab */
+    (uchar)'\xac', (uchar)'\xad', (uchar)'\xae', (uchar)'\xaf', /* 0xac-0xaf */
+    (uchar)'\xb0', (uchar)'\xb1', (uchar)'\xb2', (uchar)'\xb3', /* 0xb0-0xb3 */
+    (uchar)'\xb4', (uchar)'\xb5', (uchar)'\xb6', (uchar)'\xb7', /* 0xb4-0xb7 */
+    (uchar)'\xb8', (uchar)'\xb9', (uchar)'\xba', (uchar)'\xbb', /* 0xb8-0xbb */
+    (uchar)'\xbc', (uchar)'\xbd', (uchar)'\xbe', (uchar)'\xbf', /* 0xbc-0xbf */
+
+    (uchar)'\xc0', (uchar)'\xc1', (uchar)'\xc2', (uchar)'\xc3', /* 0xc0-0xc3 */
+    (uchar)'\xc4', (uchar)'\xc5', (uchar)'\xc6', (uchar)'\xc7', /* 0xc4-0xc7 */
+    (uchar)'\xc8', (uchar)'\xc9', (uchar)'\xca', (uchar)'\xcb', /* 0xc8-0xcb */
+    (uchar)'\xcc', (uchar)'\xcd', (uchar)'\xce', (uchar)'\xcf', /* 0xcc-0xcf */
+    (uchar)'\xd0', (uchar)'\xd1', (uchar)'\xd2', (uchar)'\xd3', /* 0xd0-0xd3 */
+    (uchar)'\xd4', (uchar)'\xd5', (uchar)'\xd6', (uchar)'\xd7', /* 0xd4-0xd7 */
+    (uchar)'\xd8', (uchar)'\xd9', (uchar)'\xda', (uchar)'\xdb', /* 0xd8-0xdb */
+    (uchar)'\xdc', (uchar)'\xdd', (uchar)'\xde', (uchar)'\xdf', /* 0xdc-0xdf */
+
+    (uchar)'\xe0', (uchar)'\xe1', (uchar)'\xe2', (uchar)'\xe3', /* 0xe0-0xe3 */
+    (uchar)'\xe4', (uchar)'\xe5', (uchar)'\xe6', (uchar)'\xe7', /* 0xe4-0xe7 */
+    (uchar)'\xe8', (uchar)'\xe9', (uchar)'\xea', (uchar)'\xeb', /* 0xe8-0xeb */
+    (uchar)'\xec', (uchar)'\xed', (uchar)'\xee', (uchar)'\xef', /* 0xec-0xef */
+    (uchar)'\xf0', (uchar)'\xf1', (uchar)'\xf2', (uchar)'\xf3', /* 0xf0-0xf3 */
+    (uchar)'\xf4', (uchar)'\xf5', (uchar)'\xf6', (uchar)'\xf7', /* 0xf4-0xf7 */
+    (uchar)'\xf8', (uchar)'\xf9', (uchar)'\xfa', (uchar)'\xfb', /* 0xf8-0xfb */
+    (uchar)'\xfc', (uchar)'\xfd', (uchar)'\xfe', (uchar)'\xff', /* 0xfc-0xff */
 };
 
 ushort CCtableG2[0x60] =
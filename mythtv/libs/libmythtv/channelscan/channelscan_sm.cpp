@@ -150,6 +150,7 @@ ChannelScanSM::ChannelScanSM(
       otherTableTime(0),
       setOtherTables(false),
       inputname(_inputname),
+      cardtype(_cardtype),
       m_test_decryption(test_decryption),
       extend_scan_list(false),
       // Optional state
@@ -165,7 +166,8 @@ ChannelScanSM::ChannelScanSM(
       channelsFound(999),
       currentInfo(NULL),
       analogSignalHandler(new AnalogSignalHandler(this)),
-      scanner_thread_running(false)
+      scanner_thread_running(false),
+      helperTransportCount(0)
 {
     inputname.detach();
 
@@ -202,6 +204,18 @@ ChannelScanSM::~ChannelScanSM(void)
     StopScanner();
     VERBOSE(VB_CHANSCAN, LOC + "ChannelScanSMner Stopped");
 
+    while (!helperScanners.empty())
+    {
+        delete helperScanners.back();
+        helperScanners.pop_back();
+    }
+
+    while (!helperChannels.empty())
+    {
+        delete helperChannels.back();
+        helperChannels.pop_back();
+    }
+
     ScanStreamData *sd = NULL;
     if (GetDTVSignalMonitor())
     {
@@ -323,6 +337,7 @@ bool ChannelScanSM::ScanExistingTransports(uint sourceid, bool follow_nit)
     transportsScanned = 0;
     if (scanTransports.size())
     {
+        SpawnScanPartitions();
         nextIt   = scanTransports.begin();
         scanning = true;
     }
@@ -570,7 +585,8 @@ bool ChannelScanSM::TestNextProgramEncryption(void)
                 QString("%1 -- Testing decryption of program %2")
                 .arg(cur_chan).arg(pnum);
 
-            scan_monitor->ScanAppendTextToLog(msg_tr);
+            if (scan_monitor)
+                scan_monitor->ScanAppendTextToLog(msg_tr);
             VERBOSE(VB_CHANSCAN, msg);
 
 #ifdef USING_DVB
@@ -852,7 +868,8 @@ bool ChannelScanSM::UpdateChannelInfo(bool wait_until_complete)
             else if (kEncUnknown == *it)
                 msg = msg + " -- Unknown decryption status";
 
-            scan_monitor->ScanAppendTextToLog(msg_tr);
+            if (scan_monitor)
+                scan_monitor->ScanAppendTextToLog(msg_tr);
             VERBOSE(VB_CHANSCAN, msg);
         }
     }
@@ -922,7 +939,8 @@ bool ChannelScanSM::UpdateChannelInfo(bool wait_until_complete)
                 .arg(cchan).arg(cchan_cnt);
         }
 
-        scan_monitor->ScanAppendTextToLog(msg_tr);
+        if (scan_monitor)
+            scan_monitor->ScanAppendTextToLog(msg_tr);
         VERBOSE(VB_CHANSCAN, LOC + msg);
 
         currentEncryptionStatus.clear();
@@ -938,7 +956,7 @@ bool ChannelScanSM::UpdateChannelInfo(bool wait_until_complete)
             waitingForTables = false;
             nextIt = current.nextTransport();
         }
-        else
+        else if (scan_monitor)
         {
             scan_monitor->ScanPercentComplete(100);
             scan_monitor->ScanComplete();
@@ -1576,7 +1594,24 @@ void ChannelScanSM::HandleActiveScan(void)
     }
     else
     {
-        scan_monitor->ScanComplete();
+        // Wait for any helper scanners still working their
+        // partitions, then merge what they found into our list so
+        // GetChannelList() returns the channels from every tuner.
+        for (uint i = 0; i < helperScanners.size(); i++)
+        {
+            if (helperScanners[i]->scanning)
+                return;
+        }
+
+        for (uint i = 0; i < helperScanners.size(); i++)
+        {
+            channelList += helperScanners[i]->channelList;
+            helperScanners[i]->channelList.clear();
+            channelsFound += helperScanners[i]->channelsFound;
+        }
+
+        if (scan_monitor)
+            scan_monitor->ScanComplete();
         scanning = false;
         current = nextIt = scanTransports.end();
     }
@@ -1626,13 +1661,14 @@ void ChannelScanSM::ScanTransport(const transport_scan_items_it_t transport)
         return; // nothing to do
     }
 
-    if (channelsFound)
+    if (channelsFound && scan_monitor)
     {
         QString progress = QObject::tr(": Found %n", "", channelsFound);
         scan_monitor->ScanUpdateStatusTitleText(progress);
     }
 
-    scan_monitor->ScanUpdateStatusText(cur_chan);
+    if (scan_monitor)
+        scan_monitor->ScanUpdateStatusText(cur_chan);
     VERBOSE(VB_CHANSCAN, LOC + tune_msg_str);
 
     if (!Tune(transport))
@@ -1667,6 +1703,9 @@ void ChannelScanSM::StopScanner(void)
 {
     VERBOSE(VB_CHANSCAN, LOC + "ChannelScanSM::StopScanner");
 
+    for (uint i = 0; i < helperScanners.size(); i++)
+        helperScanners[i]->StopScanner();
+
     threadExit = true;
 
     if (scanner_thread_running)
@@ -1676,6 +1715,146 @@ void ChannelScanSM::StopScanner(void)
         signalMonitor->Stop();
 }
 
+/**
+ *  \brief Starts a helper scanner on a pre-built list of transports.
+ *
+ *   This is the helper scanner's equivalent of ScanTransports(),
+ *   used by SpawnScanPartitions() to hand a helper its share of
+ *   the transport list.
+ */
+bool ChannelScanSM::ScanPartition(
+    const transport_scan_items_t &partition, bool follow_nit)
+{
+    if (scanning)
+        return false;
+
+    scanTransports = partition;
+
+    extend_scan_list = follow_nit;
+    timer.start();
+    waitingForTables = false;
+
+    nextIt            = scanTransports.begin();
+    transportsScanned = 0;
+    scanning          = true;
+
+    return true;
+}
+
+/**
+ *  \brief Partitions the transport list across other idle tuners of
+ *   the same type on this video source.
+ *
+ *   Each helper runs a complete scan state machine on its own tuner
+ *   and its own share of the transports, so a full scan takes only
+ *   as long as the slowest partition. HandleActiveScan() merges the
+ *   helper channel lists into ours before reporting the scan
+ *   complete. Tuners whose channel cannot be opened are considered
+ *   busy and skipped, so this never steals a tuner from a recording.
+ */
+uint ChannelScanSM::SpawnScanPartitions(void)
+{
+    // Helper scanners have no scan monitor and don't get helpers
+    // of their own.
+    if (!scan_monitor)
+        return 0;
+
+    // Only DVB and HDHomeRun tuners can be opened independently of
+    // a TVRec here; analog and V4L scans are not partitioned.
+    if ((cardtype != "DVB") && (cardtype != "HDHOMERUN"))
+        return 0;
+
+    if (scanTransports.size() < 2)
+        return 0;
+
+    uint    our_cardid = channel->GetCardID();
+    QString our_subtype;
+    if ("DVB" == cardtype)
+        our_subtype = CardUtil::ProbeDVBType(channel->GetDevice()).toUpper();
+
+    vector<uint> cardids = CardUtil::GetCardIDs(sourceID);
+    for (uint i = 0; i < cardids.size(); i++)
+    {
+        if (cardids[i] == our_cardid)
+            continue;
+
+        if (CardUtil::GetRawCardType(cardids[i]) != cardtype)
+            continue;
+
+        QString device = CardUtil::GetVideoDevice(cardids[i]);
+        if (device.isEmpty())
+            continue;
+
+        // DVB-T and DVB-S cards both have raw type "DVB", but can
+        // only take over each other's transports when the frontend
+        // type matches.
+        if (("DVB" == cardtype) &&
+            (CardUtil::ProbeDVBType(device).toUpper() != our_subtype))
+            continue;
+
+        QStringList inputnames = CardUtil::GetInputNames(cardids[i], sourceID);
+        if (inputnames.empty())
+            continue;
+
+        ChannelBase *helper_channel = NULL;
+#ifdef USING_DVB
+        if ("DVB" == cardtype)
+            helper_channel = new DVBChannel(device);
+#endif // USING_DVB
+#ifdef USING_HDHOMERUN
+        if ("HDHOMERUN" == cardtype)
+            helper_channel = new HDHRChannel(NULL, device);
+#endif // USING_HDHOMERUN
+        if (!helper_channel)
+            continue;
+
+        helper_channel->SetCardID(cardids[i]);
+
+        // An open failure means the tuner is busy, just skip it.
+        if (!helper_channel->Open())
+        {
+            delete helper_channel;
+            continue;
+        }
+
+        ChannelScanSM *helper = new ChannelScanSM(
+            NULL, cardtype, helper_channel, sourceID,
+            signalTimeout, channelTimeout, inputnames[0],
+            m_test_decryption);
+        helper->SetScanDTVTunerType(scanDTVTunerType);
+
+        helperChannels.push_back(helper_channel);
+        helperScanners.push_back(helper);
+    }
+
+    if (helperScanners.empty())
+        return 0;
+
+    // Deal the transports out round robin, keeping the
+    // first share for ourselves.
+    uint parts = helperScanners.size() + 1;
+    vector<transport_scan_items_t> partition(parts);
+    transport_scan_items_t::iterator it = scanTransports.begin();
+    for (uint n = 0; it != scanTransports.end(); ++it, n++)
+        partition[n % parts].push_back(*it);
+
+    helperTransportCount = 0;
+    for (uint i = 0; i < helperScanners.size(); i++)
+    {
+        helperTransportCount += partition[i + 1].size();
+        helperScanners[i]->ScanPartition(partition[i + 1], extend_scan_list);
+        helperScanners[i]->StartScanner();
+    }
+
+    scanTransports = partition[0];
+
+    VERBOSE(VB_CHANSCAN, LOC +
+            QString("Scanning with %1 tuners, %2 transports on this one")
+            .arg(parts).arg(scanTransports.size()));
+
+    return helperScanners.size();
+}
+
 /**
  *  \brief Generates a list of frequencies to scan and adds it to the
  *   scanTransport list, and then sets the scanning to TRANSPORT_LIST.
@@ -1751,6 +1930,8 @@ bool ChannelScanSM::ScanTransports(
     }
 
     extend_scan_list = true;
+    SpawnScanPartitions();
+
     timer.start();
     waitingForTables = false;
 
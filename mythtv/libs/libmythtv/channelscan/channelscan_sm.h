@@ -194,6 +194,10 @@ class ChannelScanSM : public MPEGStreamListener,
 
     bool AddToList(uint mplexid);
 
+    uint SpawnScanPartitions(void);
+    bool ScanPartition(const transport_scan_items_t &partition,
+                       bool follow_nit);
+
     static QString loc(const ChannelScanSM*);
 
     static const uint kDVBTableTimeout;
@@ -212,6 +216,7 @@ class ChannelScanSM : public MPEGStreamListener,
     uint              otherTableTime;
     bool              setOtherTables;
     QString           inputname;
+    QString           cardtype;
     bool              m_test_decryption;
     bool              extend_scan_list;
 
@@ -247,12 +252,26 @@ class ChannelScanSM : public MPEGStreamListener,
     /// Scanner thread, runs ChannelScanSM::StartScanner()
     pthread_t        scanner_thread;
     bool             scanner_thread_running;
+
+    /// Scanners working partitions of our transport list on
+    /// other idle tuners, see SpawnScanPartitions().
+    vector<ChannelScanSM*>  helperScanners;
+    vector<ChannelBase*>    helperChannels;
+    uint                    helperTransportCount;
 };
 
 inline void ChannelScanSM::UpdateScanPercentCompleted(void)
 {
-    int tmp = (transportsScanned * 100) /
-              (scanTransports.size() + extend_transports.size());
+    if (!scan_monitor)
+        return;
+
+    uint scanned = transportsScanned;
+    for (uint i = 0; i < helperScanners.size(); i++)
+        scanned += helperScanners[i]->transportsScanned;
+
+    int tmp = (scanned * 100) /
+              (scanTransports.size() + extend_transports.size() +
+               helperTransportCount);
     scan_monitor->ScanPercentComplete(tmp);
 }
 
@@ -11,9 +11,12 @@ using namespace std;
 #include <QFile>
 #include <QReadWriteLock>
 #include <QHash>
+#include <QMutex>
+#include <QDateTime>
 
 #include "channelutil.h"
 #include "mythdb.h"
+#include "mythcorecontext.h"
 #include "dvbtables.h"
 #include "tv.h" // for CHANNEL_DIRECTION
 
@@ -22,6 +25,78 @@ using namespace std;
 
 const QString ChannelUtil::kATSCSeparators = "(_|-|#|\\.)";
 
+/* In-memory index over the channel table for the per-field lookups
+ * below. EIT processing and channel changes hit these thousands of
+ * times a minute, so once a value (or the absence of one) has been
+ * fetched from the DB we keep it until the channel table changes.
+ * Keys look like "chanid[field]" and "sourceid_channum[field]".
+ */
+static QReadWriteLock channel_field_cache_lock;
+static QHash<QString,QString> channel_field_cache;
+
+static bool lookup_channel_field(const QString &key, QString &value)
+{
+    channel_field_cache_lock.lockForRead();
+
+    QHash<QString,QString>::const_iterator it =
+        channel_field_cache.find(key);
+    bool found = (it != channel_field_cache.end());
+    if (found)
+    {
+        value = *it;
+        value.detach();
+    }
+
+    channel_field_cache_lock.unlock();
+
+    return found;
+}
+
+static void cache_channel_field(const QString &key, const QString &value)
+{
+    channel_field_cache_lock.lockForWrite();
+    channel_field_cache[key] = value;
+    channel_field_cache_lock.unlock();
+}
+
+/** \fn ChannelUtil::ClearChannelCache(void)
+ *  \brief Drops all cached channel fields.
+ *
+ *   This is called locally whenever this process writes to the
+ *   channel table, and remotely via the "CHANNEL_CHANGED" event
+ *   when another process does.
+ */
+void ChannelUtil::ClearChannelCache(void)
+{
+    channel_field_cache_lock.lockForWrite();
+    channel_field_cache.clear();
+    channel_field_cache_lock.unlock();
+}
+
+/** \brief Flushes the channel field cache and tells other processes
+ *         that the channel table has changed.
+ *
+ *   A channel scan updates many rows back to back, so at most one
+ *   "CHANNEL_CHANGED" broadcast per second is sent; that is plenty
+ *   to keep the caches in other processes honest.
+ */
+static void channel_table_changed(void)
+{
+    ChannelUtil::ClearChannelCache();
+
+    static QMutex     last_broadcast_lock;
+    static QDateTime  last_broadcast;
+
+    QMutexLocker locker(&last_broadcast_lock);
+    QDateTime now = QDateTime::currentDateTime();
+    if (last_broadcast.isValid() && last_broadcast.secsTo(now) < 1)
+        return;
+    last_broadcast = now;
+
+    if (gCoreContext)
+        gCoreContext->SendMessage("CHANNEL_CHANGED");
+}
+
 static uint get_dtv_multiplex(uint     db_source_id,  QString sistandard,
                               uint64_t frequency,
                               // DVB specific
@@ -750,6 +825,11 @@ QString ChannelUtil::GetChannelStringField(int chan_id, const QString &field)
     if (chan_id < 0)
         return QString::null;
 
+    QString key = QString("%1[%2]").arg(chan_id).arg(field);
+    QString retval;
+    if (lookup_channel_field(key, retval))
+        return retval;
+
     MSqlQuery query(MSqlQuery::InitCon());
     query.prepare(QString("SELECT %1 FROM channel "
             "WHERE chanid=%2").arg(field).arg(chan_id));
@@ -759,10 +839,15 @@ QString ChannelUtil::GetChannelStringField(int chan_id, const QString &field)
         return QString::null;
     }
     if (!query.size())
+    {
+        cache_channel_field(key, QString::null);
         return QString::null;
+    }
 
     query.next();
-    return query.value(0).toString();
+    retval = query.value(0).toString();
+    cache_channel_field(key, retval);
+    return retval;
 }
 
 QString ChannelUtil::GetChanNum(int chan_id)
@@ -881,6 +966,11 @@ QString ChannelUtil::GetChannelValueStr(const QString &channel_field,
 {
     QString retval = QString::null;
 
+    QString key = QString("%1_%2[%3]")
+        .arg(sourceid).arg(channum).arg(channel_field);
+    if (lookup_channel_field(key, retval))
+        return retval;
+
     MSqlQuery query(MSqlQuery::InitCon());
 
     query.prepare(
@@ -895,9 +985,15 @@ QString ChannelUtil::GetChannelValueStr(const QString &channel_field,
     query.bindValue(":CHANNUM",  channum);
 
     if (!query.exec() || !query.isActive())
+    {
         MythDB::DBError("getchannelvalue", query);
-    else if (query.next())
-        retval = query.value(0).toString();
+    }
+    else
+    {
+        if (query.next())
+            retval = query.value(0).toString();
+        cache_channel_field(key, retval);
+    }
 
     return retval;
 }
@@ -1086,7 +1182,11 @@ bool ChannelUtil::SetChannelValue(const QString &field_name,
     query.bindValue(":CHANNUM",  channum);
     query.bindValue(":SOURCEID", sourceid);
 
-    return query.exec();
+    if (!query.exec())
+        return false;
+
+    channel_table_changed();
+    return true;
 }
 
 bool ChannelUtil::SetChannelValue(const QString &field_name,
@@ -1102,7 +1202,11 @@ bool ChannelUtil::SetChannelValue(const QString &field_name,
     query.bindValue(":VALUE",  value);
     query.bindValue(":CHANID", chanid);
 
-    return query.exec();
+    if (!query.exec())
+        return false;
+
+    channel_table_changed();
+    return true;
 }
 
 /** Returns the DVB default authority for the chanid given. */
@@ -1487,6 +1591,8 @@ bool ChannelUtil::CreateChannel(uint db_mplexid,
         MythDB::DBError("Adding Service", query);
         return false;
     }
+
+    channel_table_changed();
     return true;
 }
 
@@ -1569,6 +1675,8 @@ bool ChannelUtil::UpdateChannel(uint db_mplexid,
         MythDB::DBError("Updating Service", query);
         return false;
     }
+
+    channel_table_changed();
     return true;
 }
 
@@ -1617,6 +1725,7 @@ bool ChannelUtil::DeleteChannel(uint channel_id)
         return false;
     }
 
+    channel_table_changed();
     return true;
 }
 
@@ -1636,6 +1745,7 @@ bool ChannelUtil::SetVisible(uint channel_id, bool visible)
         return false;
     }
 
+    channel_table_changed();
     return true;
 }
 
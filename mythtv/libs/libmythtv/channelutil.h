@@ -221,6 +221,9 @@ class MPUBLIC ChannelUtil
                                    QString        value,
                                    int            chanid);
 
+    /// \brief Flushes the in-memory channel field cache.
+    static void    ClearChannelCache(void);
+
     static const QString kATSCSeparators;
 
   private:
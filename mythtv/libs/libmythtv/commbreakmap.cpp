@@ -1,3 +1,5 @@
+#include <climits>
+
 #include "mythcontext.h"
 #include "programinfo.h"
 #include "playercontext.h"
@@ -12,7 +14,8 @@ CommBreakMap::CommBreakMap(void)
      lastCommSkipDirection(0), lastCommSkipTime(0/*1970*/),
      lastCommSkipStart(0),     lastSkipTime(0 /*1970*/),
      hascommbreaktable(false), maxskip(3600),
-     maxShortMerge(0),         commBreakIter(commBreakMap.end())
+     maxShortMerge(0),         commBreakIter(commBreakMap.end()),
+     nextCommBreakFrame(-1)
 {
     commrewindamount = gCoreContext->GetNumSetting("CommRewindAmount",0);
     commnotifyamount = gCoreContext->GetNumSetting("CommNotifyAmount",0);
@@ -25,7 +28,8 @@ CommBreakMap::CommBreakMap(void)
 
 CommSkipMode CommBreakMap::GetAutoCommercialSkip(void)
 {
-    QMutexLocker locker(&commBreakMapLock);
+    // no lock; the mode is an aligned enum only changed on user
+    // input, and this is called every frame in the display loop
     return autocommercialskip;
 }
 
@@ -74,7 +78,10 @@ void CommBreakMap::SetTracker(uint64_t framesPlayed)
 {
     QMutexLocker locker(&commBreakMapLock);
     if (!hascommbreaktable)
+    {
+        UpdateNextCommBreak();
         return;
+    }
 
     commBreakIter = commBreakMap.begin();
     while (commBreakIter != commBreakMap.end())
@@ -92,6 +99,32 @@ void CommBreakMap::SetTracker(uint64_t framesPlayed)
                 .arg(*commBreakIter).arg(commBreakIter.key())
                 .arg(framesPlayed));
     }
+
+    UpdateNextCommBreak();
+}
+
+/** \fn CommBreakMap::UpdateNextCommBreak(void)
+ *  \brief Publishes the frame of the next commercial start for the
+ *         lock-free precheck in AutoCommercialSkip().
+ *
+ *   Call with commBreakMapLock held whenever the tracker moves. A
+ *   published value that is too small only costs a trip through the
+ *   locked path; the tracker is re-synced (and the value refreshed)
+ *   by ClearAfterSeek() after every jump, so it never stays stale
+ *   across a skip.
+ */
+void CommBreakMap::UpdateNextCommBreak(void)
+{
+    int next = -1;
+    if (hascommbreaktable)
+    {
+        frm_dir_map_t::Iterator it = commBreakIter;
+        if ((it != commBreakMap.end()) && (*it == MARK_COMM_END))
+            it++;
+        if ((it != commBreakMap.end()) && (*it == MARK_COMM_START))
+            next = (it.key() > INT_MAX) ? 0 : (int)it.key();
+    }
+    nextCommBreakFrame.fetchAndStoreOrdered(next);
 }
 
 void CommBreakMap::GetMap(frm_dir_map_t &map)
@@ -155,6 +188,18 @@ bool CommBreakMap::AutoCommercialSkip(uint64_t &jumpToFrame,
                                       uint64_t totalFrames,
                                       QString &comm_msg)
 {
+    // Lock-free fast path: most frames are nowhere near the next
+    // commercial break, so consult the published next-break frame
+    // before paying for the mutex on every displayed frame.
+    int next_break = (int)nextCommBreakFrame;
+    if (next_break < 0)
+        return false;
+    if ((framesPlayed + (uint64_t)(commnotifyamount * video_frame_rate) + 1) <
+        (uint64_t)next_break)
+    {
+        return false;
+    }
+
     QMutexLocker locker(&commBreakMapLock);
     if (!hascommbreaktable)
         return false;
@@ -195,6 +240,8 @@ bool CommBreakMap::AutoCommercialSkip(uint64_t &jumpToFrame,
 
     MergeShortCommercials(video_frame_rate);
 
+    UpdateNextCommBreak();
+
     if (commBreakIter == commBreakMap.end())
     {
         VERBOSE(VB_COMMFLAG, LOC + "AutoCommercialSkip(), at "
@@ -247,6 +294,7 @@ bool CommBreakMap::AutoCommercialSkip(uint64_t &jumpToFrame,
         return true;
     }
     ++commBreakIter;
+    UpdateNextCommBreak();
     return false;
 }
 
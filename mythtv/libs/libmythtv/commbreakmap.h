@@ -3,6 +3,7 @@
 
 #include <QMutex>
 #include <QMap>
+#include <QAtomicInt>
 #include "tv.h"
 
 class NuppelVideoPlayer;
@@ -36,6 +37,7 @@ class CommBreakMap
 
   private:
     void MergeShortCommercials(double video_frame_rate);
+    void UpdateNextCommBreak(void);
 
     mutable QMutex commBreakMapLock;
     int            skipcommercials;
@@ -52,6 +54,10 @@ class CommBreakMap
     int            maxShortMerge;
     frm_dir_map_t  commBreakMap;
     frm_dir_map_t::Iterator commBreakIter;
+    /// frame of the next commercial start at or after the tracker,
+    /// -1 if there is none; lets AutoCommercialSkip() bail out
+    /// without taking commBreakMapLock on most frames
+    QAtomicInt     nextCommBreakFrame;
 };
 
 #endif // BREAKMAP_H
@@ -96,6 +96,72 @@ DataDirectGenre::DataDirectGenre() :
 // XXX Program duration should be stored as seconds, not as a QTime.
 //     limited to 24 hours this way.
 
+// Number of rows written per multi-row INSERT into the dd_* temp
+// tables.  Kept comfortably below the default max_allowed_packet.
+static const int kDDInsertBatchSize = 500;
+
+static QString dd_sql_string(const QString &str)
+{
+    QString tmp = str;
+    tmp.replace("\\", "\\\\");
+    tmp.replace("'", "\\'");
+    return "'" + tmp + "'";
+}
+
+static QString dd_sql_bool(bool value)
+{
+    return (value) ? "1" : "0";
+}
+
+static QString dd_sql_time(const QTime &time)
+{
+    return "'" + time.toString("hh:mm:ss") + "'";
+}
+
+static QString dd_sql_datetime(const QDateTime &dt)
+{
+    return "'" + dt.toString("yyyy-MM-dd hh:mm:ss") + "'";
+}
+
+static QString dd_sql_date(const QDate &date)
+{
+    if (!date.isValid())
+        return "NULL";
+
+    return "'" + date.toString("yyyy-MM-dd") + "'";
+}
+
+void DDStructureParser::AddRowToInsert(const QString &sql_prefix,
+                                       const QString &row)
+{
+    QStringList &rows = pending_inserts[sql_prefix];
+    rows.push_back(row);
+
+    if (rows.size() >= kDDInsertBatchSize)
+        FlushInsert(sql_prefix);
+}
+
+void DDStructureParser::FlushInsert(const QString &sql_prefix)
+{
+    QStringList &rows = pending_inserts[sql_prefix];
+    if (rows.empty())
+        return;
+
+    MSqlQuery query(MSqlQuery::DDCon());
+
+    if (!query.exec(sql_prefix + " VALUES " + rows.join(", ")))
+        MythDB::DBError("Batch inserting into dd temp table", query);
+
+    rows.clear();
+}
+
+void DDStructureParser::FlushAllInserts(void)
+{
+    QMap<QString, QStringList>::iterator it = pending_inserts.begin();
+    for (; it != pending_inserts.end(); ++it)
+        FlushInsert(it.key());
+}
+
 bool DDStructureParser::startElement(const QString &pnamespaceuri,
                                      const QString &plocalname,
                                      const QString &pqname,
@@ -208,28 +274,19 @@ bool DDStructureParser::endElement(const QString &pnamespaceuri,
     (void)pnamespaceuri;
     (void)plocalname;
 
-    MSqlQuery query(MSqlQuery::DDCon());
-
     if (pqname == "station")
     {
         parent.stations[curr_station.stationid] = curr_station;
 
-        query.prepare(
+        AddRowToInsert(
             "INSERT INTO dd_station "
             "     ( stationid,  callsign,  stationname, "
-            "       affiliate,  fccchannelnumber)       "
-            "VALUES "
-            "     (:STATIONID, :CALLSIGN, :STATIONNAME, "
-            "      :AFFILIATE, :FCCCHANNUM)");
-
-        query.bindValue(":STATIONID",   curr_station.stationid);
-        query.bindValue(":CALLSIGN",    curr_station.callsign);
-        query.bindValue(":STATIONNAME", curr_station.stationname);
-        query.bindValue(":AFFILIATE",   curr_station.affiliate);
-        query.bindValue(":FCCCHANNUM",  curr_station.fccchannelnumber);
-
-        if (!query.exec())
-            MythDB::DBError("Inserting into dd_station", query);
+            "       affiliate,  fccchannelnumber)",
+            "(" + dd_sql_string(curr_station.stationid) +
+            ", " + dd_sql_string(curr_station.callsign) +
+            ", " + dd_sql_string(curr_station.stationname) +
+            ", " + dd_sql_string(curr_station.affiliate) +
+            ", " + dd_sql_string(curr_station.fccchannelnumber) + ")");
     }
     else if (pqname == "lineup")
     {
@@ -237,75 +294,54 @@ bool DDStructureParser::endElement(const QString &pnamespaceuri,
 
         parent.lineups.push_back(curr_lineup);
 
-        query.prepare(
+        AddRowToInsert(
             "INSERT INTO dd_lineup "
-            "     ( lineupid,  name,  type,  device,  postal) "
-            "VALUES "
-            "     (:LINEUPID, :NAME, :TYPE, :DEVICE, :POSTAL)");
-
-        query.bindValue(":LINEUPID",    curr_lineup.lineupid);
-        query.bindValue(":NAME",        curr_lineup.name);
-        query.bindValue(":TYPE",        curr_lineup.type);
-        query.bindValue(":DEVICE",      curr_lineup.device);
-        query.bindValue(":POSTAL",      curr_lineup.postal);
-
-        if (!query.exec())
-            MythDB::DBError("Inserting into dd_lineup", query);
+            "     ( lineupid,  name,  type,  device,  postal)",
+            "(" + dd_sql_string(curr_lineup.lineupid) +
+            ", " + dd_sql_string(curr_lineup.name) +
+            ", " + dd_sql_string(curr_lineup.type) +
+            ", " + dd_sql_string(curr_lineup.device) +
+            ", " + dd_sql_string(curr_lineup.postal) + ")");
     }
     else if (pqname == "map")
     {
         parent.lineupmaps[curr_lineupmap.lineupid].push_back(curr_lineupmap);
 
-        query.prepare(
+        AddRowToInsert(
             "INSERT INTO dd_lineupmap "
-            "     ( lineupid,  stationid,  channel,  channelMinor) "
-            "VALUES "
-            "     (:LINEUPID, :STATIONID, :CHANNEL, :CHANNELMINOR)");
-
-        query.bindValue(":LINEUPID",    curr_lineupmap.lineupid);
-        query.bindValue(":STATIONID",   curr_lineupmap.stationid);
-        query.bindValue(":CHANNEL",     curr_lineupmap.channel);
-        query.bindValue(":CHANNELMINOR",curr_lineupmap.channelMinor);
-        if (!query.exec())
-            MythDB::DBError("Inserting into dd_lineupmap", query);
+            "     ( lineupid,  stationid,  channel,  channelMinor)",
+            "(" + dd_sql_string(curr_lineupmap.lineupid) +
+            ", " + dd_sql_string(curr_lineupmap.stationid) +
+            ", " + dd_sql_string(curr_lineupmap.channel) +
+            ", " + dd_sql_string(curr_lineupmap.channelMinor) + ")");
     }
     else if (pqname == "schedule")
     {
         QDateTime endtime = curr_schedule.time.addSecs(
             QTime().secsTo(curr_schedule.duration));
 
-        query.prepare(
+        AddRowToInsert(
             "INSERT INTO dd_schedule "
             "     ( programid,      stationid,   scheduletime,   "
             "       duration,       isrepeat,    stereo,         "
             "       dolby,          subtitled,   hdtv,           "
             "       closecaptioned, tvrating,    partnumber,      "
-            "       parttotal,      endtime,     isnew) "
-            "VALUES "
-            "     (:PROGRAMID, :STATIONID,  :TIME,           "
-            "      :DURATION,  :ISREPEAT,   :STEREO,         "
-            "      :DOLBY,     :SUBTITLED,  :HDTV,           "
-            "      :CAPTIONED, :TVRATING,   :PARTNUMBER,     "
-            "      :PARTTOTAL, :ENDTIME,    :ISNEW)");
-
-        query.bindValue(":PROGRAMID",   curr_schedule.programid);
-        query.bindValue(":STATIONID",   curr_schedule.stationid);
-        query.bindValue(":TIME",        curr_schedule.time);
-        query.bindValue(":DURATION",    curr_schedule.duration);
-        query.bindValue(":ISREPEAT",    curr_schedule.repeat);
-        query.bindValue(":STEREO",      curr_schedule.stereo);
-        query.bindValue(":DOLBY",       curr_schedule.dolby);
-        query.bindValue(":SUBTITLED",   curr_schedule.subtitled);
-        query.bindValue(":HDTV",        curr_schedule.hdtv);
-        query.bindValue(":CAPTIONED",   curr_schedule.closecaptioned);
-        query.bindValue(":TVRATING",    curr_schedule.tvrating);
-        query.bindValue(":PARTNUMBER",  curr_schedule.partnumber);
-        query.bindValue(":PARTTOTAL",   curr_schedule.parttotal);
-        query.bindValue(":ENDTIME",     endtime);
-        query.bindValue(":ISNEW",       curr_schedule.isnew);
-
-        if (!query.exec())
-            MythDB::DBError("Inserting into dd_schedule", query);
+            "       parttotal,      endtime,     isnew)",
+            "(" + dd_sql_string(curr_schedule.programid) +
+            ", " + dd_sql_string(curr_schedule.stationid) +
+            ", " + dd_sql_datetime(curr_schedule.time) +
+            ", " + dd_sql_time(curr_schedule.duration) +
+            ", " + dd_sql_bool(curr_schedule.repeat) +
+            ", " + dd_sql_bool(curr_schedule.stereo) +
+            ", " + dd_sql_bool(curr_schedule.dolby) +
+            ", " + dd_sql_bool(curr_schedule.subtitled) +
+            ", " + dd_sql_bool(curr_schedule.hdtv) +
+            ", " + dd_sql_bool(curr_schedule.closecaptioned) +
+            ", " + dd_sql_string(curr_schedule.tvrating) +
+            ", " + QString::number(curr_schedule.partnumber) +
+            ", " + QString::number(curr_schedule.parttotal) +
+            ", " + dd_sql_datetime(endtime) +
+            ", " + dd_sql_bool(curr_schedule.isnew) + ")");
     }
     else if (pqname == "program")
     {
@@ -330,38 +366,28 @@ bool DDStructureParser::endElement(const QString &pnamespaceuri,
         else
             cat_type = "tvshow";
 
-        query.prepare(
+        AddRowToInsert(
             "INSERT INTO dd_program "
             "     ( programid,    title,       subtitle,       "
             "       description,  showtype,    category_type,  "
             "       mpaarating,   starrating,  stars,          "
             "       runtime,      year,        seriesid,       "
-            "       colorcode,    syndicatedepisodenumber, originalairdate) "
-            "VALUES "
-            "     (:PROGRAMID,   :TITLE,      :SUBTITLE,       "
-            "      :DESCRIPTION, :SHOWTYPE,   :CATTYPE,        "
-            "      :MPAARATING,  :STARRATING, :STARS,          "
-            "      :RUNTIME,     :YEAR,       :SERIESID,       "
-            "      :COLORCODE,   :SYNDNUM,    :ORIGAIRDATE)    ");
-
-        query.bindValue(":PROGRAMID",   curr_program.programid);
-        query.bindValue(":TITLE",       curr_program.title);
-        query.bindValue(":SUBTITLE",    curr_program.subtitle);
-        query.bindValue(":DESCRIPTION", curr_program.description);
-        query.bindValue(":SHOWTYPE",    curr_program.showtype);
-        query.bindValue(":CATTYPE",     cat_type);
-        query.bindValue(":MPAARATING",  curr_program.mpaaRating);
-        query.bindValue(":STARRATING",  curr_program.starRating);
-        query.bindValue(":STARS",       staravg);
-        query.bindValue(":RUNTIME",     curr_program.duration);
-        query.bindValue(":YEAR",        curr_program.year);
-        query.bindValue(":SERIESID",    curr_program.seriesid);
-        query.bindValue(":COLORCODE",   curr_program.colorcode);
-        query.bindValue(":SYNDNUM",     curr_program.syndicatedEpisodeNumber);
-        query.bindValue(":ORIGAIRDATE", curr_program.originalAirDate);
-
-        if (!query.exec())
-            MythDB::DBError("Inserting into dd_program", query);
+            "       colorcode,    syndicatedepisodenumber, originalairdate)",
+            "(" + dd_sql_string(curr_program.programid) +
+            ", " + dd_sql_string(curr_program.title) +
+            ", " + dd_sql_string(curr_program.subtitle) +
+            ", " + dd_sql_string(curr_program.description) +
+            ", " + dd_sql_string(curr_program.showtype) +
+            ", " + dd_sql_string(cat_type) +
+            ", " + dd_sql_string(curr_program.mpaaRating) +
+            ", " + dd_sql_string(curr_program.starRating) +
+            ", " + QString::number(staravg) +
+            ", " + dd_sql_time(curr_program.duration) +
+            ", " + dd_sql_string(curr_program.year) +
+            ", " + dd_sql_string(curr_program.seriesid) +
+            ", " + dd_sql_string(curr_program.colorcode) +
+            ", " + dd_sql_string(curr_program.syndicatedEpisodeNumber) +
+            ", " + dd_sql_date(curr_program.originalAirDate) + ")");
     }
     else if (pqname == "member")
     {
@@ -372,36 +398,26 @@ bool DDStructureParser::endElement(const QString &pnamespaceuri,
             fullname += " ";
         fullname += curr_productioncrew.surname;
 
-        query.prepare(
+        AddRowToInsert(
             "INSERT INTO dd_productioncrew "
-            "       ( programid,  role,  givenname,  surname,  fullname) "
-            "VALUES (:PROGRAMID, :ROLE, :GIVENNAME, :SURNAME, :FULLNAME)");
-
-        query.bindValue(":PROGRAMID",   lastprogramid);
-        query.bindValue(":ROLE",        roleunderlines);
-        query.bindValue(":GIVENNAME",   curr_productioncrew.givenname);
-        query.bindValue(":SURNAME",     curr_productioncrew.surname);
-        query.bindValue(":FULLNAME",    fullname);
-
-        if (!query.exec())
-            MythDB::DBError("Inserting into dd_productioncrew", query);
+            "       ( programid,  role,  givenname,  surname,  fullname)",
+            "(" + dd_sql_string(lastprogramid) +
+            ", " + dd_sql_string(roleunderlines) +
+            ", " + dd_sql_string(curr_productioncrew.givenname) +
+            ", " + dd_sql_string(curr_productioncrew.surname) +
+            ", " + dd_sql_string(fullname) + ")");
 
         curr_productioncrew.givenname = "";
         curr_productioncrew.surname = "";
     }
     else if (pqname == "genre")
     {
-        query.prepare(
+        AddRowToInsert(
             "INSERT INTO dd_genre "
-            "       ( programid,  class,  relevance) "
-            "VALUES (:PROGRAMID, :CLASS, :RELEVANCE)");
-
-        query.bindValue(":PROGRAMID",   lastprogramid);
-        query.bindValue(":CLASS",       curr_genre.gclass);
-        query.bindValue(":RELEVANCE",   curr_genre.relevance);
-
-        if (!query.exec())
-            MythDB::DBError("Inserting into dd_genre", query);
+            "       ( programid,  class,  relevance)",
+            "(" + dd_sql_string(lastprogramid) +
+            ", " + dd_sql_string(curr_genre.gclass) +
+            ", " + dd_sql_string(curr_genre.relevance) + ")");
     }
 
     return true;
@@ -415,6 +431,7 @@ bool DDStructureParser::startDocument()
 
 bool DDStructureParser::endDocument()
 {
+    FlushAllInserts();
     return true;
 }
 
@@ -231,9 +231,20 @@ class DDStructureParser: public QXmlDefaultHandler
     bool startDocument(void);
     bool endDocument(void);
 
+  private:
+    void AddRowToInsert (const QString &sql_prefix, const QString &row);
+    void FlushInsert    (const QString &sql_prefix);
+    void FlushAllInserts(void);
+
   private:
     DataDirectProcessor     &parent;
 
+    // Rows waiting to be written to the dd_* temp tables, keyed by the
+    // INSERT statement they belong to.  They are flushed as multi-row
+    // INSERTs so a full listing doesn't cost one DB round trip per
+    // parsed XML element.
+    QMap<QString, QStringList> pending_inserts;
+
     QString                  currtagname;
     DataDirectStation        curr_station;
     DataDirectLineup         curr_lineup;
@@ -20,7 +20,7 @@ using namespace std;
    mythtv/bindings/perl/MythTV.pm
 */
 /// This is the DB schema version expected by the running MythTV instance.
-const QString currentDatabaseVersion = "1264";
+const QString currentDatabaseVersion = "1265";
 
 static bool UpdateDBVersionNumber(const QString &newnumber, QString &dbver);
 static bool performActualUpdate(
@@ -5502,6 +5502,18 @@ NULL
             return false;
     }
 
+    if (dbver == "1264")
+    {
+        const char *updates[] = {
+"ALTER TABLE program       ADD INDEX (category_type, endtime);",
+"ALTER TABLE program       ADD INDEX (category, endtime);",
+"ALTER TABLE programgenres ADD INDEX (genre);",
+NULL
+};
+        if (!performActualUpdate(updates, "1265", dbver))
+            return false;
+    }
+
     return true;
 }
 
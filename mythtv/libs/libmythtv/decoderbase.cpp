@@ -4,13 +4,17 @@
 #include <algorithm>
 using namespace std;
 
+#include <QFile>
+
 #include "mythconfig.h"
 
 #include "mythplayer.h"
 #include "remoteencoder.h"
 #include "mythdbcon.h"
 #include "mythverbose.h"
+#include "mythcorecontext.h"
 #include "decoderbase.h"
+#include "seekindex.h"
 #include "programinfo.h"
 #include "livetvchain.h"
 #include "dvdringbuffer.h"
@@ -37,7 +41,7 @@ DecoderBase::DecoderBase(MythPlayer *parent, const ProgramInfo &pginfo)
       posmapStarted(false), positionMapType(MARK_UNSET),
 
       m_positionMapLock(QMutex::Recursive),
-      dontSyncPositionMap(false),
+      dontSyncPositionMap(false), seekIndexEntriesLoaded(0),
 
       exactseeks(false), livetv(false), watchingrecording(false),
 
@@ -56,6 +60,8 @@ DecoderBase::DecoderBase(MythPlayer *parent, const ProgramInfo &pginfo)
 
 DecoderBase::~DecoderBase()
 {
+    SaveSeekIndexPosMap();
+
     if (m_playbackinfo)
         delete m_playbackinfo;
 }
@@ -128,6 +134,12 @@ bool DecoderBase::PosMapFromDb(void)
 //        VERBOSE(VB_PLAYBACK, QString("%1 TotalTimeOfTitle() in ticks, %2 TotalReadPosition() in bytes, %3 is fps")
 //                .arg(ringBuffer->BD()->GetTotalTimeOfTitle()).arg(ringBuffer->BD()->GetTotalReadPosition()).arg(fps));
     }
+    else if (gCoreContext->GetNumSetting("UseSeekIndexFiles", 1) &&
+             PosMapFromSeekIndex(posMap))
+    {
+        // position map came from the recording's mmap'd seek index
+        // sidecar, no DB round trip needed
+    }
     else if ((positionMapType == MARK_UNSET) ||
         (keyframedist == -1))
     {
@@ -194,6 +206,151 @@ bool DecoderBase::PosMapFromDb(void)
     return true;
 }
 
+/** \fn DecoderBase::PosMapFromSeekIndex(frm_pos_map_t&)
+ *  \brief Fills 'posMap' from the recording's seek index sidecar,
+ *         if it has a usable one.
+ *
+ *   The sidecar is written by the recorder alongside the database
+ *   position map saves, so the two should agree; if the sidecar's
+ *   mark type conflicts with one we already know, we distrust the
+ *   sidecar and let the database path run instead.
+ */
+bool DecoderBase::PosMapFromSeekIndex(frm_pos_map_t &posMap)
+{
+    MarkTypes type = MARK_UNSET;
+    if (!SeekIndex::Load(ringBuffer->GetFilename(), type, posMap))
+        return false;
+
+    if ((positionMapType != MARK_UNSET) && (type != positionMapType))
+    {
+        VERBOSE(VB_PLAYBACK, LOC +
+                QString("Seek index mark type %1 conflicts with %2, "
+                        "using the DB").arg(type).arg(positionMapType));
+        posMap.clear();
+        return false;
+    }
+
+    positionMapType = type;
+    if (keyframedist == -1)
+    {
+        if (positionMapType == MARK_GOP_BYFRAME)
+            keyframedist = 1;
+        else if (positionMapType == MARK_GOP_START)
+        {
+            keyframedist = 15;
+            if (fps < 26 && fps > 24)
+                keyframedist = 12;
+        }
+        // for MARK_KEYFRAME the file header provides keyframedist
+    }
+
+    return true;
+}
+
+/** \fn DecoderBase::InstallSeekIndexPosMap(void)
+ *  \brief Fills the position map from a seek index sidecar for files
+ *         that have no position map anywhere else.
+ *
+ *   Imported files start each playback with an empty position map
+ *   that is slowly rebuilt as frames are parsed, so seeks past the
+ *   current position degenerate into a linear parse of the file. If
+ *   an earlier playback saved its map with SaveSeekIndexPosMap(void),
+ *   start from that instead and such seeks become a binary search.
+ *
+ *   The loaded map may still be partial -- the last viewer may have
+ *   stopped early -- so hasFullPositionMap is left unset and playback
+ *   keeps extending the map past the loaded region.
+ */
+bool DecoderBase::InstallSeekIndexPosMap(void)
+{
+    if (!gCoreContext->GetNumSetting("UseSeekIndexFiles", 1))
+        return false;
+
+    frm_pos_map_t posMap;
+    if (!PosMapFromSeekIndex(posMap) || posMap.empty())
+        return false;
+
+    QMutexLocker locker(&m_positionMapLock);
+    m_positionMap.clear();
+    m_positionMap.reserve(posMap.size());
+
+    for (frm_pos_map_t::const_iterator it = posMap.begin();
+         it != posMap.end(); it++)
+    {
+        PosMapEntry e = {it.key(), it.key() * keyframedist, *it};
+        m_positionMap.push_back(e);
+    }
+
+    indexOffset = m_positionMap[0].index;
+    seekIndexEntriesLoaded = m_positionMap.size();
+
+    long long totframes = m_positionMap.back().index * keyframedist;
+    locker.unlock();
+
+    m_parent->SetFileLength((int)(totframes / fps), totframes);
+    m_parent->SetKeyframeDistance(keyframedist);
+    posmapStarted = true;
+
+    // the map was built by a playback, not a recorder, so there is
+    // nothing to sync it against; just keep extending it ourselves
+    dontSyncPositionMap = true;
+
+    VERBOSE(VB_PLAYBACK, LOC +
+            QString("Position map filled from seek index to: %1")
+            .arg(m_positionMap.back().index));
+
+    return true;
+}
+
+/** \fn DecoderBase::SaveSeekIndexPosMap(void)
+ *  \brief Persists a position map built up during playback to the
+ *         file's seek index sidecar.
+ *
+ *   Recordings get their sidecar from the recorder; this covers
+ *   imported files, whose map otherwise only exists in memory and
+ *   dies with the decoder. The whole map is rewritten, so each
+ *   playback that parsed further than the last one extends the
+ *   index, until eventually the entire file seeks by binary search.
+ */
+void DecoderBase::SaveSeekIndexPosMap(void)
+{
+    // only save maps we built ourselves during playback
+    if (!dontSyncPositionMap || livetv || watchingrecording)
+        return;
+
+    if (!gCoreContext->GetNumSetting("UseSeekIndexFiles", 1))
+        return;
+
+    if ((positionMapType == MARK_UNSET) || (keyframedist < 1))
+        return;
+
+    // streamed files can't have a sidecar written next to them
+    if (!ringBuffer || ringBuffer->IsDisc() ||
+        !QFile::exists(ringBuffer->GetFilename()))
+        return;
+
+    frm_pos_map_t posMap;
+    {
+        QMutexLocker locker(&m_positionMapLock);
+        if (m_positionMap.size() <= seekIndexEntriesLoaded)
+            return; // playback never got past the existing index
+
+        for (uint i = 0; i < m_positionMap.size(); i++)
+            posMap[m_positionMap[i].index] = m_positionMap[i].pos;
+    }
+
+    SeekIndexWriter writer;
+    if (!writer.Open(ringBuffer->GetFilename(), positionMapType))
+        return;
+
+    writer.Append(posMap);
+    writer.Close();
+
+    VERBOSE(VB_PLAYBACK, LOC +
+            QString("Saved %1 position map entries to the seek index")
+            .arg(posMap.size()));
+}
+
 /** \fn DecoderBase::PosMapFromEnc(void)
  *  \brief Queries encoder for position map data
  *         that has not been committed to the DB yet.
@@ -147,6 +147,9 @@ class DecoderBase
     virtual bool SyncPositionMap(void);
     virtual bool PosMapFromDb(void);
     virtual bool PosMapFromEnc(void);
+    bool PosMapFromSeekIndex(frm_pos_map_t &posMap);
+    bool InstallSeekIndexPosMap(void);
+    void SaveSeekIndexPosMap(void);
 
     virtual bool FindPosition(long long desired_value, bool search_adjusted,
                               int &lower_bound, int &upper_bound);
@@ -246,6 +249,9 @@ class DecoderBase
     mutable QMutex m_positionMapLock;
     vector<PosMapEntry> m_positionMap;
     bool dontSyncPositionMap;
+    /// entries loaded from a seek index sidecar at open, used to tell
+    /// whether playback extended the map beyond what was saved before
+    uint seekIndexEntriesLoaded;
 
     bool exactseeks;
     bool livetv;
@@ -0,0 +1,86 @@
+// MythTV headers
+#include "diskwritescheduler.h"
+#include "ThreadedFileWriter.h"
+#include "mythverbose.h"
+
+#define LOC QString("DiskWriteSched: ")
+
+QMutex DiskWriteScheduler::s_lock;
+QMap<uint64_t, DiskSyncThread*> DiskWriteScheduler::s_threads;
+
+void DiskSyncThread::run(void)
+{
+    m_lock.lock();
+    while (m_run)
+    {
+        // sync the writers back to back while holding the lock;
+        // Register()/Unregister() block until the round completes,
+        // which also guarantees no writer is destroyed mid-sync
+        for (int i = 0; i < m_writers.size(); i++)
+            m_writers[i]->Sync();
+
+        if (m_run)
+            m_wait.wait(&m_lock, 1000);
+    }
+    m_lock.unlock();
+}
+
+/** \fn DiskWriteScheduler::Register(uint64_t, ThreadedFileWriter*)
+ *  \brief Adds a writer to the sync thread for 'device', creating
+ *         the thread on first use.
+ *  \param device Device the file lives on, e.g. st_dev from fstat()
+ */
+void DiskWriteScheduler::Register(uint64_t device, ThreadedFileWriter *tfw)
+{
+    QMutexLocker locker(&s_lock);
+
+    DiskSyncThread *thread = s_threads[device];
+    if (!thread)
+    {
+        thread = new DiskSyncThread();
+        s_threads[device] = thread;
+        thread->start();
+        VERBOSE(VB_FILE, LOC +
+                QString("New sync thread for device 0x%1")
+                .arg(device, 0, 16));
+    }
+
+    QMutexLocker tlocker(&thread->m_lock);
+    thread->m_writers.push_back(tfw);
+}
+
+/** \fn DiskWriteScheduler::Unregister(ThreadedFileWriter*)
+ *  \brief Removes a writer; stops and reaps the device's sync
+ *         thread when it services no other writers.
+ *
+ *   Does not return while the writer's Sync() may still be called,
+ *   so it is safe to destroy the writer afterwards.
+ */
+void DiskWriteScheduler::Unregister(ThreadedFileWriter *tfw)
+{
+    QMutexLocker locker(&s_lock);
+
+    QMap<uint64_t, DiskSyncThread*>::iterator it = s_threads.begin();
+    for (; it != s_threads.end(); ++it)
+    {
+        DiskSyncThread *thread = *it;
+
+        thread->m_lock.lock();
+        thread->m_writers.removeAll(tfw);
+        bool empty = thread->m_writers.empty();
+        if (empty)
+            thread->m_run = false;
+        thread->m_wait.wakeAll();
+        thread->m_lock.unlock();
+
+        if (empty)
+        {
+            thread->wait();
+            delete thread;
+            s_threads.erase(it);
+            return;
+        }
+    }
+}
+
+/* vim: set expandtab tabstop=4 shiftwidth=4: */
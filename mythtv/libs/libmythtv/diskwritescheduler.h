@@ -0,0 +1,50 @@
+// -*- Mode: c++ -*-
+
+#ifndef _DISK_WRITE_SCHEDULER_H_
+#define _DISK_WRITE_SCHEDULER_H_
+
+#include <stdint.h>
+
+#include <QWaitCondition>
+#include <QThread>
+#include <QMutex>
+#include <QList>
+#include <QMap>
+
+class ThreadedFileWriter;
+
+class DiskSyncThread : public QThread
+{
+  public:
+    DiskSyncThread() : m_run(true) {}
+    virtual void run(void); // QThread
+
+    bool                       m_run;     // protected by m_lock
+    QList<ThreadedFileWriter*> m_writers; // protected by m_lock
+    QMutex                     m_lock;
+    QWaitCondition             m_wait;
+};
+
+/** \class DiskWriteScheduler
+ *  \brief Coordinates the sync threads of all ThreadedFileWriter
+ *         instances writing to the same disk.
+ *
+ *   Each recording used to sync its file independently, so with many
+ *   tuners writing to one spindle the interleaved flushes made the
+ *   disk seek-thrash between the streams. Writers register here keyed
+ *   by the device their file lives on; one thread per device walks
+ *   the writers in registration order and syncs them back to back,
+ *   so each stream's dirty pages go out as one sequential burst.
+ */
+class DiskWriteScheduler
+{
+  public:
+    static void Register(uint64_t device, ThreadedFileWriter *tfw);
+    static void Unregister(ThreadedFileWriter *tfw);
+
+  private:
+    static QMutex s_lock;
+    static QMap<uint64_t, DiskSyncThread*> s_threads; // protected by s_lock
+};
+
+#endif // _DISK_WRITE_SCHEDULER_H_
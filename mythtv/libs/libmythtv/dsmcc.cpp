@@ -4,7 +4,10 @@
  */
 #include <stdint.h>
 
+#include <QDir>
+
 #include "mythverbose.h"
+#include "mythdirs.h"
 
 #include "dsmccreceiver.h"
 #include "dsmccbiop.h"
@@ -469,6 +472,22 @@ void Dsmcc::ProcessSection(const unsigned char *data, int length,
 }
 
 // Reset the object carousel and clear the caches.
+void Dsmcc::SetChannel(uint chanid)
+{
+    m_storeDir = QString();
+    if (!chanid)
+        return;
+
+    QString dir = GetConfDir() + QString("/MHEG/channel%1").arg(chanid);
+    if (!QDir().mkpath(dir))
+    {
+        VERBOSE(VB_DSMCC, QString("[dsmcc] Unable to create "
+                                  "module store %1").arg(dir));
+        return;
+    }
+    m_storeDir = dir;
+}
+
 void Dsmcc::Reset()
 {
     VERBOSE(VB_DSMCC, "Resetting carousel");
@@ -79,6 +79,13 @@ class Dsmcc
     ~Dsmcc();
     // Reset the object carousel and clear the caches.
     void Reset();
+    // Set the channel the carousel data is received from.  The channel
+    // id keys the persistent module store, so retuning a known service
+    // restores its modules from disk and only changed modules have to
+    // be re-acquired from the broadcast.
+    void SetChannel(uint chanid);
+    // Directory of the persistent module store, empty if disabled.
+    QString StoreDir(void) const { return m_storeDir; }
     // Process an incoming DSMCC carousel table
     void ProcessSection(const unsigned char *data, int length,
                         int componentTag, unsigned carouselId,
@@ -112,6 +119,9 @@ class Dsmcc
 
     // Initial stream
     unsigned short m_startTag;
+
+    // Persistent module store directory, see SetChannel().
+    QString m_storeDir;
 };
 
 #endif
@@ -6,6 +6,10 @@
 #include <stdio.h>
 #include <zlib.h>
 
+#include <QDir>
+#include <QFile>
+#include <QStringList>
+
 #include "dsmccobjcarousel.h"
 #include "dsmccreceiver.h"
 #include "dsmcccache.h"
@@ -128,9 +132,78 @@ unsigned char *DSMCCCacheModuleData::AddModuleData(DsmccDb *ddb,
     }
 }
 
+/// Name of this module's file in the persistent store.
+QString DSMCCCacheModuleData::StoreFileName(const QString &dir) const
+{
+    return dir + QString("/mod_%1_%2_%3.bin")
+        .arg(m_carousel_id).arg(m_module_id).arg(m_version);
+}
+
+/** \fn DSMCCCacheModuleData::RestoreFromStore(const QString&)
+ *  \brief Try to restore this module from the persistent store.
+ *  \return data for the module if this version was saved on an earlier
+ *          visit to the service, NULL otherwise.
+ */
+unsigned char *DSMCCCacheModuleData::RestoreFromStore(const QString &dir)
+{
+    if (dir.isEmpty() || m_completed)
+        return NULL;
+
+    QFile file(StoreFileName(dir));
+    if (!file.open(QIODevice::ReadOnly) ||
+        (file.size() != (qint64)DataSize()))
+    {
+        return NULL;
+    }
+
+    unsigned char *data = (unsigned char*) malloc(DataSize());
+    if (data == NULL)
+        return NULL;
+
+    if (file.read((char*) data, DataSize()) != (qint64)DataSize())
+    {
+        free(data);
+        return NULL;
+    }
+
+    VERBOSE(VB_DSMCC, QString("[dsmcc] Restored module %1 version %2 "
+                              "from the persistent store")
+            .arg(m_module_id).arg(m_version));
+
+    m_completed = true;
+    m_blocks.clear(); // No longer required: free the space.
+    return data;
+}
+
+/** \fn DSMCCCacheModuleData::SaveToStore(const QString&,const unsigned char*,unsigned int)
+ *  \brief Save a completed module to the persistent store, so the next
+ *         visit to this service does not have to wait for the carousel.
+ */
+void DSMCCCacheModuleData::SaveToStore(const QString &dir,
+                                       const unsigned char *data,
+                                       unsigned int len) const
+{
+    if (dir.isEmpty())
+        return;
+
+    // Drop files for other versions of this module.
+    QDir d(dir);
+    QStringList old = d.entryList(
+        QStringList(QString("mod_%1_%2_*.bin")
+                    .arg(m_carousel_id).arg(m_module_id)));
+    QStringList::iterator it = old.begin();
+    for (; it != old.end(); ++it)
+        d.remove(*it);
+
+    QFile file(StoreFileName(dir));
+    if (!file.open(QIODevice::WriteOnly))
+        return;
+
+    file.write((const char*) data, len);
+}
 
 ObjCarousel::ObjCarousel(Dsmcc *dsmcc)
-    : filecache(dsmcc), m_id(0)
+    : filecache(dsmcc), m_id(0), m_dsmcc(dsmcc)
 {
 }
 
@@ -204,6 +277,12 @@ void ObjCarousel::AddModuleInfo(DsmccDii *dii, Dsmcc *status,
 
         // Add this module to the cache.
         m_Cache.append(cachep);
+
+        // Check the persistent store in case we saved this version of
+        // the module on an earlier visit to the service.
+        unsigned char *data = cachep->RestoreFromStore(status->StoreDir());
+        if (data)
+            ProcessModule(cachep, data);
     }
 }
 
@@ -239,20 +318,31 @@ void ObjCarousel::AddModuleData(unsigned long carousel, DsmccDb *ddb,
     if (tmp_data)
     {
         // It is complete and we have the data
-        unsigned int len   = cachep->DataSize();
-        unsigned long curp = 0;
-        VERBOSE(VB_DSMCC, QString("[biop] Module size (uncompressed) = %1")
-                .arg(len));
-
-        // Now process the BIOP tables in this module.
-        // Tables may be file contents or the descriptions of
-        // directories or service gateways (root directories).
-        while (curp < len)
-        {
-            BiopMessage bm;
-            if (!bm.Process(cachep, &filecache, tmp_data, &curp))
-                break;
-        }
-        free(tmp_data);
+        cachep->SaveToStore(m_dsmcc->StoreDir(), tmp_data,
+                            cachep->DataSize());
+        ProcessModule(cachep, tmp_data);
+    }
+}
+
+/** \fn ObjCarousel::ProcessModule(DSMCCCacheModuleData*,unsigned char*)
+ *  \brief Process the BIOP tables in a completed module and free the data.
+ *
+ *   Tables may be file contents or the descriptions of
+ *   directories or service gateways (root directories).
+ */
+void ObjCarousel::ProcessModule(DSMCCCacheModuleData *cachep,
+                                unsigned char *data)
+{
+    unsigned int len   = cachep->DataSize();
+    unsigned long curp = 0;
+    VERBOSE(VB_DSMCC, QString("[biop] Module size (uncompressed) = %1")
+            .arg(len));
+
+    while (curp < len)
+    {
+        BiopMessage bm;
+        if (!bm.Process(cachep, &filecache, data, &curp))
+            break;
     }
+    free(data);
 }
@@ -6,6 +6,7 @@
 #define DSMCC_OBJCAROUSEL_H
 
 #include <QLinkedList>
+#include <QString>
 
 #include <vector>
 using namespace std;
@@ -31,6 +32,10 @@ class DSMCCCacheModuleData
 
     unsigned char *AddModuleData(DsmccDb *ddb, const unsigned char *Data);
 
+    unsigned char *RestoreFromStore(const QString &dir);
+    void SaveToStore(const QString &dir, const unsigned char *data,
+                     unsigned int len) const;
+
     unsigned long  CarouselId(void) const { return m_carousel_id; }
     unsigned short ModuleId(void)   const { return m_module_id;   }
     unsigned short StreamId(void)   const { return m_stream_id;   }
@@ -46,6 +51,8 @@ class DSMCCCacheModuleData
 
 
   private:
+    QString StoreFileName(const QString &dir) const;
+
     unsigned long  m_carousel_id;
     unsigned short m_module_id;
     unsigned short m_stream_id;
@@ -75,6 +82,11 @@ class ObjCarousel
     /// Component tags matched to this carousel.
     vector<unsigned short>         m_Tags;
     unsigned long                  m_id;
+
+  private:
+    void ProcessModule(DSMCCCacheModuleData *cachep, unsigned char *data);
+
+    Dsmcc                         *m_dsmcc;
 };
 
 #endif
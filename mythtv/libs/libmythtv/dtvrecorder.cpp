@@ -13,10 +13,6 @@
 #include "tv_rec.h"
 #include "mythverbose.h"
 
-extern "C" {
-extern const uint8_t *ff_find_start_code(const uint8_t *p, const uint8_t *end, uint32_t *state);
-}
-
 #define LOC QString("DTVRec(%1): ").arg(tvrec->GetCaptureCardNum())
 #define LOC_ERR QString("DTVRec(%1) Error: ").arg(tvrec->GetCaptureCardNum())
 
@@ -124,6 +120,8 @@ void DTVRecorder::FinishRecording(void)
         ringBuffer->WriterFlush();
     }
 
+    FlushPositionMap();
+
     if (curRecording)
     {
         if (ringBuffer)
@@ -162,6 +160,7 @@ void DTVRecorder::ResetForNewFile(void)
     positionMap.clear();
     positionMapDelta.clear();
     _payload_buffer.clear();
+    _payload_position_map.clear();
 }
 
 // documented in recorderbase.h
@@ -217,6 +216,8 @@ void DTVRecorder::BufferedWrite(const TSPacket &tspacket)
 
     if (ringBuffer)
         ringBuffer->Write(tspacket.data(), TSPacket::SIZE);
+
+    FlushPositionMap();
 }
 
 static const uint frameRateMap[16] = {
@@ -286,7 +287,7 @@ bool DTVRecorder::FindMPEG2Keyframes(const TSPacket* tspacket)
 
     while (bufptr < bufend)
     {
-        bufptr = ff_find_start_code(bufptr, bufend, &_start_code);
+        bufptr = H264Parser::find_start_code(bufptr, bufend, &_start_code);
         if ((_start_code & 0xffffff00) == 0x00000100)
         {
             // At this point we have seen the start code 0 0 1
@@ -463,9 +464,10 @@ void DTVRecorder::HandleKeyframe(uint64_t frameNum, int64_t extra)
 
     _first_keyframe = (_first_keyframe < 0) ? frameNum : _first_keyframe;
 
-    // Add key frame to position map
-    positionMapLock.lock();
-    if (!positionMap.contains(frameNum))
+    // Add key frame to the pending position map; it is folded into
+    // the shared position map when the payload buffer is flushed,
+    // so the scan loop never takes positionMapLock itself.
+    if (!_payload_position_map.contains(frameNum))
     {
         long long startpos = ringBuffer->GetWritePosition();
         // FIXME: handle keyframes with start code spanning over two ts packets
@@ -475,17 +477,41 @@ void DTVRecorder::HandleKeyframe(uint64_t frameNum, int64_t extra)
         // MAX_INT64 - offset, which is an exceedingly large number, and
         // certainly not valid.
         if (startpos >= 0)
-        {
-            positionMapDelta[frameNum] = startpos;
-            positionMap[frameNum]      = startpos;
-        }
+            _payload_position_map[frameNum] = startpos;
     }
-    positionMapLock.unlock();
 
     // Perform ringbuffer switch if needed.
     CheckForRingBufferSwitch();
 }
 
+/** \fn DTVRecorder::FlushPositionMap(void)
+ *  \brief Merges keyframes found by the keyframe scanners into the
+ *         shared position map.
+ *
+ *   The scanners accumulate hits in _payload_position_map without
+ *   locking; this folds them into the position map with a single
+ *   positionMapLock acquisition per flushed payload buffer, and only
+ *   once the frames the entries point at have actually been handed
+ *   to the ringbuffer.
+ */
+void DTVRecorder::FlushPositionMap(void)
+{
+    if (_payload_position_map.isEmpty())
+        return;
+
+    QMutexLocker locker(&positionMapLock);
+    frm_pos_map_t::const_iterator it = _payload_position_map.begin();
+    for (; it != _payload_position_map.end(); ++it)
+    {
+        if (!positionMap.contains(it.key()))
+        {
+            positionMapDelta[it.key()] = *it;
+            positionMap[it.key()]      = *it;
+        }
+    }
+    _payload_position_map.clear();
+}
+
 /** \fn DTVRecorder::FindH264Keyframes(const TSPacket*)
  *  \brief This searches the TS packet to identify keyframes.
  *  \param TSPacket Pointer the the TS packet data.
@@ -656,14 +682,10 @@ void DTVRecorder::HandleH264Keyframe(void)
 
     _first_keyframe = (_first_keyframe < 0) ? frameNum : _first_keyframe;
 
-    // Add key frame to position map
-    positionMapLock.lock();
-    if (!positionMap.contains(frameNum))
-    {
-        positionMapDelta[frameNum] = m_h264_parser.keyframeAUstreamOffset();
-        positionMap[frameNum]      = m_h264_parser.keyframeAUstreamOffset();
-    }
-    positionMapLock.unlock();
+    // Add key frame to the pending position map; it is folded into
+    // the shared position map when the payload buffer is flushed.
+    if (!_payload_position_map.contains(frameNum))
+        _payload_position_map[frameNum] = m_h264_parser.keyframeAUstreamOffset();
 
     // Perform ringbuffer switch if needed.
     CheckForRingBufferSwitch();
@@ -689,7 +711,8 @@ void DTVRecorder::FindPSKeyFrames(const uint8_t *buffer, uint len)
         bool hasKeyFrame  = false;
 
         const uint8_t *tmp = bufptr;
-        bufptr = ff_find_start_code(bufptr + skip, bufend, &_start_code);
+        bufptr = H264Parser::find_start_code(bufptr + skip, bufend,
+                                             &_start_code);
         _audio_bytes_remaining = 0;
         _other_bytes_remaining = 0;
         _video_bytes_remaining -= std::min(
@@ -828,6 +851,8 @@ void DTVRecorder::FindPSKeyFrames(const uint8_t *buffer, uint len)
             if (ringBuffer)
                 ringBuffer->Write(bufstart, (bufptr - bufstart));
 
+            FlushPositionMap();
+
             bufstart = bufptr;
         }
 
@@ -52,6 +52,7 @@ class DTVRecorder: public RecorderBase
     void ResetForNewFile(void);
 
     void HandleKeyframe(uint64_t frameNum, int64_t extra = 0);
+    void FlushPositionMap(void);
 
     void BufferedWrite(const TSPacket &tspacket);
 
@@ -114,6 +115,9 @@ class DTVRecorder: public RecorderBase
     // keyframe finding buffer
     bool                  _buffer_packets;
     vector<unsigned char> _payload_buffer;
+    /// Keyframes found while scanning the current payload buffer,
+    /// merged into the position map when the buffer is flushed.
+    frm_pos_map_t         _payload_position_map;
 
     // statistics
     unsigned long long _frames_seen_count;
@@ -134,6 +134,11 @@ void DVBChannel::Close(DVBChannel *who)
     if (!is_open.empty())
         return; // not all callers have closed the DVB channel yet..
 
+    {
+        QMutexLocker cache_locker(&tuning_cache_lock);
+        tuning_cache.clear();
+    }
+
     if (diseqc_tree)
         diseqc_tree->Close();
 
@@ -275,11 +280,38 @@ bool DVBChannel::Init(QString &inputname, QString &startchannel, bool setchan)
     return ChannelBase::Init(inputname, startchannel, setchan);
 }
 
+/** \fn DVBChannel::GetMultiplexParams(uint, DTVMultiplex&)
+ *  \brief Fetches the tuning parameters for a multiplex,
+ *         caching the database lookup.
+ *
+ *   The dtv_multiplex table only changes when a channel scan is
+ *   run, so cached parameters are kept until the card is closed;
+ *   a recorder restart picks up any rescan results.
+ */
+bool DVBChannel::GetMultiplexParams(uint mplexid, DTVMultiplex &tuning)
+{
+    QMutexLocker locker(&tuning_cache_lock);
+
+    QMap<uint,DTVMultiplex>::const_iterator it = tuning_cache.find(mplexid);
+    if (it != tuning_cache.end())
+    {
+        tuning = *it;
+        return true;
+    }
+
+    if (!tuning.FillFromDB(tunerType, mplexid))
+        return false;
+
+    tuning_cache[mplexid] = tuning;
+
+    return true;
+}
+
 // documented in dtvchannel.h
 bool DVBChannel::TuneMultiplex(uint mplexid, QString inputname)
 {
     DTVMultiplex tuning;
-    if (!tuning.FillFromDB(tunerType, mplexid))
+    if (!GetMultiplexParams(mplexid, tuning))
         return false;
 
     CheckOptions(tuning);
@@ -361,7 +393,7 @@ bool DVBChannel::SetChannelByString(const QString &channum)
 
     // Initialize basic the tuning parameters
     DTVMultiplex tuning;
-    if (!mplexid || !tuning.FillFromDB(tunerType, mplexid))
+    if (!mplexid || !GetMultiplexParams(mplexid, tuning))
     {
         VERBOSE(VB_IMPORTANT, loc_err +
                 "Failed to initialize multiplex options");
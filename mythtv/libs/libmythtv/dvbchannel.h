@@ -104,6 +104,8 @@ class DVBChannel : public DTVChannel
 
     int  GetChanID(void) const;
 
+    bool GetMultiplexParams(uint mplexid, DTVMultiplex &tuning);
+
     void CheckOptions(DTVMultiplex &t) const;
     void CheckFrequency(uint64_t frequency) const;
     bool CheckModulation(DTVModulation modulation) const;
@@ -135,6 +137,9 @@ class DVBChannel : public DTVChannel
     DTVMultiplex      desired_tuning;
     /// Last tuning options Tune() succesfully sent to hardware
     DTVMultiplex      prev_tuning;
+    /// Cached dtv_multiplex rows, see GetMultiplexParams()
+    QMap<uint,DTVMultiplex> tuning_cache;
+    mutable QMutex    tuning_cache_lock;
 
     uint              last_lnb_dev_id;
 
@@ -5,6 +5,8 @@
 #include <cmath>
 
 #include <unistd.h>
+#include <sys/poll.h>
+#include <sys/ioctl.h>
 
 #include "mythcontext.h"
 #include "mythdbcon.h"
@@ -202,6 +204,48 @@ DVBChannel *DVBSignalMonitor::GetDVBChannel(void)
     return dynamic_cast<DVBChannel*>(channel);
 }
 
+/** \fn DVBSignalMonitor::WaitForUpdate(void)
+ *  \brief Blocks on the DVB frontend's event interface between updates.
+ *
+ *   The frontend fd becomes readable as soon as the driver reports a
+ *   status change, so a newly acquired lock is picked up right away
+ *   instead of on the next tick of the poll loop.  Once the signal is
+ *   locked the periodic wakeup is stretched to ten times the update
+ *   rate; the timeout retains the plain polling behaviour as a
+ *   fallback for drivers that never generate frontend events.
+ */
+void DVBSignalMonitor::WaitForUpdate(void)
+{
+    DVBChannel *dvbchannel = GetDVBChannel();
+    int fd = (dvbchannel) ? dvbchannel->GetFd() : -1;
+    if (fd < 0)
+    {
+        SignalMonitor::WaitForUpdate();
+        return;
+    }
+
+    int timeout = update_rate;
+    {
+        QMutexLocker locker(&statusLock);
+        if (signalLock.IsGood())
+            timeout = update_rate * 10;
+    }
+
+    struct pollfd polls;
+    polls.fd      = fd;
+    polls.events  = POLLIN | POLLPRI;
+    polls.revents = 0;
+
+    int ret = poll(&polls, 1, timeout);
+    if (ret > 0 && (polls.revents & (POLLIN | POLLPRI)))
+    {
+        // Drain the event queue; the frontend fd is non-blocking,
+        // so this stops as soon as the queue is empty.
+        struct dvb_frontend_event event;
+        while (ioctl(fd, FE_GET_EVENT, &event) >= 0);
+    }
+}
+
 /** \fn DVBSignalMonitor::UpdateValues()
  *  \brief Fills in frontend stats and emits status Qt signals.
  *
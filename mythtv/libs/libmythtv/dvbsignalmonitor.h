@@ -47,6 +47,7 @@ class DVBSignalMonitor: public DTVSignalMonitor
     DVBSignalMonitor(const DVBSignalMonitor&);
 
     virtual void UpdateValues(void);
+    virtual void WaitForUpdate(void);
     void EmitDVBSignals(void);
 
     DVBChannel *GetDVBChannel(void);
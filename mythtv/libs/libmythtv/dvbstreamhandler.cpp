@@ -145,6 +145,7 @@ void DVBStreamHandler::AddListener(MPEGStreamData *data,
     }
 
     _stream_data_list.push_back(data);
+    _listener_gen.ref();
 
     _listener_lock.unlock();
 
@@ -173,6 +174,8 @@ void DVBStreamHandler::RemoveListener(MPEGStreamData *data)
     if (it != _stream_data_list.end())
         _stream_data_list.erase(it);
 
+    _listener_gen.ref();
+
     if (_stream_data_list.empty())
     {
         _allow_section_reader = false;
@@ -183,6 +186,12 @@ void DVBStreamHandler::RemoveListener(MPEGStreamData *data)
     else
     {
         _listener_lock.unlock();
+
+        // Wait for the reader thread to pick up the new listener list,
+        // so the caller can safely delete the stream data once we return.
+        int gen = (int) _listener_gen;
+        while (IsRunning() && (((int) _listener_gen_seen - gen) < 0))
+            usleep(1000);
     }
 
     VERBOSE(VB_RECORD, LOC + "RemoveListener("<<data<<") -- end");
@@ -253,6 +262,29 @@ void DVBStreamHandler::Run(void)
         RunTS();
 }
 
+/** \fn DVBStreamHandler::RefreshListeners(vector<MPEGStreamData*>&,int&)
+ *  \brief Refreshes the reader thread's copy of the listener list.
+ *
+ *   The reader thread hands packets to a local copy of
+ *   _stream_data_list, so the data path does not acquire
+ *   _listener_lock at all. The copy is only refreshed, under the
+ *   lock, when the generation counter indicates that a listener
+ *   has been added or removed. The generation actually picked up
+ *   is published so RemoveListener() knows when the reader thread
+ *   has stopped using a removed listener.
+ */
+void DVBStreamHandler::RefreshListeners(
+    vector<MPEGStreamData*> &listeners, int &generation)
+{
+    if ((int) _listener_gen == generation)
+        return;
+
+    QMutexLocker locker(&_listener_lock);
+    listeners  = _stream_data_list;
+    generation = (int) _listener_gen;
+    _listener_gen_seen.fetchAndStoreOrdered(generation);
+}
+
 /** \fn DVBStreamHandler::RunTS(void)
  *  \brief Uses TS filtering devices to read a DVB device for tables & data
  *
@@ -317,18 +349,22 @@ void DVBStreamHandler::RunTS(void)
     fd_set fd_select_set;
     FD_ZERO(        &fd_select_set);
     FD_SET (dvr_fd, &fd_select_set);
+
+    // local copy of the listener list, so that packet processing
+    // does not take _listener_lock. See RefreshListeners().
+    vector<MPEGStreamData*> listeners;
+    int listener_gen = -1;
+
     while (IsRunning() && !_error)
     {
         RetuneMonitor();
         UpdateFiltersFromStreamData();
+        RefreshListeners(listeners, listener_gen);
 
         ssize_t len = 0;
 
         if (_device_read_buffer)
         {
-            len = _device_read_buffer->Read(
-                &(buffer[remainder]), buffer_size - remainder);
-
             // Check for DRB errors
             if (_device_read_buffer->IsErrored())
             {
@@ -341,6 +377,49 @@ void DVBStreamHandler::RunTS(void)
                 VERBOSE(VB_IMPORTANT, LOC_ERR + "Device EOF detected");
                 _error = true;
             }
+
+            // Zero-copy path: process TS packets directly out of the
+            // device ring. Only the packet wrapping the end of the ring
+            // is ever copied, through the bounce buffer below.
+            unsigned char *buf1 = NULL, *buf2 = NULL;
+            uint len1 = 0, len2 = 0;
+            _device_read_buffer->WaitForReadSegments(buf1, len1, buf2, len2);
+
+            if (len1 < 10) // 10 bytes = 4 bytes TS header + 6 bytes PES header
+            {
+                usleep(100);
+                continue;
+            }
+
+            if (listeners.empty())
+            {
+                _device_read_buffer->Discard(len1 + len2);
+                continue;
+            }
+
+            uint rem = 0;
+            for (uint i = 0; i < listeners.size(); i++)
+                rem = listeners[i]->ProcessData(buf1, len1);
+
+            _device_read_buffer->Discard(len1 - rem);
+
+            if (rem && len2)
+            {
+                // complete the packet wrapping the end of the ring
+                uint head = min(len2, TSPacket::SIZE * 2);
+                memcpy(buffer, buf1 + len1 - rem, rem);
+                memcpy(buffer + rem, buf2, head);
+
+                uint blen = rem + head;
+                uint brem = 0;
+                for (uint i = 0; i < listeners.size(); i++)
+                    brem = listeners[i]->ProcessData(buffer, blen);
+
+                if (blen - brem >= rem)
+                    _device_read_buffer->Discard(blen - brem);
+            }
+
+            continue;
         }
         else
         {
@@ -372,21 +451,14 @@ void DVBStreamHandler::RunTS(void)
             continue;
         }
 
-        _listener_lock.lock();
-
-        if (_stream_data_list.empty())
-        {
-            _listener_lock.unlock();
+        if (listeners.empty())
             continue;
-        }
 
-        for (uint i = 0; i < _stream_data_list.size(); i++)
+        for (uint i = 0; i < listeners.size(); i++)
         {
-            remainder = _stream_data_list[i]->ProcessData(buffer, len);
+            remainder = listeners[i]->ProcessData(buffer, len);
         }
 
-        _listener_lock.unlock();
-
         if (remainder > 0 && (len > remainder)) // leftover bytes
             memmove(buffer, &(buffer[len - remainder]), remainder);
     }
@@ -426,10 +498,14 @@ void DVBStreamHandler::RunSR(void)
 
     VERBOSE(VB_RECORD, LOC + "RunSR(): begin");
 
+    vector<MPEGStreamData*> listeners;
+    int listener_gen = -1;
+
     while (IsRunning())
     {
         RetuneMonitor();
         UpdateFiltersFromStreamData();
+        RefreshListeners(listeners, listener_gen);
 
         QMutexLocker read_locker(&_pid_lock);
 
@@ -448,13 +524,11 @@ void DVBStreamHandler::RunSR(void)
 
             if (psip.SectionSyntaxIndicator())
             {
-                _listener_lock.lock();
-                for (uint i = 0; i < _stream_data_list.size(); i++)
+                for (uint i = 0; i < listeners.size(); i++)
                 {
-                    _stream_data_list[i]->HandleTables(
+                    listeners[i]->HandleTables(
                         fit.key() /* pid */, psip);
                 }
-                _listener_lock.unlock();
             }
         }
 
@@ -8,6 +8,7 @@ using namespace std;
 
 #include <QMap>
 #include <QMutex>
+#include <QAtomicInt>
 
 #include "util.h"
 #include "DeviceReadBuffer.h"
@@ -81,6 +82,9 @@ class DVBStreamHandler : public ReaderPausedCB
     void RunTS(void);
     void RunSR(void);
 
+    void RefreshListeners(vector<MPEGStreamData*> &listeners,
+                          int &generation);
+
     void UpdateListeningForEIT(void);
     bool UpdateFiltersFromStreamData(void);
     bool AddPIDFilter(PIDInfo *info);
@@ -117,6 +121,12 @@ class DVBStreamHandler : public ReaderPausedCB
 
     mutable QMutex          _listener_lock;
     vector<MPEGStreamData*> _stream_data_list;
+    /// Incremented under _listener_lock on every listener change;
+    /// lets the reader thread use a local copy of the listener list
+    /// so packet processing never takes _listener_lock.
+    QAtomicInt              _listener_gen;
+    /// Last generation the reader thread has picked up.
+    QAtomicInt              _listener_gen_seen;
 
     // for caching TS monitoring supported value.
     static QMutex             _rec_supports_ts_monitoring_lock;
@@ -844,11 +844,18 @@ int DVDRingBuffer::safe_read(void *data, uint sz)
 bool DVDRingBuffer::nextTrack(void)
 {
     int newPart = m_part + 1;
+    QList<uint64_t> chapters = GetChapterTimes(m_title);
 
     QMutexLocker lock(&m_seekLock);
     if (newPart < m_titleParts)
     {
-        dvdnav_part_play(m_dvdnav, m_title, newPart);
+        // When we know where the chapter starts jump straight to
+        // its cell; a part play jump re-runs the VM and costs
+        // extra reads resyncing on slow (network) discs.
+        if (newPart - 1 < chapters.size())
+            Seek((long long)chapters[newPart - 1]);
+        else
+            dvdnav_part_play(m_dvdnav, m_title, newPart);
         m_gotStop = false;
         return true;
     }
@@ -858,10 +865,16 @@ bool DVDRingBuffer::nextTrack(void)
 void DVDRingBuffer::prevTrack(void)
 {
     int newPart = m_part - 1;
+    QList<uint64_t> chapters = GetChapterTimes(m_title);
 
     QMutexLocker lock(&m_seekLock);
     if (newPart > 0)
-        dvdnav_part_play(m_dvdnav, m_title, newPart);
+    {
+        if (newPart - 1 < chapters.size())
+            Seek((long long)chapters[newPart - 1]);
+        else
+            dvdnav_part_play(m_dvdnav, m_title, newPart);
+    }
     else
         Seek(0);
     m_gotStop = false;
@@ -882,6 +895,50 @@ uint DVDRingBuffer::GetCellStart(void)
     return m_cellStart / 90000;
 }
 
+/** \brief get the start time of each chapter (part) of a title,
+ *         in 90000 ticks per second.
+ *
+ *  dvdnav re-opens the title's IFO file every time it is asked to
+ *  describe the chapters, which means real disc reads, so the table
+ *  is built on first use and cached for the life of the disc.
+ */
+QList<uint64_t> DVDRingBuffer::GetChapterTimes(uint title)
+{
+    QMutexLocker lock(&m_seekLock);
+
+    QMap<uint, QList<uint64_t> >::const_iterator it =
+        m_chapterMap.find(title);
+    if (it != m_chapterMap.end())
+        return *it;
+
+    if (!m_dvdnav)
+        return QList<uint64_t>();
+
+    uint64_t duration;
+    uint64_t *times = NULL;
+    uint32_t num = dvdnav_describe_title_chapters(
+        m_dvdnav, title, &times, &duration);
+
+    if (!times)
+    {
+        VERBOSE(VB_IMPORTANT, LOC_ERR +
+                QString("Failed to get chapter times for title %1")
+                .arg(title));
+        return QList<uint64_t>();
+    }
+
+    // dvdnav returns the end time of each chapter,
+    // chapter N starts where chapter N-1 ends
+    QList<uint64_t> chapters;
+    chapters.append(0);
+    for (uint i = 0; i + 1 < num; i++)
+        chapters.append(times[i]);
+    free(times);
+
+    m_chapterMap.insert(title, chapters);
+    return chapters;
+}
+
 /** \brief check if dvd cell has changed
  */
 bool DVDRingBuffer::CellChanged(void)
@@ -6,6 +6,7 @@
 #define DVD_MENU_MAX 7
 
 #include <QMap>
+#include <QList>
 #include <QString>
 #include <QMutex>
 #include <QRect>
@@ -49,6 +50,7 @@ class MPUBLIC DVDRingBuffer : public RingBuffer
     uint GetTotalTimeOfTitle(void);
 
     uint GetCellStart(void);
+    QList<uint64_t> GetChapterTimes(uint title);
     bool PGCLengthChanged(void);
     bool CellChanged(void);
     bool IsInStillFrame(void)   const { return m_still > 0;             }
@@ -171,6 +173,9 @@ class MPUBLIC DVDRingBuffer : public RingBuffer
     uint64_t       m_seektime;
     uint           m_currentTime;
     QMap<uint, uint> m_seekSpeedMap;
+    /// Chapter start times (in 90kHz ticks) per title, built
+    /// on first use by GetChapterTimes().
+    QMap<uint, QList<uint64_t> > m_chapterMap;
 
     MythDVDPlayer *m_parent;
 
@@ -5,6 +5,8 @@
  * License: GPL v2
  */
 
+#include <pthread.h>
+
 #include <QDateTime>
 
 #include "eitcache.h"
@@ -18,7 +20,8 @@
 const uint EITCache::kVersionMax = 31;
 
 EITCache::EITCache()
-    : accessCnt(0), hitCnt(0),   tblChgCnt(0),   verChgCnt(0),
+    : writeThreadRunning(false),
+      accessCnt(0), hitCnt(0),   tblChgCnt(0),   verChgCnt(0),
       entryCnt(0), pruneCnt(0), prunedHitCnt(0), wrongChannelHitCnt(0)
 {
     // 24 hours ago
@@ -27,6 +30,7 @@ EITCache::EITCache()
 
 EITCache::~EITCache()
 {
+    WaitForWriteThread();
     WriteToDB();
 }
 
@@ -83,27 +87,25 @@ static inline bool modified(uint64_t sig)
     return sig >> 63;
 }
 
-static void replace_in_db(int chanid, uint eventid, uint64_t sig)
-{
+/// Rows per multi-row REPLACE in replace_in_db(const QStringList&)
+static const int kReplaceChunkSize = 1000;
 
+static void replace_in_db(const QStringList &rows)
+{
     MSqlQuery query(MSqlQuery::InitCon());
 
-    QString qstr =
-        "REPLACE INTO eit_cache "
-        "       ( chanid,  eventid,  tableid,  version,  endtime) "
-        "VALUES (:CHANID, :EVENTID, :TABLEID, :VERSION, :ENDTIME)";
-
-    query.prepare(qstr);
-    query.bindValue(":CHANID",   chanid);
-    query.bindValue(":EVENTID",  eventid);
-    query.bindValue(":TABLEID",  extract_table_id(sig));
-    query.bindValue(":VERSION",  extract_version(sig));
-    query.bindValue(":ENDTIME",  extract_endtime(sig));
-
-    if (!query.exec())
-        MythDB::DBError("Error updating eitcache", query);
-
-    return;
+    for (int i = 0; i < rows.size(); i += kReplaceChunkSize)
+    {
+        QStringList chunk = rows.mid(i, kReplaceChunkSize);
+        if (!query.exec(
+                "REPLACE INTO eit_cache "
+                "       (chanid, eventid, tableid, version, endtime) "
+                "VALUES " + chunk.join(",")))
+        {
+            MythDB::DBError("Error updating eitcache", query);
+            return;
+        }
+    }
 }
 
 static void delete_in_db(uint endtime)
@@ -260,48 +262,105 @@ event_map_t * EITCache::LoadChannel(uint chanid)
     return eventMap;
 }
 
-void EITCache::WriteChannelToDB(uint chanid)
+void EITCache::WriteToDB(void)
 {
-    event_map_t * eventMap = channelMap[chanid];
+    // Collect the modified entries under the lock and mark them as
+    // synced, then do the DB work without the lock so the scanner
+    // threads are not stalled behind the flush.
+    QMutexLocker locker(&eventMapLock);
+
+    QMap<uint,QStringList> rows;
+    QMap<uint,uint>        updated;
 
-    if (!eventMap)
+    key_map_t::iterator it = channelMap.begin();
+    while (it != channelMap.end())
     {
-        channelMap.remove(chanid);
-        return;
-    }
+        event_map_t *eventMap = *it;
+        if (!eventMap)
+        {
+            it = channelMap.erase(it);
+            continue;
+        }
 
-    uint size    = eventMap->size();
-    uint updated = 0;
+        uint chanid = it.key();
+        rows[chanid];
+        updated[chanid] = 0;
 
-    event_map_t::iterator it = eventMap->begin();
-    while (it != eventMap->end())
-    {
-        if (modified(*it) && extract_endtime(*it) > lastPruneTime)
+        event_map_t::iterator jt = eventMap->begin();
+        for (; jt != eventMap->end(); ++jt)
         {
-            replace_in_db(chanid, it.key(), *it);
-            updated++;
-            *it &= ~(uint64_t)0 >> 1; // mark as synced
+            if (modified(*jt) && extract_endtime(*jt) > lastPruneTime)
+            {
+                rows[chanid].push_back(
+                    QString("(%1,%2,%3,%4,%5)")
+                    .arg(chanid).arg(jt.key())
+                    .arg(extract_table_id(*jt))
+                    .arg(extract_version(*jt))
+                    .arg(extract_endtime(*jt)));
+                updated[chanid]++;
+                *jt &= ~(uint64_t)0 >> 1; // mark as synced
+            }
         }
-        it++;
+        ++it;
     }
-    unlock_channel(chanid, updated);
 
-    if (updated)
-        VERBOSE(VB_EIT, LOC + QString("Wrote %1 modified entries of %2 "
-                                      "for channel %3 to database.")
-                .arg(updated).arg(size).arg(chanid));
+    locker.unlock();
+
+    QMap<uint,QStringList>::const_iterator cit = rows.begin();
+    for (; cit != rows.end(); ++cit)
+    {
+        uint chanid = cit.key();
+
+        if (!(*cit).empty())
+            replace_in_db(*cit);
+        unlock_channel(chanid, updated[chanid]);
+
+        if (updated[chanid])
+            VERBOSE(VB_EIT, LOC + QString("Wrote %1 modified entries "
+                                          "for channel %2 to database.")
+                    .arg(updated[chanid]).arg(chanid));
+    }
 }
 
-void EITCache::WriteToDB(void)
+/** \fn EITCache::ScheduleWriteToDB(void)
+ *  \brief Kicks off a WriteToDB() on a background thread.
+ *
+ *   An EIT burst after a mux change can dirty thousands of entries;
+ *   flushing them on the caller's thread would stall the scanner for
+ *   the duration of the DB writes. Only one flush thread runs at a
+ *   time.
+ */
+void EITCache::ScheduleWriteToDB(void)
 {
     QMutexLocker locker(&eventMapLock);
+    if (writeThreadRunning)
+        return;
+    writeThreadRunning = true;
 
-    key_map_t::iterator it = channelMap.begin();
-    while (it != channelMap.end())
-    {
-        WriteChannelToDB(it.key());
-        ++it;
-    }
+    pthread_t writer;
+    pthread_create(&writer, NULL, WriteThread, this);
+    pthread_detach(writer);
+}
+
+/// \brief Waits for a background WriteToDB() to complete.
+void EITCache::WaitForWriteThread(void)
+{
+    QMutexLocker locker(&eventMapLock);
+    while (writeThreadRunning)
+        writeThreadWait.wait(&eventMapLock);
+}
+
+void *EITCache::WriteThread(void *param)
+{
+    EITCache *cache = (EITCache*) param;
+
+    cache->WriteToDB();
+
+    QMutexLocker locker(&cache->eventMapLock);
+    cache->writeThreadRunning = false;
+    cache->writeThreadWait.wakeAll();
+
+    return NULL;
 }
 
 
@@ -314,7 +373,7 @@ bool EITCache::IsNewEIT(uint chanid,  uint tableid,   uint version,
     if (accessCnt % 500000 == 50000)
     {
         VERBOSE(VB_EIT, endl << GetStatistics());
-        WriteToDB();
+        ScheduleWriteToDB();
     }
 
     // don't readd pruned entries
@@ -387,6 +446,7 @@ uint EITCache::PruneOldEntries(uint timestamp)
     lastPruneTime  = timestamp;
 
     // Write all modified entries to DB and start with a clean cache
+    WaitForWriteThread();
     WriteToDB();
 
     // Prune old entries in the DB
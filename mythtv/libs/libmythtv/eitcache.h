@@ -11,6 +11,7 @@
 // Qt headers
 #include <QString>
 #include <QMutex>
+#include <QWaitCondition>
 #include <QMap>
 
 // MythTV headers
@@ -36,7 +37,9 @@ class EITCache
 
   private:
     event_map_t * LoadChannel(uint chanid);
-    void WriteChannelToDB(uint chanid);
+    void ScheduleWriteToDB(void);
+    void WaitForWriteThread(void);
+    static void *WriteThread(void *param);
 
     // event key cache
     key_map_t   channelMap;
@@ -44,6 +47,10 @@ class EITCache
     mutable QMutex eventMapLock;
     uint            lastPruneTime;
 
+    // write-behind flush thread
+    bool           writeThreadRunning; // protected by eventMapLock
+    QWaitCondition writeThreadWait;    // protected by eventMapLock
+
     // statistics
     uint        accessCnt;
     uint        hitCnt;
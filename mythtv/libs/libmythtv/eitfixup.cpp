@@ -319,8 +319,12 @@ void EITFixUp::FixBellExpressVu(DBEventEIT &event) const
             event.description = event.description.right(event.description.length() - 1);
     }
 
+    // Most descriptions carry none of the parenthesized markers
+    // below, so gate the regexp checks on a single literal probe.
+    const bool descHasParen = event.description.contains("(");
+
     // See if a year is present as (xxxx)
-    position = event.description.indexOf(m_bellYear);
+    position = descHasParen ? event.description.indexOf(m_bellYear) : -1;
     if (position != -1 && event.category != "")
     {
         tmp = "";
@@ -366,8 +370,10 @@ void EITFixUp::FixBellExpressVu(DBEventEIT &event) const
         event.description = event.description.replace(m_Stereo, "");
     }
 
+    const bool titleHasAllDay = event.title.contains("(All Day");
+
     // Check for "title (All Day, HD)" in the title
-    position = event.title.indexOf(m_bellPPVTitleAllDayHD);
+    position = titleHasAllDay ? event.title.indexOf(m_bellPPVTitleAllDayHD) : -1;
     if (position != -1)
     {
         event.title = event.title.replace(m_bellPPVTitleAllDayHD, "");
@@ -375,14 +381,15 @@ void EITFixUp::FixBellExpressVu(DBEventEIT &event) const
      }
 
     // Check for "title (All Day)" in the title
-    position = event.title.indexOf(m_bellPPVTitleAllDay);
+    position = titleHasAllDay ? event.title.indexOf(m_bellPPVTitleAllDay) : -1;
     if (position != -1)
     {
         event.title = event.title.replace(m_bellPPVTitleAllDay, "");
     }
 
     // Check for "HD - title" in the title
-    position = event.title.indexOf(m_bellPPVTitleHD);
+    position = event.title.startsWith("HD") ?
+        event.title.indexOf(m_bellPPVTitleHD) : -1;
     if (position != -1)
     {
         event.title = event.title.replace(m_bellPPVTitleHD, "");
@@ -406,7 +413,8 @@ void EITFixUp::FixBellExpressVu(DBEventEIT &event) const
     }
 
     // Check for HD at the end of the title
-    position = event.title.indexOf(m_dishPPVTitleHD);
+    position = event.title.contains("HD") ?
+        event.title.indexOf(m_dishPPVTitleHD) : -1;
     if (position != -1)
     {
         event.title = event.title.replace(m_dishPPVTitleHD, "");
@@ -431,96 +439,118 @@ void EITFixUp::FixBellExpressVu(DBEventEIT &event) const
     }
 
     // Remove any trailing colon in title
-    position = event.title.indexOf(m_dishPPVTitleColon);
+    position = event.title.contains(":") ?
+        event.title.indexOf(m_dishPPVTitleColon) : -1;
     if (position != -1)
     {
         event.title = event.title.replace(m_dishPPVTitleColon, "");
     }
 
     // Remove New at the end of the description
-    position = event.description.indexOf(m_dishDescriptionNew);
+    position = event.description.contains("New.") ?
+        event.description.indexOf(m_dishDescriptionNew) : -1;
     if (position != -1)
     {
         event.previouslyshown = false;
         event.description = event.description.replace(m_dishDescriptionNew, "");
     }
 
-    // Remove Series Finale at the end of the desciption
-    position = event.description.indexOf(m_dishDescriptionFinale);
-    if (position != -1)
+    if (event.description.contains("Finale."))
     {
-        event.previouslyshown = false;
-        event.description = event.description.replace(m_dishDescriptionFinale, "");
-    }
+        // Remove Series Finale at the end of the desciption
+        position = event.description.indexOf(m_dishDescriptionFinale);
+        if (position != -1)
+        {
+            event.previouslyshown = false;
+            event.description =
+                event.description.replace(m_dishDescriptionFinale, "");
+        }
 
-    // Remove Series Finale at the end of the desciption
-    position = event.description.indexOf(m_dishDescriptionFinale2);
-    if (position != -1)
-    {
-        event.previouslyshown = false;
-        event.description = event.description.replace(m_dishDescriptionFinale2, "");
+        // Remove Series Finale at the end of the desciption
+        position = event.description.indexOf(m_dishDescriptionFinale2);
+        if (position != -1)
+        {
+            event.previouslyshown = false;
+            event.description =
+                event.description.replace(m_dishDescriptionFinale2, "");
+        }
     }
 
-    // Remove Series Premiere at the end of the description
-    position = event.description.indexOf(m_dishDescriptionPremiere);
-    if (position != -1)
+    if (event.description.contains("Premier"))
     {
-        event.previouslyshown = false;
-        event.description = event.description.replace(m_dishDescriptionPremiere, "");
-    }
+        // Remove Series Premiere at the end of the description
+        position = event.description.indexOf(m_dishDescriptionPremiere);
+        if (position != -1)
+        {
+            event.previouslyshown = false;
+            event.description =
+                event.description.replace(m_dishDescriptionPremiere, "");
+        }
 
-    // Remove Series Premiere at the end of the description
-    position = event.description.indexOf(m_dishDescriptionPremiere2);
-    if (position != -1)
-    {
-        event.previouslyshown = false;
-        event.description = event.description.replace(m_dishDescriptionPremiere2, "");
+        // Remove Series Premiere at the end of the description
+        position = event.description.indexOf(m_dishDescriptionPremiere2);
+        if (position != -1)
+        {
+            event.previouslyshown = false;
+            event.description =
+                event.description.replace(m_dishDescriptionPremiere2, "");
+        }
     }
 
     // Remove Dish's PPV code at the end of the description
-    QRegExp ppvcode = m_dishPPVCode;
-    ppvcode.setCaseSensitivity(Qt::CaseInsensitive);
-    position = event.description.indexOf(ppvcode);
-    if (position != -1)
+    if (event.description.contains("("))
     {
-        event.description = event.description.replace(ppvcode, "");
+        QRegExp ppvcode = m_dishPPVCode;
+        ppvcode.setCaseSensitivity(Qt::CaseInsensitive);
+        position = event.description.indexOf(ppvcode);
+        if (position != -1)
+        {
+            event.description = event.description.replace(ppvcode, "");
+        }
     }
 
     // Remove trailing garbage
-    position = event.description.indexOf(m_dishPPVSpacePerenEnd);
+    position = event.description.contains(" )") ?
+        event.description.indexOf(m_dishPPVSpacePerenEnd) : -1;
     if (position != -1)
     {
         event.description = event.description.replace(m_dishPPVSpacePerenEnd, "");
     }
 
     // Check for subtitle "All Day (... Eastern)" in the subtitle
-    position = event.subtitle.indexOf(m_bellPPVSubtitleAllDay);
+    position = event.subtitle.startsWith("All Day") ?
+        event.subtitle.indexOf(m_bellPPVSubtitleAllDay) : -1;
     if (position != -1)
     {
         event.subtitle = event.subtitle.replace(m_bellPPVSubtitleAllDay, "");
     }
 
-    // Check for description "(... Eastern)" in the description
-    position = event.description.indexOf(m_bellPPVDescriptionAllDay);
-    if (position != -1)
+    if (event.description.contains("("))
     {
-        event.description = event.description.replace(m_bellPPVDescriptionAllDay, "");
-    }
+        // Check for description "(... Eastern)" in the description
+        position = event.description.indexOf(m_bellPPVDescriptionAllDay);
+        if (position != -1)
+        {
+            event.description =
+                event.description.replace(m_bellPPVDescriptionAllDay, "");
+        }
 
-    // Check for description "(... ET)" in the description
-    position = event.description.indexOf(m_bellPPVDescriptionAllDay2);
-    if (position != -1)
-    {
-        event.description = event.description.replace(m_bellPPVDescriptionAllDay2, "");
-    }
+        // Check for description "(... ET)" in the description
+        position = event.description.indexOf(m_bellPPVDescriptionAllDay2);
+        if (position != -1)
+        {
+            event.description =
+                event.description.replace(m_bellPPVDescriptionAllDay2, "");
+        }
 
-    // Check for description "(nnnnn)" in the description
-    position = event.description.indexOf(m_bellPPVDescriptionEventId);
-    if (position != -1)
-    {
-        event.description = event.description.replace(m_bellPPVDescriptionEventId, "");
+        // Check for description "(nnnnn)" in the description
+        position = event.description.indexOf(m_bellPPVDescriptionEventId);
+        if (position != -1)
+        {
+            event.description =
+                event.description.replace(m_bellPPVDescriptionEventId, "");
+        }
     }
-
 }
 
 /** \fn EITFixUp::SetUKSubtitle(DBEventEIT&) const
@@ -655,23 +685,35 @@ void EITFixUp::FixUK(DBEventEIT &event) const
     QString strFull;
 
     bool isMovie = event.category.startsWith("Movie",Qt::CaseInsensitive);
+
+    // The vast majority of events match none of the patterns below,
+    // so before running each regexp check for a cheap literal the
+    // pattern can not match without.
+
     // BBC three case (could add another record here ?)
-    event.description = event.description.remove(m_ukThen);
-    event.description = event.description.remove(m_ukNew);
+    if (event.description.contains("60 Seconds", Qt::CaseInsensitive))
+        event.description = event.description.remove(m_ukThen);
+    if (event.description.contains("New", Qt::CaseInsensitive))
+        event.description = event.description.remove(m_ukNew);
 
     // Removal of Class TV, CBBC and CBeebies etc..
-    event.title = event.title.remove(m_ukTitleRemove);
-    event.description = event.description.remove(m_ukDescriptionRemove);
+    if (event.title.contains(":"))
+        event.title = event.title.remove(m_ukTitleRemove);
+    if (event.description.startsWith("C") || event.description.startsWith("B"))
+        event.description = event.description.remove(m_ukDescriptionRemove);
 
     // Removal of BBC FOUR and BBC THREE
-    event.description = event.description.remove(m_ukBBC34);
+    if (event.description.contains(" on BBC ", Qt::CaseInsensitive))
+        event.description = event.description.remove(m_ukBBC34);
 
     // BBC 7 [Rpt of ...] case.
-    event.description = event.description.remove(m_ukBBC7rpt);
+    if (event.description.contains("[Rpt"))
+        event.description = event.description.remove(m_ukBBC7rpt);
 
     // Remove [AD,S] etc.
     QRegExp tmpCC = m_ukCC;
-    if ((position1 = tmpCC.indexIn(event.description)) != -1)
+    if (event.description.contains("[") &&
+        (position1 = tmpCC.indexIn(event.description)) != -1)
     {
         QStringList tmpCCitems = tmpCC.cap(0).remove("[").remove("]").split(",");
         if (tmpCCitems.contains("AD"))
@@ -689,9 +731,17 @@ void EITFixUp::FixUK(DBEventEIT &event) const
     event.description = event.description.trimmed();
 
     // Work out the episode numbers (if any)
+    // m_ukSeries can not match without an "of" or "/" separator
     bool    series  = false;
+    bool    ukSeriesPossibleTitle =
+        event.title.contains("of", Qt::CaseInsensitive) ||
+        event.title.contains("/");
+    bool    ukSeriesPossibleDesc =
+        event.description.contains("of", Qt::CaseInsensitive) ||
+        event.description.contains("/");
     QRegExp tmpExp1 = m_ukSeries;
-    if ((position1 = tmpExp1.indexIn(event.title)) != -1)
+    if (ukSeriesPossibleTitle &&
+        (position1 = tmpExp1.indexIn(event.title)) != -1)
     {
         if ((tmpExp1.cap(1).toUInt() <= tmpExp1.cap(2).toUInt())
             && tmpExp1.cap(2).toUInt()<=50)
@@ -704,7 +754,8 @@ void EITFixUp::FixUK(DBEventEIT &event) const
             series = true;
         }
     }
-    else if ((position1 = tmpExp1.indexIn(event.description)) != -1)
+    else if (ukSeriesPossibleDesc &&
+             (position1 = tmpExp1.indexIn(event.description)) != -1)
     {
         if ((tmpExp1.cap(1).toUInt() <= tmpExp1.cap(2).toUInt())
             && tmpExp1.cap(2).toUInt()<=50)
@@ -721,7 +772,8 @@ void EITFixUp::FixUK(DBEventEIT &event) const
         event.categoryType = kCategorySeries;
 
     QRegExp tmpStarring = m_ukStarring;
-    if (tmpStarring.indexIn(event.description) != -1)
+    if (event.description.contains("tarring") &&
+        tmpStarring.indexIn(event.description) != -1)
     {
         // if we match this we've captured 2 actors and an (optional) airdate
         event.AddPerson(DBPerson::kActor, tmpStarring.cap(1));
@@ -774,7 +826,8 @@ void EITFixUp::FixUK(DBEventEIT &event) const
                 }
             }
         }
-        else if ((position1 = tmp24ep.indexIn(event.description)) != -1)
+        else if (event.description.contains(":00") &&
+                 (position1 = tmp24ep.indexIn(event.description)) != -1)
         {
             // Special case for episodes of 24.
             // -2 from the length cause we don't want ": " on the end
@@ -831,7 +884,8 @@ void EITFixUp::FixUK(DBEventEIT &event) const
 
     // Work out the year (if any)
     QRegExp tmpUKYear = m_ukYear;
-    if ((position1 = tmpUKYear.indexIn(event.description)) != -1)
+    if ((event.description.contains("(") || event.description.contains("[")) &&
+        (position1 = tmpUKYear.indexIn(event.description)) != -1)
     {
         QString stmp = event.description;
         int     itmp = position1 + tmpUKYear.cap(0).length();
@@ -16,6 +16,7 @@
 #include "util.h"
 #include "mythdb.h"
 #include "mythverbose.h"
+#include "mythprofile.h"
 
 #define LOC QString("EITScanner: ")
 #define LOC_ID QString("EITScanner (%1): ").arg(cardnum)
@@ -40,12 +41,14 @@ void EITThread::run(void)
 QMutex     EITScanner::resched_lock;
 QDateTime  EITScanner::resched_next_time      = QDateTime::currentDateTime();
 const uint EITScanner::kMinRescheduleInterval = 150;
+const uint EITScanner::kMaxScanBackoff        = 16;
 
 EITScanner::EITScanner(uint _cardnum)
     : channel(NULL),              eitSource(NULL),
       eitHelper(new EITHelper()), exitThread(false),
       rec(NULL),                  activeScan(false),
-      activeScanTrigTime(0),      cardnum(_cardnum)
+      activeScanTrigTime(0),      activeScanDwellYield(0),
+      cardnum(_cardnum)
 {
     QStringList langPref = iso639_get_language_list();
     eitHelper->SetLanguagePreferences(langPref);
@@ -91,6 +94,7 @@ void EITScanner::RunEventLoop(void)
     while (!exitThread)
     {
         lock.unlock();
+        MYTH_PROFILE_COUNT("wakeups_eitscanner", 1);
         uint list_size = eitHelper->GetListSize();
 
         float rate = 1.0f;
@@ -110,7 +114,9 @@ void EITScanner::RunEventLoop(void)
 
         if (list_size)
         {
-            eitCount += eitHelper->ProcessEvents();
+            uint added = eitHelper->ProcessEvents();
+            eitCount             += added;
+            activeScanDwellYield += added;
             t.start();
         }
 
@@ -133,6 +139,42 @@ void EITScanner::RunEventLoop(void)
                 RescheduleRecordings();
             }
 
+            QDateTime now = QDateTime::currentDateTime();
+
+            // Update the yield history for the multiplex we are
+            // leaving. Multiplexes that produced new events are
+            // revisited as soon as the crawl comes around again,
+            // ones whose events were all EIT cache hits are backed
+            // off exponentially, so tuner time goes where the new
+            // data is.
+            if (!activeScanLastChan.isEmpty())
+            {
+                uint &backoff = activeScanBackoff[activeScanLastChan];
+                if (activeScanDwellYield)
+                    backoff = 1;
+                else if (backoff < kMaxScanBackoff)
+                    backoff = backoff ? (backoff << 1) : 2;
+                activeScanNextVisit[activeScanLastChan] =
+                    now.addSecs(activeScanTrigTime * (backoff - 1));
+                VERBOSE(VB_EIT, LOC_ID +
+                        QString("Multiplex of channel %1 yielded %2 "
+                                "new events, revisit in %3 scan periods")
+                        .arg(activeScanLastChan)
+                        .arg(activeScanDwellYield).arg(backoff));
+            }
+            activeScanDwellYield = 0;
+
+            // Find the next multiplex that is due for a visit. If
+            // everything is backed off just take the next one in
+            // the rotation rather than letting the tuner sit idle.
+            for (uint i = 0; i < (uint) activeScanChannels.size(); i++)
+            {
+                if (activeScanNextChan == activeScanChannels.end())
+                    activeScanNextChan = activeScanChannels.begin();
+                if (activeScanNextVisit.value(*activeScanNextChan, now) <= now)
+                    break;
+                activeScanNextChan++;
+            }
             if (activeScanNextChan == activeScanChannels.end())
                 activeScanNextChan = activeScanChannels.begin();
 
@@ -146,6 +188,7 @@ void EITScanner::RunEventLoop(void)
                         .arg(*activeScanNextChan));
             }
 
+            activeScanLastChan = *activeScanNextChan;
             activeScanNextTrig = QDateTime::currentDateTime()
                 .addSecs(activeScanTrigTime);
             activeScanNextChan++;
@@ -156,7 +199,21 @@ void EITScanner::RunEventLoop(void)
 
         lock.lock();
         if (!exitThread)
-            exitThreadCond.wait(&lock, 400); // sleep up to 400 ms.
+        {
+            // If no source is feeding us events and no active scan is
+            // running, nothing can arrive, so sleep until a scan is
+            // started or TeardownAll() wakes us. Otherwise poll, since
+            // events accumulate in the helper without a wakeup.
+            if (!activeScan && !eitSource && !eitCount &&
+                !eitHelper->GetListSize())
+            {
+                exitThreadCond.wait(&lock);
+            }
+            else
+            {
+                exitThreadCond.wait(&lock, 400); // sleep up to 400 ms.
+            }
+        }
     }
     lock.unlock();
 }
@@ -202,6 +259,7 @@ void EITScanner::StartPassiveScan(ChannelBase *_channel,
     eitHelper->SetSourceID(sourceid);
     eitSource->SetEITHelper(eitHelper);
     eitSource->SetEITRate(1.0f);
+    exitThreadCond.wakeAll();
 
     VERBOSE(VB_EIT, LOC_ID + "Started passive scan.");
 }
@@ -269,6 +327,7 @@ void EITScanner::StartActiveScan(TVRec *_rec, uint max_seconds_per_source)
     // order when the backend is first started up.
     if (activeScanChannels.size())
     {
+        QMutexLocker locker(&lock);
         uint randomStart = random() % activeScanChannels.size();
         activeScanNextChan = activeScanChannels.begin()+randomStart;
 
@@ -277,13 +336,17 @@ void EITScanner::StartActiveScan(TVRec *_rec, uint max_seconds_per_source)
         // Add a little randomness to trigger time so multiple
         // cards will have a staggered channel changing time.
         activeScanTrigTime += random() % 29;
+        activeScanLastChan = QString();
+        activeScanDwellYield = 0;
         activeScan = true;
+        exitThreadCond.wakeAll();
     }
 }
 
 void EITScanner::StopActiveScan()
 {
     activeScan = false;
+    activeScanLastChan = QString();
     rec = NULL;
     StopPassiveScan();
 }
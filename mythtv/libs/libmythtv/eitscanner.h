@@ -8,6 +8,7 @@
 #include <QDateTime>
 #include <QThread>
 #include <QMutex>
+#include <QMap>
 
 class TVRec;
 class ChannelBase;
@@ -72,6 +73,13 @@ class EITScanner
     QStringList      activeScanChannels;
     QStringList::iterator activeScanNextChan;
 
+    // per multiplex yield tracking, used to revisit fresh
+    // multiplexes quickly and back off from stable ones
+    QString          activeScanLastChan;
+    uint             activeScanDwellYield;
+    QMap<QString,uint>      activeScanBackoff;
+    QMap<QString,QDateTime> activeScanNextVisit;
+
     uint             cardnum;
 
     static QMutex    resched_lock;
@@ -79,6 +87,9 @@ class EITScanner
 
     /// Minumum number of seconds between reschedules.
     static const uint kMinRescheduleInterval;
+    /// Maximum number of scan periods to wait between visits to a
+    /// multiplex whose events are already all in the EIT cache.
+    static const uint kMaxScanBackoff;
 };
 
 #endif // EITSCANNER_H
@@ -30,9 +30,7 @@ FIFOWriter::FIFOWriter(int count, bool sync)
     maxblksize = new long[count];
     killwr = new int[count];
     fbcount = new int[count];
-    fifo_buf = new struct fifo_buf *[count];
-    fb_inptr = new struct fifo_buf *[count];
-    fb_outptr = new struct fifo_buf *[count];
+    fifo_qs = new struct fifo_q[count];
     fifothrds = new pthread_t[count];
     fifo_lock = new pthread_mutex_t [count];
     empty_cond = new pthread_cond_t[count];
@@ -64,9 +62,7 @@ FIFOWriter::~FIFOWriter()
         pthread_mutex_destroy(&fifo_lock[i]);
     }
     delete [] maxblksize;
-    delete [] fifo_buf;
-    delete [] fb_inptr;
-    delete [] fb_outptr;
+    delete [] fifo_qs;
     delete [] fifothrds;
     delete [] full_cond;
     delete [] empty_cond;
@@ -97,19 +93,17 @@ int FIFOWriter::FIFOInit(int id, QString desc, QString name, long size,
     fbdesc[id] = desc;
     killwr[id] = 0;
     fbcount[id] = (usesync) ? 2 : num_bufs;
-    fifo_buf[id] = new struct fifo_buf;
-    struct fifo_buf *fifoptr = fifo_buf[id];
-    for (int i = 0; i < fbcount[id]; i++)
-    {
-        fifoptr->data = new unsigned char[maxblksize[id]];
-        if (i == fbcount[id] - 1)
-            fifoptr->next = fifo_buf[id];
-        else
-            fifoptr->next = new struct fifo_buf;
-        fifoptr = fifoptr->next;
-    }
-    fb_inptr[id]  = fifo_buf[id];
-    fb_outptr[id] = fifo_buf[id];
+
+    // the queue starts as a single consumed dummy node; the node and
+    // buffer pool builds up to fbcount nodes through reclamation
+    struct fifo_q *q = &fifo_qs[id];
+    struct fifo_node *dummy = new struct fifo_node;
+    dummy->next = NULL;
+    dummy->data = new unsigned char[maxblksize[id]];
+    dummy->capacity = maxblksize[id];
+    dummy->blksize = 0;
+    q->head = q->first = q->tail = dummy;
+    q->count = 0;
 
     cur_id = id;
 
@@ -134,43 +128,74 @@ void FIFOWriter::FIFOWriteThread(void)
 {
     int id = cur_id;
     int fd = -1;
-    pthread_mutex_lock(&fifo_lock[id]);
+    struct fifo_q *q = &fifo_qs[id];
     cur_id = -1;
     while (1)
     {
-        if (fb_inptr[id] == fb_outptr[id])
-            pthread_cond_wait(&empty_cond[id],&fifo_lock[id]);
-        pthread_mutex_unlock(&fifo_lock[id]);
-        if (killwr[id])
-            break;
+        if (!q->count)
+        {
+            if (killwr[id])
+                break;
+            pthread_mutex_lock(&fifo_lock[id]);
+            if (!q->count && !killwr[id])
+            {
+                struct timespec timeout;
+                struct timeval now;
+                gettimeofday(&now, NULL);
+                timeout.tv_sec = now.tv_sec + 1;
+                timeout.tv_nsec = now.tv_usec * 1000;
+                pthread_cond_timedwait(&empty_cond[id], &fifo_lock[id],
+                                       &timeout);
+            }
+            pthread_mutex_unlock(&fifo_lock[id]);
+            continue;
+        }
         if (fd < 0)
         {
             QByteArray fname = filename[id].toAscii();
             fd = open(fname.constData(), O_WRONLY| O_SYNC);
         }
-        if (fd >= 0)
+
+        // drain everything queued, then wake the producer once
+        int drained = 0;
+        struct fifo_node *node;
+        while (q->count && (node = q->head->next))
         {
-            int written = 0;
-            while (written < fb_outptr[id]->blksize)
+            if (fd >= 0)
             {
-                int ret = write(fd, fb_outptr[id]->data+written,
-                                fb_outptr[id]->blksize-written);
-                if (ret < 0)
-                {
-                    VERBOSE(VB_IMPORTANT, QString("FIFOW: write failed with %1")
-                            .arg(strerror(errno)));
-                    ///FIXME: proper error propagation
-                    break;
-                }
-                else
+                int written = 0;
+                while (written < node->blksize)
                 {
-                    written += ret;
+                    int ret = write(fd, node->data+written,
+                                    node->blksize-written);
+                    if (ret < 0)
+                    {
+                        VERBOSE(VB_IMPORTANT,
+                                QString("FIFOW: write failed with %1")
+                                .arg(strerror(errno)));
+                        ///FIXME: proper error propagation
+                        break;
+                    }
+                    else
+                    {
+                        written += ret;
+                    }
                 }
             }
+
+            // advancing head releases the previous node (and its
+            // buffer) back to the producer for reuse
+            q->head = node;
+            q->count.fetchAndAddOrdered(-1);
+            drained++;
+        }
+
+        if (drained)
+        {
+            pthread_mutex_lock(&fifo_lock[id]);
+            pthread_cond_signal(&full_cond[id]);
+            pthread_mutex_unlock(&fifo_lock[id]);
         }
-        pthread_mutex_lock(&fifo_lock[id]);
-        fb_outptr[id] = fb_outptr[id]->next;
-        pthread_cond_signal(&full_cond[id]);
     }
 
     if (fd != -1)
@@ -178,44 +203,78 @@ void FIFOWriter::FIFOWriteThread(void)
 
     unlink(filename[id].toLocal8Bit().constData());
 
-    while (fifo_buf[id]->next != fifo_buf[id])
+    // free the whole list, first through tail
+    struct fifo_node *node = q->first;
+    while (node)
+    {
+        struct fifo_node *next = node->next;
+        if (node->data)
+            delete [] node->data;
+        delete node;
+        node = next;
+    }
+    q->head = q->first = q->tail = NULL;
+}
+
+/// Producer side: reclaims the oldest consumed node, or allocates a
+/// new one while the pool is still growing to fbcount nodes.
+FIFOWriter::fifo_node *FIFOWriter::GetNode(int id, long blksize)
+{
+    struct fifo_q *q = &fifo_qs[id];
+
+    struct fifo_node *node;
+    if (q->first != q->head)
     {
-        struct fifo_buf *tmpfifo = fifo_buf[id]->next->next;
-        delete [] fifo_buf[id]->next->data;
-        delete fifo_buf[id]->next;
-        fifo_buf[id]->next = tmpfifo;
+        node = q->first;
+        q->first = node->next;
     }
-    delete [] fifo_buf[id]->data;
-    delete fifo_buf[id];
+    else
+    {
+        node = new struct fifo_node;
+        node->data = NULL;
+        node->capacity = 0;
+    }
+
+    if (!node->data || node->capacity < blksize)
+    {
+        if (node->data)
+            delete [] node->data;
+        node->capacity = (blksize > maxblksize[id]) ? blksize
+                                                    : maxblksize[id];
+        node->data = new unsigned char[node->capacity];
+    }
+
+    return node;
 }
 
 void FIFOWriter::FIFOWrite(int id, void *buffer, long blksize)
 {
-    pthread_mutex_lock(&fifo_lock[id]);
-    while (fb_inptr[id]->next == fb_outptr[id])
+    struct fifo_q *q = &fifo_qs[id];
+
+    // soft bound: block once a pool's worth of data is queued, unless
+    // another fifo has run dry -- then we must keep going or the
+    // process reading the fifos can deadlock the whole pipeline, so
+    // the pool is allowed to grow instead (as before)
+    while (q->count >= fbcount[id])
     {
         bool blocking = false;
         if (!usesync)
         {
-            for(int i = 0; i < num_fifos; i++)
+            for (int i = 0; i < num_fifos; i++)
             {
                 if (i == id)
                     continue;
-                if (fb_inptr[i] == fb_outptr[i])
+                if (!fifo_qs[i].count)
                     blocking = true;
             }
         }
 
         if (blocking)
         {
-            struct fifo_buf *tmpfifo;
-            tmpfifo = fb_inptr[id]->next;
-            fb_inptr[id]->next = new struct fifo_buf;
-            fb_inptr[id]->next->data = new unsigned char[maxblksize[id]];
-            fb_inptr[id]->next->next = tmpfifo;
             QString msg = QString("allocating additonal buffer for : %1(%2)")
                           .arg(fbdesc[id]).arg(++fbcount[id]);
             VERBOSE(VB_FILE, msg);
+            break;
         }
         else
         {
@@ -224,19 +283,30 @@ void FIFOWriter::FIFOWrite(int id, void *buffer, long blksize)
             gettimeofday(&now, NULL);
             timeout.tv_sec = now.tv_sec + 1;
             timeout.tv_nsec = now.tv_usec * 1000;
-            pthread_cond_timedwait(&full_cond[id], &fifo_lock[id], &timeout);
+            pthread_mutex_lock(&fifo_lock[id]);
+            if (q->count >= fbcount[id])
+                pthread_cond_timedwait(&full_cond[id], &fifo_lock[id],
+                                       &timeout);
+            pthread_mutex_unlock(&fifo_lock[id]);
         }
     }
-    if (blksize > maxblksize[id])
+
+    struct fifo_node *node = GetNode(id, blksize);
+
+    memcpy(node->data, buffer, blksize);
+    node->blksize = blksize;
+    node->next = NULL;
+    q->tail->next = node;
+    q->tail = node;
+
+    // the ordered increment publishes the node; wake the writer only
+    // on the empty->nonempty transition
+    if (q->count.fetchAndAddOrdered(1) == 0)
     {
-        delete [] fb_inptr[id]->data;
-        fb_inptr[id]->data = new unsigned char[blksize];
+        pthread_mutex_lock(&fifo_lock[id]);
+        pthread_cond_signal(&empty_cond[id]);
+        pthread_mutex_unlock(&fifo_lock[id]);
     }
-    memcpy(fb_inptr[id]->data,buffer,blksize);
-    fb_inptr[id]->blksize = blksize;
-    fb_inptr[id] = fb_inptr[id]->next;
-    pthread_cond_signal(&empty_cond[id]);
-    pthread_mutex_unlock(&fifo_lock[id]);
 }
 
 void FIFOWriter::FIFODrain(void)
@@ -247,7 +317,7 @@ void FIFOWriter::FIFODrain(void)
         count = 0;
         for (int i = 0; i < num_fifos; i++)
         {
-            if (fb_inptr[i] == fb_outptr[i])
+            if (!fifo_qs[i].count)
             {
                 killwr[i] = 1;
                 pthread_mutex_lock(&fifo_lock[i]);
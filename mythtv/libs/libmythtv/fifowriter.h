@@ -6,7 +6,7 @@
 
 // Qt headers
 #include <QString>
-#include <QMutex>
+#include <QAtomicInt>
 
 // MythTV headers
 #include "mythexp.h"
@@ -27,12 +27,29 @@ class MPUBLIC FIFOWriter
     void FIFOWriteThread(void);
     static void *FIFOStartThread(void *param);
 
-    struct fifo_buf 
+    struct fifo_node
     {
-        struct fifo_buf *next;
+        struct fifo_node *next; ///< written by producer, read by consumer
         unsigned char *data;
         long blksize;
-     } **fifo_buf, **fb_inptr, **fb_outptr;
+        long capacity;
+    };
+
+    /** Single-producer/single-consumer queue: the transcode thread
+     *  appends at tail, the FIFO thread advances head past consumed
+     *  nodes, and the producer reclaims the consumed nodes (with
+     *  their buffers) from first up to head. All nodes live on one
+     *  list, so neither side ever updates a pointer the other side
+     *  updates, and the steady state allocates nothing. */
+    struct fifo_q
+    {
+        struct fifo_node * volatile head; ///< consumer: last consumed node
+        struct fifo_node *first;          ///< producer: oldest reclaimable
+        struct fifo_node *tail;           ///< producer: newest node
+        QAtomicInt count;                 ///< nodes queued, orders node writes
+    } *fifo_qs;
+
+    struct fifo_node *GetNode(int id, long blksize);
 
      pthread_t *fifothrds;
      pthread_mutex_t *fifo_lock;
@@ -48,4 +65,3 @@ class MPUBLIC FIFOWriter
 };
 
 #endif
-
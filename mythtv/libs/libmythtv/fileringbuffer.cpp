@@ -6,11 +6,15 @@
 #include <sys/time.h>
 #include <unistd.h>
 #include <fcntl.h>
+#ifndef USING_MINGW
+#include <sys/mman.h>
+#endif
 
 #include <QFileInfo>
 #include <QDir>
 
 #include "ThreadedFileWriter.h"
+#include "asyncreadengine.h"
 #include "fileringbuffer.h"
 #include "mythcontext.h"
 #include "remotefile.h"
@@ -39,8 +43,19 @@ static int posix_fadvise(int, off_t, off_t, int) { return 0; }
 #define LOC_WARN QString("FileRingBuf(%1) Warning: ").arg(filename)
 #define LOC_ERR  QString("FileRingBuf(%1) Error: ").arg(filename)
 
+/// Below this size a read is serviced with a single read() syscall;
+/// splitting it across the async engine would only add overhead.
+#define MIN_ASYNC_READ_SIZE (128*1024)
+
+/// Size of the sliding mmap() window used for local playback.
+/// Kept well below 2GB so 32-bit frontends are not starved of
+/// address space.
+#define MMAP_WINDOW_SIZE (64LL*1024*1024)
+
 FileRingBuffer::FileRingBuffer(const QString &lfilename,
                                bool write, bool readahead, int timeout_ms)
+    : asyncreader(NULL),
+      mapbuf(NULL), mapbase(0), mapsize(0), mapfilesize(0)
 {
     startreadahead = readahead;
     filename = lfilename;
@@ -97,6 +112,14 @@ FileRingBuffer::~FileRingBuffer()
         tfw = NULL;
     }
 
+    if (asyncreader)
+    {
+        delete asyncreader;
+        asyncreader = NULL;
+    }
+
+    UnmapFile();
+
     if (fd2 >= 0)
     {
         close(fd2);
@@ -106,6 +129,61 @@ FileRingBuffer::~FileRingBuffer()
     rwlock.unlock();
 }
 
+/** \fn FileRingBuffer::UnmapFile(void)
+ *  \brief Releases any current memory mapping of the file.
+ */
+void FileRingBuffer::UnmapFile(void)
+{
+#ifndef USING_MINGW
+    if (mapbuf)
+    {
+        munmap(mapbuf, mapsize);
+        mapbuf  = NULL;
+        mapbase = 0;
+        mapsize = 0;
+    }
+#endif
+}
+
+/** \fn FileRingBuffer::MapRegion(long long)
+ *  \brief Slides the mmap() window so that 'pos' falls within it.
+ *  \return false if pos is at/past EOF or the mapping fails.
+ */
+bool FileRingBuffer::MapRegion(long long pos)
+{
+#ifdef USING_MINGW
+    return false;
+#else
+    if (pos >= mapfilesize)
+        return false;
+
+    UnmapFile();
+
+    // align the window start down to a 64KB boundary
+    mapbase = pos & ~0xffffLL;
+    mapsize = min(MMAP_WINDOW_SIZE, mapfilesize - mapbase);
+
+    mapbuf = mmap(NULL, mapsize, PROT_READ, MAP_SHARED, fd2, mapbase);
+    if (MAP_FAILED == mapbuf)
+    {
+        VERBOSE(VB_IMPORTANT, LOC_ERR +
+                QString("mmap(%1@%2) failed").arg(mapsize).arg(mapbase) + ENO);
+        mapbuf  = NULL;
+        mapbase = 0;
+        mapsize = 0;
+        mapfilesize = 0; // disables the mmap read path
+        return false;
+    }
+
+    (void) madvise(mapbuf, mapsize, MADV_SEQUENTIAL);
+
+    VERBOSE(VB_FILE, LOC + QString("MapRegion(%1): window %2@%3")
+            .arg(pos).arg(mapsize).arg(mapbase));
+
+    return true;
+#endif
+}
+
 /** \fn check_permissions(const QString&)
  *  \brief Returns false iff file exists and has incorrect permissions.
  *  \param filename File (including path) that we want to know about
@@ -197,13 +275,22 @@ bool FileRingBuffer::OpenFile(const QString &lfilename, uint retry_ms)
         remotefile = NULL;
     }
 
+    if (asyncreader)
+    {
+        delete asyncreader;
+        asyncreader = NULL;
+    }
+
+    UnmapFile();
+    mapfilesize = 0;
+
     if (fd2 >= 0)
     {
         close(fd2);
         fd2 = -1;
     }
 
-    bool is_local = 
+    bool is_local =
         (filename.left(4) != "/dev") &&
         ((filename.left(1) == "/") || QFile::exists(filename));
 
@@ -299,6 +386,22 @@ bool FileRingBuffer::OpenFile(const QString &lfilename, uint retry_ms)
         VERBOSE(VB_FILE, LOC + QString("OpenFile() made %1 attempts in %2 ms")
                 .arg(openAttempts).arg(openTimer.elapsed()));
 
+        // Memory-mapped playback only makes sense for files that are
+        // no longer growing; still-recording files use the read paths.
+        if ((fd2 >= 0) && oldfile &&
+            gCoreContext->GetNumSetting("UseMmapPlayback", 0))
+        {
+            mapfilesize = QFileInfo(filename).size();
+            if (MapRegion(0))
+                VERBOSE(VB_FILE, LOC + "OpenFile(): using mmap playback");
+        }
+
+        if ((fd2 >= 0) && !mapbuf &&
+            gCoreContext->GetNumSetting("UseAsyncRingbufferRead", 1))
+        {
+            asyncreader = new AsyncReadEngine(fd2);
+            VERBOSE(VB_FILE, LOC + "OpenFile(): using async read engine");
+        }
     }
     else
     {
@@ -399,6 +502,63 @@ int FileRingBuffer::safe_read(int fd, void *data, uint sz)
     if (stopreads)
         return 0;
 
+    // Serve the read straight from the memory mapping when enabled;
+    // this avoids a syscall per read and lets the kernel fault pages
+    // in as needed. The window slides when the read leaves it.
+    if (mapfilesize)
+    {
+        long long pos = lseek64(fd2, 0, SEEK_CUR);
+        if (pos >= 0)
+        {
+            while (tot < sz && (pos + (long long)tot) < mapfilesize)
+            {
+                long long off = pos + tot;
+                if (!mapbuf || off < mapbase || off >= mapbase + mapsize)
+                {
+                    if (!MapRegion(off))
+                        break;
+                }
+                uint cnt = min((long long)(sz - tot),
+                               mapbase + mapsize - off);
+                memcpy((char*)data + tot,
+                       (char*)mapbuf + (off - mapbase), cnt);
+                tot += cnt;
+            }
+            lseek64(fd2, pos + tot, SEEK_SET);
+            if (mapfilesize) // false if a remap failed mid-read
+                return tot;
+        }
+    }
+
+    // Large reads are split into several positioned reads serviced in
+    // parallel, so one slow request (e.g. to an NFS storage group) only
+    // stalls its own slice of the block. A short read leaves a hole and
+    // the sequential loop below handles everything from there on, which
+    // keeps the EOF/still-recording logic in one place.
+    if (asyncreader && sz >= MIN_ASYNC_READ_SIZE)
+    {
+        long long pos = lseek64(fd2, 0, SEEK_CUR);
+        if (pos >= 0)
+        {
+            uint nreq  = AsyncReadEngine::kDefaultWorkers;
+            uint chunk = ((sz / nreq) + 0x7fff) & ~0x7fff; // 32KB multiples
+            for (uint off = 0; off < sz; off += chunk)
+            {
+                if (!asyncreader->Submit(pos + off, (char*)data + off,
+                                         min(chunk, sz - off)))
+                {
+                    break; // queue full; remainder is read sequentially
+                }
+            }
+
+            tot = asyncreader->CollectAll();
+            lseek64(fd2, pos + tot, SEEK_SET);
+
+            if (tot >= sz || stopreads)
+                return tot;
+        }
+    }
+
     while (tot < sz)
     {
         ret = read(fd2, (char *)data + tot, sz - tot);
@@ -1,5 +1,7 @@
 #include "ringbuffer.h"
 
+class AsyncReadEngine;
+
 class MPUBLIC FileRingBuffer : public RingBuffer
 {
     friend class RingBuffer;
@@ -32,4 +34,17 @@ class MPUBLIC FileRingBuffer : public RingBuffer
     }
     int safe_read(int fd, void *data, uint sz);
     int safe_read(RemoteFile *rf, void *data, uint sz);
+
+  protected:
+    bool MapRegion(long long pos);
+    void UnmapFile(void);
+
+  protected:
+    AsyncReadEngine *asyncreader; // protected by rwlock
+
+    // memory-mapped playback; all protected by rwlock
+    void      *mapbuf;      ///< current mapping, NULL if not mapped
+    long long  mapbase;     ///< file offset of start of mapping
+    long long  mapsize;     ///< size of current mapping
+    long long  mapfilesize; ///< size of file when mapping was enabled
 };
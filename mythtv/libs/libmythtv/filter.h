@@ -44,6 +44,15 @@ typedef struct ConstFilterInfo_
 struct VideoFilter_
 {
     int (*filter)(struct VideoFilter_ *, VideoFrame *, int);
+    /* Optional slice entry point for filters whose output pixels only
+     * depend on input pixels in the same rows. Called with a starting
+     * luma row (always even) and a row count; processing every slice
+     * of a frame must give the same result as one filter() call.
+     * Adjacent filters that provide this are run tile-by-tile in one
+     * cache-resident pass instead of full-frame passes. NULL when the
+     * filter can only run whole frames. */
+    int (*filter_slice)(struct VideoFilter_ *, VideoFrame *, int,
+                        int, int);
     void (*cleanup)(struct VideoFilter_ *);
 
     void *handle; /* Library handle */
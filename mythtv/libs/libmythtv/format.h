@@ -136,12 +136,14 @@ typedef struct kfatable_entry
 #define FILEHEADERSIZE  sizeof(rtfileheader)
 #define EXTENDEDSIZE sizeof(extendeddata)
 
+/* The freeTo* flags hand these buffers between the capture and write
+   threads without locking, so they must not be cached in registers. */
 typedef struct vidbuffertype
 {
     int sample;
     int timecode;
-    int freeToEncode;
-    int freeToBuffer;
+    volatile int freeToEncode;
+    volatile int freeToBuffer;
     unsigned char *buffer;
     int bufferlen;
     int forcekey;
@@ -151,8 +153,8 @@ typedef struct audbuffertype
 {
     int sample;
     int timecode;
-    int freeToEncode;
-    int freeToBuffer;
+    volatile int freeToEncode;
+    volatile int freeToBuffer;
     unsigned char *buffer;
 } audbuffertyp;
 
@@ -160,8 +162,8 @@ typedef struct txtbuffertype
 {
     int timecode;
     int pagenr;
-    int freeToEncode;
-    int freeToBuffer;
+    volatile int freeToEncode;
+    volatile int freeToBuffer;
     unsigned char *buffer;
     int bufferlen;
 } txtbuffertyp;
@@ -256,6 +256,15 @@ void HDHRStreamHandler::RunTS(void)
     // Buffer should be at least about 1MB..
     buffersize = max(49 * TSPacket::SIZE * 128, buffersize);
 
+    /* Size the interposed ring buffer like our ringbuffer setting,
+     * rather than using the library default of two seconds. */
+    if (hdhomerun_device_set_video_buffer_size(
+            _hdhomerun_device, buffersize) < 0)
+    {
+        VERBOSE(VB_RECORD, LOC_WARN +
+                "Failed to set video buffer size, using default");
+    }
+
     /* Create TS socket. */
     if (!hdhomerun_device_stream_start(_hdhomerun_device))
     {
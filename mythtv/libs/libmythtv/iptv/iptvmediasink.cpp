@@ -4,19 +4,30 @@
  *  Distributed as part of MythTV under GPL v2 and later.
  */
 #include <algorithm>
+#include <cstring>
 
 #include "mythcontext.h"
 #include "mythverbose.h"
 #include "iptvmediasink.h"
 #include "streamlisteners.h"
+#include "tspacket.h"
 
 #define LOC QString("IPTVSink:")
 #define LOC_ERR QString("IPTVSink, Error:")
 
+/// Accumulate this much data before waking the listeners.  An RTP
+/// datagram normally carries 7 TS packets, so this batches roughly
+/// 32 datagrams, a few milliseconds of a typical IPTV stream.
+static const unsigned int kFlushThreshold = TSPacket::SIZE * 7 * 32;
+/// How long data may sit in the buffer before it is flushed anyway.
+static const int64_t kFlushTimeoutUSecs = 5000;
+
 IPTVMediaSink::IPTVMediaSink(UsageEnvironment &env,
                              unsigned int      bufferSize) :
     MediaSink(env),
     _buf(NULL),         _buf_size(bufferSize),
+    _buf_used(0),       _buf_sent(0),
+    _flush_task(NULL),
     _env(env),          _lock(QMutex::Recursive)
 {
     _buf = new unsigned char[_buf_size];
@@ -24,6 +35,9 @@ IPTVMediaSink::IPTVMediaSink(UsageEnvironment &env,
 
 IPTVMediaSink::~IPTVMediaSink()
 {
+    if (_flush_task)
+        _env.taskScheduler().unscheduleDelayedTask(_flush_task);
+
     if (_buf)
     {
         delete[] _buf;
@@ -41,7 +55,8 @@ Boolean IPTVMediaSink::continuePlaying(void)
 {
     if (fSource)
     {
-        fSource->getNextFrame(_buf, _buf_size, afterGettingFrame, this,
+        fSource->getNextFrame(_buf + _buf_used, _buf_size - _buf_used,
+                              afterGettingFrame, this,
                               onSourceClosure, this);
         return True;
     }
@@ -63,13 +78,56 @@ void IPTVMediaSink::afterGettingFrame(
 void IPTVMediaSink::afterGettingFrame1(unsigned int   frameSize,
                                           struct timeval)
 {
+    if (_buf_sent && (_buf_sent == _buf_used))
+    {
+        // Everything before the frame we just received was already
+        // delivered by the timed flush; move the frame to the front
+        // so the buffer does not creep forward on slow streams.
+        memmove(_buf, _buf + _buf_used, frameSize);
+        _buf_sent = _buf_used = 0;
+    }
+
+    _buf_used += frameSize;
+
+    // Batch the datagrams so the listeners see one large buffer
+    // instead of being called for every datagram; the timed flush
+    // keeps low bitrate streams from being delayed.
+    if (_buf_used - _buf_sent >= kFlushThreshold)
+    {
+        if (_flush_task)
+            _env.taskScheduler().unscheduleDelayedTask(_flush_task);
+        Flush();
+        // No read is outstanding here, so the buffer can be reused.
+        _buf_sent = _buf_used = 0;
+    }
+    else if (!_flush_task)
+    {
+        _flush_task = _env.taskScheduler().scheduleDelayedTask(
+            kFlushTimeoutUSecs, FlushTask, this);
+    }
+
+    continuePlaying();
+}
+
+void IPTVMediaSink::FlushTask(void *clientData)
+{
+    IPTVMediaSink *sink = (IPTVMediaSink*) clientData;
+    sink->_flush_task = NULL;
+    sink->Flush();
+}
+
+void IPTVMediaSink::Flush(void)
+{
+    if (_buf_sent == _buf_used)
+        return;
+
     _lock.lock();
     vector<TSDataListener*>::iterator it = _listeners.begin();
     for (; it != _listeners.end(); ++it)
-        (*it)->AddData(_buf, frameSize);
+        (*it)->AddData(_buf + _buf_sent, _buf_used - _buf_sent);
     _lock.unlock();
 
-    continuePlaying();
+    _buf_sent = _buf_used;
 }
 
 void IPTVMediaSink::AddListener(TSDataListener *item)
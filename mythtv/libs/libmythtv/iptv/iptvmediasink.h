@@ -42,12 +42,23 @@ class IPTVMediaSink : public MediaSink
                                   struct timeval presentationTime,
                                   unsigned int   durationInMicroseconds);
 
+    /// Hand the batched data to the listeners.
+    void Flush(void);
+    /// Thunk to call Flush() from the task scheduler.
+    static void FlushTask(void *clientData);
+
   private:
     virtual Boolean continuePlaying(void);
 
   private:
     unsigned char           *_buf;
     unsigned int             _buf_size;
+    /// Bytes accumulated in _buf so far.
+    unsigned int             _buf_used;
+    /// Bytes of _buf already given to the listeners.
+    unsigned int             _buf_sent;
+    /// Pending delayed Flush(), NULL if none is scheduled.
+    TaskToken                _flush_task;
     UsageEnvironment        &_env;
     vector<TSDataListener*>  _listeners;
     mutable QMutex           _lock;
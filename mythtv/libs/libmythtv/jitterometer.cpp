@@ -6,12 +6,15 @@
 #include <cmath>
 
 #include "jitterometer.h"
+#include "mythverbose.h"
 
 Jitterometer::Jitterometer(const char *nname, int ncycles) :
-    count(0), num_cycles(ncycles), starttime_valid(0)
+    count(0), num_cycles(ncycles), starttime_valid(0),
+    total_count(0), total_sum(0.0), total_sum_sq(0.0), max_time(0)
 {
     times = (unsigned*) malloc(ncycles * sizeof(unsigned));
     memset(&starttime, 0, sizeof(struct timeval));
+    memset(histogram, 0, sizeof(histogram));
 
     if (nname)
         name = strdup(nname);
@@ -41,12 +44,26 @@ bool Jitterometer::RecordEndTime()
 
   if (starttime_valid)
     {
-      times[count] =
+      unsigned us =
         (timenow.tv_sec  - starttime.tv_sec ) * 1000000 +
         (timenow.tv_usec - starttime.tv_usec) ;
 
+      times[count] = us;
+
       //printf("recorded timediff '%d'\n", times[count]);
 
+      /* cumulative statistics for GetReport() */
+      total_count++;
+      total_sum    += us;
+      total_sum_sq += (double) us * us;
+      if (us > max_time)
+        max_time = us;
+
+      unsigned bucket = 0;
+      while ((us >> (bucket + 1)) && (bucket < kHistogramBuckets - 1))
+        bucket++;
+      histogram[bucket]++;
+
       count++;
     }
 
@@ -80,7 +97,10 @@ bool Jitterometer::RecordEndTime()
       /* compute standard deviation */
       standard_deviation = sqrt(sum_of_squared_deviations / (num_cycles - 1));
 
-      printf("'%s' mean = '%.2f', std. dev. = '%.2f', fps = '%.2f'\n", name, mean, standard_deviation, fps);
+      VERBOSE(VB_PLAYBACK,
+              QString("'%1' mean = '%2', std. dev. = '%3', fps = '%4'")
+              .arg(name).arg(mean, 0, 'f', 2)
+              .arg(standard_deviation, 0, 'f', 2).arg(fps, 0, 'f', 2));
 
       count = 0;
 
@@ -94,3 +114,33 @@ void Jitterometer::RecordStartTime()
   gettimeofday(&starttime, NULL);
   starttime_valid = 1;
 }
+
+/** \fn Jitterometer::GetReport(void) const
+ *  \brief Returns the cumulative timing statistics as a single line,
+ *         for querying at runtime (e.g. over network control).
+ *
+ *   The histogram buckets are powers of two of microseconds: bucket
+ *   zero is <2us, bucket ten is 1-2ms, the last bucket is open ended.
+ */
+QString Jitterometer::GetReport(void) const
+{
+    if (!total_count)
+        return QString("%1: no samples").arg(name);
+
+    double mean = total_sum / total_count;
+    double var  = (total_sum_sq / total_count) - (mean * mean);
+    double sd   = (var > 0.0) ? sqrt(var) : 0.0;
+
+    QString hist;
+    for (unsigned i = 0; i < kHistogramBuckets; i++)
+    {
+        hist += QString::number(histogram[i]);
+        if (i + 1 < kHistogramBuckets)
+            hist += "/";
+    }
+
+    return QString("%1: samples %2 mean %3us stddev %4us max %5us "
+                   "hist(log2 us) %6")
+        .arg(name).arg(total_count).arg(mean, 0, 'f', 1)
+        .arg(sd, 0, 'f', 1).arg(max_time).arg(hist);
+}
@@ -1,6 +1,7 @@
 #ifndef JITTEROMETER_H
 #define JITTEROMETER_H
 
+#include <QString>
 
 class Jitterometer
 {
@@ -46,6 +47,12 @@ class Jitterometer
   void RecordStartTime();
   bool RecordEndTime();
 
+  /// Number of histogram buckets; bucket i counts samples of
+  /// roughly 2^i microseconds, the last bucket is open ended.
+  static const unsigned kHistogramBuckets = 16;
+
+  QString GetReport(void) const;
+
  private:
   int count;
   int num_cycles;
@@ -54,6 +61,13 @@ class Jitterometer
   int starttime_valid;
   unsigned *times; // array of cycle lengths, in uS
 
+  // cumulative statistics over the life of the meter, for GetReport()
+  unsigned long long total_count;
+  double total_sum;     // uS
+  double total_sum_sq;
+  unsigned max_time;    // uS
+  unsigned histogram[kHistogramBuckets]; // log2(uS) buckets
+
   char *name;
 };
 
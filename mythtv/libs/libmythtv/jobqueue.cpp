@@ -27,6 +27,7 @@ using namespace std;
 #include "mythdb.h"
 #include "mythdirs.h"
 #include "mythverbose.h"
+#include "mythprofile.h"
 
 #ifndef O_STREAMING
 #define O_STREAMING 0
@@ -66,6 +67,9 @@ JobQueue::JobQueue(bool master)
 JobQueue::~JobQueue(void)
 {
     pthread_cancel(queueThread);
+    queueThreadCondLock.lock();
+    queueThreadCond.wakeAll();
+    queueThreadCondLock.unlock();
     pthread_join(queueThread, NULL);
 
     gCoreContext->removeListener(this);
@@ -134,6 +138,14 @@ void JobQueue::customEvent(QEvent *e)
                 runningJobsLock->unlock();
             }
         }
+        else if (message.left(17) == "JOB_QUEUE_CHANGED")
+        {
+            // A job was queued or commanded somewhere, check the queue
+            // now instead of waiting out the poll interval.
+            queueThreadCondLock.lock();
+            queueThreadCond.wakeAll();
+            queueThreadCondLock.unlock();
+        }
     }
 }
 
@@ -172,6 +184,10 @@ void JobQueue::ProcessQueue(void)
 
     QMap<int, int> jobStatus;
     int maxJobs;
+    int maxCPUJobs;
+    int maxIOJobs;
+    int cpuJobsRunning = 0;
+    int ioJobsRunning = 0;
     QString message;
     QMap<int, JobQueueEntry> jobs;
     bool atMax = false;
@@ -183,9 +199,13 @@ void JobQueue::ProcessQueue(void)
     {
         pthread_testcancel();
 
+        MYTH_PROFILE_COUNT("wakeups_jobqueue", 1);
         startedJobAlready = false;
         sleepTime = gCoreContext->GetNumSetting("JobQueueCheckFrequency", 30);
         maxJobs = gCoreContext->GetNumSetting("JobQueueMaxSimultaneousJobs", 3);
+        // Per-class limits, 0 means only the overall limit applies.
+        maxCPUJobs = gCoreContext->GetNumSetting("JobQueueMaxCPUJobs", 0);
+        maxIOJobs = gCoreContext->GetNumSetting("JobQueueMaxIOJobs", 0);
         VERBOSE(VB_JOBQUEUE, LOC +
                 QString("Currently set to run up to %1 job(s) max.")
                         .arg(maxJobs));
@@ -207,6 +227,8 @@ void JobQueue::ProcessQueue(void)
         {
             inTimeWindow = InJobRunWindow();
             jobsRunning = 0;
+            cpuJobsRunning = 0;
+            ioJobsRunning = 0;
             for (int x = 0; x < jobs.size(); x++)
             {
                 status = jobs[x].status;
@@ -216,7 +238,13 @@ void JobQueue::ProcessQueue(void)
                      (status == JOB_STARTING) ||
                      (status == JOB_PAUSED)) &&
                     (hostname == m_hostname))
-                jobsRunning++;
+                {
+                    jobsRunning++;
+                    if (IsCPUBoundJob(jobs[x].type))
+                        cpuJobsRunning++;
+                    else
+                        ioJobsRunning++;
+                }
             }
 
             message = QString("Currently Running %1 jobs.")
@@ -265,17 +293,39 @@ void JobQueue::ProcessQueue(void)
                     (!hostname.isEmpty()) &&
                     (hostname != m_hostname))
                 {
-                    // Setting the status here will prevent us from processing
-                    // any other jobs for this recording until this one is
-                    // completed on the remote host.
-                    jobStatus[jobID] = status;
+                    // If we are idle and the assigned host has left the
+                    // job sitting in the queue past the takeover timeout,
+                    // claim it so one busy host can't back up the queue.
+                    if ((status == JOB_QUEUED) &&
+                        (jobsRunning == 0) &&
+                        (gCoreContext->GetNumSetting("JobQueueStealJobs", 0)) &&
+                        (jobs[x].statustime.addSecs(60 * gCoreContext->
+                             GetNumSetting("JobQueueStealTimeout", 10)) <
+                         QDateTime::currentDateTime()) &&
+                        (ChangeJobHost(jobID, m_hostname, hostname)))
+                    {
+                        message = QString("Taking over '%1' job for %2 "
+                                          "from busy host '%3'")
+                                          .arg(JobText(jobs[x].type))
+                                          .arg(logInfo).arg(hostname);
+                        VERBOSE(VB_JOBQUEUE, LOC + message);
 
-                    message = QString("Skipping '%1' job for %2, "
-                                      "should run on '%3' instead")
-                                      .arg(JobText(jobs[x].type)).arg(logInfo)
-                                      .arg(hostname);
-                    VERBOSE(VB_JOBQUEUE, LOC + message);
-                    continue;
+                        hostname = jobs[x].hostname = m_hostname;
+                    }
+                    else
+                    {
+                        // Setting the status here will prevent us from
+                        // processing any other jobs for this recording until
+                        // this one is completed on the remote host.
+                        jobStatus[jobID] = status;
+
+                        message = QString("Skipping '%1' job for %2, "
+                                          "should run on '%3' instead")
+                                          .arg(JobText(jobs[x].type))
+                                          .arg(logInfo).arg(hostname);
+                        VERBOSE(VB_JOBQUEUE, LOC + message);
+                        continue;
+                    }
                 }
 
                 // Check to see if there was a previous job that is not done
@@ -425,9 +475,30 @@ void JobQueue::ProcessQueue(void)
                     continue;
                 }
 
-                // never start or claim more than one job in a single run
-                if (startedJobAlready)
+                // Don't overload one job class; commercial flagging is
+                // I/O bound while transcodes and user jobs fight over
+                // the CPU.
+                if (IsCPUBoundJob(jobs[x].type))
+                {
+                    if (maxCPUJobs && (cpuJobsRunning >= maxCPUJobs))
+                    {
+                        message = QString("Skipping '%1' job for %2, "
+                                          "at maximum CPU bound jobs.")
+                                          .arg(JobText(jobs[x].type))
+                                          .arg(logInfo);
+                        VERBOSE(VB_JOBQUEUE, LOC + message);
+                        continue;
+                    }
+                }
+                else if (maxIOJobs && (ioJobsRunning >= maxIOJobs))
+                {
+                    message = QString("Skipping '%1' job for %2, "
+                                      "at maximum IO bound jobs.")
+                                      .arg(JobText(jobs[x].type))
+                                      .arg(logInfo);
+                    VERBOSE(VB_JOBQUEUE, LOC + message);
                     continue;
+                }
 
                 if ((inTimeWindow) &&
                     (hostname.isEmpty()) &&
@@ -458,13 +529,22 @@ void JobQueue::ProcessQueue(void)
                 ProcessJob(jobs[x]);
 
                 startedJobAlready = true;
+                jobsRunning++;
+                if (IsCPUBoundJob(jobs[x].type))
+                    cpuJobsRunning++;
+                else
+                    ioJobsRunning++;
             }
         }
 
+        // Sleep for the poll interval, but wake up early when a
+        // JOB_QUEUE_CHANGED event signals that the table has changed.
+        queueThreadCondLock.lock();
         if (startedJobAlready)
-            sleep(5);
+            queueThreadCond.wait(&queueThreadCondLock, 5 * 1000);
         else
-            sleep(sleepTime);
+            queueThreadCond.wait(&queueThreadCondLock, sleepTime * 1000);
+        queueThreadCondLock.unlock();
     }
 }
 
@@ -574,6 +654,10 @@ bool JobQueue::QueueJob(int jobType, uint chanid, const QDateTime &recstartts,
         return false;
     }
 
+    // Wake up any JobQueue that could run this right away.
+    MythEvent me("JOB_QUEUE_CHANGED");
+    gCoreContext->dispatch(me);
+
     return true;
 }
 
@@ -883,6 +967,9 @@ bool JobQueue::ChangeJobCmds(int jobID, int newCmds)
         return false;
     }
 
+    MythEvent me("JOB_QUEUE_CHANGED");
+    gCoreContext->dispatch(me);
+
     return true;
 }
 
@@ -905,6 +992,9 @@ bool JobQueue::ChangeJobCmds(int jobType, uint chanid,
         return false;
     }
 
+    MythEvent me("JOB_QUEUE_CHANGED");
+    gCoreContext->dispatch(me);
+
     return true;
 }
 
@@ -1342,17 +1432,27 @@ int JobQueue::GetJobsInQueue(QMap<int, JobQueueEntry> &jobs, int findJobs)
     return jobCount;
 }
 
-bool JobQueue::ChangeJobHost(int jobID, QString newHostname)
+bool JobQueue::ChangeJobHost(int jobID, QString newHostname,
+                             QString oldHostname)
 {
     MSqlQuery query(MSqlQuery::InitCon());
 
     if (!newHostname.isEmpty())
     {
-        query.prepare("UPDATE jobqueue SET hostname = :NEWHOSTNAME "
-                      "WHERE hostname = :EMPTY AND id = :ID;");
+        QString querystr =
+            "UPDATE jobqueue SET hostname = :NEWHOSTNAME "
+            "WHERE hostname = :OLDHOSTNAME AND id = :ID";
+        // A takeover from another host is only valid while the job is
+        // still sitting in the queue unstarted.
+        if (!oldHostname.isEmpty())
+            querystr += " AND status = :QUEUED";
+
+        query.prepare(querystr + ";");
         query.bindValue(":NEWHOSTNAME", newHostname);
-        query.bindValue(":EMPTY", "");
+        query.bindValue(":OLDHOSTNAME", oldHostname);
         query.bindValue(":ID", jobID);
+        if (!oldHostname.isEmpty())
+            query.bindValue(":QUEUED", JOB_QUEUED);
     }
     else
     {
@@ -1408,6 +1508,17 @@ bool JobQueue::AllowedToRun(JobQueueEntry job)
     return false;
 }
 
+/** \fn JobQueue::IsCPUBoundJob(int)
+ *  \brief Returns true for job types that are predominantly CPU bound.
+ *
+ *  Transcodes and user jobs compete for the CPU, while commercial
+ *  flagging is mostly limited by how fast the file can be read.
+ */
+bool JobQueue::IsCPUBoundJob(int jobType)
+{
+    return (jobType != JOB_COMMFLAG);
+}
+
 enum JobCmds JobQueue::GetJobCmd(int jobID)
 {
     MSqlQuery query(MSqlQuery::InitCon());
@@ -141,7 +141,8 @@ class MPUBLIC JobQueue : public QObject
     static bool ChangeJobFlags(int jobID, int newFlags);
     static bool ChangeJobStatus(int jobID, int newStatus,
                                 QString comment = "");
-    static bool ChangeJobHost(int jobID, QString newHostname);
+    static bool ChangeJobHost(int jobID, QString newHostname,
+                              QString oldHostname = "");
     static bool ChangeJobComment(int jobID,
                                  QString comment = "");
     static bool ChangeJobArgs(int jobID,
@@ -204,6 +205,7 @@ class MPUBLIC JobQueue : public QObject
     void ProcessJob(JobQueueEntry job);
 
     bool AllowedToRun(JobQueueEntry job);
+    static bool IsCPUBoundJob(int jobType);
 
     static bool InJobRunWindow(int orStartingWithinMins = 0);
 
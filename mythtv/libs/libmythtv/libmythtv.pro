@@ -163,6 +163,8 @@ HEADERS += recordingrule.h          programdetail.h
 HEADERS += mythsystemevent.h
 HEADERS += avfringbuffer.h          ThreadedFileWriter.h
 HEADERS += ringbuffer.h             fileringbuffer.h
+HEADERS += asyncreadengine.h       diskwritescheduler.h
+HEADERS += seekindex.h
 HEADERS += dvdringbuffer.h          bdringbuffer.h
 HEADERS += streamingringbuffer.h
 
@@ -189,6 +191,8 @@ SOURCES += recordingrule.cpp        programdetail.cpp
 SOURCES += mythsystemevent.cpp
 SOURCES += avfringbuffer.cpp        ThreadedFileWriter.cpp
 SOURCES += ringbuffer.cpp           fileringBuffer.cpp
+SOURCES += asyncreadengine.cpp     diskwritescheduler.cpp
+SOURCES += seekindex.cpp
 SOURCES += dvdringbuffer.cpp        bdringbuffer.cpp
 SOURCES += streamingringbuffer.cpp
 
@@ -57,6 +57,7 @@ void LiveTVChain::AppendNewProgram(ProgramInfo *pginfo, QString channum,
     newent.starttime = pginfo->GetRecordingStartTime();
     newent.starttime.setTime(QTime(tmptime.hour(), tmptime.minute(),
                                    tmptime.second()));
+    newent.endtime = pginfo->GetRecordingEndTime();
     newent.discontinuity = discont;
     newent.hostprefix = m_hostprefix;
     newent.cardtype = m_cardtype;
@@ -93,7 +94,7 @@ void LiveTVChain::AppendNewProgram(ProgramInfo *pginfo, QString channum,
                 .arg(m_maxpos));
 
     m_maxpos++;
-    BroadcastUpdate();
+    BroadcastUpdate(UpdateToStringList("APPEND", m_maxpos - 1, newent));
 }
 
 void LiveTVChain::FinishedRecording(ProgramInfo *pginfo)
@@ -122,6 +123,8 @@ void LiveTVChain::FinishedRecording(ProgramInfo *pginfo)
             (*it).starttime == pginfo->GetRecordingStartTime())
         {
             (*it).endtime = pginfo->GetRecordingEndTime();
+            BroadcastUpdate(UpdateToStringList("UPDATE", -1, *it));
+            return;
         }
     }
     BroadcastUpdate();
@@ -172,13 +175,128 @@ void LiveTVChain::DeleteProgram(ProgramInfo *pginfo)
     }
 }
 
-void LiveTVChain::BroadcastUpdate(void)
+/** \fn LiveTVChain::BroadcastUpdate(const QStringList&)
+ *  \brief Tells any players watching this chain that it has changed.
+ *
+ *   When 'update' is non-empty it describes the change itself, so a
+ *   player that is in sync can apply it in memory instead of
+ *   re-reading the tvchain table; see ApplyUpdate(const QStringList&).
+ */
+void LiveTVChain::BroadcastUpdate(const QStringList &update)
 {
     QString message = QString("LIVETV_CHAIN UPDATE %1").arg(m_id);
-    MythEvent me(message);
+    MythEvent me(message, update);
     gCoreContext->dispatch(me);
 }
 
+QStringList LiveTVChain::UpdateToStringList(
+    const QString &action, int chainpos, const LiveTVChainEntry &entry)
+{
+    QStringList update;
+    update << action
+           << QString::number(chainpos)
+           << QString::number(entry.chanid)
+           << entry.starttime.toString(Qt::ISODate)
+           << entry.endtime.toString(Qt::ISODate)
+           << QString::number((int)entry.discontinuity)
+           << entry.hostprefix
+           << entry.cardtype
+           << entry.channum
+           << entry.inputname;
+    return update;
+}
+
+/** \fn LiveTVChain::QueueUpdate(const QStringList&)
+ *  \brief Queues a chain change received over the event mechanism
+ *         for the next ReloadAll(void) to apply.
+ */
+void LiveTVChain::QueueUpdate(const QStringList &update)
+{
+    QMutexLocker lock(&m_lock);
+    m_pendingUpdates.append(update);
+}
+
+/** \fn LiveTVChain::ApplyUpdate(const QStringList&)
+ *  \brief Applies one broadcast chain change to the in-memory chain.
+ *
+ *   Appends carry their chainpos, which acts as a sequence number: if
+ *   it doesn't line up with what we already have, we missed an update
+ *   somewhere and the caller falls back to re-reading the database.
+ */
+bool LiveTVChain::ApplyUpdate(const QStringList &update)
+{
+    if (update.size() < 10)
+        return false;
+
+    LiveTVChainEntry entry;
+    int chainpos       = update[1].toInt();
+    entry.chanid       = update[2].toUInt();
+    entry.starttime    = QDateTime::fromString(update[3], Qt::ISODate);
+    entry.endtime      = QDateTime::fromString(update[4], Qt::ISODate);
+    entry.discontinuity = update[5].toInt();
+    entry.hostprefix   = update[6];
+    entry.cardtype     = update[7];
+    entry.channum      = update[8];
+    entry.inputname    = update[9];
+
+    if (update[0] == "APPEND")
+    {
+        if (chainpos == m_chain.size())
+        {
+            m_chain.append(entry);
+            m_maxpos = chainpos + 1;
+            return true;
+        }
+        // a full reload may have raced the event and picked the
+        // entry up already; if so there is nothing left to do
+        if ((chainpos == m_chain.size() - 1) &&
+            (m_chain.back().chanid    == entry.chanid) &&
+            (m_chain.back().starttime == entry.starttime))
+        {
+            return true;
+        }
+        return false;
+    }
+
+    if (update[0] == "UPDATE")
+    {
+        QList<LiveTVChainEntry>::iterator it;
+        for (it = m_chain.begin(); it != m_chain.end(); ++it)
+        {
+            if ((*it).chanid    == entry.chanid &&
+                (*it).starttime == entry.starttime)
+            {
+                (*it).endtime = entry.endtime;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    return false;
+}
+
+/** \fn LiveTVChain::ApplyQueuedUpdates(void)
+ *  \brief Applies any queued chain changes, returning false if the
+ *         chain needs to be re-read from the database instead.
+ */
+bool LiveTVChain::ApplyQueuedUpdates(void)
+{
+    if (m_pendingUpdates.empty())
+        return false;
+
+    while (!m_pendingUpdates.empty())
+    {
+        if (!ApplyUpdate(m_pendingUpdates.takeFirst()))
+        {
+            m_pendingUpdates.clear();
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void LiveTVChain::DestroyChain(void)
 {
     QMutexLocker lock(&m_lock);
@@ -198,6 +316,28 @@ void LiveTVChain::ReloadAll(void)
     QMutexLocker lock(&m_lock);
 
     int prev_size = m_chain.size();
+
+    // changes pushed over the event mechanism save us the DB round
+    // trips below; only hit the database if we have nothing queued
+    // or the queued changes don't line up with what we have
+    if (ApplyQueuedUpdates())
+    {
+        m_curpos = ProgramIsAt(m_cur_chanid, m_cur_startts);
+        if (m_curpos < 0)
+            m_curpos = 0;
+
+        if (m_switchid >= 0)
+            m_switchid = ProgramIsAt(m_switchentry.chanid,
+                                     m_switchentry.starttime);
+
+        if (prev_size != m_chain.size())
+        {
+            VERBOSE(VB_PLAYBACK, LOC +
+                    "ReloadAll(): Added new recording");
+        }
+        return;
+    }
+
     m_chain.clear();
 
     MSqlQuery query(MSqlQuery::InitCon());
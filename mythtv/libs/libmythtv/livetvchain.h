@@ -2,6 +2,7 @@
 #define _LIVETVCHAIN_H_
 
 #include <QString>
+#include <QStringList>
 #include <QDateTime>
 #include <QMutex>
 #include <QList>
@@ -43,6 +44,7 @@ class MPUBLIC LiveTVChain
     void DeleteProgram(ProgramInfo *pginfo);
 
     void ReloadAll();
+    void QueueUpdate(const QStringList &update);
 
     // const gets
     QString GetID(void)  const { return m_id; }
@@ -85,12 +87,17 @@ class MPUBLIC LiveTVChain
     QString toString() const;
 
   private:
-    void BroadcastUpdate();
+    void BroadcastUpdate(const QStringList &update = QStringList());
+    bool ApplyQueuedUpdates(void);
+    bool ApplyUpdate(const QStringList &update);
     void GetEntryAt(int at, LiveTVChainEntry &entry) const;
     static ProgramInfo *EntryToProgram(const LiveTVChainEntry &entry);
+    static QStringList UpdateToStringList(
+        const QString &action, int chainpos, const LiveTVChainEntry &entry);
 
     QString m_id;
     QList<LiveTVChainEntry> m_chain;
+    QList<QStringList> m_pendingUpdates;
     int m_maxpos;
     mutable QMutex m_lock;
 
@@ -159,6 +159,7 @@ void MHIContext::Restart(uint chanid, uint cardid, bool isLive)
             m_dsmcc = new Dsmcc();
         {
             QMutexLocker locker(&m_dsmccLock);
+            m_dsmcc->SetChannel(chanid);
             m_dsmcc->Reset();
             ClearQueue();
         }
@@ -172,6 +173,7 @@ void MHIContext::Restart(uint chanid, uint cardid, bool isLive)
 
         {
             QMutexLocker locker(&m_dsmccLock);
+            m_dsmcc->SetChannel(chanid);
             m_dsmcc->Reset();
             ClearQueue();
         }
@@ -3,15 +3,13 @@
 
 extern "C" {
 // from libavcodec
-    extern const uint8_t *ff_find_start_code(const uint8_t * p,
-                                             const uint8_t *end,
-                                             uint32_t * state);
 #include "libavcodec/avcodec.h"
 #include "libavutil/internal.h"
 #include "libavcodec/golomb.h"
 }
 
 #include <cmath>
+#include <cstring>
 #include <strings.h>
 
 static const float eps = 1E-5;
@@ -263,6 +261,85 @@ bool H264Parser::new_AU(void)
     return result;
 }
 
+/** \fn H264Parser::find_start_code(const uint8_t*,const uint8_t*,uint32_t*)
+ *  \brief Scans for an 0x000001 start code prefix.
+ *
+ *   Drop-in replacement for libavcodec's ff_find_start_code() with the
+ *   same state handling, so a start code spanning two buffers is still
+ *   found.  A start code begins with two zero bytes, which lets the
+ *   scanner skip through runs of non-zero bytes eight at a time with a
+ *   word-sized zero-byte test instead of inspecting every byte.
+ *
+ *  \param p     Buffer to scan.
+ *  \param end   One past the last byte of the buffer.
+ *  \param state The last four bytes seen, carried between calls.
+ *               Contains 0x000001XX on a match, where XX is the byte
+ *               following the start code.
+ *  \return Pointer just past the matched start code, or end.
+ */
+const uint8_t *H264Parser::find_start_code(const uint8_t *p,
+                                           const uint8_t *end,
+                                           uint32_t      *state)
+{
+    if (p >= end)
+        return end;
+
+    // Finish any start code partially accumulated from an earlier
+    // buffer before scanning at full speed.
+    for (int i = 0; i < 3; i++)
+    {
+        uint32_t tmp = *state << 8;
+        *state = tmp + *p++;
+        if (tmp == 0x100)
+            return p;
+        if (p == end)
+            return p;
+    }
+
+    while (p < end)
+    {
+        // Skip runs of non-zero bytes, but only while no partial start
+        // code is pending in *state.
+        if (*p && (*state & 0xff) && ((*state & 0x00ffffff) != 0x000001))
+        {
+            while (end - p >= 8)
+            {
+                uint64_t v;
+                memcpy(&v, p, sizeof(v));
+                if ((v - 0x0101010101010101ULL) & ~v &
+                    0x8080808080808080ULL)
+                    break;
+                p += 8;
+            }
+            while (p < end && *p)
+                p++;
+
+            // The matcher below sees the previous bytes through
+            // *state, so re-sync it with what was skipped over.  The
+            // 0xff top byte keeps the caller's 0x000001XX test from
+            // matching a partial value at the end of a buffer.
+            *state = 0xff000000 |
+                ((uint32_t)p[-3] << 16) | ((uint32_t)p[-2] << 8) | p[-1];
+
+            if (p == end)
+                return end;
+        }
+
+        // Byte-wise matching through the zero run.
+        while (p < end)
+        {
+            uint32_t tmp = *state << 8;
+            *state = tmp + *p++;
+            if (tmp == 0x100)
+                return p;
+            if (p[-1] && ((*state & 0x00ffffff) != 0x000001))
+                break;
+        }
+    }
+
+    return end;
+}
+
 uint32_t H264Parser::addBytes(const uint8_t  *bytes,
                               const uint32_t  byte_count,
                               const uint64_t  stream_offset)
@@ -275,7 +352,7 @@ uint32_t H264Parser::addBytes(const uint8_t  *bytes,
 
     while (byteP < endP)
     {
-        byteP = ff_find_start_code(byteP, endP, &sync_accumulator);
+        byteP = find_start_code(byteP, endP, &sync_accumulator);
 
         if ((sync_accumulator & 0xffffff00) == 0x00000100)
         {
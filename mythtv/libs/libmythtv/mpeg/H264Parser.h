@@ -108,6 +108,10 @@ class H264Parser {
                       const uint64_t  stream_offset);
     void Reset(void);
 
+    static const uint8_t *find_start_code(const uint8_t *p,
+                                          const uint8_t *end,
+                                          uint32_t      *state);
+
     bool stateChanged(void) const { return state_changed; }
 
     uint8_t lastNALtype(void) const { return nal_unit_type; }
@@ -1,4 +1,6 @@
 
+#include <QMutex>
+
 #include "atsc_huffman.h"
 
 /*------------------------------------------------------------------------
@@ -40,55 +42,160 @@ static inline bool huffman1_get_bit(const unsigned char *src, uint bit)
     return (src[(bit - (bit & 0x7)) >> 3] >> (7 - (bit & 0x7))) & 0x01;
 }
 
+/* Returns the 8 bits starting at bit (MSB first) */
+static inline uint huffman1_peek_byte(const unsigned char *src, uint bit)
+{
+    uint offset = bit >> 3;
+    uint shift  = bit & 0x7;
+    uint value  = (src[offset] << shift) & 0xff;
+    if (shift)
+        value |= src[offset + 1] >> (8 - shift);
+    return value;
+}
+
+/** \brief 8-bit probe table entry for the order-1 Huffman decoder.
+ *
+ *   For each previous-character context there are 256 entries, one per
+ *   possible next byte of the bitstream. Codes of eight bits or less,
+ *   i.e. nearly all of them, decode in a single table probe; longer
+ *   codes record the interior tree node to continue the walk from.
+ */
+struct Huffman1LutEntry
+{
+    unsigned char  value;  ///< terminal table value, valid when bits != 0
+    unsigned char  bits;   ///< code length, 0 if code is longer than 8 bits
+    unsigned short node;   ///< node to continue the walk from when bits == 0
+};
+
+static Huffman1LutEntry *huff1_lut[3][128];
+static QMutex huff1_lut_lock;
+
+/* Returns the probe table for a context, building it on first use */
+static const Huffman1LutEntry *huffman1_get_lut(uint table_index, uint context)
+{
+    QMutexLocker locker(&huff1_lut_lock);
+
+    Huffman1LutEntry *&lut = huff1_lut[table_index][context];
+    if (lut)
+        return lut;
+
+    const unsigned char *table = atsc_tables[table_index];
+    int root = huffman1_get_root(context, table);
+
+    lut = new Huffman1LutEntry[256];
+    for (uint idx = 0; idx < 256; idx++)
+    {
+        uint used = 0;
+        unsigned int  node = 0;
+        unsigned char val  = 0;
+        while (used < 8)
+        {
+            bool thebit = (idx >> (7 - used)) & 0x1;
+            val = (thebit) ? table[root + (node*2) + 1]
+                           : table[root + (node*2)];
+            used++;
+            if (val & 0x80)
+                break;
+            node = val;
+        }
+
+        if (val & 0x80)
+        {
+            lut[idx].value = val;
+            lut[idx].bits  = used;
+            lut[idx].node  = 0;
+        }
+        else
+        {
+            lut[idx].value = 0;
+            lut[idx].bits  = 0;
+            lut[idx].node  = node;
+        }
+    }
+
+    return lut;
+}
+
 QString atsc_huffman1_to_string(const unsigned char *compressed,
                                 uint size, uint table_index)
 {
     QString retval = "";
+    retval.reserve(size * 2);
 
     const unsigned char *table = atsc_tables[table_index];
     int totalbits = size * 8;
     int bit = 0;
     int root = huffman1_get_root(0, table);
-    int node = 0;
+    const Huffman1LutEntry *lut = huffman1_get_lut(table_index, 0);
     bool thebit;
     unsigned char val;
 
     while (bit < totalbits)
     {
-        thebit = huffman1_get_bit(compressed, bit);
-        val = (thebit) ? table[root + (node*2) + 1] : table[root + (node*2)];
-
-        if (val & 0x80)
+        int node = 0;
+        if (bit + 8 <= totalbits)
         {
-            /* Got a Null Character so return */
-            if ((val & 0x7F) == 0)
+            // Probe eight bits at once; almost every code fits.
+            const Huffman1LutEntry &ent =
+                lut[huffman1_peek_byte(compressed, bit)];
+            if (ent.bits)
             {
-                return retval;
+                val  = ent.value;
+                bit += ent.bits;
             }
-            /* Escape character so next character is uncompressed */
-            if ((val & 0x7F) == 27)
+            else
             {
-                unsigned char val2 = 0;
-                for (int i = 0 ; i < 7 ; i++)
-                {
-                    val2 |=
-                        huffman1_get_bit(compressed, bit + i + 2) << (6 - i);
-                }
-                retval += QChar(val2);
+                // Code longer than 8 bits, continue the tree walk.
+                node = ent.node;
                 bit += 8;
-                root = huffman1_get_root(val2, table);
+                val  = 0;
             }
-            /* Standard Character */
-            else
+        }
+        else
+            val = 0;
+
+        while (!(val & 0x80) && (bit < totalbits))
+        {
+            thebit = huffman1_get_bit(compressed, bit);
+            val = (thebit) ? table[root + (node*2) + 1]
+                           : table[root + (node*2)];
+            bit++;
+            if (!(val & 0x80))
+                node = val;
+        }
+
+        /* Ran out of bits mid-code */
+        if (!(val & 0x80))
+            break;
+
+        /* Got a Null Character so return */
+        if ((val & 0x7F) == 0)
+        {
+            return retval;
+        }
+        /* Escape character so next character is uncompressed */
+        if ((val & 0x7F) == 27)
+        {
+            if (bit + 8 > totalbits)
+                break;
+            unsigned char val2 = 0;
+            for (int i = 0 ; i < 7 ; i++)
             {
-                root = huffman1_get_root(val & 0x7F, table);
-                retval += QChar(val & 0x7F);
+                val2 |=
+                    huffman1_get_bit(compressed, bit + i + 1) << (6 - i);
             }
-            node = 0;
+            retval += QChar(val2);
+            bit += 8;
+            root = huffman1_get_root(val2, table);
+            lut  = huffman1_get_lut(table_index, val2);
         }
+        /* Standard Character */
         else
-            node = val;
-        bit++;
+        {
+            root = huffman1_get_root(val & 0x7F, table);
+            lut  = huffman1_get_lut(table_index, val & 0x7F);
+            retval += QChar(val & 0x7F);
+        }
     }
     /* If you get here something went wrong so just return a blank string */
     return QString("");
@@ -120,6 +227,7 @@ QString atsc_huffman2_to_string(const unsigned char *compressed,
                                 uint length, uint table)
 {
     QString decompressed = "";
+    decompressed.reserve(length * 2);
 
     unsigned char        bitpos;
     const unsigned char *bufptr;
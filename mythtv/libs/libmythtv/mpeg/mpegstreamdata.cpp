@@ -84,6 +84,7 @@ MPEGStreamData::MPEGStreamData(int desiredProgram, bool cacheTables)
 
     // MS Windows doesn't like bzero()..
     memset(_si_time_offsets, 0, sizeof(_si_time_offsets));
+    memset(_pid_filter, 0, sizeof(_pid_filter));
 
     AddListeningPID(MPEG_PAT_PID);
 }
@@ -191,6 +192,8 @@ void MPEGStreamData::Reset(int desiredProgram)
 
     _pid_video_single_program = _pid_pmt_single_program = 0xffffffff;
 
+    RebuildPIDFilter();
+
     _pat_version.clear();
     _pat_section_seen.clear();
 
@@ -624,6 +627,11 @@ bool MPEGStreamData::CreatePMTSingleProgram(const ProgramMapTable &pmt)
 
     if (videoPIDs.size() >= 1)
         _pid_video_single_program = videoPIDs[0];
+
+    // the audio map was cleared and the video PID may have changed
+    // behind UpdatePIDFilter()'s back, so recompute the whole table
+    RebuildPIDFilter();
+
     for (uint i = 1; i < videoPIDs.size(); i++)
         AddWritingPID(videoPIDs[i]);
 
@@ -967,7 +975,9 @@ bool MPEGStreamData::ProcessTSPacket(const TSPacket& tspacket)
 {
     bool ok = !tspacket.TransportError();
 
-    if (IsEncryptionTestPID(tspacket.PID()))
+    const unsigned char flags = _pid_filter[tspacket.PID()];
+
+    if (flags & kPIDFilterEncTest)
     {
         ProcessEncryptedPacket(tspacket);
     }
@@ -975,9 +985,12 @@ bool MPEGStreamData::ProcessTSPacket(const TSPacket& tspacket)
     if (!ok)
         return false;
 
+    if (!flags)
+        return true; // no one is interested in this PID
+
     if (!tspacket.Scrambled() && tspacket.HasPayload())
     {
-        if (IsVideoPID(tspacket.PID()))
+        if (flags & kPIDFilterVideo)
         {
             for (uint j = 0; j < _ts_av_listeners.size(); j++)
                 _ts_av_listeners[j]->ProcessVideoTSPacket(tspacket);
@@ -985,7 +998,7 @@ bool MPEGStreamData::ProcessTSPacket(const TSPacket& tspacket)
             return true;
         }
 
-        if (IsAudioPID(tspacket.PID()))
+        if (flags & kPIDFilterAudio)
         {
             for (uint j = 0; j < _ts_av_listeners.size(); j++)
                 _ts_av_listeners[j]->ProcessAudioTSPacket(tspacket);
@@ -993,18 +1006,18 @@ bool MPEGStreamData::ProcessTSPacket(const TSPacket& tspacket)
             return true;
         }
 
-        if (IsWritingPID(tspacket.PID()) && _ts_writing_listeners.size())
+        if ((flags & kPIDFilterWriting) && _ts_writing_listeners.size())
         {
             for (uint j = 0; j < _ts_writing_listeners.size(); j++)
                 _ts_writing_listeners[j]->ProcessTSPacket(tspacket);
         }
 
-        if (IsListeningPID(tspacket.PID()))
+        if (flags & kPIDFilterListening)
         {
             HandleTSTables(&tspacket);
         }
     }
-    else if (!tspacket.Scrambled() && IsWritingPID(tspacket.PID()))
+    else if (!tspacket.Scrambled() && (flags & kPIDFilterWriting))
     {
         // PCRPID and other streams we're writing may not have payload...
         for (uint j = 0; j < _ts_writing_listeners.size(); j++)
@@ -1034,6 +1047,67 @@ int MPEGStreamData::ResyncStream(const unsigned char *buffer, int curr_pos,
     return pos;
 }
 
+/** \fn MPEGStreamData::UpdatePIDFilter(uint)
+ *  \brief Recomputes the dispatch table entry for one PID.
+ *
+ *   Called by the PID map mutators so that _pid_filter always reflects
+ *   the QMap based PID sets.
+ */
+void MPEGStreamData::UpdatePIDFilter(uint pid)
+{
+    if (pid >= 0x2000)
+        return;
+
+    unsigned char flags = 0;
+    if (_pids_listening.contains(pid))
+        flags |= kPIDFilterListening;
+    if (_pids_writing.contains(pid))
+        flags |= kPIDFilterWriting;
+    if (_pids_audio.contains(pid))
+        flags |= kPIDFilterAudio;
+    if (_pid_video_single_program == pid)
+        flags |= kPIDFilterVideo;
+    if (_encryption_pid_to_info.contains(pid))
+        flags |= kPIDFilterEncTest;
+
+    _pid_filter[pid] = flags;
+}
+
+/** \fn MPEGStreamData::RebuildPIDFilter(void)
+ *  \brief Recomputes the whole dispatch table from the PID maps.
+ *
+ *   Needed after code clears or replaces a PID map wholesale instead of
+ *   going through the Add/Remove PID methods.
+ */
+void MPEGStreamData::RebuildPIDFilter(void)
+{
+    memset(_pid_filter, 0, sizeof(_pid_filter));
+
+    pid_map_t::const_iterator it = _pids_listening.begin();
+    for (; it != _pids_listening.end(); ++it)
+        if (it.key() < 0x2000)
+            _pid_filter[it.key()] |= kPIDFilterListening;
+
+    it = _pids_writing.begin();
+    for (; it != _pids_writing.end(); ++it)
+        if (it.key() < 0x2000)
+            _pid_filter[it.key()] |= kPIDFilterWriting;
+
+    it = _pids_audio.begin();
+    for (; it != _pids_audio.end(); ++it)
+        if (it.key() < 0x2000)
+            _pid_filter[it.key()] |= kPIDFilterAudio;
+
+    if (_pid_video_single_program < 0x2000)
+        _pid_filter[_pid_video_single_program] |= kPIDFilterVideo;
+
+    QMap<uint, CryptInfo>::const_iterator cit =
+        _encryption_pid_to_info.begin();
+    for (; cit != _encryption_pid_to_info.end(); ++cit)
+        if (cit.key() < 0x2000)
+            _pid_filter[cit.key()] |= kPIDFilterEncTest;
+}
+
 bool MPEGStreamData::IsListeningPID(uint pid) const
 {
     pid_map_t::const_iterator it = _pids_listening.find(pid);
@@ -1605,6 +1679,7 @@ void MPEGStreamData::AddEncryptionTestPID(uint pnum, uint pid, bool isvideo)
     AddListeningPID(pid);
 
     _encryption_pid_to_info[pid] = CryptInfo((isvideo) ? 10000 : 500, 8);
+    UpdatePIDFilter(pid);
 
     _encryption_pid_to_pnums[pid].push_back(pnum);
     _encryption_pnum_to_pids[pnum].push_back(pid);
@@ -1644,6 +1719,7 @@ void MPEGStreamData::RemoveEncryptionTestPIDs(uint pnum)
             {
                 _encryption_pid_to_pnums.remove(pid);
                 _encryption_pid_to_info.remove(pid);
+                UpdatePIDFilter(pid);
             }
         }
     }
@@ -1692,6 +1768,8 @@ void MPEGStreamData::ResetDecryptionMonitoringState(void)
     _encryption_pid_to_info.clear();
     _encryption_pid_to_pnums.clear();
     _encryption_pnum_to_pids.clear();
+
+    RebuildPIDFilter();
 }
 
 bool MPEGStreamData::IsProgramDecrypted(uint pnum) const
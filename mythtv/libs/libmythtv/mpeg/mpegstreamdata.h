@@ -118,21 +118,24 @@ class MPEGStreamData : public EITSource
     // Listening
     virtual void AddListeningPID(
         uint pid, PIDPriority priority = kPIDPriorityNormal)
-        { _pids_listening[pid] = priority; }
+        { _pids_listening[pid] = priority; UpdatePIDFilter(pid); }
     virtual void AddNotListeningPID(uint pid)
         { _pids_notlistening[pid] = kPIDPriorityNormal; }
     virtual void AddWritingPID(
         uint pid, PIDPriority priority = kPIDPriorityHigh)
-        { _pids_writing[pid] = priority; }
+        { _pids_writing[pid] = priority; UpdatePIDFilter(pid); }
     virtual void AddAudioPID(
         uint pid, PIDPriority priority = kPIDPriorityHigh)
-        { _pids_audio[pid] = priority; }
+        { _pids_audio[pid] = priority; UpdatePIDFilter(pid); }
 
-    virtual void RemoveListeningPID(uint pid) { _pids_listening.remove(pid);  }
+    virtual void RemoveListeningPID(uint pid)
+        { _pids_listening.remove(pid); UpdatePIDFilter(pid); }
     virtual void RemoveNotListeningPID(uint pid)
         { _pids_notlistening.remove(pid); }
-    virtual void RemoveWritingPID(uint pid) { _pids_writing.remove(pid);    }
-    virtual void RemoveAudioPID(uint pid)   { _pids_audio.remove(pid);      }
+    virtual void RemoveWritingPID(uint pid)
+        { _pids_writing.remove(pid); UpdatePIDFilter(pid); }
+    virtual void RemoveAudioPID(uint pid)
+        { _pids_audio.remove(pid); UpdatePIDFilter(pid); }
 
     virtual bool IsListeningPID(uint pid) const;
     virtual bool IsNotListeningPID(uint pid) const;
@@ -300,6 +303,10 @@ class MPEGStreamData : public EITSource
     void ProcessPMT(const ProgramMapTable *pmt);
     void ProcessEncryptedPacket(const TSPacket&);
 
+    // PID dispatch table
+    void UpdatePIDFilter(uint pid);
+    void RebuildPIDFilter(void);
+
     static int ResyncStream(const unsigned char *buffer, int curr_pos, int len);
 
     void UpdateTimeOffset(uint64_t si_utc_time);
@@ -332,6 +339,19 @@ class MPEGStreamData : public EITSource
     pid_map_t _pids_writing;
     pid_map_t _pids_audio;
 
+    enum PIDFilterFlag
+    {
+        kPIDFilterListening = 0x01,
+        kPIDFilterWriting   = 0x02,
+        kPIDFilterAudio     = 0x04,
+        kPIDFilterVideo     = 0x08,
+        kPIDFilterEncTest   = 0x10,
+    };
+    /// Flat dispatch table with one flag byte per possible PID, so
+    /// ProcessTSPacket() can route a packet with a single array lookup
+    /// instead of several QMap searches.
+    unsigned char _pid_filter[0x2000];
+
     // Encryption monitoring
     mutable QMutex            _encryption_lock;
     QMap<uint, CryptInfo>     _encryption_pid_to_info;
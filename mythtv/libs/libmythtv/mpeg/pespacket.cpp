@@ -8,12 +8,13 @@ extern "C" {
 #include "mythconfig.h"
 #include "libavcodec/avcodec.h"
 #include "libavformat/avformat.h"
-#include "libavutil/crc.h"
-#include "libavutil/bswap.h"
 }
 
+#include <stdint.h>
+
 #include <vector>
-#include <map>
+
+#include <QMutex>
 
 using namespace std;
 
@@ -141,12 +142,76 @@ void PESPacket::GetAsTSPackets(vector<TSPacket> &output, uint cc) const
 #undef INCR_CC
 }
 
+// CRC-32/MPEG-2 lookup tables, sliced so the hot loop can process
+// eight input bytes per iteration instead of one.
+static uint32_t crc_table[8][256];
+static bool     crc_table_ready = false;
+static QMutex   crc_table_lock;
+
+static void init_crc_table(void)
+{
+    for (uint i = 0; i < 256; i++)
+    {
+        uint32_t crc = i << 24;
+        for (uint j = 0; j < 8; j++)
+            crc = (crc << 1) ^ ((crc & 0x80000000) ? 0x04c11db7 : 0);
+        crc_table[0][i] = crc;
+    }
+
+    // crc_table[j][i] is the CRC of byte i followed by j zero bytes.
+    for (uint i = 0; i < 256; i++)
+        for (uint j = 1; j < 8; j++)
+            crc_table[j][i] = (crc_table[j-1][i] << 8) ^
+                crc_table[0][crc_table[j-1][i] >> 24];
+}
+
+/** \brief Computes the CRC-32/MPEG-2 checksum of a buffer.
+ *
+ *   Uses the slice-by-8 technique, folding eight bytes into the CRC per
+ *   iteration; EIT heavy muxes push hundreds of tables a second per
+ *   tuner through this, so the inner loop matters.
+ */
+static uint32_t mpeg_crc32(const unsigned char *data, uint len)
+{
+    if (!crc_table_ready)
+    {
+        QMutexLocker locker(&crc_table_lock);
+        if (!crc_table_ready)
+        {
+            init_crc_table();
+            crc_table_ready = true;
+        }
+    }
+
+    uint32_t crc = 0xffffffff;
+
+    while (len >= 8)
+    {
+        crc ^= ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) |
+               ((uint32_t)data[2] <<  8) |  (uint32_t)data[3];
+        crc  = crc_table[7][(crc >> 24) & 0xff] ^
+               crc_table[6][(crc >> 16) & 0xff] ^
+               crc_table[5][(crc >>  8) & 0xff] ^
+               crc_table[4][ crc        & 0xff] ^
+               crc_table[3][data[4]] ^
+               crc_table[2][data[5]] ^
+               crc_table[1][data[6]] ^
+               crc_table[0][data[7]];
+        data += 8;
+        len  -= 8;
+    }
+
+    while (len--)
+        crc = (crc << 8) ^ crc_table[0][((crc >> 24) ^ *data++) & 0xff];
+
+    return crc;
+}
+
 uint PESPacket::CalcCRC(void) const
 {
     if (Length() < 1)
         return 0xffffffff;
-    return av_bswap32(av_crc(av_crc_get_table(AV_CRC_32_IEEE), (uint32_t) -1,
-                             _pesdata, Length() - 1));
+    return mpeg_crc32(_pesdata, Length() - 1);
 }
 
 bool PESPacket::VerifyCRC(void) const
@@ -211,13 +276,18 @@ float SequenceHeader::aspect(bool mpeg1) const
 // Memory allocator to avoid malloc global lock and waste less memory. //
 /////////////////////////////////////////////////////////////////////////
 
+// Blocks are carved out of large slabs and recycled through plain
+// freelist vectors. Pool membership is a range compare against the
+// slab list (normally a single slab), so neither pes_alloc() nor
+// pes_free() touches the real allocator on the demux hot path.
+
 static vector<unsigned char*> mem188;
 static vector<unsigned char*> free188;
-static map<unsigned char*, bool> alloc188;
+static uint used188 = 0;
 
 static vector<unsigned char*> mem4096;
 static vector<unsigned char*> free4096;
-static map<unsigned char*, bool> alloc4096;
+static uint used4096 = 0;
 
 #define BLOCKS188 512
 static unsigned char* get_188_block()
@@ -225,7 +295,7 @@ static unsigned char* get_188_block()
     if (free188.empty())
     {
         mem188.push_back((unsigned char*) malloc(188 * BLOCKS188));
-        free188.reserve(BLOCKS188);
+        free188.reserve(mem188.size() * BLOCKS188);
         unsigned char* block_start = mem188.back();
         for (uint i = 0; i < BLOCKS188; ++i)
             free188.push_back(i*188 + block_start);
@@ -233,22 +303,28 @@ static unsigned char* get_188_block()
 
     unsigned char *ptr = free188.back();
     free188.pop_back();
-    alloc188[ptr] = true;
+    used188++;
     return ptr;
 }
-#undef BLOCKS188
 
 static bool is_188_block(unsigned char* ptr)
 {
-    return alloc188.find(ptr) != alloc188.end();
+    vector<unsigned char*>::const_iterator it = mem188.begin();
+    for (; it != mem188.end(); ++it)
+    {
+        if ((ptr >= *it) && (ptr < *it + 188 * BLOCKS188))
+            return true;
+    }
+    return false;
 }
+#undef BLOCKS188
 
 static void return_188_block(unsigned char* ptr)
 {
-    alloc188.erase(ptr);
     free188.push_back(ptr);
+    used188--;
     // free the allocator only if more than 1 block was used
-    if (alloc188.empty() && mem188.size() > 1)
+    if (!used188 && mem188.size() > 1)
     {
         vector<unsigned char*>::iterator it;
         for (it = mem188.begin(); it != mem188.end(); ++it)
@@ -265,7 +341,7 @@ static unsigned char* get_4096_block()
     if (free4096.empty())
     {
         mem4096.push_back((unsigned char*) malloc(4096 * BLOCKS4096));
-        free4096.reserve(BLOCKS4096);
+        free4096.reserve(mem4096.size() * BLOCKS4096);
         unsigned char* block_start = mem4096.back();
         for (uint i = 0; i < BLOCKS4096; ++i)
             free4096.push_back(i*4096 + block_start);
@@ -273,40 +349,29 @@ static unsigned char* get_4096_block()
 
     unsigned char *ptr = free4096.back();
     free4096.pop_back();
-    alloc4096[ptr] = true;
+    used4096++;
     return ptr;
 }
-#undef BLOCKS4096
 
 static bool is_4096_block(unsigned char* ptr)
 {
-    return alloc4096.find(ptr) != alloc4096.end();
+    vector<unsigned char*>::const_iterator it = mem4096.begin();
+    for (; it != mem4096.end(); ++it)
+    {
+        if ((ptr >= *it) && (ptr < *it + 4096 * BLOCKS4096))
+            return true;
+    }
+    return false;
 }
+#undef BLOCKS4096
 
 static void return_4096_block(unsigned char* ptr)
 {
-    alloc4096.erase(ptr);
     free4096.push_back(ptr);
-
-#if 0 // enable this to debug memory leaks
-        cerr<<alloc4096.size()<<" 4096 blocks remain"<<endl;
-        map<unsigned char*, bool>::iterator it;
-        for (it = alloc4096.begin(); it != alloc4096.end(); ++it)
-        {
-            TSPacket *ts = (TSPacket*) it->first;
-            cerr<<QString("PES Packet: pid(0x%1)").arg(ts->PID(),0,16);
-            if (ts->PID() == 0x1ffb)
-            {
-                cerr<<QString(" tid(0x%1) ext(0x%2)")
-                    .arg(PSIPTable::View(*ts).TableID(),0,16)
-                    .arg(PSIPTable::View(*ts).TableIDExtension(),0,16);
-            }
-            cerr<<endl;
-        }
-#endif
+    used4096--;
 
     // free the allocator only if more than 1 block was used
-    if (alloc4096.empty() && mem4096.size() > 1)
+    if (!used4096 && mem4096.size() > 1)
     {
         vector<unsigned char*>::iterator it;
         for (it = mem4096.begin(); it != mem4096.end(); ++it)
@@ -398,9 +398,13 @@ bool MpegRecorder::OpenV4L2DeviceAsInput(void)
 
     if (CardUtil::GetV4LInfo(chanfd, card, driver, version))
     {
+        // Reads from the PS drivers return as soon as data is available,
+        // so a page multiple well above the old 4096 just batches up the
+        // read()/keyframe scan cycle when the driver has a backlog, it
+        // does not add latency.
         if (driver == "ivtv")
         {
-            bufferSize    = 4096;
+            bufferSize    = 64 * 1024;
             usingv4l2     = (version >= IVTV_KERNEL_VERSION(0, 8, 0));
             has_v4l2_vbi  = (version >= IVTV_KERNEL_VERSION(0, 3, 8));
             has_buggy_vbi = true;
@@ -409,7 +413,7 @@ bool MpegRecorder::OpenV4L2DeviceAsInput(void)
         }
         else if (driver == "pvrusb2")
         {
-            bufferSize    = 4096;
+            bufferSize    = 64 * 1024;
             usingv4l2     = true;
             has_v4l2_vbi  = true;
             has_buggy_vbi = true;
@@ -429,7 +433,7 @@ bool MpegRecorder::OpenV4L2DeviceAsInput(void)
         }
         else
         {
-            bufferSize    = 4096;
+            bufferSize    = 64 * 1024;
             usingv4l2     = has_v4l2_vbi = true;
             has_buggy_vbi = requires_special_pause = false;
         }
@@ -34,24 +34,128 @@ extern "C" {
 #include "mythverbose.h"
 #include "myth_imgconvert.h"
 
+/* A single cached SwsContext serialized every conversion in the
+ * process behind one mutex, and alternating callers (player OSD,
+ * preview generation, the commflag PGM converter) tore the context
+ * down and rebuilt it on every call. Cache a handful of contexts
+ * keyed by the conversion parameters instead; the lock only covers
+ * the checkout, so different conversions run concurrently on their
+ * own contexts. */
+
+#define MAX_CONVERT_CONTEXTS 8
+
+typedef struct
+{
+    struct SwsContext *ctx;
+    int                width;
+    int                height;
+    PixelFormat        srcfmt;
+    PixelFormat        dstfmt;
+    bool               in_use;
+    uint64_t           last_used;
+} CachedConvertContext;
+
+static QMutex               cache_lock;
+static CachedConvertContext cache[MAX_CONVERT_CONTEXTS];
+static uint64_t             cache_clock = 0;
+
 int myth_sws_img_convert(AVPicture *dst, PixelFormat dst_pix_fmt, AVPicture *src,
                 PixelFormat pix_fmt, int width, int height)
 {
-    static QMutex ctx_lock;
-    static struct SwsContext *convert_ctx;
-
-    QMutexLocker locker(&ctx_lock);
-    convert_ctx = sws_getCachedContext(convert_ctx, width, height, pix_fmt,
-                                       width, height, dst_pix_fmt,
-                                       SWS_FAST_BILINEAR, NULL, NULL, NULL);
-    if (convert_ctx == NULL) {
+    CachedConvertContext *entry = NULL;
+
+    {
+        QMutexLocker locker(&cache_lock);
+        int free_slot = -1, evict = -1;
+        for (int i = 0; i < MAX_CONVERT_CONTEXTS; i++)
+        {
+            if (!cache[i].ctx)
+            {
+                if (free_slot < 0)
+                    free_slot = i;
+                continue;
+            }
+            if (cache[i].in_use)
+                continue;
+            if (cache[i].width  == width       &&
+                cache[i].height == height      &&
+                cache[i].srcfmt == pix_fmt     &&
+                cache[i].dstfmt == dst_pix_fmt)
+            {
+                entry = &cache[i];
+                break;
+            }
+            if (evict < 0 || cache[i].last_used < cache[evict].last_used)
+                evict = i;
+        }
+
+        if (!entry)
+        {
+            int slot = (free_slot >= 0) ? free_slot : evict;
+            if (slot >= 0)
+            {
+                entry = &cache[slot];
+                if (entry->ctx)
+                {
+                    sws_freeContext(entry->ctx);
+                    entry->ctx = NULL;
+                }
+                entry->width  = width;
+                entry->height = height;
+                entry->srcfmt = pix_fmt;
+                entry->dstfmt = dst_pix_fmt;
+            }
+            // else every slot is checked out; fall through to an
+            // uncached one-shot context below.
+        }
+
+        if (entry)
+        {
+            entry->in_use    = true;
+            entry->last_used = ++cache_clock;
+        }
+    }
+
+    struct SwsContext *ctx;
+    if (entry)
+    {
+        entry->ctx = sws_getCachedContext(entry->ctx, width, height, pix_fmt,
+                                          width, height, dst_pix_fmt,
+                                          SWS_FAST_BILINEAR,
+                                          NULL, NULL, NULL);
+        ctx = entry->ctx;
+    }
+    else
+    {
+        ctx = sws_getContext(width, height, pix_fmt,
+                             width, height, dst_pix_fmt,
+                             SWS_FAST_BILINEAR, NULL, NULL, NULL);
+    }
+
+    if (ctx == NULL)
+    {
         VERBOSE(VB_IMPORTANT, "myth_sws_img_convert: Cannot initialize "
                 "the image conversion context");
+        if (entry)
+        {
+            QMutexLocker locker(&cache_lock);
+            entry->in_use = false;
+        }
         return -1;
     }
 
-    sws_scale(convert_ctx, src->data, src->linesize,
+    sws_scale(ctx, src->data, src->linesize,
               0, height, dst->data, dst->linesize);
 
+    if (entry)
+    {
+        QMutexLocker locker(&cache_lock);
+        entry->in_use = false;
+    }
+    else
+    {
+        sws_freeContext(ctx);
+    }
+
     return 0;
 }
@@ -201,7 +201,8 @@ MythPlayer::MythPlayer(bool muted)
       m_scan_tracker(0),            m_scan_initialized(false),
       keyframedist(30),             noVideoTracks(false),
       // Prebuffering
-      buffering(false),
+      buffering(false), buffering_boost(0),
+      buffering_count(0), buffering_total_wait(0),
       // General Caption/Teletext/Subtitle support
       textDisplayMode(kDisplayNone),
       prevTextDisplayMode(kDisplayNone),
@@ -246,7 +247,8 @@ MythPlayer::MythPlayer(bool muted)
       // LiveTVChain stuff
       m_tv(NULL),                   isDummy(false),
       // Debugging variables
-      output_jmeter(NULL)
+      output_jmeter(NULL),          vsync_jmeter(NULL),
+      render_jmeter(NULL),          decode_jmeter(NULL)
 {
     playerThread = QThread::currentThread();
     // Playback (output) zoom control
@@ -331,6 +333,24 @@ MythPlayer::~MythPlayer(void)
         output_jmeter = NULL;
     }
 
+    if (vsync_jmeter)
+    {
+        delete vsync_jmeter;
+        vsync_jmeter = NULL;
+    }
+
+    if (render_jmeter)
+    {
+        delete render_jmeter;
+        render_jmeter = NULL;
+    }
+
+    if (decode_jmeter)
+    {
+        delete decode_jmeter;
+        decode_jmeter = NULL;
+    }
+
     if (detect_letter_box)
     {
         delete detect_letter_box;
@@ -1738,7 +1758,11 @@ void MythPlayer::AVSync(VideoFrame *buffer, bool limit_delay)
         osdLock.unlock();
         VERBOSE(VB_PLAYBACK|VB_TIMESTAMP, QString("AVSync waitforframe %1 %2")
                 .arg(avsync_adjustment).arg(m_double_framerate));
+        if (vsync_jmeter)
+            vsync_jmeter->RecordStartTime();
         videosync->WaitForFrame(frameDelay + avsync_adjustment + repeat_delay);
+        if (vsync_jmeter)
+            vsync_jmeter->RecordEndTime();
         VERBOSE(VB_PLAYBACK|VB_TIMESTAMP, "AVSync show");
         videoOutput->Show(ps);
 
@@ -1906,6 +1930,21 @@ void MythPlayer::SetBuffering(bool new_buffering, bool pause_audio)
 {
     if (!buffering && new_buffering)
     {
+        // If we are back here shortly after resuming, the refill
+        // target was too shallow for this source (slow network or
+        // marginal storage); demand more frames before resuming
+        // next time. Otherwise the source has been keeping up, so
+        // work the extra depth back off.
+        if (buffering_last_exit.isValid() &&
+            (buffering_last_exit.msecsTo(QTime::currentTime()) < 10000))
+        {
+            buffering_boost = min(buffering_boost + 2, 16);
+        }
+        else if (buffering_boost)
+        {
+            buffering_boost--;
+        }
+
         VERBOSE(VB_PLAYBACK, LOC + "Waiting for video buffers...");
         buffering = true;
         audio.Pause(pause_audio);
@@ -1915,6 +1954,15 @@ void MythPlayer::SetBuffering(bool new_buffering, bool pause_audio)
     {
         buffering = false;
         audio.Pause(false);
+        buffering_last_exit = QTime::currentTime();
+        buffering_count++;
+        buffering_total_wait += buffering_start.msecsTo(buffering_last_exit);
+        VERBOSE(VB_PLAYBACK, LOC +
+                QString("Buffering ended after %1 ms "
+                        "(episode %2, %3 ms total, refill boost %4 frames)")
+                .arg(buffering_start.msecsTo(buffering_last_exit))
+                .arg(buffering_count).arg(buffering_total_wait)
+                .arg(buffering_boost));
     }
 }
 
@@ -1923,10 +1971,15 @@ bool MythPlayer::PrebufferEnoughFrames(bool pause_audio, int min_buffers)
     if (!videoOutput)
         return false;
 
+    // while already buffering, demand the adaptive refill depth on
+    // top of the normal threshold so marginal sources don't
+    // oscillate between pausing and resuming
+    int extra = buffering ? buffering_boost : 0;
+
     if (!(min_buffers ? (videoOutput->ValidVideoFrames() >= min_buffers) :
                         (videoOutput->hasHWAcceleration() ?
-                            videoOutput->EnoughPrebufferedFrames() :
-                            videoOutput->EnoughDecodedFrames())))
+                            videoOutput->EnoughPrebufferedFrames(extra) :
+                            videoOutput->EnoughDecodedFrames(extra))))
     {
         SetBuffering(true, pause_audio);
         usleep(frame_interval >> 3);
@@ -1981,11 +2034,15 @@ void MythPlayer::DisplayNormalFrame(bool check_prebuffer)
     if (kScan_Detect == m_scan || kScan_Ignore == m_scan)
         ps = kScan_Progressive;
 
+    if (render_jmeter)
+        render_jmeter->RecordStartTime();
     osdLock.lock();
     videofiltersLock.lock();
     videoOutput->ProcessFrame(frame, osd, videoFilters, pip_players, ps);
     videofiltersLock.unlock();
     osdLock.unlock();
+    if (render_jmeter)
+        render_jmeter->RecordEndTime();
 
     AVSync(frame, 0);
     videoOutput->DoneDisplayingFrame(frame);
@@ -2051,10 +2108,15 @@ void MythPlayer::VideoStart(void)
     refreshrate = 0;
     lastsync = false;
 
-    if (VERBOSE_LEVEL_CHECK(VB_PLAYBACK))
+    // always-on pipeline instrumentation; the periodic reports only
+    // go out under VB_PLAYBACK, but the cumulative statistics stay
+    // queryable via GetJitterReport()
+    if (!output_jmeter)
         output_jmeter = new Jitterometer("video_output", 100);
-    else
-        output_jmeter = NULL;
+    if (!vsync_jmeter)
+        vsync_jmeter = new Jitterometer("vsync_wait", 100);
+    if (!render_jmeter)
+        render_jmeter = new Jitterometer("video_render", 100);
 
     refreshrate = frame_interval;
 
@@ -2897,10 +2959,7 @@ bool MythPlayer::DecoderGetFrame(DecodeType decodetype, bool unsafe)
     // Wait for frames to be available for decoding onto
     if (!videoOutput->EnoughFreeFrames() && !unsafe && !killdecoder)
     {
-        int tries = 0;
-        while (!videoOutput->EnoughFreeFrames() && (tries++ < 10))
-            usleep(1000);
-        if (!videoOutput->EnoughFreeFrames())
+        if (!videoOutput->WaitForAvailable(10))
         {
             if (++videobuf_retries >= 2000)
             {
@@ -2921,7 +2980,14 @@ bool MythPlayer::DecoderGetFrame(DecodeType decodetype, bool unsafe)
         return false;
     }
     else if (ffrew_skip == 1 || decodeOneFrame)
+    {
+        // created lazily so it lives entirely in the decoder thread
+        if (!decode_jmeter)
+            decode_jmeter = new Jitterometer("video_decode", 100);
+        decode_jmeter->RecordStartTime();
         ret = decoder->GetFrame(decodetype);
+        decode_jmeter->RecordEndTime();
+    }
     else if (ffrew_skip != 0)
         ret = DecoderGetFrameFFREW();
     return ret;
@@ -4056,6 +4122,31 @@ QString MythPlayer::GetEncodingType(void) const
     return QString();
 }
 
+/** \fn MythPlayer::GetJitterReport(void) const
+ *  \brief Returns the cumulative per-stage pipeline timing reports
+ *         (decode, render, vsync wait, output cycle), one per line.
+ *
+ *   Queryable at runtime over network control ("query jitter") so
+ *   stutter reports can be diagnosed in the field without a rebuild.
+ */
+QString MythPlayer::GetJitterReport(void) const
+{
+    QStringList reports;
+    if (decode_jmeter)
+        reports += decode_jmeter->GetReport();
+    if (render_jmeter)
+        reports += render_jmeter->GetReport();
+    if (vsync_jmeter)
+        reports += vsync_jmeter->GetReport();
+    if (output_jmeter)
+        reports += output_jmeter->GetReport();
+
+    if (reports.empty())
+        return QString("no timing data");
+
+    return reports.join("\n");
+}
+
 void MythPlayer::GetCodecDescription(InfoMap &infoMap)
 {
     infoMap["audiocodec"]    = ff_codec_id_string((CodecID)audio.GetCodec());
@@ -4193,6 +4284,19 @@ void MythPlayer::SetCutList(const frm_dir_map_t &newCutList)
     deleteMap.SetMap(newCutList);
 }
 
+/** \fn MythPlayer::ReloadPositionMap(void)
+ *  \brief Reloads the decoder's position map from the database.
+ *
+ *   Used by the transcoder after it has rebuilt the seek table of a
+ *   recording that was opened without one, so that cutlist jumps can
+ *   seek by file offset instead of decoding their way forward.
+ */
+void MythPlayer::ReloadPositionMap(void)
+{
+    if (decoder && decoder->PosMapFromDb())
+        hasFullPositionMap = true;
+}
+
 bool MythPlayer::WriteStoredData(RingBuffer *outRingBuffer,
                                  bool writevideo, long timecodeOffset)
 {
@@ -182,6 +182,7 @@ class MPUBLIC MythPlayer
     bool      IsDecoderErrored(void)   const
         { return (errorType & kError_Decode); }
     QString   GetEncodingType(void) const;
+    QString   GetJitterReport(void) const;
     void      GetCodecDescription(InfoMap &infoMap);
     QString   GetXDS(const QString &key) const;
     PIPLocation GetNextPIPLocation(void) const;
@@ -196,6 +197,7 @@ class MPUBLIC MythPlayer
     bool    IsReallyNearEnd(void) const;
     bool    IsNearEnd(int64_t framesRemaining = -1);
     bool    HasAudioOut(void) const           { return audio.HasAudioOut(); }
+    bool    HasFullPositionMap(void) const    { return hasFullPositionMap; }
     bool    IsPIPActive(void) const           { return pip_active; }
     bool    IsPIPVisible(void) const          { return pip_visible; }
     bool    IsMuted(void)                     { return audio.IsMuted(); }
@@ -228,6 +230,7 @@ class MPUBLIC MythPlayer
         RingBuffer *outRingBuffer, bool writevideo, long timecodeOffset);
     long UpdateStoredFrameNum(long curFrameNum);
     void SetCutList(const frm_dir_map_t &newCutList);
+    void ReloadPositionMap(void);
 
     // Decoder stuff..
     VideoFrame *GetNextVideoFrame(bool allow_unsafe = true);
@@ -623,6 +626,14 @@ class MPUBLIC MythPlayer
     // Buffering
     bool     buffering;
     QTime    buffering_start;
+    QTime    buffering_last_exit;
+    /// extra decoded frames required before leaving a buffering
+    /// pause; grows when buffering recurs soon after resuming so
+    /// marginal sources prebuffer deeper, decays when it doesn't
+    int      buffering_boost;
+    // instrumentation, reported when each buffering episode ends
+    uint     buffering_count;
+    int      buffering_total_wait;
     // General Caption/Teletext/Subtitle support
     uint     textDisplayMode;
     uint     prevTextDisplayMode;
@@ -720,6 +731,9 @@ class MPUBLIC MythPlayer
 
     // Debugging variables
     Jitterometer *output_jmeter;
+    Jitterometer *vsync_jmeter;
+    Jitterometer *render_jmeter;
+    Jitterometer *decode_jmeter;
 };
 
 #endif
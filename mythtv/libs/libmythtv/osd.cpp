@@ -638,17 +638,32 @@ QRegion OSD::Draw(MythPainter* painter, QPaintDevice *device, QSize size,
             }
         }
 
-        // and finally draw
-        QRect cliprect = dirty.boundingRect();
+        // and finally draw, compositing each damaged rectangle separately
+        // so widgets between two distant changes aren't redrawn - clipping
+        // to the region's bounding rect degenerates to the whole screen
+        // when e.g. the clock and the position bar change together
         painter->Begin(device);
-        painter->SetClipRegion(dirty);
-        // TODO painting in reverse may be more efficient...
+        QVector<QRect> drects = dirty.rects();
+        for (int i = 0; i < drects.size(); i++)
+        {
+            if (drects[i].isEmpty())
+                continue;
+
+            // SetClipRegion replaces the clip where SetClipRect unions;
+            // the exact rect stops alpha being composited twice where a
+            // widget spans two damaged rects
+            painter->SetClipRegion(QRegion(drects[i]));
+            // TODO painting in reverse may be more efficient...
+            for (it = m_Children.begin(); it != m_Children.end(); ++it)
+            {
+                if (it.value()->NeedsRedraw() && it.value()->IsVisible())
+                    it.value()->Draw(painter, 0, 0, 255, drects[i]);
+            }
+        }
         for (it = m_Children.begin(); it != m_Children.end(); ++it)
         {
             if (it.value()->NeedsRedraw())
             {
-                if (it.value()->IsVisible())
-                    it.value()->Draw(painter, 0, 0, 255, cliprect);
                 it.value()->SetAlpha(255);
                 it.value()->ResetNeedsRedraw();
             }
@@ -323,7 +323,10 @@ bool PreviewGenerator::Run(void)
 void PreviewGenerator::run(void)
 {
     setPriority(QThread::LowPriority);
-    Run();
+    if (!!(mode & kInProcess))
+        RunReal();
+    else
+        Run();
     connect(this, SIGNAL(finished()),
             this, SLOT(deleteLater()));
 }
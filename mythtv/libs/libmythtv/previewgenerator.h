@@ -43,6 +43,9 @@ class MPUBLIC PreviewGenerator : public QThread
         kLocalAndRemote = 0x3,
         kForceLocal     = 0x5,
         kModeMask       = 0x7,
+        /// decode in this process instead of spawning mythpreviewgen,
+        /// so a resident daemon pays decoder init once, not per preview
+        kInProcess      = 0x8,
     } Mode;
 
   public:
@@ -4,6 +4,7 @@
 
 // C++ includes
 #include <algorithm>
+#include <cmath>
 using namespace std;
 
 // MythTV headers
@@ -1112,16 +1113,144 @@ void ProgramData::HandlePrograms(
                 .arg(unchanged));
 }
 
+/** \class ExistingProgram
+ *  Snapshot of the program table columns the unchanged-check compares.
+ *  These are loaded with one SELECT per channel, so deciding which guide
+ *  entries actually changed no longer costs one round trip per program.
+ */
+class ExistingProgram
+{
+  public:
+    QString       title;
+    QString       subtitle;
+    QString       description;
+    QString       category;
+    QString       cattype;
+    QDateTime     endtime;
+    uint16_t      airdate;
+    float         stars;
+    bool          previouslyshown;
+    QString       title_pronounce;
+    unsigned char audioprops;
+    unsigned char videoprops;
+    unsigned char subtitletypes;
+    uint16_t      partnumber;
+    uint16_t      parttotal;
+    QString       seriesid;
+    QString       showtype;
+    QString       colorcode;
+    QString       syndicatedepisodenumber;
+    QString       programid;
+};
+typedef QMap<QDateTime, ExistingProgram> ExistingProgramMap;
+
+static bool load_existing_programs(MSqlQuery &query, uint chanid,
+                                   const QDateTime &from,
+                                   const QDateTime &to,
+                                   ExistingProgramMap &existing)
+{
+    query.prepare(
+        "SELECT starttime,       endtime,        title, "
+        "       subtitle,        description,    category, "
+        "       category_type,   airdate,        stars+0, "
+        "       previouslyshown, title_pronounce, "
+        "       audioprop+0,     videoprop+0,    subtitletypes+0, "
+        "       partnumber,      parttotal,      seriesid, "
+        "       showtype,        colorcode, "
+        "       syndicatedepisodenumber,         programid "
+        "FROM program "
+        "WHERE chanid     = :CHANID AND "
+        "      starttime >= :FROM   AND "
+        "      starttime <= :TO");
+
+    query.bindValue(":CHANID", chanid);
+    query.bindValue(":FROM",   from);
+    query.bindValue(":TO",     to);
+
+    if (!query.exec())
+    {
+        MythDB::DBError("load_existing_programs", query);
+        return false;
+    }
+
+    while (query.next())
+    {
+        ExistingProgram prog;
+
+        prog.endtime         = query.value(1).toDateTime();
+        prog.title           = query.value(2).toString();
+        prog.subtitle        = query.value(3).toString();
+        prog.description     = query.value(4).toString();
+        prog.category        = query.value(5).toString();
+        prog.cattype         = query.value(6).toString();
+        prog.airdate         = query.value(7).toUInt();
+        prog.stars           = query.value(8).toDouble();
+        prog.previouslyshown = query.value(9).toBool();
+        prog.title_pronounce = query.value(10).toString();
+        prog.audioprops      = query.value(11).toUInt();
+        prog.videoprops      = query.value(12).toUInt();
+        prog.subtitletypes   = query.value(13).toUInt();
+        prog.partnumber      = query.value(14).toUInt();
+        prog.parttotal       = query.value(15).toUInt();
+        prog.seriesid        = query.value(16).toString();
+        prog.showtype        = query.value(17).toString();
+        prog.colorcode       = query.value(18).toString();
+        prog.syndicatedepisodenumber = query.value(19).toString();
+        prog.programid       = query.value(20).toString();
+
+        existing[query.value(0).toDateTime()] = prog;
+    }
+
+    return true;
+}
+
+static bool is_unchanged(const ExistingProgramMap &existing,
+                         const ProgInfo &pi)
+{
+    ExistingProgramMap::const_iterator it = existing.find(pi.starttime);
+    if (it == existing.end())
+        return false;
+
+    return ((*it).endtime         == pi.endtime         &&
+            (*it).title           == pi.title           &&
+            (*it).subtitle        == pi.subtitle        &&
+            (*it).description     == pi.description     &&
+            (*it).category        == pi.category        &&
+            (*it).cattype  == myth_category_type_to_string(pi.categoryType) &&
+            (*it).airdate         == pi.airdate         &&
+            fabs((*it).stars - pi.stars.toFloat()) < 0.001 &&
+            (*it).previouslyshown == pi.previouslyshown &&
+            (*it).title_pronounce == pi.title_pronounce &&
+            (*it).audioprops      == pi.audioProps      &&
+            (*it).videoprops      == pi.videoProps      &&
+            (*it).subtitletypes   == pi.subtitleType    &&
+            (*it).partnumber      == pi.partnumber      &&
+            (*it).parttotal       == pi.parttotal       &&
+            (*it).seriesid        == pi.seriesId        &&
+            (*it).showtype        == pi.showtype        &&
+            (*it).colorcode       == pi.colorcode       &&
+            (*it).syndicatedepisodenumber == pi.syndicatedepisodenumber &&
+            (*it).programid       == pi.programId);
+}
+
 void ProgramData::HandlePrograms(MSqlQuery             &query,
                                  uint                   chanid,
                                  const QList<ProgInfo*> &sortlist,
                                  uint &unchanged,
                                  uint &updated)
 {
+    if (sortlist.empty())
+        return;
+
+    ExistingProgramMap existing;
+    load_existing_programs(query, chanid,
+                           sortlist.front()->starttime,
+                           sortlist.back()->starttime, existing);
+
     QList<ProgInfo*>::const_iterator it = sortlist.begin();
     for (; it != sortlist.end(); ++it)
     {
-        if (IsUnchanged(query, chanid, **it))
+        if (is_unchanged(existing, **it))
         {
             unchanged++;
             continue;
@@ -1196,68 +1325,6 @@ int ProgramData::fix_end_times(void)
     return count;
 }
 
-bool ProgramData::IsUnchanged(
-    MSqlQuery &query, uint chanid, const ProgInfo &pi)
-{
-    query.prepare(
-        "SELECT count(*) "
-        "FROM program "
-        "WHERE chanid          = :CHANID     AND "
-        "      starttime       = :START      AND "
-        "      endtime         = :END        AND "
-        "      title           = :TITLE      AND "
-        "      subtitle        = :SUBTITLE   AND "
-        "      description     = :DESC       AND "
-        "      category        = :CATEGORY   AND "
-        "      category_type   = :CATEGORY_TYPE AND "
-        "      airdate         = :AIRDATE    AND "
-        "      stars >= (:STARS1 - 0.001)    AND "
-        "      stars <= (:STARS2 + 0.001)    AND "
-        "      previouslyshown = :PREVIOUSLYSHOWN AND "
-        "      title_pronounce = :TITLE_PRONOUNCE AND "
-        "      audioprop       = :AUDIOPROP  AND "
-        "      videoprop       = :VIDEOPROP  AND "
-        "      subtitletypes   = :SUBTYPES   AND "
-        "      partnumber      = :PARTNUMBER AND "
-        "      parttotal       = :PARTTOTAL  AND "
-        "      seriesid        = :SERIESID   AND "
-        "      showtype        = :SHOWTYPE   AND "
-        "      colorcode       = :COLORCODE  AND "
-        "      syndicatedepisodenumber = :SYNDICATEDEPISODENUMBER AND "
-        "      programid       = :PROGRAMID");
-
-    QString cattype = myth_category_type_to_string(pi.categoryType);
-
-    query.bindValue(":CHANID",     chanid);
-    query.bindValue(":START",      pi.starttime);
-    query.bindValue(":END",        pi.endtime);
-    query.bindValue(":TITLE",      pi.title);
-    query.bindValue(":SUBTITLE",   pi.subtitle);
-    query.bindValue(":DESC",       pi.description);
-    query.bindValue(":CATEGORY",   pi.category);
-    query.bindValue(":CATEGORY_TYPE", cattype);
-    query.bindValue(":AIRDATE",    pi.airdate);
-    query.bindValue(":STARS1",     pi.stars);
-    query.bindValue(":STARS2",     pi.stars);
-    query.bindValue(":PREVIOUSLYSHOWN", pi.previouslyshown);
-    query.bindValue(":TITLE_PRONOUNCE", pi.title_pronounce);
-    query.bindValue(":AUDIOPROP",  pi.audioProps);
-    query.bindValue(":VIDEOPROP",  pi.videoProps);
-    query.bindValue(":SUBTYPES",   pi.subtitleType);
-    query.bindValue(":PARTNUMBER", pi.partnumber);
-    query.bindValue(":PARTTOTAL",  pi.parttotal);
-    query.bindValue(":SERIESID",   pi.seriesId);
-    query.bindValue(":SHOWTYPE",   pi.showtype);
-    query.bindValue(":COLORCODE",  pi.colorcode);
-    query.bindValue(":SYNDICATEDEPISODENUMBER", pi.syndicatedepisodenumber);
-    query.bindValue(":PROGRAMID",  pi.programId);
-
-    if (query.exec() && query.next())
-        return query.value(0).toUInt() > 0;
-
-    return false;
-}
-
 bool ProgramData::DeleteOverlaps(
     MSqlQuery &query, uint chanid, const ProgInfo &pi)
 {
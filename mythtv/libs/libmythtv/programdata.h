@@ -277,8 +277,6 @@ class MPUBLIC ProgramData
         MSqlQuery &query, uint chanid,
         const QList<ProgInfo*> &sortlist,
         uint &unchanged, uint &updated);
-    static bool IsUnchanged(
-        MSqlQuery &query, uint chanid, const ProgInfo &pi);
     static bool DeleteOverlaps(
         MSqlQuery &query, uint chanid, const ProgInfo &pi);
 };
@@ -7,7 +7,9 @@ using namespace std;
 #include "recorderbase.h"
 #include "tv_rec.h"
 #include "mythverbose.h"
+#include "mythcorecontext.h"
 #include "ringbuffer.h"
+#include "seekindex.h"
 #include "recordingprofile.h"
 #include "programinfo.h"
 #include "util.h"
@@ -38,7 +40,8 @@ RecorderBase::RecorderBase(TVRec *rec)
       curRecording(NULL),
       request_pause(false),     paused(false),
       nextRingBuffer(NULL),     nextRecording(NULL),
-      positionMapType(MARK_GOP_BYFRAME)
+      positionMapType(MARK_GOP_BYFRAME),
+      seekIndexWriter(NULL)
 {
     QMutexLocker locker(avcodeclock);
     avcodec_init(); // init CRC's
@@ -52,6 +55,11 @@ RecorderBase::~RecorderBase(void)
         ringBuffer = NULL;
     }
     SetRecording(NULL);
+    if (seekIndexWriter)
+    {
+        delete seekIndexWriter;
+        seekIndexWriter = NULL;
+    }
 }
 
 void RecorderBase::SetRingBuffer(RingBuffer *rbuf)
@@ -228,6 +236,14 @@ void RecorderBase::CheckForRingBufferSwitch(void)
         FinishRecording();
         ResetForNewFile();
 
+        // the seek index belongs to the old file; a new one is
+        // opened on the first position map save of the new file
+        if (seekIndexWriter)
+        {
+            delete seekIndexWriter;
+            seekIndexWriter = NULL;
+        }
+
         m_videoAspect = m_videoWidth = m_videoHeight = 0;
         m_frameRate = 0;
 
@@ -322,6 +338,16 @@ void RecorderBase::SavePositionMap(bool force)
             positionMapLock.unlock();
 
             curRecording->SavePositionMapDelta(deltaCopy, positionMapType);
+
+            if (!seekIndexWriter && ringBuffer &&
+                gCoreContext->GetNumSetting("RecordSeekIndex", 1))
+            {
+                seekIndexWriter = new SeekIndexWriter();
+                seekIndexWriter->Open(ringBuffer->GetFilename(),
+                                      positionMapType);
+            }
+            if (seekIndexWriter)
+                seekIndexWriter->Append(deltaCopy);
         }
         else
         {
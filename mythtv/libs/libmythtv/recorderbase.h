@@ -19,6 +19,7 @@ class TVRec;
 class RingBuffer;
 class ProgramInfo;
 class RecordingProfile;
+class SeekIndexWriter;
 
 /** \class RecorderBase
  *  \brief This is the abstract base class for supporting
@@ -296,6 +297,9 @@ class MPUBLIC RecorderBase
     frm_pos_map_t  positionMap;
     frm_pos_map_t  positionMapDelta;
     MythTimer      positionMapTimer;
+    /// on-disk seek index sidecar, opened on the first position
+    /// map save and closed when the recording file changes
+    SeekIndexWriter *seekIndexWriter;
 };
 
 #endif
@@ -222,6 +222,11 @@ class MPUBLIC RecordingInfo : public ProgramInfo
     static bool InsertProgram(const RecordingInfo *pg,
                               const RecordingRule *rule);
 
+    /// RecordingInfo assigns the serialized ProgramInfo fields
+    /// directly all over the place, so the pre-serialized cache
+    /// can not be trusted for these objects.
+    virtual bool CacheSerializedForm(void) const { return false; }
+
     static QString unknownTitle;
 };
 
@@ -23,6 +23,7 @@
 #include "mythcontext.h"
 #include "ringbuffer.h"
 #include "mythconfig.h"
+#include "mythprofile.h"
 #include "remotefile.h"
 #include "compat.h"
 #include "util.h"
@@ -216,8 +217,13 @@ RingBuffer::RingBuffer(void) :
     readblocksize(CHUNK),     wanttoread(0),
     numfailures(0),           commserror(false),
     oldfile(false),           livetvchain(NULL),
-    ignoreliveeof(false),     readAdjust(0)
+    ignoreliveeof(false),     readAdjust(0),
+    adaptiveread(true),       consumerate(0.0),
+    storagewaitavg(0.0),      storagewaithigh(0.0),
+    rdconsumed(0)
 {
+    adaptiveread = gCoreContext->GetNumSetting("AdaptiveReadAhead", 1);
+
     {
         QMutexLocker locker(&subExtLock);
         if (subExt.empty())
@@ -371,6 +377,69 @@ void RingBuffer::CalcReadAheadThresh(void)
             .arg(fill_min/1024).arg(readblocksize/1024));
 }
 
+/** \fn RingBuffer::AdjustReadAheadThresh(void)
+ *  \brief Re-sizes fill_min and readblocksize from the observed
+ *         consumption rate and storage latency.
+ *
+ *   CalcReadAheadThresh() seeds the thresholds from the container's
+ *   average bitrate, which chronically under-reads ahead of the
+ *   high bitrate scenes of VBR content. This controller instead
+ *   tracks how fast the consumer actually drains the buffer and how
+ *   long reads actually take (including a decaying worst case, so
+ *   storage latency spikes are remembered for a while), and keeps
+ *   enough buffered to ride out several worst-case reads.
+ *
+ *   WARNING: Called from the read ahead thread with rwlock in read
+ *   lock state; fill_min and readblocksize updates follow the same
+ *   fragile convention as the block size adaptation (see note 1).
+ */
+void RingBuffer::AdjustReadAheadThresh(void)
+{
+    rbrlock.lockForWrite();
+    long long consumed = rdconsumed;
+    rdconsumed = 0;
+    rbrlock.unlock();
+
+    int interval = consumetimer.elapsed();
+    consumetimer.start();
+    if (interval < 500)
+        return;
+
+    double rate = consumed / (double) interval; // bytes per ms
+    consumerate = (consumerate <= 0.0) ? rate : (consumerate * 3 + rate) / 4;
+
+    if (consumerate <= 0.0)
+        return; // consumer is paused or hasn't started yet
+
+    const int KB32 = 32*1024;
+
+    // keep enough buffered to ride out three worst-case reads,
+    // but never devote more than half the buffer to the minimum
+    int min_needed = (int) (consumerate * max(storagewaithigh, 50.0) * 3);
+    min_needed     = min(max(min_needed, KB32), (int) kBufferSize / 2);
+    int new_min    = ((min_needed / KB32) + 1) * KB32;
+
+    // size reads to roughly a quarter second of consumption
+    int rbs = (int) (consumerate * 250);
+    rbs     = min(max(rbs, CHUNK), (int) (kBufferSize >> 2));
+    int new_rbs = ((rbs + CHUNK - 1) / CHUNK) * CHUNK;
+
+    if (new_min != fill_min || new_rbs != readblocksize)
+    {
+        VERBOSE(VB_FILE, LOC +
+                QString("AdjustReadAheadThresh() rate(%1 KB/s) "
+                        "lat avg(%2 ms) high(%3 ms)\n\t\t\t -> "
+                        "min read(%4 KB) blk size(%5 KB)")
+                .arg((uint)(consumerate * 1000) / 1024)
+                .arg(storagewaitavg, 0, 'f', 1)
+                .arg(storagewaithigh, 0, 'f', 1)
+                .arg(new_min/1024).arg(new_rbs/1024));
+    }
+
+    fill_min      = new_min;
+    readblocksize = new_rbs;
+}
+
 bool RingBuffer::IsNearEnd(double fps, uint vvf) const
 {
     rwlock.lockForRead();
@@ -660,6 +729,9 @@ void RingBuffer::run(void)
     ResetReadAhead(0);
     readaheadrunning = true;
     reallyrunning = true;
+    rdconsumed = 0;
+    consumetimer.start();
+    threshtimer.start();
     generalWait.wakeAll();
     poslock.unlock();
     rwlock.unlock();
@@ -712,7 +784,7 @@ void RingBuffer::run(void)
 
             // adapt blocksize
             gettimeofday(&now, NULL);
-            if (!ignore_for_read_timing)
+            if (!adaptiveread && !ignore_for_read_timing)
             {
                 int readinterval = (now.tv_sec  - lastread.tv_sec ) * 1000 +
                     (now.tv_usec - lastread.tv_usec) / 1000;
@@ -768,12 +840,25 @@ void RingBuffer::run(void)
                     LOC + QString("safe_read(...@%1, %2) -- begin")
                     .arg(rbwpos).arg(totfree));
 
+            MythTimer readtimer;
+            readtimer.start();
+
             read_return = safe_read(readAheadBuffer + rbwpos, totfree);
 
             VERBOSE(VB_FILE|VB_EXTRA, LOC +
                     QString("safe_read(...@%1, %2) -> %3")
                     .arg(rbwpos).arg(totfree).arg(read_return));
 
+            if (adaptiveread && (read_return > 0))
+            {
+                // feed observed storage latency into the adaptive
+                // readahead controller
+                int read_ms = readtimer.elapsed();
+                storagewaitavg  = (storagewaitavg * 7.0 + read_ms) / 8.0;
+                storagewaithigh = max(storagewaithigh * 0.99,
+                                      (double) read_ms);
+            }
+
             rbwlock.unlock();
         }
 
@@ -836,6 +921,12 @@ void RingBuffer::run(void)
             used = kBufferSize - ReadBufFree();
         }
 
+        if (adaptiveread && threshtimer.elapsed() > 1000)
+        {
+            AdjustReadAheadThresh();
+            threshtimer.start();
+        }
+
         VERBOSE(VB_FILE|VB_EXTRA, LOC + "@ end of read ahead loop");
 
         if (readsallowed || commserror || ateof || setswitchtonext ||
@@ -1063,6 +1154,8 @@ int RingBuffer::ReadDirect(void *buf, int count, bool peek)
  */
 int RingBuffer::ReadPriv(void *buf, int count, bool peek)
 {
+    MYTH_PROFILE_SCOPE("RingBuffer::ReadPriv");
+
     QString loc_desc = 
             QString("ReadPriv(..%1, %2)")
         .arg(count).arg(peek?"peek":"normal");
@@ -1170,6 +1263,7 @@ int RingBuffer::ReadPriv(void *buf, int count, bool peek)
 
     if (!peek)
     {
+        rdconsumed += count;
         rbrpos = (rbrpos + count) % kBufferSize;
         generalWait.wakeAll();
     }
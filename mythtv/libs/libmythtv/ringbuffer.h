@@ -16,6 +16,7 @@ extern "C" {
 }
 
 #include "mythexp.h"
+#include "util.h" // for MythTimer
 
 class ThreadedFileWriter;
 class DVDRingBuffer;
@@ -123,6 +124,7 @@ class MPUBLIC RingBuffer : protected QThread
 
     void run(void); // QThread
     void CalcReadAheadThresh(void);
+    void AdjustReadAheadThresh(void);
     bool PauseAndWait(void);
     virtual int safe_read(void *data, uint sz) = 0;
 
@@ -190,6 +192,15 @@ class MPUBLIC RingBuffer : protected QThread
 
     long long readAdjust;         // protected by rwlock
 
+    // adaptive readahead controller, see note 1 for locking caveats
+    bool      adaptiveread;       // set in ctor, constant thereafter
+    double    consumerate;        ///< consumption rate in bytes/ms
+    double    storagewaitavg;     ///< smoothed safe_read() latency in ms
+    double    storagewaithigh;    ///< decaying worst-case read latency in ms
+    long long rdconsumed;         // protected by rbrlock
+    MythTimer consumetimer;       // used only by the read ahead thread
+    MythTimer threshtimer;        // used only by the read ahead thread
+
     // note 1: numfailures is modified with only a read lock in the
     // read ahead thread, but this is safe since all other places
     // that use it are protected by a write lock. But this is a
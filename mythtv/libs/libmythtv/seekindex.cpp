@@ -0,0 +1,191 @@
+// POSIX headers
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifndef USING_MINGW
+#include <sys/mman.h>
+#endif
+
+// MythTV headers
+#include "seekindex.h"
+#include "mythverbose.h"
+#include "compat.h"
+
+#define LOC     QString("SeekIndex: ")
+#define LOC_ERR QString("SeekIndex Error: ")
+
+static const char    *kSeekIndexMagic   = "MythSeek";
+static const uint32_t kSeekIndexVersion = 1;
+
+QString SeekIndex::IndexFileName(const QString &videofile)
+{
+    return videofile + ".mseek";
+}
+
+/** \fn SeekIndex::Load(const QString&,MarkTypes&,frm_pos_map_t&)
+ *  \brief Maps the seek index sidecar and copies its entries into
+ *         'posMap'.
+ *
+ *   Anything unexpected -- no sidecar, wrong magic or version, a
+ *   header promising more entries than the file holds -- returns
+ *   false so the caller falls back to the database position map.
+ */
+bool SeekIndex::Load(const QString &videofile,
+                     MarkTypes &type, frm_pos_map_t &posMap)
+{
+#ifdef USING_MINGW
+    (void) videofile;
+    (void) type;
+    (void) posMap;
+    return false;
+#else
+    QByteArray fname = IndexFileName(videofile).toLocal8Bit();
+    int fd = open(fname.constData(), O_RDONLY);
+    if (fd < 0)
+        return false; // no sidecar, perfectly normal
+
+    struct stat st;
+    if (fstat(fd, &st) < 0 || (size_t)st.st_size < sizeof(SeekIndexHeader))
+    {
+        close(fd);
+        return false;
+    }
+
+    void *map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+    {
+        VERBOSE(VB_PLAYBACK, LOC_ERR +
+                QString("mmap of '%1' failed").arg(fname.constData()) + ENO);
+        return false;
+    }
+
+    bool ok = false;
+    const SeekIndexHeader *hdr = (const SeekIndexHeader*) map;
+    uint64_t avail = (st.st_size - sizeof(SeekIndexHeader)) /
+        sizeof(SeekIndexEntry);
+
+    if (!memcmp(hdr->magic, kSeekIndexMagic, sizeof(hdr->magic)) &&
+        (hdr->version == kSeekIndexVersion) &&
+        (hdr->count   <= avail) &&
+        (hdr->count   >  0))
+    {
+        const SeekIndexEntry *entries = (const SeekIndexEntry*)
+            ((const char*) map + sizeof(SeekIndexHeader));
+
+        for (uint64_t i = 0; i < hdr->count; i++)
+            posMap[entries[i].frame] = entries[i].pos;
+
+        type = (MarkTypes) hdr->marktype;
+        ok   = true;
+
+        VERBOSE(VB_PLAYBACK, LOC +
+                QString("Loaded %1 entries from '%2'")
+                .arg(hdr->count).arg(fname.constData()));
+    }
+
+    munmap(map, st.st_size);
+    return ok;
+#endif // !USING_MINGW
+}
+
+SeekIndexWriter::SeekIndexWriter() : fd(-1), count(0)
+{
+}
+
+SeekIndexWriter::~SeekIndexWriter()
+{
+    Close();
+}
+
+/** \fn SeekIndexWriter::Open(const QString&,MarkTypes)
+ *  \brief Creates the seek index sidecar for 'videofile', truncating
+ *         any stale one, and writes a header with a zero entry count.
+ */
+bool SeekIndexWriter::Open(const QString &videofile, MarkTypes type)
+{
+    Close();
+
+    QByteArray fname = SeekIndex::IndexFileName(videofile).toLocal8Bit();
+    fd = open(fname.constData(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        VERBOSE(VB_IMPORTANT, LOC_ERR +
+                QString("Failed to create '%1'")
+                .arg(fname.constData()) + ENO);
+        return false;
+    }
+
+    SeekIndexHeader hdr;
+    memcpy(hdr.magic, kSeekIndexMagic, sizeof(hdr.magic));
+    hdr.version  = kSeekIndexVersion;
+    hdr.marktype = type;
+    hdr.count    = 0;
+    count        = 0;
+
+    if (write(fd, &hdr, sizeof(hdr)) != (int)sizeof(hdr))
+    {
+        VERBOSE(VB_IMPORTANT, LOC_ERR +
+                QString("Failed to write header of '%1'")
+                .arg(fname.constData()) + ENO);
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+/** \fn SeekIndexWriter::Append(const frm_pos_map_t&)
+ *  \brief Appends 'delta' to the sidecar and bumps the header count.
+ *
+ *   The header count is rewritten only after the entries land, so an
+ *   interrupted write at worst leaves unpromised bytes at the end of
+ *   the file. Any write error closes the file and turns the writer
+ *   into a no-op; the database copy is unaffected.
+ */
+void SeekIndexWriter::Append(const frm_pos_map_t &delta)
+{
+    if (fd < 0 || delta.empty())
+        return;
+
+    frm_pos_map_t::const_iterator it = delta.begin();
+    for (; it != delta.end(); ++it)
+    {
+        SeekIndexEntry entry;
+        entry.frame = it.key();
+        entry.pos   = *it;
+        if (write(fd, &entry, sizeof(entry)) != (int)sizeof(entry))
+        {
+            VERBOSE(VB_IMPORTANT, LOC_ERR +
+                    "Failed to append entry, disabling seek index" + ENO);
+            Close();
+            return;
+        }
+        count++;
+    }
+
+    off_t end = lseek(fd, 0, SEEK_CUR);
+    if ((lseek(fd, offsetof(SeekIndexHeader, count), SEEK_SET) < 0) ||
+        (write(fd, &count, sizeof(count)) != (int)sizeof(count)) ||
+        (lseek(fd, end, SEEK_SET) < 0))
+    {
+        VERBOSE(VB_IMPORTANT, LOC_ERR +
+                "Failed to update header, disabling seek index" + ENO);
+        Close();
+    }
+}
+
+void SeekIndexWriter::Close(void)
+{
+    if (fd >= 0)
+    {
+        close(fd);
+        fd = -1;
+    }
+}
+
+/* vim: set expandtab tabstop=4 shiftwidth=4: */
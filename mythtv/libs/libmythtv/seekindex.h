@@ -0,0 +1,80 @@
+// -*- Mode: c++ -*-
+#ifndef SEEKINDEX_H_
+#define SEEKINDEX_H_
+
+#include <stdint.h>
+
+// Qt headers
+#include <QString>
+
+// MythTV headers
+#include "mythexp.h"
+#include "programtypes.h" // for frm_pos_map_t and MarkTypes
+
+/** \file seekindex.h
+ *  \brief On-disk seek index sidecar files.
+ *
+ *   A seek index file sits next to a recording ("file.mpg.mseek") and
+ *   holds the keyframe position map as a flat, memory-mappable array
+ *   of (frame, byte offset) pairs in file order. The recorder appends
+ *   to it as the position map grows, and the decoder can load it at
+ *   open without a database round trip. The database copy of the
+ *   position map is unaffected and remains authoritative; a missing
+ *   or damaged index file just means we fall back to the DB.
+ *
+ *   Layout (all fields little-endian, written natively):
+ *     SeekIndexHeader, then header.count SeekIndexEntry records.
+ *   The entry count in the header is updated after the entries are
+ *   written, so a reader never sees more entries promised than exist.
+ */
+
+struct SeekIndexHeader
+{
+    char     magic[8];   ///< kSeekIndexMagic
+    uint32_t version;    ///< kSeekIndexVersion
+    uint32_t marktype;   ///< MarkTypes of the indexed frames
+    uint64_t count;      ///< number of SeekIndexEntry records
+};
+
+struct SeekIndexEntry
+{
+    uint64_t frame; ///< frame or keyframe number
+    uint64_t pos;   ///< byte offset in the recording
+};
+
+class MPUBLIC SeekIndex
+{
+  public:
+    /// Returns the seek index filename for a recording file.
+    static QString IndexFileName(const QString &videofile);
+
+    /// Loads the seek index sidecar for 'videofile' into 'posMap',
+    /// returning false (leaving posMap alone) if there isn't a
+    /// usable one.
+    static bool Load(const QString &videofile,
+                     MarkTypes &type, frm_pos_map_t &posMap);
+};
+
+/** \class SeekIndexWriter
+ *  \brief Appends position map entries to a recording's seek index.
+ *
+ *   Used by RecorderBase alongside the database position map saves.
+ *   If the file can't be created the writer logs once and all later
+ *   calls are no-ops, so callers don't need to track failure.
+ */
+class MPUBLIC SeekIndexWriter
+{
+  public:
+    SeekIndexWriter();
+    ~SeekIndexWriter();
+
+    bool Open(const QString &videofile, MarkTypes type);
+    void Append(const frm_pos_map_t &delta);
+    void Close(void);
+
+  private:
+    int      fd;
+    uint64_t count;
+};
+
+#endif // SEEKINDEX_H_
@@ -329,7 +329,7 @@ void SignalMonitor::MonitorLoop()
             //cerr<<"sent SIGNAL"<<endl;
         }
 
-        usleep(update_rate * 1000);
+        WaitForUpdate();
     }
 
     // We need to send a last informational message because a
@@ -347,6 +347,19 @@ void SignalMonitor::MonitorLoop()
     running = false;
 }
 
+/** \fn SignalMonitor::WaitForUpdate(void)
+ *  \brief Waits between signal monitoring attempts.
+ *
+ *   The default implementation just sleeps for the update rate;
+ *   monitors with a kernel event source, such as the DVB frontend,
+ *   override this to block on the driver instead.
+ *   \sa DVBSignalMonitor::WaitForUpdate(void)
+ */
+void SignalMonitor::WaitForUpdate(void)
+{
+    usleep(update_rate * 1000);
+}
+
 /** \fn SignalMonitor::SpawnMonitorLoop(void*)
  *  \brief Runs MonitorLoop() within the monitor_thread pthread.
  */
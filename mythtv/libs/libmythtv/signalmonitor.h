@@ -125,6 +125,9 @@ class SignalMonitor
     /// \brief This should be overridden to actually do signal monitoring.
     virtual void UpdateValues() { ; }
 
+    /// \brief Waits between signal monitoring attempts.
+    virtual void WaitForUpdate(void);
+
   public:
     /// We've seen a PAT,
     /// which maps MPEG program numbers to pids where we find PMTs
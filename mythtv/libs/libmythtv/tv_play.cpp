@@ -4975,6 +4975,20 @@ void TV::ProcessNetworkControlCommand(PlayerContext *ctx,
         {
             QString infoStr = QString("%1%").arg(ctx->player->GetVolume());
 
+            QString message = QString("NETWORK_CONTROL ANSWER %1")
+                .arg(infoStr);
+            MythEvent me(message);
+            gCoreContext->dispatch(me);
+        }
+        else if (tokens[2] == "JITTER")
+        {
+            QString infoStr = "-";
+
+            ctx->LockDeletePlayer(__FILE__, __LINE__);
+            if (ctx->player)
+                infoStr = ctx->player->GetJitterReport().replace("\n", " | ");
+            ctx->UnlockDeletePlayer(__FILE__, __LINE__);
+
             QString message = QString("NETWORK_CONTROL ANSWER %1")
                 .arg(infoStr);
             MythEvent me(message);
@@ -8599,6 +8613,11 @@ void TV::customEvent(QEvent *e)
             PlayerContext *ctx = GetPlayer(mctx, i);
             if (ctx->tvchain && ctx->tvchain->GetID() == id)
             {
+                // the event may carry the change itself, which lets
+                // the chain update without re-reading the database
+                if (!me->ExtraDataList().empty())
+                    ctx->tvchain->QueueUpdate(me->ExtraDataList());
+
                 QMutexLocker locker(&timerIdLock);
                 tvchainUpdateTimerId[StartTimer(1, __LINE__)] = ctx;
                 break;
@@ -75,7 +75,8 @@ QMap<uint,TVRec*> TVRec::cards;
 static bool is_dishnet_eit(uint cardid);
 static QString load_profile(QString,void*,RecordingInfo*,RecordingProfile&);
 static int init_jobs(const RecordingInfo *rec, RecordingProfile &profile,
-                     bool on_host, bool transcode_bfr_comm, bool on_line_comm);
+                     bool on_host, bool transcode_bfr_comm, bool on_line_comm,
+                     bool on_line_trans);
 
 /** \class TVRec
  *  \brief This is the coordinating class of the \ref recorder_subsystem.
@@ -111,7 +112,8 @@ TVRec::TVRec(int capturecardnum)
       recorder_thread(pthread_t()),
       // Configuration variables from database
       transcodeFirst(false),
-      earlyCommFlag(false),         runJobOnHostOnly(false),
+      earlyCommFlag(false),         earlyTranscode(false),
+      runJobOnHostOnly(false),
       eitCrawlIdleStart(60),        eitTransportTimeout(5*60),
       audioSampleRateDB(0),
       overRecordSecNrml(0),         overRecordSecCat(0),
@@ -139,7 +141,9 @@ TVRec::TVRec(int capturecardnum)
       // tvchain
       tvchain(NULL),
       // RingBuffer info
-      ringBuffer(NULL), rbFileExt("mpg")
+      ringBuffer(NULL), rbFileExt("mpg"),
+      // Prepared LiveTV ring buffer
+      preparedLiveTVRecording(NULL), preparedLiveTVRingBuffer(NULL)
 {
     QMutexLocker locker(&cardsLock);
     cards[cardid] = this;
@@ -259,6 +263,7 @@ bool TVRec::Init(void)
     transcodeFirst    =
         gCoreContext->GetNumSetting("AutoTranscodeBeforeAutoCommflag", 0);
     earlyCommFlag     = gCoreContext->GetNumSetting("AutoCommflagWhileRecording", 0);
+    earlyTranscode    = gCoreContext->GetNumSetting("AutoTranscodeWhileRecording", 0);
     runJobOnHostOnly  = gCoreContext->GetNumSetting("JobsRunOnRecordHost", 0);
     eitTransportTimeout=gCoreContext->GetNumSetting("EITTransportTimeout", 5) * 60;
     eitCrawlIdleStart = gCoreContext->GetNumSetting("EITCrawIdleStart", 60);
@@ -310,6 +315,8 @@ void TVRec::TeardownAll(void)
     TeardownRecorder(true);
 
     SetRingBuffer(NULL);
+
+    DiscardPreparedLiveTVRingBuffer();
 }
 
 void TVRec::WakeEventLoop(void)
@@ -2905,7 +2912,8 @@ void TVRec::SetLiveRecording(int recording)
         RecordingProfile profile;
         load_profile(genOpt.cardtype, NULL, curRecording, profile);
         autoRunJobs = init_jobs(curRecording, profile, runJobOnHostOnly,
-                                transcodeFirst, earlyCommFlag);
+                                transcodeFirst, earlyCommFlag,
+                                earlyTranscode);
     }
 
     MythEvent me(QString("UPDATE_RECORDING_STATUS %1 %2 %3 %4 %5")
@@ -3570,8 +3578,18 @@ void TVRec::HandleTuning(void)
     }
 
     MPEGStreamData *streamData = NULL;
-    if (HasFlags(kFlagWaitingForSignal) && !(streamData = TuningSignalCheck()))
-        return;
+    if (HasFlags(kFlagWaitingForSignal))
+    {
+        // Get the recorded table insert, the storage group query and
+        // the ring buffer creation out of the way while the frontend
+        // is still acquiring a lock, so the recorder can be started
+        // the moment the signal check succeeds.
+        if (HasFlags(kFlagNeedToStartRecorder))
+            TuningPrepareLiveTVRingBuffer();
+
+        if (!(streamData = TuningSignalCheck()))
+            return;
+    }
 
     if (HasFlags(kFlagNeedToStartRecorder))
     {
@@ -3661,6 +3679,9 @@ void TVRec::TuningShutdowns(const TuningRequest &request)
     if (HasFlags(kFlagWaitingForSignal))
         ClearFlags(kFlagWaitingForSignal);
 
+    // Anything prepared for the canceled wait is no longer usable.
+    DiscardPreparedLiveTVRingBuffer();
+
     // At this point any waits are canceled.
 
     if (newCardID || (request.flags & kFlagNoRec))
@@ -3956,7 +3977,8 @@ MPEGStreamData *TVRec::TuningSignalCheck(void)
 }
 
 static int init_jobs(const RecordingInfo *rec, RecordingProfile &profile,
-                      bool on_host, bool transcode_bfr_comm, bool on_line_comm)
+                      bool on_host, bool transcode_bfr_comm, bool on_line_comm,
+                      bool on_line_trans)
 {
     if (!rec)
         return 0; // no jobs for Live TV recordings..
@@ -3994,6 +4016,28 @@ static int init_jobs(const RecordingInfo *rec, RecordingProfile &profile,
         JobQueue::RemoveJobsFromMask(JOB_COMMFLAG, jobs);
     }
 
+    // is transcoding enabled, and is on-line transcoding enabled?
+    bool lt = JobQueue::JobIsInMask(JOB_TRANSCODE, jobs) && on_line_trans;
+    // also, we either need commercial flagging to be disabled or
+    // we need to be allowed to transcode before commercial flagging,
+    // otherwise the transcoder would run ahead of the flagger.
+    lt &= JobQueue::JobIsNotInMask(JOB_COMMFLAG, jobs) || transcode_bfr_comm;
+    if (lt)
+    {
+        // queue up real-time (i.e. on-line) transcoding; mythtranscode
+        // follows along behind the write head, so the result is ready
+        // shortly after the recording ends and its reads come out of
+        // the page cache instead of hitting the disk.
+        QString host = (on_host) ? gCoreContext->GetHostName() : "";
+        JobQueue::QueueJob(JOB_TRANSCODE,
+                           rec->GetChanID(),
+                           rec->GetRecordingStartTime(), "", "",
+                           host, JOB_LIVE_REC);
+
+        // don't queue the regular transcode, this one replaces it.
+        JobQueue::RemoveJobsFromMask(JOB_TRANSCODE, jobs);
+    }
+
     return jobs;
 }
 
@@ -4157,7 +4201,8 @@ void TVRec::TuningNewRecorder(MPEGStreamData *streamData)
 
     if (!tvchain)
         autoRunJobs = init_jobs(rec, profile, runJobOnHostOnly,
-                                transcodeFirst, earlyCommFlag);
+                                transcodeFirst, earlyCommFlag,
+                                earlyTranscode);
 
     ClearFlags(kFlagNeedToStartRecorder);
     return;
@@ -4245,7 +4290,8 @@ void TVRec::TuningRestartRecorder(void)
         QString profileName = load_profile(genOpt.cardtype, NULL,
                                            curRecording, profile);
         autoRunJobs = init_jobs(curRecording, profile, runJobOnHostOnly,
-                                transcodeFirst, earlyCommFlag);
+                                transcodeFirst, earlyCommFlag,
+                                earlyTranscode);
     }
 
     ClearFlags(kFlagNeedToStartRecorder);
@@ -4380,6 +4426,24 @@ bool TVRec::GetProgramRingBufferForLiveTV(RecordingInfo **pginfo,
     if (!channel || !tvchain || !pginfo || !rb)
         return false;
 
+    // Use the program and ring buffer prepared while we were
+    // waiting for the signal lock, if they were made for this channel.
+    if (preparedLiveTVRecording)
+    {
+        if (preparedLiveTVChanNum == channum)
+        {
+            VERBOSE(VB_RECORD, LOC +
+                    "Using prepared LiveTV ring buffer");
+            *pginfo = preparedLiveTVRecording;
+            *rb     = preparedLiveTVRingBuffer;
+            preparedLiveTVRecording = NULL;
+            preparedLiveTVRingBuffer = NULL;
+            preparedLiveTVChanNum.clear();
+            return true;
+        }
+        DiscardPreparedLiveTVRingBuffer();
+    }
+
     nextLiveTVDirLock.lock();
     nextLiveTVDir.clear();
     nextLiveTVDirLock.unlock();
@@ -4586,6 +4650,65 @@ bool TVRec::SwitchLiveTVRingBuffer(const QString & channum,
     return true;
 }
 
+/** \fn TVRec::TuningPrepareLiveTVRingBuffer(void)
+ *  \brief Creates the LiveTV program and ring buffer for the current
+ *         channel while the signal monitor is still waiting for a lock.
+ *
+ *   Creating the ring buffer involves a recorded table insert, a
+ *   storage group query and a file open; doing this while the
+ *   frontend is tuning gets it out of the critical path between
+ *   achieving a signal lock and starting the recorder.
+ *
+ *   The result is consumed by GetProgramRingBufferForLiveTV(), or
+ *   discarded if the tuning request is canceled.
+ */
+void TVRec::TuningPrepareLiveTVRingBuffer(void)
+{
+    if (!channel || !tvchain)
+        return;
+
+    QString channum = channel->GetCurrentName();
+    if (preparedLiveTVChanNum == channum)
+        return; // already prepared (or attempted) for this channel
+
+    DiscardPreparedLiveTVRingBuffer();
+    preparedLiveTVChanNum = channum;
+
+    QString inputName;
+    if (!channel->CheckChannel(channum, inputName))
+        return;
+
+    int inputID = inputName.isEmpty() ?
+        channel->GetCurrentInputNum() : channel->GetInputByName(inputName);
+
+    RecordingInfo *pginfo = NULL;
+    RingBuffer    *rb     = NULL;
+    if (!GetProgramRingBufferForLiveTV(&pginfo, &rb, channum, inputID))
+        return;
+
+    preparedLiveTVRecording = pginfo;
+    preparedLiveTVRingBuffer = rb;
+}
+
+/** \fn TVRec::DiscardPreparedLiveTVRingBuffer(void)
+ *  \brief Deletes a program and ring buffer prepared by
+ *         TuningPrepareLiveTVRingBuffer() that were never used.
+ */
+void TVRec::DiscardPreparedLiveTVRingBuffer(void)
+{
+    if (preparedLiveTVRingBuffer)
+    {
+        delete preparedLiveTVRingBuffer;
+        preparedLiveTVRingBuffer = NULL;
+    }
+    if (preparedLiveTVRecording)
+    {
+        delete preparedLiveTVRecording;
+        preparedLiveTVRecording = NULL;
+    }
+    preparedLiveTVChanNum.clear();
+}
+
 TVRec* TVRec::GetTVRec(uint cardid)
 {
     QMutexLocker locker(&cardsLock);
@@ -310,6 +310,8 @@ class MPUBLIC TVRec : public SignalMonitorListener
     bool CreateLiveTVRingBuffer(const QString & channum);
     bool SwitchLiveTVRingBuffer(const QString & channum,
 				bool discont, bool set_rec);
+    void TuningPrepareLiveTVRingBuffer(void);
+    void DiscardPreparedLiveTVRingBuffer(void);
 
     void StartedRecording(RecordingInfo*);
     void FinishedRecording(RecordingInfo*);
@@ -332,6 +334,7 @@ class MPUBLIC TVRec : public SignalMonitorListener
     // Configuration variables from database
     bool    transcodeFirst;
     bool    earlyCommFlag;
+    bool    earlyTranscode;
     bool    runJobOnHostOnly;
     int     eitCrawlIdleStart;
     int     eitTransportTimeout;
@@ -393,6 +396,11 @@ class MPUBLIC TVRec : public SignalMonitorListener
     RingBuffer  *ringBuffer;
     QString      rbFileExt;
 
+    // LiveTV ring buffer prepared while waiting for a signal lock
+    RecordingInfo *preparedLiveTVRecording;
+    RingBuffer    *preparedLiveTVRingBuffer;
+    QString        preparedLiveTVChanNum;
+
     static QMutex            cardsLock;
     static QMap<uint,TVRec*> cards;
 
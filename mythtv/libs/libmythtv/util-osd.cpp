@@ -1,6 +1,33 @@
 #include "util-osd.h"
 #include "dithertable.h"
 
+#ifdef MMX
+extern "C" {
+#include "libavcodec/avcodec.h"
+// from libavcodec/dsputil.h, which is not C++ clean
+int mm_support(void);
+}
+#endif
+
+/**
+ * \fn osd_blend_align(void)
+ *  Returns the horizontal alignment, in pixels, required by the widest
+ *  OSD blending kernel this CPU supports. OSD::Draw() expands dirty
+ *  rectangle edges to this multiple so the kernels never see a
+ *  partial vector.
+ */
+int osd_blend_align(void)
+{
+#ifdef MMX
+    static int align = 0;
+    if (!align)
+        align = (mm_support() & FF_MM_SSE2) ? ALIGN_X_SSE2 : ALIGN_X_MMX;
+    return align;
+#else
+    return ALIGN_X_MMX;
+#endif
+}
+
 #if HAVE_BIGENDIAN
 #define R_OI  1
 #define G_OI  2
@@ -19,8 +46,11 @@ void yuv888_to_yv12(VideoFrame *frame, MythImage *osd_image,
     bool c_aligned  = !(left % ALIGN_C || right % ALIGN_C);
     bool misaligned = (top % ALIGN_C || bottom % ALIGN_C) || !c_aligned;
     bool mmx_aligned = false;
+    bool sse2_aligned = false;
 #ifdef MMX
     mmx_aligned = !(left % ALIGN_X_MMX || right % ALIGN_X_MMX);
+    sse2_aligned = (osd_blend_align() == ALIGN_X_SSE2) &&
+        !(left % ALIGN_X_SSE2 || right % ALIGN_X_SSE2);
 #endif
 
     if (misaligned)
@@ -28,6 +58,10 @@ void yuv888_to_yv12(VideoFrame *frame, MythImage *osd_image,
         VERBOSE(VB_IMPORTANT,
             QString("OSD image size is odd. This shouldn't happen."));
     }
+    else if (sse2_aligned)
+    {
+        sse2_yuv888_to_yv12(frame, osd_image, left, top, right, bottom);
+    }
     else if (mmx_aligned)
     {
         mmx_yuv888_to_yv12(frame, osd_image, left, top, right, bottom);
@@ -221,6 +255,161 @@ void inline mmx_yuv888_to_yv12(VideoFrame *frame, MythImage *osd_image,
 #endif
 }
 
+/* Same blend as mmx_yuv888_to_yv12(), sixteen pixels per iteration.
+ * The MMX transpose network does not survive widening to 128 bit
+ * registers (the unpacks interleave the two halves), so this pulls
+ * each channel out of the packed pixels with dword shifts and packs
+ * instead, then blends whole planes in the word domain. Saturation
+ * matches the MMX kernel (paddusb/paddusw throughout). */
+void inline sse2_yuv888_to_yv12(VideoFrame *frame, MythImage *osd_image,
+                                int left, int top, int right, int bottom)
+{
+#ifdef MMX
+    unsigned char *src1, *src2, *y1, *y2, *u, *v;
+    int y_wrap, src_wrap, u_wrap, v_wrap, width, height;
+
+    width  = right - left;
+    height = bottom - top;
+    src1 = osd_image->scanLine(top) + (left << 2);
+    src2 = src1 + osd_image->bytesPerLine();
+    src_wrap = (osd_image->bytesPerLine() << 1) - (width << 2);
+
+    y1 = frame->buf + frame->offsets[0] + (frame->pitches[0] * top) + left;
+    y2 = y1 + frame->pitches[0];
+    u  = frame->buf + frame->offsets[1] +
+        (frame->pitches[1] * (top >> 1)) + (left >> 1);
+    v  = frame->buf + frame->offsets[2] +
+        (frame->pitches[2] * (top >> 1)) + (left >> 1);
+    y_wrap = (frame->pitches[0] << 1) - width;
+    u_wrap = frame->pitches[1] - (width >> 1);
+    v_wrap = frame->pitches[2] - (width >> 1);
+
+    static const uint64_t XMM_DWFF[2] __attribute__ ((aligned (16))) =
+        { 0x000000FF000000FFULL, 0x000000FF000000FFULL };
+    static const uint64_t XMM_255[2] __attribute__ ((aligned (16))) =
+        { 0x00FF00FF00FF00FFULL, 0x00FF00FF00FF00FFULL };
+    uint64_t tmp_na1[2] __attribute__ ((aligned (16)));
+    uint64_t tmp_na2[2] __attribute__ ((aligned (16)));
+    uint64_t tmp_u1[2] __attribute__ ((aligned (16)));
+    uint64_t tmp_u2[2] __attribute__ ((aligned (16)));
+    uint64_t tmp_v1[2] __attribute__ ((aligned (16)));
+    uint64_t tmp_v2[2] __attribute__ ((aligned (16)));
+
+/* extract one channel of the 16 pixels held in xmm0-xmm3 into 16
+ * bytes in xmm4; the channel is selected by the dword right shift */
+#define EXTRACT(shift) \
+            ASM("movdqa %xmm0, %xmm4") \
+            ASM("movdqa %xmm1, %xmm5") \
+            ASM("movdqa %xmm2, %xmm6") \
+            ASM("movdqa %xmm3, %xmm7") \
+            ASM("psrld $" shift ", %xmm4") \
+            ASM("psrld $" shift ", %xmm5") \
+            ASM("psrld $" shift ", %xmm6") \
+            ASM("psrld $" shift ", %xmm7") \
+            ASM("pand %0, %%xmm4"::"m"(XMM_DWFF[0])) \
+            ASM("pand %0, %%xmm5"::"m"(XMM_DWFF[0])) \
+            ASM("pand %0, %%xmm6"::"m"(XMM_DWFF[0])) \
+            ASM("pand %0, %%xmm7"::"m"(XMM_DWFF[0])) \
+            ASM("packssdw %xmm5, %xmm4") \
+            ASM("packssdw %xmm7, %xmm6") \
+            ASM("packuswb %xmm6, %xmm4")
+
+/* y = ((y * (255 - alpha)) >> 8) +sat osd_y for the 16 luma bytes in
+ * xmm4, with 255 - alpha spilled in tmp_na and the dest at yp */
+#define BLEND_LUMA(yp, tmp_na) \
+            ASM("pxor %xmm7, %xmm7") \
+            ASM("movdqa %0, %%xmm6"::"m"(tmp_na[0])) \
+            ASM("movdqa %xmm6, %xmm5") \
+            ASM("punpcklbw %xmm7, %xmm5") \
+            ASM("punpckhbw %xmm7, %xmm6") \
+            ASM("movdqu %0, %%xmm0"::"m"(*(yp))) \
+            ASM("movdqa %xmm0, %xmm1") \
+            ASM("punpcklbw %xmm7, %xmm0") \
+            ASM("punpckhbw %xmm7, %xmm1") \
+            ASM("pmullw %xmm5, %xmm0") \
+            ASM("pmullw %xmm6, %xmm1") \
+            ASM("psrlw $8, %xmm0") \
+            ASM("psrlw $8, %xmm1") \
+            ASM("packuswb %xmm1, %xmm0") \
+            ASM("paddusb %xmm4, %xmm0") \
+            ASM("movdqu %%xmm0, %0":"=m"(*(yp)):)
+
+/* 2x2 subsample: pair-sum the 16 bytes of each spilled row, add the
+ * rows and divide by four, leaving 8 words in the given register */
+#define SUBSAMPLE(tmp_r1, tmp_r2, reg) \
+            ASM("movdqa %0, %%" reg ::"m"(tmp_r1[0])) \
+            ASM("movdqa %" reg ", %xmm6") \
+            ASM("pand %0, %%" reg ::"m"(XMM_255[0])) \
+            ASM("psrlw $8, %xmm6") \
+            ASM("paddusw %xmm6, %" reg) \
+            ASM("movdqa %0, %%xmm6"::"m"(tmp_r2[0])) \
+            ASM("movdqa %xmm6, %xmm7") \
+            ASM("pand %0, %%xmm6"::"m"(XMM_255[0])) \
+            ASM("psrlw $8, %xmm7") \
+            ASM("paddusw %xmm7, %xmm6") \
+            ASM("paddusw %xmm6, %" reg) \
+            ASM("psrlw $2, %" reg)
+
+/* split the 16 pixels at sp into planes, blend luma into yp and
+ * spill 255 - alpha and the chroma subsampling inputs */
+#define PROCESS_ROW(sp, yp, tmp_na, tmp_u, tmp_v) \
+            ASM("movdqu %0, %%xmm0"::"m"((sp)[0])) \
+            ASM("movdqu %0, %%xmm1"::"m"((sp)[16])) \
+            ASM("movdqu %0, %%xmm2"::"m"((sp)[32])) \
+            ASM("movdqu %0, %%xmm3"::"m"((sp)[48])) \
+            EXTRACT("24") \
+            ASM("pcmpeqb %xmm5, %xmm5") \
+            ASM("psubusb %xmm4, %xmm5") \
+            ASM("movdqa %%xmm5, %0":"=m"(tmp_na[0]):) \
+            EXTRACT("8") \
+            ASM("movdqa %%xmm4, %0":"=m"(tmp_u[0]):) \
+            EXTRACT("0") \
+            ASM("movdqa %%xmm4, %0":"=m"(tmp_v[0]):) \
+            EXTRACT("16") \
+            BLEND_LUMA(yp, tmp_na)
+
+    for (int row = 0; row < height; row += 2)
+    {
+        for (int col = 0; col < (width >> 4); col++)
+        {
+            PROCESS_ROW(src1, y1, tmp_na1, tmp_u1, tmp_v1)
+            PROCESS_ROW(src2, y2, tmp_na2, tmp_u2, tmp_v2)
+
+            // subsampled 255 - alpha -> xmm2, osd u -> xmm1
+            SUBSAMPLE(tmp_na1, tmp_na2, "xmm2")
+            SUBSAMPLE(tmp_u1, tmp_u2, "xmm1")
+            ASM("pxor %xmm7, %xmm7")
+            ASM("movq %0, %%xmm3"::"m"(*u))
+            ASM("punpcklbw %xmm7, %xmm3")
+            ASM("pmullw %xmm2, %xmm3")
+            ASM("psrlw $8, %xmm3")
+            ASM("paddusw %xmm1, %xmm3")
+            ASM("packuswb %xmm3, %xmm3")
+            ASM("movq %%xmm3, %0":"=m"(*u):)
+
+            SUBSAMPLE(tmp_v1, tmp_v2, "xmm1")
+            ASM("pxor %xmm7, %xmm7")
+            ASM("movq %0, %%xmm3"::"m"(*v))
+            ASM("punpcklbw %xmm7, %xmm3")
+            ASM("pmullw %xmm2, %xmm3")
+            ASM("psrlw $8, %xmm3")
+            ASM("paddusw %xmm1, %xmm3")
+            ASM("packuswb %xmm3, %xmm3")
+            ASM("movq %%xmm3, %0":"=m"(*v):)
+
+            src1 += 64; src2 += 64; y1 += 16; y2 += 16; u += 8; v += 8;
+        }
+        y1 += y_wrap; y2 += y_wrap; u += u_wrap; v += v_wrap;
+        src1 += src_wrap; src2 += src_wrap;
+    }
+
+#undef EXTRACT
+#undef BLEND_LUMA
+#undef SUBSAMPLE
+#undef PROCESS_ROW
+#endif // MMX
+}
+
 void inline c_yuv888_to_yv12(VideoFrame *frame, MythImage *osd_image,
                              int left, int top, int right, int bottom)
 {
@@ -8,12 +8,17 @@
 #define ALIGN_C 2
 #ifdef MMX
 #define ALIGN_X_MMX 8
+#define ALIGN_X_SSE2 16
 #else
 #define ALIGN_X_MMX 2
+#define ALIGN_X_SSE2 2
 #endif
 
+int osd_blend_align(void);
 void yuv888_to_yv12(VideoFrame *frame, MythImage *osd_image,
                     int left, int top, int right, int bottom);
+void inline sse2_yuv888_to_yv12(VideoFrame *frame, MythImage *osd_image,
+                                int left, int top, int right, int bottom);
 void inline mmx_yuv888_to_yv12(VideoFrame *frame, MythImage *osd_image,
                                int left, int top, int right, int bottom);
 void inline c_yuv888_to_yv12(VideoFrame *frame, MythImage *osd_image,
@@ -331,6 +331,67 @@ VideoFrame *VideoBuffers::GetNextFreeFrame(bool with_lock,
     return NULL;
 }
 
+/**
+ * \fn VideoBuffers::WaitForAvailable(ulong)
+ *  Waits up to wait_ms milliseconds for enough frames to become
+ *  available for EnoughFreeFrames() to return true.
+ *
+ *   This lets the decoder thread sleep until the display loop
+ *   returns a frame instead of polling for one. The predicate is
+ *   checked outside available_wait_lock, so a frame freed between
+ *   the check and the wait is only picked up when the wait times
+ *   out; this is no worse than the polling it replaces.
+ *
+ * \return true if enough frames are available to decode onto.
+ */
+bool VideoBuffers::WaitForAvailable(ulong wait_ms)
+{
+    if (EnoughFreeFrames())
+        return true;
+
+    available_wait_lock.lock();
+    available_wait.wait(&available_wait_lock, wait_ms);
+    available_wait_lock.unlock();
+
+    return EnoughFreeFrames();
+}
+
+/**
+ * \fn VideoBuffers::EnoughDecodedFrames(int)
+ *  Returns true if there are plenty of decoded frames ready for
+ *  display. 'extra' raises the bar by that many frames -- used for
+ *  refill hysteresis when recovering from a buffering pause -- but
+ *  is clamped so we never demand more frames than the pool can hold
+ *  while keeping the decoder's free-frame reserve.
+ */
+bool VideoBuffers::EnoughDecodedFrames(int extra) const
+{
+    uint target = needprebufferframes + ((extra > 0) ? extra : 0);
+    if ((numbuffers > needfreeframes + 1) &&
+        (target > numbuffers - needfreeframes - 1))
+    {
+        target = numbuffers - needfreeframes - 1;
+    }
+    return size(kVideoBuffer_used) >= target;
+}
+
+/**
+ * \fn VideoBuffers::EnoughPrebufferedFrames(int)
+ *  Returns true if we have at least the minimum number of decoded
+ *  frames ready for display; 'extra' works as in
+ *  EnoughDecodedFrames(int).
+ */
+bool VideoBuffers::EnoughPrebufferedFrames(int extra) const
+{
+    uint target = keepprebufferframes + ((extra > 0) ? extra : 0);
+    if ((numbuffers > needfreeframes + 1) &&
+        (target > numbuffers - needfreeframes - 1))
+    {
+        target = numbuffers - needfreeframes - 1;
+    }
+    return size(kVideoBuffer_used) >= target;
+}
+
 /**
  * \fn VideoBuffers::ReleaseFrame(VideoFrame*)
  *  Frame is ready to be for filtering or OSD application.
@@ -359,6 +420,7 @@ void VideoBuffers::DeLimboFrame(VideoFrame *frame)
     {
         limbo.remove(frame);
         available.enqueue(frame);
+        available_wait.wakeAll();
     }
 
     // BEGIN HACK HACK HACK, see trac ticket #4159
@@ -382,15 +444,21 @@ void VideoBuffers::StartDisplayingFrame(void)
 /**
  * \fn VideoBuffers::DoneDisplayingFrame(VideoFrame *frame)
  *  Removes frame from used queue and adds it to the available list.
+ *
+ *   This runs at frame rate in the display thread, so the queues are
+ *   manipulated directly under a single lock acquisition rather than
+ *   through remove()/enqueue(), which each retake the lock.
  */
 void VideoBuffers::DoneDisplayingFrame(VideoFrame *frame)
 {
     QMutexLocker locker(&global_lock);
 
-    if(used.contains(frame))
+    if (used.contains(frame))
     {
-        remove(kVideoBuffer_used, frame);
-        enqueue(kVideoBuffer_avail, frame);
+        used.remove(frame);
+        available.remove(frame);
+        available.enqueue(frame);
+        available_wait.wakeAll();
     }
 }
 
@@ -425,10 +493,11 @@ void VideoBuffers::DiscardFrame(VideoFrame *frame)
     }
 }
 
+// Maps a BufferType to the queue member; this is a static mapping
+// that touches no queue state, so no lock is needed (or useful --
+// the caller must lock around any use of the returned queue anyway).
 frame_queue_t *VideoBuffers::queue(BufferType type)
 {
-    QMutexLocker locker(&global_lock);
-
     frame_queue_t *q = NULL;
 
     if (type == kVideoBuffer_avail)
@@ -449,8 +518,6 @@ frame_queue_t *VideoBuffers::queue(BufferType type)
 
 const frame_queue_t *VideoBuffers::queue(BufferType type) const
 {
-    QMutexLocker locker(&global_lock);
-
     const frame_queue_t *q = NULL;
 
     if (type == kVideoBuffer_avail)
@@ -523,6 +590,8 @@ void VideoBuffers::enqueue(BufferType type, VideoFrame *frame)
     global_lock.lock();
     q->remove(frame);
     q->enqueue(frame);
+    if (q == &available)
+        available_wait.wakeAll();
     global_lock.unlock();
 
     return;
@@ -119,10 +119,9 @@ class VideoBuffers
     uint FreeVideoFrames(void) const { return size(kVideoBuffer_avail); }
     bool EnoughFreeFrames(void) const
         { return size(kVideoBuffer_avail) >= needfreeframes; }
-    bool EnoughDecodedFrames(void) const
-        { return size(kVideoBuffer_used) >= needprebufferframes; }
-    bool EnoughPrebufferedFrames(void) const
-        { return size(kVideoBuffer_used) >= keepprebufferframes; }
+    bool WaitForAvailable(ulong wait_ms);
+    bool EnoughDecodedFrames(int extra = 0) const;
+    bool EnoughPrebufferedFrames(int extra = 0) const;
 
     const VideoFrame *at(uint i) const { return &buffers[i]; }
     const VideoFrame *GetLastDecodedFrame(void) const { return at(vpos); }
@@ -188,6 +187,9 @@ class VideoBuffers
 
     mutable QMutex         global_lock;
 
+    QMutex                 available_wait_lock;
+    QWaitCondition         available_wait;
+
     bool                   use_frame_locks;
     QMutex                 frame_lock;
     frame_lock_map_t       frame_locks;
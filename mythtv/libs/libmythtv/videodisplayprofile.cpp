@@ -2,12 +2,16 @@
 #include <algorithm>
 using namespace std;
 
+#include <QThread>
+#include <QTime>
+
 #include "videodisplayprofile.h"
 #include "mythcorecontext.h"
 #include "mythdb.h"
 #include "mythverbose.h"
 #include "videooutbase.h"
 #include "avformatdecoder.h"
+#include "filtermanager.h"
 
 bool ProfileItem::IsMatch(const QSize &size, float rate) const
 {
@@ -357,6 +361,25 @@ QString VideoDisplayProfile::GetFilteredDeint(const QString &override)
     return deint;
 }
 
+/** \fn VideoDisplayProfile::GetMaxCPUs(void) const
+ *  \brief Returns the number of CPU cores to use for decoding.
+ *
+ *   If the profile does not specify a count, all detected cores
+ *   are used, capped at the same maximum the settings screen
+ *   offers. Profiles that explicitly ask for one core (the old
+ *   default) are left alone.
+ */
+uint VideoDisplayProfile::GetMaxCPUs(void) const
+{
+    uint cpus = GetPreference("pref_max_cpus").toUInt();
+    if (!cpus)
+    {
+        int detected = QThread::idealThreadCount();
+        cpus = (detected > 0) ? detected : 1;
+    }
+    return min(cpus, 4U);
+}
+
 QString VideoDisplayProfile::GetPreference(const QString &key) const
 {
     QMutexLocker locker(&lock);
@@ -1146,6 +1169,147 @@ void VideoDisplayProfile::CreateVDPAUProfiles(const QString &hostname)
                   "vdpauskipchroma,vdpaucolorspace=auto");
 }
 
+/**
+ * \fn benchmark_deint_filter(const QString&, const QSize&)
+ *  Loads the given software deinterlacer and times it over a
+ *  synthetic frame, returning milliseconds per ProcessFrame() call
+ *  or -1.0 if the filter could not be loaded.
+ */
+static float benchmark_deint_filter(const QString &deint, const QSize &size)
+{
+    FilterManager fm;
+    VideoFrameType itmp = FMT_YV12;
+    VideoFrameType otmp = FMT_YV12;
+    int width   = size.width();
+    int height  = size.height();
+    int bufsize = 0;
+
+    FilterChain *chain =
+        fm.LoadFilters(deint, itmp, otmp, width, height, bufsize, 1);
+    if (!chain)
+        return -1.0f;
+
+    bufsize = max(bufsize, width * height * 3 / 2);
+    unsigned char *buf = new unsigned char[bufsize];
+    // deterministic pseudo video, so the kernels see plausible data
+    for (int i = 0; i < bufsize; i++)
+        buf[i] = (i * 7) & 0xff;
+
+    VideoFrame frame;
+    init(&frame, FMT_YV12, buf, width, height, bufsize);
+
+    // warm the caches and any lazy CPU dispatch before timing
+    chain->ProcessFrame(&frame, kScan_Interlaced);
+
+    QTime timer;
+    timer.start();
+    int iterations = 0;
+    while (timer.elapsed() < 80 && iterations < 100)
+    {
+        frame.frameNumber = iterations;
+        chain->ProcessFrame(&frame, kScan_Interlaced);
+        iterations++;
+    }
+    float ms_per_call = timer.elapsed() / (float) iterations;
+
+    delete chain;
+    delete [] buf;
+
+    return ms_per_call;
+}
+
+/**
+ * \fn VideoDisplayProfile::CreateAutoBenchmarkProfile(const QString&)
+ *  Times the software deinterlacers on this machine at SD and HD
+ *  resolutions and (re)creates an "Auto Benchmark" profile group
+ *  using the best deinterlacer that fits in the frame budget for
+ *  each resolution class, so mixed frontends do not need hand
+ *  tuning. The raw timings are saved in the BenchmarkedDeintTimes
+ *  setting for support purposes.
+ *
+ *  The video renderer is not timed: rendering cannot be benchmarked
+ *  without a window to render into, so the existing renderer
+ *  priority table picks it as usual.
+ */
+void VideoDisplayProfile::CreateAutoBenchmarkProfile(const QString &hostname)
+{
+    // best to worst; the benchmark picks the first that fits
+    static const char *deints[] =
+    {
+        "yadifdoubleprocessdeint",   "yadifdeint",
+        "greedyhdoubleprocessdeint", "greedyhdeint",
+        "kerneldoubleprocessdeint",  "kerneldeint",
+        "linearblend",               "onefield",
+    };
+    static const uint kNumDeints = sizeof(deints) / sizeof(deints[0]);
+
+    struct
+    {
+        QSize   size;
+        float   rate;
+        QString chosen;
+    } res[2] =
+    {
+        { QSize(1920, 1080), 30000.0f / 1001.0f, QString() },
+        { QSize( 720,  576), 25.0f,              QString() },
+    };
+
+    QString results;
+    for (uint i = 0; i < 2; i++)
+    {
+        // leave two thirds of the frame period for decode and render
+        float budget = (1000.0f / res[i].rate) / 3.0f;
+        for (uint j = 0; j < kNumDeints; j++)
+        {
+            QString deint = deints[j];
+            float ms = benchmark_deint_filter(deint, res[i].size);
+            if (ms < 0.0f)
+                continue;
+
+            int calls_per_frame = deint.contains("doubleprocess") ? 2 : 1;
+            float frame_ms = ms * calls_per_frame;
+            results += QString("%1x%2:%3=%4ms ")
+                .arg(res[i].size.width()).arg(res[i].size.height())
+                .arg(deint).arg(frame_ms, 0, 'f', 2);
+            VERBOSE(VB_PLAYBACK, QString(
+                        "Benchmark: %1 at %2x%3 takes %4 ms per frame "
+                        "(budget %5 ms)")
+                    .arg(deint).arg(res[i].size.width())
+                    .arg(res[i].size.height())
+                    .arg(frame_ms, 0, 'f', 2).arg(budget, 0, 'f', 2));
+
+            if (res[i].chosen.isEmpty() && frame_ms <= budget)
+                res[i].chosen = deint;
+        }
+        if (res[i].chosen.isEmpty())
+            res[i].chosen = "onefield";
+
+        VERBOSE(VB_IMPORTANT, QString(
+                    "Benchmark: selected '%1' for %2x%3")
+                .arg(res[i].chosen).arg(res[i].size.width())
+                .arg(res[i].size.height()));
+    }
+
+    gCoreContext->SaveSettingOnHost(
+        "BenchmarkedDeintTimes", results.trimmed(), hostname);
+
+    QString renderer = GetPreferredVideoRenderer("ffmpeg");
+
+    (void) QObject::tr("Auto Benchmark",
+                       "Sample: locally benchmarked");
+    DeleteProfileGroup("Auto Benchmark", hostname);
+    uint groupid = CreateProfileGroup("Auto Benchmark", hostname);
+    // fall back to the single rate version of a 2x deinterlacer
+    QString fallback0 = QString(res[0].chosen).remove("doubleprocess");
+    QString fallback1 = QString(res[1].chosen).remove("doubleprocess");
+    CreateProfile(groupid, 1, ">=", 1280, 720, "", 0, 0,
+                  "ffmpeg", 0, true, renderer, "softblend", true,
+                  res[0].chosen, fallback0, "");
+    CreateProfile(groupid, 2, ">", 0, 0, "", 0, 0,
+                  "ffmpeg", 0, true, renderer, "softblend", true,
+                  res[1].chosen, fallback1, "");
+}
+
 void VideoDisplayProfile::CreateProfiles(const QString &hostname)
 {
     CreateOldProfiles(hostname);
@@ -93,8 +93,7 @@ class MPUBLIC VideoDisplayProfile
         { return GetPreference("pref_decoder"); }
     bool    IsDecoderCompatible(const QString &decoder);
 
-    uint GetMaxCPUs(void) const
-        { return GetPreference("pref_max_cpus").toUInt(); }
+    uint GetMaxCPUs(void) const;
 
     bool IsSkipLoopEnabled(void) const
         { return GetPreference("pref_skiploop").toInt(); }     
@@ -149,6 +148,7 @@ class MPUBLIC VideoDisplayProfile
     static void        CreateOldProfiles(const QString &hostname);
     static void        CreateNewProfiles(const QString &hostname);
     static void        CreateVDPAUProfiles(const QString &hostname);
+    static void        CreateAutoBenchmarkProfile(const QString &hostname);
 
     static QStringList GetVideoRenderers(const QString &decoder);
     static QString     GetVideoRendererHelp(const QString &renderer);
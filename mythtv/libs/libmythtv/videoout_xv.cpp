@@ -188,6 +188,7 @@ VideoOutputXv::VideoOutputXv()
       xv_port(-1),      xv_hue_base(0),
       xv_colorkey(0),   xv_draw_colorkey(false),
       xv_chroma(0),     xv_set_defaults(false),
+      xv_shm_event_base(-1), xv_put_pending(false),
 
       chroma_osd(NULL)
 {
@@ -926,6 +927,14 @@ bool VideoOutputXv::InitXVideo()
     if (ok)
         ok = CreateBuffers(XVideo);
 
+    if (ok && XShmQueryExtension(disp->GetDisplay()))
+    {
+        // Ask the server for ShmCompletion events, so Show() can queue
+        // an XvShmPutImage() and pick the event up before the next put
+        // instead of paying an XSync() round trip on every frame.
+        xv_shm_event_base = XShmGetEventBase(disp->GetDisplay());
+    }
+
     if (!disp->StopLog())
     {
         VERBOSE(VB_IMPORTANT, LOC_ERR + "Failed to create XVideo Buffers.");
@@ -1813,6 +1822,7 @@ bool VideoOutputXv::CreateBuffers(VOSType subtype)
 void VideoOutputXv::DeleteBuffers(VOSType subtype, bool delete_pause_frame)
 {
     (void) subtype;
+    WaitForShmCompletion();
     DiscardFrames(true);
 
     if (chroma_osd)
@@ -2509,11 +2519,15 @@ void VideoOutputXv::ShowXVideo(FrameScanType scan)
     }
 
     vbuffers.UnlockFrame(frame, "ShowXVideo");
+
+    WaitForShmCompletion();
+
     {
         QMutexLocker locker(&global_lock);
         vbuffers.LockFrame(frame, "ShowXVideo");
         int video_height = (3 != field) ?
             (video_rect.height()/2) : video_rect.height();
+        Bool send_event = (xv_shm_event_base >= 0);
         disp->Lock();
         XvShmPutImage(disp->GetDisplay(), xv_port, XJ_curwin,
                       disp->GetGC(), image,
@@ -2521,12 +2535,49 @@ void VideoOutputXv::ShowXVideo(FrameScanType scan)
                       video_rect.width(), video_height,
                       display_video_rect.left(), dest_y,
                       display_video_rect.width(),
-                      display_video_rect.height(), False);
+                      display_video_rect.height(), send_event);
         disp->Unlock();
+        xv_put_pending = send_event;
         vbuffers.UnlockFrame(frame, "ShowXVideo");
     }
 }
 
+/** \fn VideoOutputXv::WaitForShmCompletion(void)
+ *  \brief Waits for the ShmCompletion event of the last XvShmPutImage().
+ *
+ *   Normally the event arrived long before the next frame is shown and
+ *   this returns without blocking; when the X server is behind we wait
+ *   here, before touching the shared memory segment it may still be
+ *   reading. A timeout guards against servers that drop the event.
+ */
+void VideoOutputXv::WaitForShmCompletion(void)
+{
+    if (!xv_put_pending || xv_shm_event_base < 0)
+        return;
+
+    XEvent event;
+    for (uint i = 0; i < 100; i++)
+    {
+        bool found;
+        {
+            MythXLocker lock(disp);
+            found = XCheckTypedEvent(disp->GetDisplay(),
+                                     xv_shm_event_base + ShmCompletion,
+                                     &event);
+        }
+        if (found)
+        {
+            xv_put_pending = false;
+            return;
+        }
+        usleep(500);
+    }
+
+    VERBOSE(VB_PLAYBACK, LOC_WARN +
+            "Timed out waiting for ShmCompletion event");
+    xv_put_pending = false;
+}
+
 // this is documented in videooutbase.cpp
 void VideoOutputXv::Show(FrameScanType scan)
 {
@@ -2547,7 +2598,15 @@ void VideoOutputXv::Show(FrameScanType scan)
     else if (VideoOutputSubType() == XVideo)
         ShowXVideo(scan);
 
-    disp->Sync();
+    if (XVideo == VideoOutputSubType() && xv_shm_event_base >= 0)
+    {
+        // The put completion is tracked by its ShmCompletion event,
+        // so just push it out without a blocking round trip.
+        MythXLocker lock(disp);
+        XFlush(disp->GetDisplay());
+    }
+    else
+        disp->Sync();
 }
 
 void VideoOutputXv::ShowPIP(VideoFrame  *frame,
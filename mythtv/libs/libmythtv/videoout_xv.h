@@ -151,6 +151,7 @@ class VideoOutputXv : public VideoOutput
 
     void ShowXvMC(FrameScanType scan);
     void ShowXVideo(FrameScanType scan);
+    void WaitForShmCompletion(void);
 
     virtual void ShowPIP(VideoFrame  *frame,
                          MythPlayer  *pipplayer,
@@ -232,6 +233,10 @@ class VideoOutputXv : public VideoOutput
     bool                 xv_set_defaults;
     buffer_map_t         xv_buffers;
     bool                 xv_need_bobdeint_repaint;
+    /// ShmCompletion event type for this display, -1 when unavailable
+    int                  xv_shm_event_base;
+    /// true while an XvShmPutImage() awaits its ShmCompletion event
+    bool                 xv_put_pending;
     QMap<PictureAttribute,int> xv_attribute_min;
     QMap<PictureAttribute,int> xv_attribute_max;
     QMap<PictureAttribute,int> xv_attribute_def;
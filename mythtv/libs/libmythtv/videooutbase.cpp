@@ -2,6 +2,9 @@
 #include <cstdlib>
 
 #include <QDesktopWidget>
+#include <QRunnable>
+#include <QThread>
+#include <QThreadPool>
 
 #include "osd.h"
 #include "mythplayer.h"
@@ -327,6 +330,7 @@ VideoOutput::VideoOutput() :
     vsz_desired_display_rect(0,0,0,0),  vsz_display_size(0,0),
     vsz_video_size(0,0),
     vsz_tmp_buf(NULL),                  vsz_scale_context(NULL),
+    vsz_pool(NULL),
 
     // Deinterlacing
     m_deinterlacing(false),             m_deintfiltername("linearblend"),
@@ -376,6 +380,12 @@ VideoOutput::~VideoOutput()
 
     ShutdownVideoResize();
 
+    if (vsz_pool)
+    {
+        delete vsz_pool;
+        vsz_pool = NULL;
+    }
+
     if (m_deintFilter)
         delete m_deintFilter;
     if (m_deintFiltMan)
@@ -1098,8 +1108,75 @@ void VideoOutput::DoVideoResize(const QSize &inDim, const QSize &outDim)
                               vsz_display_size.height(),
                               PIX_FMT_YUV420P, SWS_FAST_BILINEAR,
                               NULL, NULL, NULL);
+
+    // Scaling a full frame on one core stutters on large frames, so
+    // split the scale into horizontal bands, one context per band,
+    // and fan the bands out over a worker pool in ResizeVideo().
+    // Band edges land on even rows for the subsampled chroma; bands
+    // too short to scale well are not worth a thread.
+    int bands = min(4, QThread::idealThreadCount());
+    while (bands > 1 && (vsz_display_size.height() / bands) < 64)
+        bands--;
+
+    if (bands > 1)
+    {
+        int bh = (vsz_display_size.height() / bands) & ~1;
+        for (int i = 0; i < bands; i++)
+        {
+            ResizeBand band;
+            band.dst_y = i * bh;
+            band.dst_h = (i == bands - 1) ?
+                vsz_display_size.height() - band.dst_y : bh;
+            band.src_y = (band.dst_y * vsz_video_size.height() /
+                          vsz_display_size.height()) & ~1;
+            band.src_h = (i == bands - 1) ?
+                vsz_video_size.height() - band.src_y :
+                (((i + 1) * bh * vsz_video_size.height() /
+                  vsz_display_size.height()) & ~1) - band.src_y;
+            band.ctx = sws_getContext(
+                vsz_video_size.width(), band.src_h, PIX_FMT_YUV420P,
+                vsz_display_size.width(), band.dst_h, PIX_FMT_YUV420P,
+                SWS_FAST_BILINEAR, NULL, NULL, NULL);
+            if (!band.ctx)
+            {
+                VERBOSE(VB_PLAYBACK, LOC + QString(
+                            "Failed to create resize context for band %1, "
+                            "using the single threaded resize.").arg(i));
+                for (uint j = 0; j < vsz_bands.size(); j++)
+                    sws_freeContext(vsz_bands[j].ctx);
+                vsz_bands.clear();
+                return;
+            }
+            vsz_bands.push_back(band);
+        }
+
+        if (!vsz_pool)
+            vsz_pool = new QThreadPool();
+        vsz_pool->setMaxThreadCount(bands - 1);
+    }
 }
 
+/// Scales one horizontal band of a frame for VideoOutput::ResizeVideo().
+class ResizeBandTask : public QRunnable
+{
+  public:
+    ResizeBandTask(struct SwsContext *ctx, const AVPicture &in, int in_h,
+                   const AVPicture &out) :
+        m_ctx(ctx), m_in(in), m_in_h(in_h), m_out(out) { }
+
+    virtual void run(void)
+    {
+        sws_scale(m_ctx, m_in.data, m_in.linesize, 0, m_in_h,
+                  m_out.data, m_out.linesize);
+    }
+
+  private:
+    struct SwsContext *m_ctx;
+    AVPicture          m_in;
+    int                m_in_h;
+    AVPicture          m_out;
+};
+
 void VideoOutput::ResizeVideo(VideoFrame *frame)
 {
     if (vsz_desired_display_rect.isNull() || frame->codec !=  FMT_YV12)
@@ -1138,8 +1215,41 @@ void VideoOutput::ResizeVideo(VideoFrame *frame)
                        resize.width(), resize.height());
         avpicture_fill(&img_in, (uint8_t *)frame->buf, PIX_FMT_YUV420P,
                        frame->width, frame->height);
-        sws_scale(vsz_scale_context, img_in.data, img_in.linesize, 0,
+
+        if (vsz_bands.size() > 1 && vsz_pool)
+        {
+            // scale each band on its own context; the first band runs
+            // on this thread while the pool handles the rest
+            for (uint i = 0; i < vsz_bands.size(); i++)
+            {
+                const ResizeBand &band = vsz_bands[i];
+                AVPicture in_band  = img_in;
+                AVPicture out_band = img_out;
+                in_band.data[0]  += band.src_y * img_in.linesize[0];
+                in_band.data[1]  += (band.src_y >> 1) * img_in.linesize[1];
+                in_band.data[2]  += (band.src_y >> 1) * img_in.linesize[2];
+                out_band.data[0] += band.dst_y * img_out.linesize[0];
+                out_band.data[1] += (band.dst_y >> 1) * img_out.linesize[1];
+                out_band.data[2] += (band.dst_y >> 1) * img_out.linesize[2];
+                if (i)
+                {
+                    vsz_pool->start(new ResizeBandTask(
+                                        band.ctx, in_band, band.src_h,
+                                        out_band));
+                }
+                else
+                {
+                    sws_scale(band.ctx, in_band.data, in_band.linesize, 0,
+                              band.src_h, out_band.data, out_band.linesize);
+                }
+            }
+            vsz_pool->waitForDone();
+        }
+        else
+        {
+            sws_scale(vsz_scale_context, img_in.data, img_in.linesize, 0,
                       frame->height, img_out.data, img_out.linesize);
+        }
     }
 
     int xoff = resize.left();
@@ -1205,6 +1315,12 @@ void VideoOutput::ShutdownVideoResize(void)
         vsz_scale_context = NULL;
     }
 
+    if (vsz_pool)
+        vsz_pool->waitForDone();
+    for (uint i = 0; i < vsz_bands.size(); i++)
+        sws_freeContext(vsz_bands[i].ctx);
+    vsz_bands.clear();
+
     vsz_video_size   = QSize(0,0);
     vsz_display_size = QSize(0,0);
     vsz_enabled      = false;
@@ -1284,7 +1400,7 @@ bool VideoOutput::DisplayOSD(VideoFrame *frame, OSD *osd)
 
     QRegion dirty   = QRegion();
     QRegion visible = osd->Draw(osd_painter, osd_image, osd_size, dirty,
-                                frame->codec == FMT_YV12 ? ALIGN_X_MMX : 0,
+                                frame->codec == FMT_YV12 ? osd_blend_align() : 0,
                                 frame->codec == FMT_YV12 ? ALIGN_C : 0);
     bool changed    = !dirty.isEmpty();
     bool show       = !visible.isEmpty();
@@ -34,6 +34,7 @@ class OSD;
 class FilterChain;
 class FilterManager;
 class OpenGLContextGLX;
+class QThreadPool;
 
 typedef QMap<MythPlayer*,PIPLocation> PIPMap;
 
@@ -172,12 +173,18 @@ class VideoOutput
     int FreeVideoFrames(void) { return vbuffers.FreeVideoFrames(); }
     /// \brief Returns true iff enough frames are available to decode onto.
     bool EnoughFreeFrames(void) { return vbuffers.EnoughFreeFrames(); }
+    /// \brief Waits for enough frames to be available to decode onto.
+    bool WaitForAvailable(ulong wait_ms)
+        { return vbuffers.WaitForAvailable(wait_ms); }
     /// \brief Returns true iff there are plenty of decoded frames ready
-    ///        for display.
-    bool EnoughDecodedFrames(void) { return vbuffers.EnoughDecodedFrames(); }
+    ///        for display, plus 'extra' frames of refill hysteresis.
+    bool EnoughDecodedFrames(int extra = 0)
+        { return vbuffers.EnoughDecodedFrames(extra); }
     /// \brief Returns true iff we have at least the minimum number of
-    ///        decoded frames ready for display.
-    bool EnoughPrebufferedFrames(void) { return vbuffers.EnoughPrebufferedFrames(); }
+    ///        decoded frames ready for display, plus 'extra' frames
+    ///        of refill hysteresis.
+    bool EnoughPrebufferedFrames(int extra = 0)
+        { return vbuffers.EnoughPrebufferedFrames(extra); }
 
     /// \brief Returns if videooutput is embedding
     bool IsEmbedding(void);
@@ -306,6 +313,15 @@ class VideoOutput
     QSize   vsz_video_size;
     unsigned char      *vsz_tmp_buf;
     struct SwsContext  *vsz_scale_context;
+    /// One horizontal band of the threaded resize path
+    struct ResizeBand
+    {
+        struct SwsContext *ctx;
+        int src_y, src_h;
+        int dst_y, dst_h;
+    };
+    vector<ResizeBand>  vsz_bands;
+    QThreadPool        *vsz_pool;
 
     // Deinterlacing
     bool           m_deinterlacing;
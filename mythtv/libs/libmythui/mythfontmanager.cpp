@@ -1,8 +1,11 @@
 #include <QDir>
 #include <QFileInfo>
 #include <QFontDatabase>
+#include <QFontMetrics>
+#include <QImage>
 #include <QList>
 #include <QMutexLocker>
+#include <QPainter>
 
 #include "mythfontmanager.h"
 #include "mythverbose.h"
@@ -124,6 +127,47 @@ void MythFontManager::ReleaseFonts(const QString &registeredFor)
     }
 }
 
+/**
+ *  \brief Rasterizes the printable ASCII range for the given font.
+ *
+ *   Qt pulls glyphs into its glyph caches the first time each character
+ *   is painted, so the first show of a screen full of text areas pays
+ *   for shaping and rasterization of every distinct face and size it
+ *   uses.  Drawing the common glyph range into a scratch image here
+ *   moves that cost to theme load time.  Each face/size/attribute
+ *   combination is only warmed once per run; the glyph caches are
+ *   per-thread, so this must be called from the UI thread.
+ *
+ *  \param font The font to warm, at the size it will be painted
+ */
+void MythFontManager::PreloadGlyphs(const QFont &font)
+{
+    {
+        QMutexLocker locker(&m_lock);
+        if (m_preloadedFonts.contains(font.key()))
+            return;
+        m_preloadedFonts.insert(font.key());
+    }
+
+    QString sample;
+    for (int c = 0x20; c < 0x7F; c++)
+        sample.append(QChar(c));
+
+    QFontMetrics fm(font);
+    QSize size(fm.width(sample), fm.height());
+    if (size.isEmpty())
+        return;
+
+    QImage scratch(size, QImage::Format_ARGB32);
+    scratch.fill(0);
+
+    QPainter paint;
+    paint.begin(&scratch);
+    paint.setFont(font);
+    paint.drawText(scratch.rect(), Qt::AlignLeft | Qt::AlignTop, sample);
+    paint.end();
+}
+
 /**
  *  \brief Loads fonts from font files in the specified directory.
  *
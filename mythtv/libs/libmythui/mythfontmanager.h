@@ -3,10 +3,12 @@
 
 #include <QMultiHash>
 #include <QMutex>
+#include <QSet>
 #include <QString>
 
 #include "mythexp.h"
 
+class QFont;
 class MythFontReference;
 typedef QMultiHash<QString, MythFontReference*> FontPathToReference;
 
@@ -17,6 +19,7 @@ class MPUBLIC MythFontManager
 
     void LoadFonts(const QString &directory, const QString &registeredFor);
     void ReleaseFonts(const QString &registeredFor);
+    void PreloadGlyphs(const QFont &font);
 
     static MythFontManager *GetGlobalFontManager(void);
 
@@ -32,6 +35,7 @@ class MPUBLIC MythFontManager
 
     QMutex m_lock;
     FontPathToReference m_fontPathToReference;
+    QSet<QString> m_preloadedFonts;
 
 };
 
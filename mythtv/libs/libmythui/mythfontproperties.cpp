@@ -9,6 +9,7 @@
 #include "mythverbose.h"
 #include "mythdb.h"
 
+#include "mythfontmanager.h"
 #include "mythuihelper.h"
 #include "mythmainwindow.h"
 #include "xmlparsebase.h"
@@ -442,6 +443,10 @@ MythFontProperties *MythFontProperties::ParseFromXml(
                     LOC + QString("loaded '%1'").arg(fi.family()));
     }
 
+    // Warm the glyph caches now, behind theme load, rather than during
+    // the first paint of a screen using this font
+    GetGlobalFontManager()->PreloadGlyphs(newFont->m_face);
+
     if (addToGlobal)
         GetGlobalFontMap()->AddFont(name, newFont);
 
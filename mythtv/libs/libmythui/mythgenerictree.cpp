@@ -105,15 +105,18 @@ MythGenericTree::MythGenericTree(const QString &a_string, int an_int,
                          bool selectable_flag)
 {
     m_subnodes = new SortableMythGenericTreeList;
-    m_ordered_subnodes = new SortableMythGenericTreeList;
-    m_flatenedSubnodes = new SortableMythGenericTreeList;
+    m_ordered_subnodes = NULL;
+    m_flatenedSubnodes = NULL;
+
+    m_pendingSortType = -1;
+    m_pendingSortAttribute = 0;
 
     m_parent = NULL;
     m_selected_subnode = NULL;
     m_currentOrderingIndex = -1;
 
     // TODO Switch to a QT List, or drop the attribute concept entirely
-    m_attributes = new IntVector(6);
+    m_attributes = NULL;
 
     m_text = a_string;
     m_int = an_int;
@@ -147,7 +150,8 @@ MythGenericTree *MythGenericTree::addNode(MythGenericTree *child)
 {
     child->setParent(this);
     m_subnodes->append(child);
-    m_ordered_subnodes->append(child);
+    if (m_ordered_subnodes)
+        m_ordered_subnodes->append(child);
     if (child->IsVisible())
         IncVisibleCount();
 
@@ -159,8 +163,10 @@ void MythGenericTree::removeNode(MythGenericTree *child)
     if (m_selected_subnode == child)
         m_selected_subnode = NULL;
 
-    m_ordered_subnodes->removeAll(child);
-    m_flatenedSubnodes->removeAll(child);
+    if (m_ordered_subnodes)
+        m_ordered_subnodes->removeAll(child);
+    if (m_flatenedSubnodes)
+        m_flatenedSubnodes->removeAll(child);
     m_subnodes->removeAll(child);
 
     if (child && child->IsVisible())
@@ -268,7 +274,7 @@ int MythGenericTree::getChildPosition(MythGenericTree *child) const
     if (m_currentOrderingIndex == -1)
         return m_subnodes->indexOf(child);
 
-    return m_ordered_subnodes->indexOf(child);
+    return sortedSubnodes()->indexOf(child);
 }
 
 int MythGenericTree::getPosition()
@@ -337,31 +343,35 @@ QList<MythGenericTree*> *MythGenericTree::getAllChildren() const
     if (m_currentOrderingIndex == -1)
         return m_subnodes;
 
-    return m_ordered_subnodes;
+    return sortedSubnodes();
 }
 
 MythGenericTree* MythGenericTree::getChildAt(uint reference) const
 {
-    if (reference >= (uint)m_ordered_subnodes->count())
-        return NULL;
+    QList<MythGenericTree*> *list;
 
     if (m_currentOrderingIndex == -1)
-        return m_subnodes->at(reference);
+        list = m_subnodes;
+    else
+        list = sortedSubnodes();
+
+    if (reference >= (uint)list->count())
+        return NULL;
 
-    return m_ordered_subnodes->at(reference);
+    return list->at(reference);
 }
 
 MythGenericTree* MythGenericTree::getVisibleChildAt(uint reference) const
 {
-    if (reference >= (uint)m_ordered_subnodes->count())
-        return NULL;
-
     QList<MythGenericTree*> *list;
 
     if (m_currentOrderingIndex == -1)
         list = m_subnodes;
     else
-        list = m_ordered_subnodes;
+        list = sortedSubnodes();
+
+    if (reference >= (uint)list->count())
+        return NULL;
 
     uint n = 0;
     for (int i = 0; i < list->size(); ++i)
@@ -444,7 +454,7 @@ QList<MythGenericTree*>::iterator MythGenericTree::getFirstChildIterator() const
     if (m_currentOrderingIndex == -1)
         it = m_subnodes->begin();
     else
-        it = m_ordered_subnodes->begin();
+        it = sortedSubnodes()->begin();
     return it;
 }
 
@@ -461,6 +471,9 @@ void MythGenericTree::setAttribute(uint attribute_position, int value_of_attribu
     // stores a value for random ordering in the first "column" (0) and a value
     // for "intelligent" (1) ordering in the second column
 
+    if (!m_attributes)
+        m_attributes = new IntVector(6);
+
     if (m_attributes->size() < (int)(attribute_position + 1))
         m_attributes->resize(attribute_position + 1);
     (*m_attributes)[attribute_position] = value_of_attribute;
@@ -468,14 +481,21 @@ void MythGenericTree::setAttribute(uint attribute_position, int value_of_attribu
 
 int MythGenericTree::getAttribute(uint which_one) const
 {
-    if (m_attributes->size() < (int)(which_one + 1))
+    // an unset attribute vector reads as the six zeroed columns it
+    // used to be allocated with
+    if (!m_attributes)
+    {
+        if (which_one < 6)
+            return 0;
+    }
+    else if (m_attributes->size() >= (int)(which_one + 1))
     {
-        VERBOSE(VB_IMPORTANT, "Asked a MythGenericTree node for a non-existent"
-                              "attribute");
-        return 0;
+        return m_attributes->at(which_one);
     }
 
-    return m_attributes->at(which_one);
+    VERBOSE(VB_IMPORTANT, "Asked a MythGenericTree node for a non-existent"
+                          "attribute");
+    return 0;
 }
 
 void MythGenericTree::setOrderingIndex(int ordering_index)
@@ -489,8 +509,46 @@ void MythGenericTree::reorderSubnodes()
     // The nodes are there, we just want to re-order them according to
     // attribute column defined by ordering_index
 
-    m_ordered_subnodes->Sort(SortableMythGenericTreeList::SORT_ATTRIBUTE,
-                             m_currentOrderingIndex);
+    m_pendingSortType = SortableMythGenericTreeList::SORT_ATTRIBUTE;
+    m_pendingSortAttribute = m_currentOrderingIndex;
+}
+
+/**
+ *  \brief Returns the ordered child list, creating and sorting it on
+ *         first use.
+ *
+ *   A pending sort is applied here rather than when it was requested,
+ *   and the sort spec is passed down to the children so each level of
+ *   the tree orders itself the first time it is actually visited.
+ *   Building and sorting a large media tree this way stays linear in
+ *   the number of nodes created, with the per-branch sorts paid only
+ *   along the paths the user browses.
+ */
+SortableMythGenericTreeList *MythGenericTree::sortedSubnodes(void) const
+{
+    if (!m_ordered_subnodes)
+    {
+        m_ordered_subnodes = new SortableMythGenericTreeList;
+        *m_ordered_subnodes = *m_subnodes;
+    }
+
+    if (m_pendingSortType != -1)
+    {
+        m_ordered_subnodes->Sort(
+            (SortableMythGenericTreeList::SortType)m_pendingSortType,
+            m_pendingSortAttribute);
+
+        QList<MythGenericTree*>::iterator it = m_subnodes->begin();
+        for (; it != m_subnodes->end(); ++it)
+        {
+            (*it)->m_pendingSortType = m_pendingSortType;
+            (*it)->m_pendingSortAttribute = m_pendingSortAttribute;
+        }
+
+        m_pendingSortType = -1;
+    }
+
+    return m_ordered_subnodes;
 }
 
 void MythGenericTree::addYourselfIfSelectable(QList<MythGenericTree*> *flat_list)
@@ -513,7 +571,10 @@ void MythGenericTree::buildFlatListOfSubnodes(bool scrambled_parents)
     // This builds a flat list of every selectable child according to the
     // current ordering index.
 
-    m_flatenedSubnodes->clear();
+    if (!m_flatenedSubnodes)
+        m_flatenedSubnodes = new SortableMythGenericTreeList;
+    else
+        m_flatenedSubnodes->clear();
 
     QList<MythGenericTree*>::iterator it;
     it = m_subnodes->begin();
@@ -532,7 +593,7 @@ MythGenericTree* MythGenericTree::nextPrevFromFlatList(bool forward_or_backward,
                                                bool wrap_around,
                                                MythGenericTree *active) const
 {
-    int i = m_flatenedSubnodes->indexOf(active);
+    int i = m_flatenedSubnodes ? m_flatenedSubnodes->indexOf(active) : -1;
     if (i < 0)
     {
         VERBOSE(VB_IMPORTANT, "Can't find active item on flatened list");
@@ -609,57 +670,32 @@ MythGenericTree* MythGenericTree::getChildById(int an_int) const
 
 void MythGenericTree::sortByString()
 {
-    m_ordered_subnodes->Sort(SortableMythGenericTreeList::SORT_STRING);
-
-    QList<MythGenericTree*> *children = getAllChildren();
-    if (children && children->count() > 0)
-    {
-        SortableMythGenericTreeList::Iterator it;
-        MythGenericTree *child = NULL;
-
-        for (it = children->begin(); it != children->end(); ++it)
-        {
-            child = *it;
-            if (!child)
-                continue;
-            child->sortByString();
-        }
-    }
+    // Deferred; sortedSubnodes() applies this and hands it down to the
+    // children as each level is first visited, instead of eagerly
+    // walking and sorting the entire subtree here
+    m_pendingSortType = SortableMythGenericTreeList::SORT_STRING;
+    m_pendingSortAttribute = 0;
 }
 
 void MythGenericTree::sortByAttributeThenByString(int which_attribute)
 {
-    m_ordered_subnodes->Sort(SortableMythGenericTreeList::SORT_ATT_THEN_STRING,
-                             which_attribute);
-
-    QList<MythGenericTree*>::iterator it;
-    it = m_subnodes->begin();
-    MythGenericTree *child;
-    while ((child = *it) != 0)
-    {
-        child->sortByAttributeThenByString(which_attribute);
-        ++it;
-    }
+    m_pendingSortType = SortableMythGenericTreeList::SORT_ATT_THEN_STRING;
+    m_pendingSortAttribute = which_attribute;
 }
 
 void MythGenericTree::sortBySelectable()
 {
-    m_ordered_subnodes->Sort(SortableMythGenericTreeList::SORT_SELECTABLE);
-
-    QList<MythGenericTree*>::iterator it;
-    it = m_subnodes->begin();
-    MythGenericTree *child;
-    while ((child = *it) != 0)
-    {
-        child->sortBySelectable();
-        ++it;
-    }
+    m_pendingSortType = SortableMythGenericTreeList::SORT_SELECTABLE;
+    m_pendingSortAttribute = 0;
 }
 
 void MythGenericTree::deleteAllChildren()
 {
-    m_flatenedSubnodes->clear();
-    m_ordered_subnodes->clear();
+    if (m_flatenedSubnodes)
+        m_flatenedSubnodes->clear();
+    if (m_ordered_subnodes)
+        m_ordered_subnodes->clear();
+    m_pendingSortType = -1;
     m_selected_subnode = NULL;
     m_currentOrderingIndex = -1;
     MythGenericTree *child;
@@ -679,7 +715,9 @@ void MythGenericTree::reOrderAsSorted()
     //  subnodes
     //
 
-    if (m_subnodes->count() != m_ordered_subnodes->count())
+    SortableMythGenericTreeList *ordered = sortedSubnodes();
+
+    if (m_subnodes->count() != ordered->count())
     {
         VERBOSE(VB_IMPORTANT, "Can't reOrderAsSorted(), because the number "
              "of subnodes is different than the number of ordered subnodes");
@@ -690,7 +728,7 @@ void MythGenericTree::reOrderAsSorted()
     m_currentOrderingIndex = -1;
 
     QList<MythGenericTree*>::iterator it;
-    it = m_ordered_subnodes->begin();
+    it = ordered->begin();
     MythGenericTree *child;
     while ((child = *it) != 0)
     {
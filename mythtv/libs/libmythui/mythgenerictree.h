@@ -94,6 +94,7 @@ class MPUBLIC MythGenericTree
 
     void setAttribute(uint attribute_position, int value_of_attribute);
     int getAttribute(uint which_one) const;
+    /// May return NULL if no attribute has ever been set on this node
     IntVector *getAttributes(void) const { return m_attributes; }
 
     void setOrderingIndex(int ordering_index);
@@ -121,6 +122,7 @@ class MPUBLIC MythGenericTree
 
   private:
     void reorderSubnodes(void);
+    SortableMythGenericTreeList *sortedSubnodes(void) const;
 
     QString m_text;
     QMap<QString, TextProperties> m_strings;
@@ -130,10 +132,19 @@ class MPUBLIC MythGenericTree
     QVariant m_data;
     uint m_visibleCount;
 
+    // Only m_subnodes always exists; the ordered view, the flattened
+    // list and the attribute vector are created on first use so that
+    // leaf nodes in large media trees cost a single allocation
     SortableMythGenericTreeList *m_subnodes;
-    SortableMythGenericTreeList *m_ordered_subnodes;
+    mutable SortableMythGenericTreeList *m_ordered_subnodes;
     SortableMythGenericTreeList *m_flatenedSubnodes;
 
+    // sort requested but not yet applied to m_ordered_subnodes; the
+    // spec is handed down one level each time a node's sorted view is
+    // materialized, so only branches that are visited pay for sorting
+    mutable int m_pendingSortType;
+    mutable int m_pendingSortAttribute;
+
     MythGenericTree *m_selected_subnode;
     IntVector *m_attributes;
     MythGenericTree *m_parent;
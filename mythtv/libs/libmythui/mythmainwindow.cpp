@@ -39,6 +39,7 @@ using namespace std;
 // libmythdb headers
 #include "mythdb.h"
 #include "mythverbose.h"
+#include "mythprofile.h"
 #include "mythevent.h"
 #include "mythdirs.h"
 #include "compat.h"
@@ -634,6 +635,8 @@ void MythMainWindow::drawScreen(void)
     if (currentWidget() || !d->m_drawEnabled)
         return;
 
+    MYTH_PROFILE_SCOPE("MythMainWindow::drawScreen");
+
     if (!d->painter->SupportsClipping())
         d->repaintRegion = d->repaintRegion.unite(d->uiScreenRect);
     else
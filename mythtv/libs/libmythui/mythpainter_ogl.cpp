@@ -25,7 +25,7 @@ using namespace std;
 MythOpenGLPainter::MythOpenGLPainter(MythRenderOpenGL *render,
                                      QGLWidget *parent) :
     MythPainter(), realParent(parent), realRender(render),
-    target(0), swapControl(true)
+    target(0), swapControl(true), m_batchTexture(0), m_batchAlpha(255)
 {
     if (realRender)
         VERBOSE(VB_GENERAL, "OpenGL painter using existing OpenGL context.");
@@ -50,6 +50,9 @@ void MythOpenGLPainter::DeleteTextures(void)
     if (!realRender || m_textureDeleteList.empty())
         return;
 
+    // the pending quads may reference a texture about to be deleted
+    FlushBatch();
+
     QMutexLocker locker(&m_textureDeleteLock);
     while (!m_textureDeleteList.empty())
     {
@@ -121,6 +124,7 @@ void MythOpenGLPainter::End(void)
     }
     else
     {
+        FlushBatch();
         realRender->Flush(false);
         if (target == 0 && swapControl)
             realRender->swapBuffers();
@@ -182,13 +186,38 @@ int MythOpenGLPainter::GetTextureFromCache(MythImage *im)
     return tx_id;
 }
 
+void MythOpenGLPainter::FlushBatch(void)
+{
+    if (realRender && m_batchTexture && !m_batchDst.isEmpty())
+    {
+        realRender->DrawBitmaps(m_batchTexture, m_batchDst.size(), target,
+                                m_batchSrc.constData(),
+                                m_batchDst.constData(), 0, m_batchAlpha);
+    }
+    m_batchTexture = 0;
+    m_batchSrc.resize(0);
+    m_batchDst.resize(0);
+}
+
 void MythOpenGLPainter::DrawImage(const QRect &r, MythImage *im,
                                   const QRect &src, int alpha)
 {
+    if (!realRender)
+        return;
 
-    if (realRender)
-        realRender->DrawBitmap(GetTextureFromCache(im), target,
-                               &src, &r, 0, alpha);
+    // queue the quad; anything batched so far with different state goes
+    // out first so the paint order is preserved
+    uint tx_id = GetTextureFromCache(im);
+    if (!tx_id)
+        return;
+
+    if (tx_id != m_batchTexture || alpha != m_batchAlpha)
+        FlushBatch();
+
+    m_batchTexture = tx_id;
+    m_batchAlpha   = alpha;
+    m_batchSrc.append(src);
+    m_batchDst.append(r);
 }
 
 MythImage *MythOpenGLPainter::GetImageFromString(const QString &msg,
@@ -357,12 +386,15 @@ void MythOpenGLPainter::DrawText(const QRect &r, const QString &msg,
 }
 
 void MythOpenGLPainter::DrawRect(const QRect &area,
-                                 bool drawFill, const QColor &fillColor, 
+                                 bool drawFill, const QColor &fillColor,
                                  bool drawLine, int lineWidth, const QColor &lineColor)
 {
     if (realRender)
+    {
+        FlushBatch();
         realRender->DrawRect(area, drawFill, fillColor, drawLine,
                              lineWidth, lineColor);
+    }
 }
 
 void MythOpenGLPainter::DrawRoundRect(const QRect &area, int radius,
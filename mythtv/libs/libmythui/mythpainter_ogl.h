@@ -3,6 +3,7 @@
 
 #include <QMap>
 #include <QMutex>
+#include <QVector>
 #include <QGLWidget>
 
 #include <list>
@@ -41,6 +42,7 @@ class MPUBLIC MythOpenGLPainter : public MythPainter
 
   protected:
     virtual void DeleteFormatImagePriv(MythImage *im);
+    void       FlushBatch(void);
     void       ExpireImages(uint max = 0);
     void       ClearCache(void);
     void       DeleteTextures(void);
@@ -58,6 +60,13 @@ class MPUBLIC MythOpenGLPainter : public MythPainter
     int               target;
     bool              swapControl;
 
+    // consecutive DrawImage calls with the same texture and alpha are
+    // queued here and submitted as one draw
+    uint              m_batchTexture;
+    int               m_batchAlpha;
+    QVector<QRect>    m_batchSrc;
+    QVector<QRect>    m_batchDst;
+
     QMap<MythImage *, uint>    m_ImageIntMap;
     std::list<MythImage *>     m_ImageExpireList;
     QMap<QString, MythImage *> m_StringToImageMap;
@@ -94,17 +94,24 @@ class MythGLShaderObject
 };
 
 #define TEX_OFFSET 8
+
+/// Pixel buffer objects per texture. Rotating through a small ring
+/// (on top of orphaning) keeps the driver from ever making us wait
+/// on a buffer the GPU is still reading from.
+#define TEX_PBO_RING 3
+
 class MythGLTexture
 {
   public:
     MythGLTexture() :
         m_type(GL_TEXTURE_2D), m_data(NULL), m_data_size(0),
         m_data_type(GL_UNSIGNED_BYTE), m_data_fmt(GL_BGRA),
-        m_internal_fmt(GL_RGBA8), m_pbo(0), m_vbo(0),
+        m_internal_fmt(GL_RGBA8), m_pbo_idx(0), m_vbo(0),
         m_filter(GL_LINEAR), m_wrap(GL_CLAMP_TO_EDGE),
         m_size(0,0), m_act_size(0,0)
     {
         memset(&m_vertex_data, 0, sizeof(m_vertex_data));
+        memset(m_pbos, 0, sizeof(m_pbos));
     }
 
     ~MythGLTexture()
@@ -117,7 +124,8 @@ class MythGLTexture
     GLuint  m_data_type;
     GLuint  m_data_fmt;
     GLuint  m_internal_fmt;
-    GLuint  m_pbo;
+    GLuint  m_pbos[TEX_PBO_RING];
+    uint    m_pbo_idx;
     GLuint  m_vbo;
     GLuint  m_filter;
     GLuint  m_wrap;
@@ -349,9 +357,10 @@ void* MythRenderOpenGL::GetTextureBuffer(uint tex, bool create_buffer)
     if (!create_buffer)
         return NULL;
 
-    if (m_textures[tex].m_pbo)
+    if (m_textures[tex].m_pbos[0])
     {
-        m_glBindBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB, m_textures[tex].m_pbo);
+        m_glBindBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB,
+                          m_textures[tex].m_pbos[m_textures[tex].m_pbo_idx]);
         m_glBufferDataARB(GL_PIXEL_UNPACK_BUFFER_ARB,
                              m_textures[tex].m_data_size, NULL, GL_STREAM_DRAW);
         return m_glMapBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB, GL_WRITE_ONLY);
@@ -377,13 +386,15 @@ void MythRenderOpenGL::UpdateTexture(uint tex, void *buf)
 
     QSize size = m_textures[tex].m_act_size;
 
-    if (m_textures[tex].m_pbo)
+    if (m_textures[tex].m_pbos[0])
     {
         m_glUnmapBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB);
         glTexSubImage2D(m_textures[tex].m_type, 0, 0, 0, size.width(),
                         size.height(), m_textures[tex].m_data_fmt,
                         m_textures[tex].m_data_type, 0);
         m_glBindBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB, 0);
+        m_textures[tex].m_pbo_idx =
+            (m_textures[tex].m_pbo_idx + 1) % TEX_PBO_RING;
     }
     else
     {
@@ -452,7 +463,7 @@ uint MythRenderOpenGL::CreateTexture(QSize act_size, bool use_pbo,
         {
             SetTextureFilters(tex, filter, wrap);
             if (use_pbo)
-                m_textures[tex].m_pbo = CreatePBO(tex);
+                CreatePBOs(tex);
             if (kGLHighProfile == m_profile)
                 m_textures[tex].m_vbo = CreateVBO();
         }
@@ -632,8 +643,8 @@ void MythRenderOpenGL::DeleteTexture(uint tex)
     glDeleteTextures(1, &gltex);
     if (m_textures[tex].m_data)
         delete m_textures[tex].m_data;
-    if (m_textures[tex].m_pbo)
-        m_glDeleteBuffersARB(1, &(m_textures[tex].m_pbo));
+    if (m_textures[tex].m_pbos[0])
+        m_glDeleteBuffersARB(TEX_PBO_RING, m_textures[tex].m_pbos);
     if (m_textures[tex].m_vbo)
         m_glDeleteBuffersARB(1, &(m_textures[tex].m_vbo));
     m_textures.remove(tex);
@@ -1000,6 +1011,37 @@ void MythRenderOpenGL::DrawBitmap(uint *textures, uint texture_count,
     doneCurrent();
 }
 
+void MythRenderOpenGL::DrawBitmaps(uint tex, uint count, uint target,
+                                   const QRect *src, const QRect *dst,
+                                   uint prog, int alpha)
+{
+    if (!count || !tex || !m_textures.contains(tex))
+        return;
+
+    if (target && !m_framebuffers.contains(target))
+        target = 0;
+
+    if (count == 1)
+    {
+        DrawBitmap(tex, target, src, dst, prog, alpha);
+        return;
+    }
+
+    makeCurrent();
+    BindFramebuffer(target);
+
+    if (kGLLegacyProfile == m_profile)
+    {
+        DrawBitmapsLegacy(tex, count, src, dst, prog, alpha);
+    }
+    else
+    {
+        DrawBitmapsHigh(tex, count, src, dst, prog, alpha);
+    }
+
+    doneCurrent();
+}
+
 void MythRenderOpenGL::DrawRect(const QRect &area, bool drawFill,
                                 const QColor &fillColor,  bool drawLine,
                                 int lineWidth, const QColor &lineColor,
@@ -1136,6 +1178,148 @@ void MythRenderOpenGL::DrawBitmapHigh(uint tex, const QRect *src,
     m_glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
 }
 
+void MythRenderOpenGL::DrawBitmapsLegacy(uint tex, uint count,
+                                         const QRect *src, const QRect *dst,
+                                         uint prog, int alpha)
+{
+    if (prog && !m_programs.contains(prog))
+        prog = 0;
+
+    EnableFragmentProgram(prog);
+    SetBlend(true);
+    SetColor(255, 255, 255, alpha);
+
+    // expand each quad into two triangles so the whole batch goes out in
+    // one submission; the strip order is the one UpdateTextureVertices
+    // produces (topleft, bottomleft, topright, bottomright)
+    static const int corner[6] = { 0, 1, 2, 2, 1, 3 };
+    m_batch_verts.resize(count * 12);
+    m_batch_texcs.resize(count * 12);
+    GLfloat *v = m_batch_verts.data();
+    GLfloat *t = m_batch_texcs.data();
+    for (uint i = 0; i < count; i++)
+    {
+        if (!UpdateTextureVertices(tex, &src[i], &dst[i]))
+            return;
+        GLfloat *data = m_textures[tex].m_vertex_data;
+        for (int j = 0; j < 6; j++)
+        {
+            *v++ = data[corner[j] * 2];
+            *v++ = data[corner[j] * 2 + 1];
+            *t++ = data[corner[j] * 2 + TEX_OFFSET];
+            *t++ = data[corner[j] * 2 + 1 + TEX_OFFSET];
+        }
+    }
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    EnableTextures(tex);
+    glBindTexture(m_textures[tex].m_type, tex);
+
+    uint vert_size = count * 12 * sizeof(GLfloat);
+    if (!m_batch_vbo)
+        m_batch_vbo = CreateVBO();
+    if (m_batch_vbo)
+    {
+        // stream the batch through a retained buffer object, orphaning
+        // the old contents so the driver never waits on a prior frame
+        m_glBindBufferARB(GL_ARRAY_BUFFER_ARB, m_batch_vbo);
+        m_glBufferDataARB(GL_ARRAY_BUFFER_ARB, vert_size * 2, NULL,
+                          GL_STREAM_DRAW);
+        void* target = m_glMapBufferARB(GL_ARRAY_BUFFER_ARB, GL_WRITE_ONLY);
+        if (target)
+        {
+            memcpy(target, m_batch_verts.constData(), vert_size);
+            memcpy((char*)target + vert_size,
+                   m_batch_texcs.constData(), vert_size);
+        }
+        m_glUnmapBufferARB(GL_ARRAY_BUFFER_ARB);
+        glVertexPointer(2, GL_FLOAT, 0, (const void*) 0);
+        glTexCoordPointer(2, GL_FLOAT, 0, (const void*)(uintptr_t) vert_size);
+    }
+    else
+    {
+        glVertexPointer(2, GL_FLOAT, 0, m_batch_verts.constData());
+        glTexCoordPointer(2, GL_FLOAT, 0, m_batch_texcs.constData());
+    }
+
+    glDrawArrays(GL_TRIANGLES, 0, count * 6);
+
+    if (m_batch_vbo)
+        m_glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+}
+
+void MythRenderOpenGL::DrawBitmapsHigh(uint tex, uint count,
+                                       const QRect *src, const QRect *dst,
+                                       uint prog, int alpha)
+{
+    if (prog && !m_shader_objects.contains(prog))
+        prog = 0;
+    if (prog == 0)
+        prog = m_shaders[kShaderDefault];
+
+    EnableShaderObject(prog);
+    SetBlend(true);
+
+    EnableTextures(tex);
+    glBindTexture(m_textures[tex].m_type, tex);
+
+    static const int corner[6] = { 0, 1, 2, 2, 1, 3 };
+    m_batch_verts.resize(count * 12);
+    m_batch_texcs.resize(count * 12);
+    GLfloat *v = m_batch_verts.data();
+    GLfloat *t = m_batch_texcs.data();
+    for (uint i = 0; i < count; i++)
+    {
+        if (!UpdateTextureVertices(tex, &src[i], &dst[i]))
+            return;
+        GLfloat *data = m_textures[tex].m_vertex_data;
+        for (int j = 0; j < 6; j++)
+        {
+            *v++ = data[corner[j] * 2];
+            *v++ = data[corner[j] * 2 + 1];
+            *t++ = data[corner[j] * 2 + TEX_OFFSET];
+            *t++ = data[corner[j] * 2 + 1 + TEX_OFFSET];
+        }
+    }
+
+    // the high profile always has buffer objects - it is a requirement
+    // of the profile
+    uint vert_size = count * 12 * sizeof(GLfloat);
+    if (!m_batch_vbo)
+        m_batch_vbo = CreateVBO();
+    m_glBindBufferARB(GL_ARRAY_BUFFER_ARB, m_batch_vbo);
+    m_glBufferDataARB(GL_ARRAY_BUFFER_ARB, vert_size * 2, NULL,
+                      GL_STREAM_DRAW);
+    void* target = m_glMapBufferARB(GL_ARRAY_BUFFER_ARB, GL_WRITE_ONLY);
+    if (target)
+    {
+        memcpy(target, m_batch_verts.constData(), vert_size);
+        memcpy((char*)target + vert_size,
+               m_batch_texcs.constData(), vert_size);
+    }
+    m_glUnmapBufferARB(GL_ARRAY_BUFFER_ARB);
+
+    m_glEnableVertexAttribArray(VERTEX_INDEX);
+    m_glEnableVertexAttribArray(TEXTURE_INDEX);
+
+    m_glVertexAttribPointer(VERTEX_INDEX, VERTEX_SIZE, GL_FLOAT, GL_FALSE,
+                            VERTEX_SIZE * sizeof(GLfloat),
+                            (const void *) 0);
+    m_glVertexAttrib4f(COLOR_INDEX, 1.0, 1.0, 1.0, alpha / 255.0);
+    m_glVertexAttribPointer(TEXTURE_INDEX, TEXTURE_SIZE, GL_FLOAT, GL_FALSE,
+                            TEXTURE_SIZE * sizeof(GLfloat),
+                            (const void *)(uintptr_t) vert_size);
+
+    glDrawArrays(GL_TRIANGLES, 0, count * 6);
+
+    m_glDisableVertexAttribArray(TEXTURE_INDEX);
+    m_glDisableVertexAttribArray(VERTEX_INDEX);
+    m_glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
+}
+
 void MythRenderOpenGL::DrawBitmapLegacy(uint *textures, uint texture_count,
                                         const QRectF *src, const QRectF *dst,
                                         uint prog)
@@ -1528,6 +1712,7 @@ void MythRenderOpenGL::Reset(void)
 void MythRenderOpenGL::ResetVars(void)
 {
     m_fence           = 0;
+    m_batch_vbo       = 0;
 
     m_lock            = new QMutex(QMutex::Recursive);
     m_lock_level      = 0;
@@ -1605,13 +1790,13 @@ void MythRenderOpenGL::ResetProcs(void)
     m_glVertexAttrib4f = NULL;
 }
 
-uint MythRenderOpenGL::CreatePBO(uint tex)
+bool MythRenderOpenGL::CreatePBOs(uint tex)
 {
     if (!(m_exts_used & kGLExtPBufObj))
-        return 0;
+        return false;
 
     if (!m_textures.contains(tex))
-        return 0;
+        return false;
 
     m_glBindBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB, 0);
     glTexImage2D(m_textures[tex].m_type, 0, m_textures[tex].m_internal_fmt,
@@ -1619,12 +1804,12 @@ uint MythRenderOpenGL::CreatePBO(uint tex)
                  m_textures[tex].m_size.height(), 0,
                  m_textures[tex].m_data_fmt, m_textures[tex].m_data_type, NULL);
 
-    GLuint tmp_pbo;
-    m_glGenBuffersARB(1, &tmp_pbo);
+    m_glGenBuffersARB(TEX_PBO_RING, m_textures[tex].m_pbos);
+    m_textures[tex].m_pbo_idx = 0;
     m_glBindBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB, 0);
 
     Flush(true);
-    return tmp_pbo;
+    return true;
 }
 
 uint MythRenderOpenGL::CreateVBO(void)
@@ -1657,6 +1842,12 @@ void MythRenderOpenGL::DeleteOpenGLResources(void)
         m_fence = 0;
     }
 
+    if (m_batch_vbo)
+    {
+        m_glDeleteBuffersARB(1, &m_batch_vbo);
+        m_batch_vbo = 0;
+    }
+
     Flush(false);
 
     ExpireVertices();
@@ -1683,8 +1874,8 @@ void MythRenderOpenGL::DeleteTextures(void)
         glDeleteTextures(1, &(it.key()));
         if (it.value().m_data)
             delete it.value().m_data;
-        if (it.value().m_pbo)
-            m_glDeleteBuffersARB(1, &(it.value().m_pbo));
+        if (it.value().m_pbos[0])
+            m_glDeleteBuffersARB(TEX_PBO_RING, it.value().m_pbos);
     }
     m_textures.clear();
     Flush(true);
@@ -127,6 +127,9 @@ class MPUBLIC MythRenderOpenGL : public QGLContext, public MythRender
                     int blue = 255);
     void DrawBitmap(uint *textures, uint texture_count, uint target,
                     const QRectF *src, const QRectF *dst, uint prog);
+    void DrawBitmaps(uint tex, uint count, uint target,
+                     const QRect *src, const QRect *dst,
+                     uint prog, int alpha = 255);
     void DrawRect(const QRect &area, bool drawFill,
                   const QColor &fillColor, bool drawLine,
                   int lineWidth, const QColor &lineColor,
@@ -145,6 +148,12 @@ class MPUBLIC MythRenderOpenGL : public QGLContext, public MythRender
                           const QRectF *src, const QRectF *dst, uint prog);
     void DrawBitmapHigh(uint *textures, uint texture_count,
                         const QRectF *src, const QRectF *dst, uint prog);
+    void DrawBitmapsLegacy(uint tex, uint count,
+                           const QRect *src, const QRect *dst,
+                           uint prog, int alpha);
+    void DrawBitmapsHigh(uint tex, uint count,
+                         const QRect *src, const QRect *dst,
+                         uint prog, int alpha);
     void DrawRectLegacy(const QRect &area, bool drawFill,
                         const QColor &fillColor,  bool drawLine,
                         int lineWidth, const QColor &lineColor, int prog);
@@ -160,7 +169,7 @@ class MPUBLIC MythRenderOpenGL : public QGLContext, public MythRender
     void ResetVars(void);
     void ResetProcs(void);
 
-    uint CreatePBO(uint tex);
+    bool CreatePBOs(uint tex);
     uint CreateVBO(void);
     void DeleteOpenGLResources(void);
     void DeleteTextures(void);
@@ -192,6 +201,13 @@ class MPUBLIC MythRenderOpenGL : public QGLContext, public MythRender
     QVector<GLuint>              m_framebuffers;
     GLuint                       m_fence;
 
+    // scratch vertex arrays for DrawBitmaps quad batches and the
+    // retained buffer object they are streamed through, orphaned on
+    // every submission so uploads never stall on in-flight draws
+    QVector<GLfloat>             m_batch_verts;
+    QVector<GLfloat>             m_batch_texcs;
+    GLuint                       m_batch_vbo;
+
     QMutex  *m_lock;
     int      m_lock_level;
 
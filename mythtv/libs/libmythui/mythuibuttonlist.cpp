@@ -144,6 +144,14 @@ void MythUIButtonList::Reset()
 
 void MythUIButtonList::Update()
 {
+    // Bulk population calls this once per item (and again for every
+    // SetText/SetImage on those items).  If a layout pass is already
+    // pending and the redraw has been propagated since the last draw,
+    // there is nothing new to record - skip the walk up the parent
+    // chain so filling a list stays O(N) instead of O(N * depth)
+    if (m_needsUpdate && NeedsRedraw())
+        return;
+
     m_needsUpdate = true;
     SetRedraw();
 }
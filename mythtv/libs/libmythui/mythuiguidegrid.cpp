@@ -10,6 +10,7 @@ using namespace std;
 
 // Qt headers
 #include <QFile>
+#include <QPainter>
 #include <QDomElement>
 
 // myth
@@ -55,6 +56,9 @@ MythUIGuideGrid::MythUIGuideGrid(MythUIType *parent, const QString &name)
     m_rowCount = 0;
     m_progPastCol = 0;
 
+    m_bgImage = NULL;
+    m_bgDirty = true;
+
     m_drawCategoryColors = GetMythDB()->GetNumSetting("EPGShowCategoryColors", 1);
     m_drawCategoryText = true;
     m_categoryAlpha = 255;
@@ -84,6 +88,9 @@ MythUIGuideGrid::~MythUIGuideGrid()
     delete m_font;
     m_font = NULL;
 
+    if (m_bgImage)
+        m_bgImage->DownRef();
+
     for (uint x = 0; x < RECSTATUSSIZE; x++)
     {
         if (m_recImages[x])
@@ -303,22 +310,46 @@ QColor MythUIGuideGrid::calcColor(const QColor &color, int alpha, int alphaMod)
 void MythUIGuideGrid::DrawSelf(MythPainter *p, int xoffset, int yoffset,
                                int alphaMod, QRect clipRect)
 {
+    if (m_bgDirty)
+        updateCachedBackground(p);
+
+    if (m_bgImage)
+        p->DrawImage(m_Area.x(), m_Area.y(), m_bgImage, alphaMod);
+
+    drawCurrent(p, &selectedItem, alphaMod);
+
     for (int i = 0; i < m_rowCount; i++)
     {
         QList<UIGTCon*>::iterator it = allData[i].begin();
         for (; it != allData[i].end(); ++it)
         {
             UIGTCon *data = *it;
-            if (data->recStat == 0)
-                drawBackground(p, data, alphaMod);
-            else if (data->recStat == 1)
-                drawBox(p, data, m_recordingColor, alphaMod);
-            else
-                drawBox(p, data, m_conflictingColor, alphaMod);
+            drawText(p, data, alphaMod);
+
+            if (data->recType != 0 || data->arrow != 0)
+                drawRecType(p, data, alphaMod);
         }
     }
+}
 
-    drawCurrent(p, &selectedItem, alphaMod);
+/**
+ *  Composite the program backgrounds and recording/conflict boxes for
+ *  every cell into m_bgImage.  The result only changes when the guide
+ *  scrolls or the data is refreshed, so DrawSelf can put it up with a
+ *  single image blit instead of a rect draw per cell.  Text and status
+ *  icons stay on the MythPainter path where they are already cached.
+ */
+void MythUIGuideGrid::updateCachedBackground(MythPainter *p)
+{
+    QImage image(m_Area.size(), QImage::Format_ARGB32);
+    image.fill(0);
+
+    QPainter paint;
+    paint.begin(&image);
+
+    // cell rects are kept in screen coordinates so the m_progPastCol
+    // comparisons still work; shift the painter back to widget space
+    paint.translate(-m_Area.x(), -m_Area.y());
 
     for (int i = 0; i < m_rowCount; i++)
     {
@@ -326,12 +357,22 @@ void MythUIGuideGrid::DrawSelf(MythPainter *p, int xoffset, int yoffset,
         for (; it != allData[i].end(); ++it)
         {
             UIGTCon *data = *it;
-            drawText(p, data, alphaMod);
-
-            if (data->recType != 0 || data->arrow != 0)
-                drawRecType(p, data, alphaMod);
+            if (data->recStat == 0)
+                drawBackground(&paint, data);
+            else if (data->recStat == 1)
+                drawBox(&paint, data, m_recordingColor);
+            else
+                drawBox(&paint, data, m_conflictingColor);
         }
     }
+
+    paint.end();
+
+    if (!m_bgImage)
+        m_bgImage = p->GetFormatImage();
+
+    m_bgImage->Assign(image);
+    m_bgDirty = false;
 }
 
 void MythUIGuideGrid::drawCurrent(MythPainter *p, UIGTCon *data, int alphaMod)
@@ -435,18 +476,18 @@ void MythUIGuideGrid::drawRecType(MythPainter *p, UIGTCon *data, int alphaMod)
     }
 }
 
-void MythUIGuideGrid::drawBox(MythPainter *p, UIGTCon *data, const QColor &color, int alphaMod)
+void MythUIGuideGrid::drawBox(QPainter *p, UIGTCon *data, const QColor &color)
 {
     int breakin = 1;
     QRect area = data->drawArea;
     area.translate(m_Area.x(), m_Area.y());
     area.adjust(breakin, breakin, -breakin, -breakin);
 
-    QColor fillColor = calcColor(color, m_categoryAlpha, alphaMod);
-    p->DrawRect(area, true, fillColor, false, 0, QColor());
+    QColor fillColor = calcColor(color, m_categoryAlpha, 255);
+    p->fillRect(area, fillColor);
 }
 
-void MythUIGuideGrid::drawBackground(MythPainter *p, UIGTCon *data, int alphaMod)
+void MythUIGuideGrid::drawBackground(QPainter *p, UIGTCon *data)
 {
     QColor overColor;
     QRect overArea;
@@ -457,9 +498,9 @@ void MythUIGuideGrid::drawBackground(MythPainter *p, UIGTCon *data, int alphaMod
     QColor fillColor;
 
     if (m_drawCategoryColors && data->categoryColor.isValid())
-        fillColor = calcColor(data->categoryColor, m_categoryAlpha, alphaMod);
+        fillColor = calcColor(data->categoryColor, m_categoryAlpha, 255);
     else
-        fillColor = calcColor(m_solidColor, m_categoryAlpha, alphaMod);
+        fillColor = calcColor(m_solidColor, m_categoryAlpha, 255);
 
     if (m_verticalLayout)
     {
@@ -519,9 +560,9 @@ void MythUIGuideGrid::drawBackground(MythPainter *p, UIGTCon *data, int alphaMod
     if (area.height() <= 1)
         area.setHeight(2);
 
-    p->DrawRect(area, true, fillColor, false, 0, QColor());
+    p->fillRect(area, fillColor);
     if (overArea.width() > 0)
-        p->DrawRect(overArea, true, overColor, false, 0, QColor());
+        p->fillRect(overArea, overColor);
 }
 
 void MythUIGuideGrid::drawText(MythPainter *p, UIGTCon *data, int alphaMod)
@@ -575,6 +616,8 @@ void MythUIGuideGrid::SetProgramInfo(int row, int col, const QRect &area,
 
     if (selected)
         selectedItem = *data;
+
+    m_bgDirty = true;
 }
 
 bool MythUIGuideGrid::parseDefaultCategoryColors(QMap<QString, QString> &catColors)
@@ -681,6 +724,8 @@ void MythUIGuideGrid::ResetRow(int row)
         delete allData[row].back();
         allData[row].pop_back();
     }
+
+    m_bgDirty = true;
 }
 
 void MythUIGuideGrid::SetProgPast(int ppast)
@@ -690,5 +735,6 @@ void MythUIGuideGrid::SetProgPast(int ppast)
     else
         m_progPastCol = m_Area.x() + (m_Area.width() * ppast / 100);
 
+    m_bgDirty = true;
     SetRedraw();
 }
@@ -13,7 +13,10 @@
 #define ARROWIMAGESIZE 4
 #define RECSTATUSSIZE  8
 
+class QPainter;
+
 class MythFontProperties;
+class MythImage;
 
 /** \class MythUIGuideGrid
  *
@@ -95,11 +98,12 @@ class MPUBLIC MythUIGuideGrid : public MythUIType
         int recStat;
     };
 
-    void drawBackground(MythPainter *p, UIGTCon *data, int alpaMod);
-    void drawBox(MythPainter *p, UIGTCon *data, const QColor &color, int alpaMod);
+    void drawBackground(QPainter *p, UIGTCon *data);
+    void drawBox(QPainter *p, UIGTCon *data, const QColor &color);
     void drawText(MythPainter *p, UIGTCon *data, int alpaMod);
     void drawRecType(MythPainter *p, UIGTCon *data, int alpaMod);
     void drawCurrent(MythPainter *p, UIGTCon *data, int alpaMod);
+    void updateCachedBackground(MythPainter *p);
 
     QColor calcColor(const QColor &color, int alpha, int alphaMod);
     QColor calcColor(const QColor &color, int alphaMod);
@@ -107,6 +111,13 @@ class MPUBLIC MythUIGuideGrid : public MythUIType
     QList<UIGTCon*> *allData;
     UIGTCon selectedItem;
 
+    // the backgrounds and category boxes only change on a scroll or a
+    // guide data update, so they are composited once into this image
+    // and redrawn as a single blit; only the selection highlight, text
+    // and status icons are painted per draw
+    MythImage *m_bgImage;
+    bool       m_bgDirty;
+
     MythImage *m_recImages[RECSTATUSSIZE];
     MythImage *m_arrowImages[ARROWIMAGESIZE];
 
@@ -33,6 +33,20 @@ class ImageLoadThread;
 #define LOC_WARN QString("MythUIImage(0x%1) Warning: ") \
                      .arg((uintptr_t)this,0,16)
 
+/////////////////////////////////////////////////////////////////
+class MythUIImagePrivate
+{
+  public:
+    MythUIImagePrivate(MythUIImage *p)
+        : m_parent(p),            m_UpdateLock(QReadWriteLock::Recursive)
+          { };
+   ~MythUIImagePrivate() {};
+
+    MythUIImage *m_parent;
+
+    QReadWriteLock m_UpdateLock;
+};
+
 /*!
  * \class ImageLoadEvent
  */
@@ -84,6 +98,15 @@ class ImageLoadThread : public QRunnable
 
     void run()
     {
+        // If the widget has been pointed at another file while we sat in
+        // the thread pool queue (e.g. scrolled past in a list), skip the
+        // decode entirely - customEvent() would only throw the result away
+        m_parent->d->m_UpdateLock.lockForRead();
+        bool stale = (m_parent->m_Filename != m_basefile);
+        m_parent->d->m_UpdateLock.unlock();
+        if (stale)
+            return;
+
         QString tmpFilename;
         if ((m_filename.startsWith("/")) ||
             (m_filename.startsWith("http://")) ||
@@ -117,20 +140,6 @@ class ImageLoadThread : public QRunnable
     ImageCacheMode m_cacheMode;
 };
 
-/////////////////////////////////////////////////////////////////
-class MythUIImagePrivate
-{
-  public:
-    MythUIImagePrivate(MythUIImage *p)
-        : m_parent(p),            m_UpdateLock(QReadWriteLock::Recursive)
-          { };
-   ~MythUIImagePrivate() {};
-
-    MythUIImage *m_parent;
-
-    QReadWriteLock m_UpdateLock;
-};
-
 /////////////////////////////////////////////////////////////////
 
 QHash<QString, MythUIImage*> MythUIImage::m_loadingImages;
@@ -5,6 +5,8 @@
 #include <QtGlobal>
 #include <QDomDocument>
 #include <QFontMetrics>
+#include <QMutex>
+#include <QMutexLocker>
 #include <QString>
 #include <QHash>
 
@@ -540,6 +542,16 @@ void MythUIText::StopCycling(void)
     SetRedraw();
 }
 
+// Recently cut-down strings, shared between all text areas.  Buttons
+// recycled while a list scrolls keep re-setting the same item texts,
+// and each cut-down is a binary search of full layout passes over the
+// string; identical text in an identically sized area with the same
+// font always cuts the same way, so remember the results
+static QMutex gCutdownLock;
+static QHash<QString, QString> gCutdownCache;
+static QList<QString> gCutdownExpireList;
+static const int kMaxCutdownCacheItems = 300;
+
 QString MythUIText::cutDown(const QString &data, MythFontProperties *font,
                             bool multiline)
 {
@@ -549,6 +561,18 @@ QString MythUIText::cutDown(const QString &data, MythFontProperties *font,
 
     int maxwidth = GetArea().width();
     int maxheight = GetArea().height();
+
+    QString key = font->GetHash() + QString::number(maxwidth) +
+                  QString::number(maxheight) +
+                  QString::number(multiline) + data;
+
+    {
+        QMutexLocker locker(&gCutdownLock);
+        QHash<QString, QString>::const_iterator it = gCutdownCache.find(key);
+        if (it != gCutdownCache.end())
+            return it.value();
+    }
+
     int justification = Qt::AlignLeft | Qt::TextWordWrap;
     QFontMetrics fm(font->face());
 
@@ -574,17 +598,24 @@ QString MythUIText::cutDown(const QString &data, MythFontProperties *font,
             margin = (length - 1) - index;
     }
 
+    QString result = data;
     if (index < length - 1)
     {
-        QString tmpStr(data);
-        tmpStr.truncate(index);
+        result.truncate(index);
         if (index >= 3)
-            tmpStr.replace(index - 3, 3, "...");
-        return tmpStr;
+            result.replace(index - 3, 3, "...");
     }
 
-    return data;
+    QMutexLocker locker(&gCutdownLock);
+    if (!gCutdownCache.contains(key))
+    {
+        gCutdownCache.insert(key, result);
+        gCutdownExpireList.append(key);
+        if (gCutdownExpireList.size() > kMaxCutdownCacheItems)
+            gCutdownCache.remove(gCutdownExpireList.takeFirst());
+    }
 
+    return result;
 }
 
 bool MythUIText::ParseElement(
@@ -7,7 +7,11 @@
 
 // QT headers
 #include <QFile>
+#include <QFileInfo>
+#include <QDateTime>
 #include <QDomDocument>
+#include <QHash>
+#include <QMutex>
 #include <QString>
 #include <QBrush>
 #include <QLinearGradient>
@@ -42,6 +46,77 @@
 #define LOC_WARN QString("XMLParseBase, Warning: ")
 #define LOC_ERR  QString("XMLParseBase, Error: ")
 
+/* Parsed theme file cache. Every screen re-loads its window definition
+   when it is created, which used to mean re-reading and re-parsing the
+   same theme files from disk over and over during startup and on every
+   screen change. Parsed documents are kept here for the life of the
+   process, keyed on the full file path and invalidated when the file's
+   modification time changes. Files that are missing or malformed are
+   remembered too, so probing the theme search path doesn't re-stat
+   them for every window. */
+
+struct ParsedDocument
+{
+    QDomDocument doc;
+    QDateTime    mtime;
+    bool         valid;
+};
+
+static QHash<QString, ParsedDocument> parsedCache;
+static QMutex                         parsedCacheLock;
+
+static bool GetParsedDocument(const QString &filename, QDomDocument &doc)
+{
+    QMutexLocker locker(&parsedCacheLock);
+
+    QFileInfo fi(filename);
+    QDateTime mtime = fi.lastModified(); // null when the file is missing
+
+    QHash<QString, ParsedDocument>::iterator it = parsedCache.find(filename);
+    if (it != parsedCache.end() && it.value().mtime == mtime)
+    {
+        if (!it.value().valid)
+            return false;
+        doc = it.value().doc;
+        return true;
+    }
+
+    ParsedDocument entry;
+    entry.mtime = mtime;
+    entry.valid = false;
+
+    QFile f(filename);
+    if (fi.exists() && f.open(QIODevice::ReadOnly))
+    {
+        QString errorMsg;
+        int errorLine = 0;
+        int errorColumn = 0;
+
+        if (entry.doc.setContent(&f, false, &errorMsg,
+                                 &errorLine, &errorColumn))
+        {
+            entry.valid = true;
+        }
+        else
+        {
+            VERBOSE(VB_IMPORTANT, LOC_ERR +
+                    QString("Location: '%1' @ %2 column: %3"
+                            "\n\t\t\tError: %4")
+                    .arg(qPrintable(filename)).arg(errorLine).arg(errorColumn)
+                    .arg(qPrintable(errorMsg)));
+        }
+        f.close();
+    }
+
+    parsedCache.insert(filename, entry);
+
+    if (!entry.valid)
+        return false;
+
+    doc = entry.doc;
+    return true;
+}
+
 void VERBOSE_XML(
     unsigned int verbose_type,
     const QString &filename, const QDomElement &element, QString msg)
@@ -299,6 +374,11 @@ void XMLParseBase::ClearGlobalObjectStore(void)
     delete globalObjectStore;
     globalObjectStore = NULL;
     GetGlobalObjectStore();
+
+    // a theme change invalidates most of the parsed documents anyway,
+    // so drop the lot rather than letting the old theme's files linger
+    QMutexLocker locker(&parsedCacheLock);
+    parsedCache.clear();
 }
 
 void XMLParseBase::ParseChildren(const QString &filename,
@@ -563,28 +643,10 @@ bool XMLParseBase::WindowExists(const QString &xmlfile,
     for (; it != searchpath.end(); ++it)
     {
         QString themefile = *it + xmlfile;
-        QFile f(themefile);
-
-        if (!f.open(QIODevice::ReadOnly))
-            continue;
-
         QDomDocument doc;
-        QString errorMsg;
-        int errorLine = 0;
-        int errorColumn = 0;
 
-        if (!doc.setContent(&f, false, &errorMsg, &errorLine, &errorColumn))
-        {
-            VERBOSE(VB_IMPORTANT, LOC_ERR +
-                    QString("Location: '%1' @ %2 column: %3"
-                            "\n\t\t\tError: %4")
-                    .arg(qPrintable(themefile)).arg(errorLine).arg(errorColumn)
-                    .arg(qPrintable(errorMsg)));
-            f.close();
+        if (!GetParsedDocument(themefile, doc))
             continue;
-        }
-
-        f.close();
 
         QDomElement docElem = doc.documentElement();
         QDomNode n = docElem.firstChild();
@@ -645,28 +707,10 @@ bool XMLParseBase::doLoad(const QString &windowname,
                           bool showWarnings)
 {
     QDomDocument doc;
-    QFile f(filename);
 
-    if (!f.open(QIODevice::ReadOnly))
+    if (!GetParsedDocument(filename, doc))
         return false;
 
-    QString errorMsg;
-    int errorLine = 0;
-    int errorColumn = 0;
-
-    if (!doc.setContent(&f, false, &errorMsg, &errorLine, &errorColumn))
-    {
-        VERBOSE(VB_IMPORTANT, LOC_ERR +
-                QString("Location: '%1' @ %2 column: %3"
-                        "\n\t\t\tError: %4")
-                .arg(qPrintable(filename)).arg(errorLine).arg(errorColumn)
-                .arg(qPrintable(errorMsg)));
-        f.close();
-        return false;
-    }
-
-    f.close();
-
     QDomElement docElem = doc.documentElement();
     QDomNode n = docElem.firstChild();
     while (!n.isNull())
@@ -25,11 +25,49 @@
 
 #include <QTextCodec>
 #include <QTextStream>
+#include <QSet>
 
 #include "upnp.h"
 #include "eventing.h"
 #include "upnptaskevent.h"
 
+// Window during which state-variable changes are coalesced into a
+// single NOTIFY per subscriber.
+
+static const int g_nNotifyWindowMS = 250;
+
+// A flush task can outlive the Eventing extension it points to (the
+// HttpServer destroys its extensions before UPnp::CleanUp shuts the
+// TaskQueue down), so track live instances and check before calling in.
+
+static QMutex           g_eventingLock;
+static QSet<Eventing *> g_eventingInstances;
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// UPnpNotifyFlushTask Implementation
+//
+/////////////////////////////////////////////////////////////////////////////
+
+UPnpNotifyFlushTask::UPnpNotifyFlushTask( Eventing *pEventing )
+{
+    m_pEventing = pEventing;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////
+
+void UPnpNotifyFlushTask::Execute( TaskQueue * /*pQueue*/ )
+{
+    g_eventingLock.lock();
+
+    if (g_eventingInstances.contains( m_pEventing ))
+        m_pEventing->FlushNotifies();
+
+    g_eventingLock.unlock();
+}
+
 /////////////////////////////////////////////////////////////////////////////
 //
 /////////////////////////////////////////////////////////////////////////////
@@ -75,9 +113,14 @@ Eventing::Eventing(const QString &sExtensionName,
     m_nSubscriptionDuration(
         UPnp::g_pConfig->GetValue("UPnP/SubscriptionDuration", 1800)),
     m_nHoldCount(0),
+    m_bFlushPending(false),
     m_pInitializeSubscriber(NULL)
 {
     m_sEventMethodName.detach();
+
+    g_eventingLock.lock();
+    g_eventingInstances.insert( this );
+    g_eventingLock.unlock();
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -86,6 +129,10 @@ Eventing::Eventing(const QString &sExtensionName,
 
 Eventing::~Eventing()
 {
+    g_eventingLock.lock();
+    g_eventingInstances.remove( this );
+    g_eventingLock.unlock();
+
     Subscribers::iterator it = m_Subscribers.begin();
     for (; it != m_Subscribers.end(); ++it)
         delete *it;
@@ -315,12 +362,44 @@ void Eventing::HandleUnsubscribe( HTTPRequest *pRequest )
 /////////////////////////////////////////////////////////////////////////////
 
 void Eventing::Notify()
+{
+    // ----------------------------------------------------------------------
+    // Don't build & send anything yet - schedule a flush a short window
+    // out so further changes are folded into the same NOTIFY.  Only one
+    // flush is outstanding per extension at a time.
+    // ----------------------------------------------------------------------
+
+    m_mutex.lock();
+
+    if (m_bFlushPending)
+    {
+        m_mutex.unlock();
+        return;
+    }
+
+    m_bFlushPending = true;
+    m_mutex.unlock();
+
+    if (UPnp::g_pTaskQueue != NULL)
+        UPnp::g_pTaskQueue->AddTask( g_nNotifyWindowMS,
+                                     new UPnpNotifyFlushTask( this ));
+    else
+        FlushNotifies();
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////
+
+void Eventing::FlushNotifies()
 {
     TaskTime tt;
     gettimeofday( (&tt), NULL );
 
     m_mutex.lock();
 
+    m_bFlushPending = false;
+
     Subscribers::iterator it = m_Subscribers.begin();
     while (it != m_Subscribers.end())
     { 
@@ -31,8 +31,34 @@
 #include "upnpimpl.h"
 #include "upnputil.h"
 #include "httpserver.h"
+#include "taskqueue.h"
 
 class QTextStream;
+class Eventing;
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// UPnpNotifyFlushTask Class Definition
+//
+// Fired a short window after the first state-variable change, so a burst
+// of changes results in a single NOTIFY per subscriber (last-writer-wins
+// per variable) instead of one per change.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class UPNP_PUBLIC UPnpNotifyFlushTask : public Task
+{
+    protected:
+
+        Eventing   *m_pEventing;
+
+    public:
+
+        explicit UPnpNotifyFlushTask( Eventing *pEventing );
+
+        virtual void    Execute( TaskQueue *pQueue );
+        virtual QString Name   () { return( "NotifyFlush" ); }
+};
 
 //////////////////////////////////////////////////////////////////////////////
 //
@@ -277,6 +303,7 @@ class UPNP_PUBLIC  Eventing : public HttpServerExtension,
         int                 m_nSubscriptionDuration;
 
         short               m_nHoldCount;
+        bool                m_bFlushPending;
 
         SubscriberInfo     *m_pInitializeSubscriber;
 
@@ -302,6 +329,8 @@ class UPNP_PUBLIC  Eventing : public HttpServerExtension,
         short    HoldEvents    ( );
         short    ReleaseEvents ( );
 
+        void     FlushNotifies ( );
+
         void     ExecutePostProcess( );
 
 
@@ -494,17 +494,17 @@ qint64 HTTPRequest::SendFile( QFile &file, qint64 llStart, qint64 llBytes )
     while ((sent < llBytes) && !file.atEnd())
     {
         llBytesToRead  = std::min( (qint64)SENDFILE_BUFFER_SIZE, llBytesRemaining );
-        
-        if (( llBytesRead = file.read( aBuffer, llBytesToRead )) != -1 )
-        {
-            if (( llBytesWritten = WriteBlockDirect( aBuffer, llBytesRead )) == -1)
-                return -1;
 
-            // -=>TODO: We don't handle the situation where we read more than was sent.
+        if (( llBytesRead = file.read( aBuffer, llBytesToRead )) == -1 )
+            return -1;
 
-            sent             += llBytesRead;
-            llBytesRemaining -= llBytesRead;
-        }
+        if (( llBytesWritten = WriteBlockDirect( aBuffer, llBytesRead )) == -1)
+            return -1;
+
+        // -=>TODO: We don't handle the situation where we read more than was sent.
+
+        sent             += llBytesRead;
+        llBytesRemaining -= llBytesRead;
     }
 
 #else
@@ -520,24 +520,38 @@ qint64 HTTPRequest::SendFile( QFile &file, qint64 llStart, qint64 llBytes )
                              .arg( strerror( file.error( ) ))); 
         sent = -1; 
     } 
-    else 
-    { 
-        do 
-        { 
-            // SSIZE_MAX should work in kernels 2.6.16 and later. 
-            // The loop is needed in any case. 
-  
-            sent = sendfile64( 
-                getSocketHandle(), fd, &offset, 
-                (size_t) ((llBytes > INT_MAX) ? INT_MAX : llBytes)); 
-  
-            llBytes  -= ( offset - llStart ); 
-            VERBOSE(VB_UPNP, QString("SendResponseFile : --- " 
-            "size = %1, offset = %2, sent = %3") 
-            .arg(llBytes).arg(offset).arg(sent)); 
-        } 
-        while (( sent >= 0 ) && ( llBytes > 0 )); 
-    } 
+    else
+    {
+#if HAVE_POSIX_FADVISE
+        // let the kernel read ahead of the socket instead of on demand
+        posix_fadvise( fd, llStart, llBytes, POSIX_FADV_SEQUENTIAL );
+#endif
+
+        do
+        {
+            // SSIZE_MAX should work in kernels 2.6.16 and later.
+            // The loop is needed in any case.
+
+            __off64_t last = offset;
+
+            sent = sendfile64(
+                getSocketHandle(), fd, &offset,
+                (size_t) ((llBytes > INT_MAX) ? INT_MAX : llBytes));
+
+            if ((sent == -1) && (errno == EINTR))
+            {
+                sent = 0;
+                continue;
+            }
+
+            // offset advances by what was sent this call, not in total
+            llBytes  -= ( offset - last );
+            VERBOSE(VB_UPNP, QString("SendResponseFile : --- "
+            "size = %1, offset = %2, sent = %3")
+            .arg(llBytes).arg(offset).arg(sent));
+        }
+        while (( sent >= 0 ) && ( llBytes > 0 ));
+    }
 
 #endif
 
@@ -620,7 +634,7 @@ void HTTPRequest::FormatActionResponse(const NameValues &args)
         m_response << ">";
 
         if (m_bSOAPRequest)
-            m_response << Encode( (*nit).sValue );
+            Encode( m_response, (*nit).sValue );
         else
             m_response << (*nit).sValue;
 
@@ -1331,6 +1345,47 @@ QString HTTPRequest::Encode(const QString &sIn)
     return sStr;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////
+
+// Streaming version - escapes sIn into os in a single pass, without
+// building intermediate copies of the (potentially very large) input.
+
+void HTTPRequest::Encode( QTextStream &os, const QString &sIn )
+{
+    int nSize = sIn.size();
+    int nLast = 0;
+
+    for (int nIdx = 0; nIdx < nSize; nIdx++)
+    {
+        const char *pszEntity = NULL;
+
+        switch( sIn[ nIdx ].unicode() )
+        {
+            case '&' : pszEntity = "&amp;" ; break;
+            case '<' : pszEntity = "&lt;"  ; break;
+            case '>' : pszEntity = "&gt;"  ; break;
+            case '"' : pszEntity = "&quot;"; break;
+            case '\'': pszEntity = "&apos;"; break;
+        }
+
+        if (pszEntity != NULL)
+        {
+            if (nIdx > nLast)
+                os << sIn.mid( nLast, nIdx - nLast );
+
+            os << pszEntity;
+            nLast = nIdx + 1;
+        }
+    }
+
+    if (nLast == 0)
+        os << sIn;                  // nothing needed escaping
+    else if (nLast < nSize)
+        os << sIn.mid( nLast );
+}
+
 /////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////
 //
@@ -200,6 +200,7 @@ class UPNP_PUBLIC HTTPRequest
         static QString  TestMimeType    ( const QString &sFileName );
         static long     GetParameters   ( QString  sParams, QStringMap &mapParams );
         static QString  Encode          ( const QString &sIn );
+        static void     Encode          ( QTextStream &os, const QString &sIn );
 
         // ------------------------------------------------------------------
 
@@ -57,6 +57,9 @@ HttpServer::HttpServer() : QTcpServer(), ThreadPool("HTTP")
     setMaxPendingConnections(20);
     InitializeThreads();
 
+    m_pIdleMonitor = new HttpIdleConnectionMonitor( this );
+    m_pIdleMonitor->start();
+
     // ----------------------------------------------------------------------
     // Build Platform String
     // ----------------------------------------------------------------------
@@ -92,6 +95,11 @@ HttpServer::HttpServer() : QTcpServer(), ThreadPool("HTTP")
 
 HttpServer::~HttpServer()
 {
+    m_pIdleMonitor->RequestTerminate();
+    m_pIdleMonitor->wait();
+    delete m_pIdleMonitor;
+    m_pIdleMonitor = NULL;
+
     while (!m_extensions.empty())
     {
         delete m_extensions.back();
@@ -182,10 +190,176 @@ void HttpServer::DelegateRequest( HttpWorkerThread *pThread, HTTPRequest *pReque
     if (!bProcessed)
     {
         pRequest->m_eResponseType   = ResponseTypeHTML;
-        pRequest->m_nResponseStatus = 404; 
+        pRequest->m_nResponseStatus = 404;
     }
 }
 
+/////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////
+
+void HttpServer::ParkConnection( BufferedSocketDevice *pSocket,
+                                 int                   nTimeoutMS )
+{
+    m_pIdleMonitor->Watch( pSocket, nTimeoutMS );
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////
+
+void HttpServer::DispatchConnection( BufferedSocketDevice *pSocket )
+{
+    HttpWorkerThread *pThread = (HttpWorkerThread *)GetWorkerThread();
+
+    if (pThread != NULL)
+        pThread->StartWork( pSocket );
+    else
+    {
+        // thread pool exhausted... drop the connection.
+        pSocket->Close();
+        delete pSocket;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////
+//
+// HttpIdleConnectionMonitor Class Implementation
+//
+/////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////
+
+HttpIdleConnectionMonitor::HttpIdleConnectionMonitor( HttpServer *pParent ) :
+    QThread(), m_pHttpServer( pParent ), m_bTermRequested( false )
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////
+
+HttpIdleConnectionMonitor::~HttpIdleConnectionMonitor()
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////
+
+void HttpIdleConnectionMonitor::Watch( BufferedSocketDevice *pSocket,
+                                       int                   nTimeoutMS )
+{
+    HttpIdleConnection conn;
+
+    conn.pSocket = pSocket;
+
+    gettimeofday( &conn.ttExpires, NULL );
+    AddMicroSecToTaskTime( conn.ttExpires, nTimeoutMS * 1000 );
+
+    m_mutex.lock();
+    m_connections.append( conn );
+    m_mutex.unlock();
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////
+
+void HttpIdleConnectionMonitor::RequestTerminate( void )
+{
+    m_bTermRequested = true;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////
+
+void HttpIdleConnectionMonitor::run()
+{
+    fd_set          read_set;
+    struct timeval  timeout;
+
+    while ( ! m_bTermRequested )
+    {
+        int nMaxSocket = 0;
+
+        FD_ZERO( &read_set );
+
+        m_mutex.lock();
+
+        HttpIdleConnectionList::iterator it = m_connections.begin();
+        for (; it != m_connections.end(); ++it )
+        {
+            FD_SET( (*it).pSocket->socket(), &read_set );
+            nMaxSocket = max( (*it).pSocket->socket(), nMaxSocket );
+        }
+
+        m_mutex.unlock();
+
+        timeout.tv_sec  = 1;
+        timeout.tv_usec = 0;
+
+        if ( select( nMaxSocket + 1, &read_set, NULL, NULL, &timeout ) == -1)
+            FD_ZERO( &read_set );
+
+        TaskTime ttNow;
+        gettimeofday( &ttNow, NULL );
+
+        // ------------------------------------------------------------------
+        // Hand connections with a request waiting back to a worker thread
+        // and close the ones whose keep-alive time has expired.  Sockets
+        // parked after the fd_set was built are picked up next pass.
+        // ------------------------------------------------------------------
+
+        QList<BufferedSocketDevice*> ready;
+
+        m_mutex.lock();
+
+        it = m_connections.begin();
+        while (it != m_connections.end())
+        {
+            BufferedSocketDevice *pSocket = (*it).pSocket;
+
+            if (FD_ISSET( pSocket->socket(), &read_set ))
+            {
+                ready.append( pSocket );
+                it = m_connections.erase( it );
+            }
+            else if ( !pSocket->IsValid() || ((*it).ttExpires < ttNow) )
+            {
+                pSocket->Close();
+                delete pSocket;
+                it = m_connections.erase( it );
+            }
+            else
+                ++it;
+        }
+
+        m_mutex.unlock();
+
+        // dispatching can block waiting for a worker thread, so it is
+        // done without holding the connection list mutex.
+        for (int nIdx = 0; nIdx < ready.size(); nIdx++ )
+            m_pHttpServer->DispatchConnection( ready[ nIdx ] );
+    }
+
+    // ----------------------------------------------------------------------
+    // Close any connections still parked at shutdown.
+    // ----------------------------------------------------------------------
+
+    m_mutex.lock();
+
+    while (!m_connections.empty())
+    {
+        m_connections.front().pSocket->Close();
+        delete m_connections.front().pSocket;
+        m_connections.pop_front();
+    }
+
+    m_mutex.unlock();
+}
+
 /////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////
 //
@@ -202,11 +376,12 @@ HttpWorkerThread::HttpWorkerThread( HttpServer *pParent, const QString &sName )
                   WorkerThread( (ThreadPool *)pParent, sName )
 {
     m_pHttpServer    = pParent;
-    m_nSocket        = 0;                                                  
+    m_nSocket        = 0;
     m_nSocketTimeout = UPnp::g_pConfig->GetValue( "HTTP/KeepAliveTimeoutSecs", 10 ) * 1000;
 
+    m_pSocket        = NULL;
     m_pData          = NULL;
-}                  
+}
 
 /////////////////////////////////////////////////////////////////////////////
 //
@@ -248,6 +423,21 @@ void HttpWorkerThread::StartWork( int nSocket )
 //
 /////////////////////////////////////////////////////////////////////////////
 
+void HttpWorkerThread::StartWork( BufferedSocketDevice *pSocket )
+{
+    // Takes over a keep-alive connection handed back by the idle
+    // connection monitor.
+
+    m_pSocket = pSocket;
+    m_nSocket = pSocket->socket();
+
+    SignalWork();
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////
+
 void  HttpWorkerThread::ProcessWork()
 {
 //    VERBOSE( VB_UPNP, QString( "HttpWorkerThread::ProcessWork:Begin( %1 ) socket=%2" )
@@ -261,7 +451,13 @@ void  HttpWorkerThread::ProcessWork()
 
     try
     {
-        if ((pSocket = new BufferedSocketDevice( m_nSocket )) == NULL)
+        if (m_pSocket != NULL)
+        {
+            // keep-alive connection handed back by the idle monitor
+            pSocket   = m_pSocket;
+            m_pSocket = NULL;
+        }
+        else if ((pSocket = new BufferedSocketDevice( m_nSocket )) == NULL)
         {
             VERBOSE( VB_IMPORTANT, QString( "HttpWorkerThread::ProcessWork - Error Creating BufferedSocketDevice" ));
             return;
@@ -336,7 +532,22 @@ void  HttpWorkerThread::ProcessWork()
                     delete pRequest;
                     pRequest = NULL;
 
+                    // ----------------------------------------------------------
+                    // Rather than sitting in WaitForMore for the whole
+                    // keep-alive timeout, park the now idle connection
+                    // with the idle connection monitor and return this
+                    // thread to the pool.  The monitor hands the socket
+                    // back to a worker when the next request arrives.
+                    // ----------------------------------------------------------
 
+                    if (bKeepAlive && pSocket->IsValid() &&
+                        (pSocket->BytesAvailable() == 0))
+                    {
+                        m_pHttpServer->ParkConnection( pSocket,
+                                                       m_nSocketTimeout );
+                        pSocket = NULL;
+                        break;
+                    }
                 }
                 else
                 {
@@ -358,9 +569,12 @@ void  HttpWorkerThread::ProcessWork()
     if (pRequest != NULL)
         delete pRequest;
 
-    pSocket->Close();
+    if (pSocket != NULL)
+    {
+        pSocket->Close();
+        delete pSocket;
+    }
 
-    delete pSocket;
     m_nSocket = 0;
 
 //    VERBOSE( VB_UPNP, QString( "HttpWorkerThread::ProcessWork:End( %1 )")
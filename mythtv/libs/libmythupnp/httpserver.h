@@ -36,6 +36,8 @@
 #include <QThread>
 #include <QTcpServer>
 #include <QReadWriteLock>
+#include <QMutex>
+#include <QList>
 
 // MythTV headers
 #include "upnputil.h"
@@ -79,6 +81,52 @@ class UPNP_PUBLIC HttpServerExtension
 
 typedef QList<HttpServerExtension*> HttpServerExtensionList;
 
+/////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////
+//
+// HttpIdleConnectionMonitor Class Definition
+//
+// Parks idle persistent (keep-alive) connections between requests, so
+// that a worker thread is only held while a request is actually being
+// processed.  Without it every open connection pins a thread for the
+// whole keep-alive timeout and the pool bounds the connection count.
+//
+/////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////
+
+typedef struct
+{
+    BufferedSocketDevice *pSocket;
+    TaskTime              ttExpires;
+
+} HttpIdleConnection;
+
+typedef QList<HttpIdleConnection> HttpIdleConnectionList;
+
+class UPNP_PUBLIC HttpIdleConnectionMonitor : public QThread
+{
+    protected:
+
+        HttpServer             *m_pHttpServer;
+
+        QMutex                  m_mutex;
+        HttpIdleConnectionList  m_connections;
+
+        bool                    m_bTermRequested;
+
+    protected:
+
+        virtual void run();
+
+    public:
+
+                 HttpIdleConnectionMonitor( HttpServer *pParent );
+        virtual ~HttpIdleConnectionMonitor();
+
+        void     Watch( BufferedSocketDevice *pSocket, int nTimeoutMS );
+        void     RequestTerminate( void );
+};
+
 /////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////
 //
@@ -96,6 +144,8 @@ class UPNP_PUBLIC HttpServer : public QTcpServer,
         QReadWriteLock          m_rwlock;
         HttpServerExtensionList m_extensions;
 
+        HttpIdleConnectionMonitor *m_pIdleMonitor;
+
         virtual WorkerThread *CreateWorkerThread( ThreadPool *,
                                                   const QString &sName );
         virtual void          incomingConnection     ( int socket );
@@ -116,6 +166,10 @@ class UPNP_PUBLIC HttpServer : public QTcpServer,
         void     DelegateRequest    ( HttpWorkerThread *pThread,
                                       HTTPRequest      *pRequest );
 
+        void     ParkConnection     ( BufferedSocketDevice *pSocket,
+                                      int                   nTimeoutMS );
+        void     DispatchConnection ( BufferedSocketDevice *pSocket );
+
 };
 
 /////////////////////////////////////////////////////////////////////////////
@@ -146,10 +200,13 @@ class UPNP_PUBLIC HttpWorkerThread : public WorkerThread
 {
     protected:
 
-        HttpServer      *m_pHttpServer; 
+        HttpServer      *m_pHttpServer;
         int              m_nSocket;
         int              m_nSocketTimeout;
 
+        /// connection handed back by the idle connection monitor
+        BufferedSocketDevice *m_pSocket;
+
         HttpWorkerData  *m_pData;
 
     protected:
@@ -162,6 +219,7 @@ class UPNP_PUBLIC HttpWorkerThread : public WorkerThread
         virtual ~HttpWorkerThread();
 
         void            StartWork( int nSocket );
+        void            StartWork( BufferedSocketDevice *pSocket );
 
         void            SetWorkerData( HttpWorkerData *pData );
         HttpWorkerData *GetWorkerData( ) { return( m_pData ); }
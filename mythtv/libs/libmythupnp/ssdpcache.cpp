@@ -141,41 +141,32 @@ void SSDPCacheEntries::Remove( const QString &sUSN )
 
 int SSDPCacheEntries::RemoveStale( const TaskTime &ttNow )
 {
-    int          nCount = 0;
-    QStringList  lstKeys;
+    int nCount = 0;
 
     Lock();
 
     // ----------------------------------------------------------------------
-    // Iterate through all USN's and build list of stale entries keys
+    // Iterate through all USN's and erase the stale ones in place.
+    // (Can't call Remove() here, the lock is already held.)
     // ----------------------------------------------------------------------
 
-    EntryMap::iterator it  = m_mapEntries.begin();
-    for (; it != m_mapEntries.end(); ++it)
+    EntryMap::iterator it = m_mapEntries.begin();
+    while (it != m_mapEntries.end())
     {
-        if (*it)
-            continue;
-
-        (*it)->AddRef();
-        
-        if ((*it)->m_ttExpires < ttNow)
-            lstKeys.push_back(it.key());
-
-        (*it)->Release();
+        if (*it == NULL)
+        {
+            it = m_mapEntries.erase(it);
+        }
+        else if ((*it)->m_ttExpires < ttNow)
+        {
+            (*it)->Release();
+            it = m_mapEntries.erase(it);
+            nCount++;
+        }
+        else
+            ++it;
     }
 
-    nCount = lstKeys.count();
-
-    // ----------------------------------------------------------------------
-    // Iterate through list of keys and remove them.
-    // (This avoids issues when removing from a QMap while iterating it)
-    // ----------------------------------------------------------------------
-
-    for ( QStringList::Iterator it = lstKeys.begin();
-                                it != lstKeys.end();
-                              ++it ) 
-        Remove( *it );
-
     Unlock();
 
     return nCount;
@@ -285,7 +276,13 @@ void SSDPCache::Add( const QString &sURI,
     // Get a Pointer to a Entries QDict... (Create if not found)
     // --------------------------------------------------------------
 
-    SSDPCacheEntries *pEntries = Find( sURI );
+    Lock();
+
+    SSDPCacheEntries *pEntries = NULL;
+
+    SSDPCacheEntriesMap::iterator itURI = m_cache.find( sURI );
+    if (itURI != m_cache.end())
+        pEntries = *itURI;
 
     if (pEntries == NULL)
     {
@@ -296,6 +293,8 @@ void SSDPCache::Add( const QString &sURI,
 
     pEntries->AddRef();
 
+    Unlock();
+
     // --------------------------------------------------------------
     // See if the Entries Collection contains our USN... (Create if not found)
     // --------------------------------------------------------------
@@ -306,9 +305,7 @@ void SSDPCache::Add( const QString &sURI,
     {
         pEntry = new DeviceLocation( sURI, sUSN, sLocation, ttExpires );
 
-        Lock();
         pEntries->Insert( sUSN, pEntry );
-        Unlock();
 
         NotifyAdd( sURI, sUSN, sLocation );
     }
@@ -371,61 +368,46 @@ void SSDPCache::Remove( const QString &sURI, const QString &sUSN )
 
 int SSDPCache::RemoveStale()
 {
-    int          nCount = 0;
-    TaskTime     ttNow;
-    QStringList  lstKeys;
+    int       nCount = 0;
+    TaskTime  ttNow;
 
     gettimeofday( (&ttNow), NULL );
 
     Lock();
 
     // ----------------------------------------------------------------------
-    // Iterate through all Type URI's and build list of stale entries keys
+    // Iterate through all Type URI's, expire their entries and erase the
+    // collections that end up empty.
     // ----------------------------------------------------------------------
 
-    for (SSDPCacheEntriesMap::Iterator it  = m_cache.begin();
-                                       it != m_cache.end();
-                                     ++it )
+    SSDPCacheEntriesMap::iterator it = m_cache.begin();
+    while (it != m_cache.end())
     {
         SSDPCacheEntries *pEntries = *it;
 
-        if (pEntries != NULL)
+        if (pEntries == NULL)
         {
-            pEntries->AddRef();
-
-            nCount += pEntries->RemoveStale( ttNow );
-     
-            if (pEntries->Count() == 0)
-                lstKeys.append( it.key() );
-
-            pEntries->Release();
+            it = m_cache.erase(it);
+            continue;
         }
-    }
-
-    Unlock();
 
-    nCount = lstKeys.count();
-
-    // ----------------------------------------------------------------------
-    // Iterate through list of keys and remove them.
-    // (This avoids issues when removing from a QMap while iterating it)
-    // ----------------------------------------------------------------------
+        pEntries->AddRef();
 
-    for ( QStringList::Iterator itKey = lstKeys.begin();
-                                itKey != lstKeys.end();
-                              ++itKey ) 
-    {
-        SSDPCacheEntriesMap::iterator it = m_cache.find( *itKey );
-        if (it == m_cache.end())
-            continue;
+        nCount += pEntries->RemoveStale( ttNow );
 
-        if (*it)
+        if (pEntries->Count() == 0)
         {
-            (*it)->Release();
-            m_cache.erase(it);
+            pEntries->Release();    // release the reference the map held
+            it = m_cache.erase(it);
         }
+        else
+            ++it;
+
+        pEntries->Release();
     }
 
+    Unlock();
+
     return nCount;
 }
 
@@ -27,11 +27,11 @@
 #include "mythobservable.h"
 
 #include <QObject>
-#include <QMap>
+#include <QHash>
 
 #include "upnpdevice.h"
 
-typedef QMap< QString, DeviceLocation * > EntryMap;     // Key == Unique Service Name (USN)
+typedef QHash< QString, DeviceLocation * > EntryMap;    // Key == Unique Service Name (USN)
 
 /////////////////////////////////////////////////////////////////////////////
 // QDict Implementation that uses RefCounted pointers
@@ -74,7 +74,7 @@ class SSDPCacheEntries : public RefCounted
         EntryMap       *GetEntryMap() { return &m_mapEntries;  }
 };
 
-typedef QMap< QString, SSDPCacheEntries * > SSDPCacheEntriesMap;   // Key == Service Type URI
+typedef QHash< QString, SSDPCacheEntries * > SSDPCacheEntriesMap;  // Key == Service Type URI
 
 /////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////
@@ -84,7 +84,7 @@ TaskQueue::TaskQueue() : m_bTermRequested( false )
 
 TaskQueue::~TaskQueue()
 {
-    m_bTermRequested = true; 
+    RequestTerminate();
 
     wait();
 
@@ -95,6 +95,18 @@ TaskQueue::~TaskQueue()
 //
 /////////////////////////////////////////////////////////////////////////////
 
+void TaskQueue::RequestTerminate( )
+{
+    m_mutex.lock();
+    m_bTermRequested = true;
+    m_taskAvail.wakeAll();
+    m_mutex.unlock();
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////
+
 void TaskQueue::run( )
 {
     Task *pTask;
@@ -102,13 +114,16 @@ void TaskQueue::run( )
     while ( !m_bTermRequested )
     {
         // ------------------------------------------------------------------
-        // Process Any Tasks that may need to be executed.
+        // Process all Tasks that have come due, not just the first one,
+        // so a batch sharing the same deadline (per-subscription notify
+        // tasks, for example) is drained in a single pass.
         // ------------------------------------------------------------------
 
         TaskTime ttNow;
         gettimeofday( (&ttNow), NULL );
 
-        if ((pTask = GetNextExpiredTask( ttNow )) != NULL)
+        while (!m_bTermRequested &&
+               ((pTask = GetNextExpiredTask( ttNow )) != NULL))
         {
             try
             {
@@ -121,9 +136,34 @@ void TaskQueue::run( )
             }
 
         }
-        // Make sure to throttle our processing.
 
-        msleep( 100 );
+        // ------------------------------------------------------------------
+        // Sleep until the next Task is due or a new one is added, instead
+        // of polling on a fixed interval.
+        // ------------------------------------------------------------------
+
+        m_mutex.lock();
+
+        unsigned long nWaitMS = 10000;
+
+        TaskMap::iterator it = m_mapTasks.begin();
+
+        if (it != m_mapTasks.end())
+        {
+            gettimeofday( (&ttNow), NULL );
+
+            TaskTime ttTask = (*it).first;
+
+            long nDiffMS = (ttTask.tv_sec  - ttNow.tv_sec ) * 1000 +
+                           (ttTask.tv_usec - ttNow.tv_usec) / 1000;
+
+            nWaitMS = (nDiffMS > 0) ? nDiffMS : 0;
+        }
+
+        if ((nWaitMS > 0) && !m_bTermRequested)
+            m_taskAvail.wait( &m_mutex, nWaitMS );
+
+        m_mutex.unlock();
     }
 
 }
@@ -172,9 +212,10 @@ void TaskQueue::AddTask( TaskTime ttKey, Task *pTask )
 
     if (pTask != NULL)
     {
-        m_mutex.lock(); 
+        m_mutex.lock();
         pTask->AddRef();
         m_mapTasks.insert( TaskMap::value_type( ttKey, pTask ));
+        m_taskAvail.wakeAll();
         m_mutex.unlock();
     }
 }
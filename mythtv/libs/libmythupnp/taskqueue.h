@@ -37,6 +37,7 @@
 
 // Qt headers
 #include <QThread>
+#include <QWaitCondition>
 
 // MythTV headers
 #include "upnputil.h"
@@ -92,9 +93,10 @@ class TaskQueue : public QThread
 {
     protected:
 
-        TaskMap     m_mapTasks;
-        QMutex      m_mutex;
-        bool        m_bTermRequested;
+        TaskMap         m_mapTasks;
+        QMutex          m_mutex;
+        QWaitCondition  m_taskAvail;
+        bool            m_bTermRequested;
 
     protected:
 
@@ -292,7 +292,10 @@ void WorkerThread::run( void )
 
 ThreadPool::ThreadPool( const QString &sName )
 {
-    m_sName = sName;
+    m_sName            = sName;
+    m_nDispatchCount   = 0;
+    m_nExhaustedCount  = 0;
+    m_nPeakBusyCount   = 0;
 
     m_nInitialThreadCount = UPnp::g_pConfig->GetValue( "ThreadPool/" + m_sName + "/Initial", 1 );
     m_nMaxThreadCount     = UPnp::g_pConfig->GetValue( "ThreadPool/" + m_sName + "/Max"    , 25 );
@@ -311,6 +314,11 @@ ThreadPool::ThreadPool( const QString &sName )
 
 ThreadPool::~ThreadPool( )
 {
+    VERBOSE(VB_UPNP, QString("ThreadPool:%1: dispatched %2, peak busy %3 "
+                             "of %4 max, exhausted %5 times")
+        .arg(m_sName) .arg(m_nDispatchCount) .arg(m_nPeakBusyCount)
+        .arg(m_nMaxThreadCount) .arg(m_nExhaustedCount) );
+
     // --------------------------------------------------------------
     // Request Termination of all worker threads.
     // --------------------------------------------------------------
@@ -357,50 +365,64 @@ void ThreadPool::InitializeThreads()
 
 WorkerThread *ThreadPool::GetWorkerThread()
 {
-    WorkerThread *pThread     = NULL;
-    long          nThreadCount= 0;
+    WorkerThread *pThread = NULL;
+
+    m_mList.lock();
 
     while (pThread == NULL)
     {
         // --------------------------------------------------------------
         // See if we have a worker thread available.
         // --------------------------------------------------------------
-        
-        m_mList.lock();
+
+        if ( m_lstAvailableThreads.size() > 0)
         {
-            if ( m_lstAvailableThreads.size() > 0)
-            {
-                pThread = m_lstAvailableThreads.front();                
-                m_lstAvailableThreads.pop_front();
-            }
-        
-            nThreadCount = m_lstThreads.size();
+            pThread = m_lstAvailableThreads.front();
+            m_lstAvailableThreads.pop_front();
+
+            break;
         }
-        m_mList.unlock();
 
-        if (pThread == NULL)
+        // --------------------------------------------------------------
+        // Check to see if we need to create a new thread or
+        // wait for one to become available.
+        // --------------------------------------------------------------
+
+        if ( (int)m_lstThreads.size() < m_nMaxThreadCount)
+        {
+            m_mList.unlock();
+            pThread = AddWorkerThread( false, m_nIdleTimeout );
+            m_mList.lock();
+        }
+        else
         {
             // ----------------------------------------------------------
-            // Check to see if we need to create a new thread or 
-            // wait for one to become available.
+            // Wait on the list mutex itself, so a thread returned between
+            // the check above and the wait can't slip past unnoticed.
+            // (Waiting on a private mutex used to allow exactly that,
+            // leaving callers asleep for the full timeout.)
             // ----------------------------------------------------------
-        
-            if ( nThreadCount < m_nMaxThreadCount)
-                pThread = AddWorkerThread( false, m_nIdleTimeout );
-            else
-            {
-                QMutex mutex;
-                mutex.lock();
 
-                if (m_threadAvail.wait( &mutex, 5000 ) == false )
-                {
-                    VERBOSE(VB_IMPORTANT, QString("ThreadPool:%1: thread pool exhausted (max %2 threads)") .arg(m_sName) .arg(m_nMaxThreadCount));
-                    return( NULL );     // timeout exceeded.
-                }
+            m_nExhaustedCount++;
+
+            if (m_threadAvail.wait( &m_mList, 5000 ) == false )
+            {
+                VERBOSE(VB_IMPORTANT, QString("ThreadPool:%1: thread pool exhausted (max %2 threads, %3 times so far)") .arg(m_sName) .arg(m_nMaxThreadCount) .arg(m_nExhaustedCount));
+                m_mList.unlock();
+                return( NULL );     // timeout exceeded.
             }
         }
     }
 
+    m_nDispatchCount++;
+
+    long nBusy = m_lstThreads.size() - m_lstAvailableThreads.size();
+
+    if (nBusy > m_nPeakBusyCount)
+        m_nPeakBusyCount = nBusy;
+
+    m_mList.unlock();
+
     return( pThread );
 }
 
@@ -483,7 +505,9 @@ void ThreadPool::ThreadTerminating ( WorkerThread *pThread )
         WorkerThreadList::iterator it =
             find(m_lstAvailableThreads.begin(),
                  m_lstAvailableThreads.end(), pThread);
-        m_lstAvailableThreads.erase(it);
+
+        if (it != m_lstAvailableThreads.end())
+            m_lstAvailableThreads.erase(it);
 
         // Need to leave in m_lstThreads so that we can
         // delete the ptr in destructor
@@ -491,3 +515,68 @@ void ThreadPool::ThreadTerminating ( WorkerThread *pThread )
     m_mList.unlock();
 }
 
+/////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////
+
+long ThreadPool::GetThreadCount()
+{
+    m_mList.lock();
+    long nCount = m_lstThreads.size();
+    m_mList.unlock();
+
+    return( nCount );
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////
+
+long ThreadPool::GetBusyCount()
+{
+    m_mList.lock();
+    long nCount = m_lstThreads.size() - m_lstAvailableThreads.size();
+    m_mList.unlock();
+
+    return( nCount );
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////
+
+long ThreadPool::GetPeakBusyCount()
+{
+    m_mList.lock();
+    long nCount = m_nPeakBusyCount;
+    m_mList.unlock();
+
+    return( nCount );
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////
+
+long ThreadPool::GetDispatchCount()
+{
+    m_mList.lock();
+    long nCount = m_nDispatchCount;
+    m_mList.unlock();
+
+    return( nCount );
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////
+
+long ThreadPool::GetExhaustedCount()
+{
+    m_mList.lock();
+    long nCount = m_nExhaustedCount;
+    m_mList.unlock();
+
+    return( nCount );
+}
+
@@ -167,6 +167,13 @@ class ThreadPool
         int                         m_nMaxThreadCount;
         long                        m_nIdleTimeout;
 
+        // Pool statistics (protected by m_mList) - used for sizing the
+        // Initial/Max config values against real load.
+
+        long                        m_nDispatchCount;   // threads handed out
+        long                        m_nExhaustedCount;  // waits on a full pool
+        long                        m_nPeakBusyCount;   // most threads busy at once
+
     protected:
 
         void            InitializeThreads();
@@ -185,6 +192,11 @@ class ThreadPool
 
         WorkerThread   *GetWorkerThread();
 
+        long            GetThreadCount   ();
+        long            GetBusyCount     ();
+        long            GetPeakBusyCount ();
+        long            GetDispatchCount ();
+        long            GetExhaustedCount();
 };
 
 
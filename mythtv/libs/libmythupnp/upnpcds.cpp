@@ -23,6 +23,9 @@
 
 #include <cmath>
 
+#include <QTextCodec>
+#include <QTextStream>
+
 #include "upnp.h"
 #include "upnpcds.h"
 #include "upnputil.h"
@@ -46,13 +49,23 @@ void UPnpCDSExtensionResults::Add( CDSObject *pObject )
 
 QString UPnpCDSExtensionResults::GetResultXML(FilterMap &filter)
 {
-    QString sXML;
+    QString     sXML;
+    QTextStream os( &sXML, QIODevice::WriteOnly );
+    os.setCodec(QTextCodec::codecForName("UTF-8"));
+    GetResultXML(os, filter);
+    os << flush;
+    return( sXML );
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////
 
+void UPnpCDSExtensionResults::GetResultXML(QTextStream &os, FilterMap &filter)
+{
     CDSObjects::const_iterator it = m_List.begin();
     for (; it != m_List.end(); ++it)
-        sXML += (*it)->toXml(filter);    
-
-    return sXML;
+        (*it)->toXml(os, filter);
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -295,8 +308,15 @@ void UPnpCDS::HandleBrowse( HTTPRequest *pRequest )
     short          nTotalMatches   = 0;
     short          nUpdateID       = 0;
     QString        sResultXML;
+    QTextStream    os( &sResultXML, QIODevice::WriteOnly );
     FilterMap filter =  (FilterMap) request.m_sFilter.split(',');
 
+    // Build the DIDL-Lite document in a single buffer rather than
+    // concatenating per-object strings.
+
+    os.setCodec(QTextCodec::codecForName("UTF-8"));
+    os << DIDL_LITE_BEGIN;
+
     VERBOSE(VB_UPNP, QString("UPnpCDS::HandleBrowse ObjectID=%1, ContainerId=%2")
                      .arg(request.m_sObjectId)
                      .arg(request.m_sContainerID));
@@ -322,7 +342,7 @@ void UPnpCDS::HandleBrowse( HTTPRequest *pRequest )
 
                 m_root.SetChildCount( m_extensions.count() );
 
-                sResultXML      = m_root.toXml(filter);
+                m_root.toXml(os, filter);
 
                 break;
             }
@@ -367,7 +387,7 @@ void UPnpCDS::HandleBrowse( HTTPRequest *pRequest )
                     {
                         if (pResult->m_eErrorCode == UPnPResult_Success)
                         {
-                            sResultXML  += pResult->GetResultXML(filter);
+                            pResult->GetResultXML(os, filter);
                             nNumberReturned ++;
                         }
 
@@ -406,13 +426,13 @@ void UPnpCDS::HandleBrowse( HTTPRequest *pRequest )
                 nNumberReturned = pResult->m_List.count();
                 nTotalMatches   = pResult->m_nTotalMatches;
                 nUpdateID       = pResult->m_nUpdateID;
-                sResultXML      = pResult->GetResultXML(filter);
+                pResult->GetResultXML(os, filter);
             }
 
             delete pResult;
         }
     }
-    
+
     // ----------------------------------------------------------------------
     // Output Results of Browse Method
     // ----------------------------------------------------------------------
@@ -421,11 +441,10 @@ void UPnpCDS::HandleBrowse( HTTPRequest *pRequest )
     {
         NameValues list;
 
-        QString sResults = DIDL_LITE_BEGIN;
-        sResults += sResultXML;
-        sResults += DIDL_LITE_END;
+        os << DIDL_LITE_END;
+        os << flush;
 
-        list.push_back(NameValue("Result",         sResults));
+        list.push_back(NameValue("Result",         sResultXML));
         list.push_back(NameValue("NumberReturned", nNumberReturned));
         list.push_back(NameValue("TotalMatches",   nTotalMatches));
         list.push_back(NameValue("UpdateID",       nUpdateID));
@@ -452,6 +471,10 @@ void UPnpCDS::HandleSearch( HTTPRequest *pRequest )
     short         nTotalMatches   = 0;
     short         nUpdateID       = 0;
     QString       sResultXML;
+    QTextStream   os( &sResultXML, QIODevice::WriteOnly );
+
+    os.setCodec(QTextCodec::codecForName("UTF-8"));
+    os << DIDL_LITE_BEGIN;
 
     DetermineClient( pRequest, &request );
     request.m_sObjectId         = pRequest->m_mapParams[ "ObjectID"      ];
@@ -542,7 +565,7 @@ void UPnpCDS::HandleSearch( HTTPRequest *pRequest )
             nNumberReturned = pResult->m_List.count();
             nTotalMatches   = pResult->m_nTotalMatches;
             nUpdateID       = pResult->m_nUpdateID;
-            sResultXML      = pResult->GetResultXML(filter);
+            pResult->GetResultXML(os, filter);
             //bSearchDone = true;
         }
 
@@ -555,11 +578,11 @@ void UPnpCDS::HandleSearch( HTTPRequest *pRequest )
     if (eErrorCode == UPnPResult_Success)
     {
         NameValues list;
-        QString sResults = DIDL_LITE_BEGIN;
-        sResults += sResultXML;
-        sResults += DIDL_LITE_END;
 
-        list.push_back(NameValue("Result",         sResults));
+        os << DIDL_LITE_END;
+        os << flush;
+
+        list.push_back(NameValue("Result",         sResultXML));
         list.push_back(NameValue("NumberReturned", nNumberReturned));
         list.push_back(NameValue("TotalMatches",   nTotalMatches));
         list.push_back(NameValue("UpdateID",       nUpdateID));
@@ -1172,6 +1195,34 @@ UPnpCDSExtensionResults *UPnpCDSExtension::ProcessContainer( UPnpCDSRequest
 //
 /////////////////////////////////////////////////////////////////////////////
 
+static const int g_nCountCacheSecs = 30;
+
+bool UPnpCDSExtension::GetCachedCount( const QString &sKey, int &nCount )
+{
+    QDateTime ttNow = QDateTime::currentDateTime();
+
+    if (!m_lastCountTime.isValid() ||
+        (m_lastCountTime.secsTo( ttNow ) >= g_nCountCacheSecs))
+    {
+        m_mapCountCache.clear();
+        m_lastCountTime = ttNow;
+        return false;
+    }
+
+    QMap<QString, int>::const_iterator it = m_mapCountCache.find( sKey );
+
+    if (it == m_mapCountCache.end())
+        return false;
+
+    nCount = *it;
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////
+
 int UPnpCDSExtension::GetDistinctCount( UPnpCDSRootInfo *pInfo )
 {
     int nCount = 0;
@@ -1179,6 +1230,11 @@ int UPnpCDSExtension::GetDistinctCount( UPnpCDSRootInfo *pInfo )
     if ((pInfo == NULL) || (pInfo->column == NULL))
         return 0;
 
+    QString sCacheKey = QString( "distinct:%1" ).arg( pInfo->column );
+
+    if (GetCachedCount( sCacheKey, nCount ))
+        return( nCount );
+
     MSqlQuery query(MSqlQuery::InitCon());
 
     if (query.isConnected())
@@ -1209,6 +1265,8 @@ int UPnpCDSExtension::GetDistinctCount( UPnpCDSRootInfo *pInfo )
         }
     }
 
+    m_mapCountCache[ sCacheKey ] = nCount;
+
     return( nCount );
 }
 
@@ -1220,6 +1278,11 @@ int UPnpCDSExtension::GetCount( const QString &sColumn, const QString &sKey )
 {
     int nCount = 0;
 
+    QString sCacheKey = QString( "%1=%2" ).arg( sColumn ).arg( sKey );
+
+    if (GetCachedCount( sCacheKey, nCount ))
+        return( nCount );
+
     MSqlQuery query(MSqlQuery::InitCon());
 
     if (query.isConnected())
@@ -1242,6 +1305,8 @@ int UPnpCDSExtension::GetCount( const QString &sColumn, const QString &sKey )
                                   sSQL + " = " + QString::number(nCount));
     }
 
+    m_mapCountCache[ sCacheKey ] = nCount;
+
     return( nCount );
 }
 
@@ -1281,9 +1346,10 @@ void UPnpCDSExtension::CreateItems( UPnpCDSRequest          *pRequest,
                        .arg( pInfo->column );
         }
 
-        QString sSQL = QString( "%1 %2 LIMIT %3, %4" )
-                          .arg( GetItemListSQL( pInfo->column )  )
+        QString sSQL = QString( "%1 %2 %3 LIMIT %4, %5" )
+                          .arg( GetItemListSQL    ( pInfo->column )  )
                           .arg( sWhere )
+                          .arg( GetItemListOrderBy( pInfo->column )  )
                           .arg( pRequest->m_nStartingIndex  )
                           .arg( pRequest->m_nRequestedCount );
 
@@ -141,6 +141,7 @@ class UPNP_PUBLIC UPnpCDSExtensionResults
 
         void    Add         ( CDSObject *pObject );
         QString GetResultXML(FilterMap &filter);
+        void    GetResultXML(QTextStream &os, FilterMap &filter);
 };
 
 //////////////////////////////////////////////////////////////////////////////
@@ -164,6 +165,14 @@ class UPNP_PUBLIC UPnpCDSExtension
 
     protected:
 
+        // Cached Browse counts.  A control point paging through a large
+        // container issues one Browse request per page, and re-counting
+        // the table each time is wasted work.  Entries expire after a
+        // few seconds so new recordings still show up promptly.
+
+        QMap<QString, int>  m_mapCountCache;
+        QDateTime           m_lastCountTime;
+
         QString RemoveToken ( const QString &sToken, const QString &sStr, int num );
 
         virtual UPnpCDSExtensionResults *ProcessRoot     ( UPnpCDSRequest          *pRequest, 
@@ -197,6 +206,14 @@ class UPNP_PUBLIC UPnpCDSExtension
         virtual int  GetDistinctCount      ( UPnpCDSRootInfo *pInfo );
         virtual int  GetCount              ( const QString &sColumn, const QString &sKey );
 
+        /// Order clause appended to the item list query.  LIMIT paging is
+        /// only stable with a deterministic order, so extensions should
+        /// override this when they support paged Browse requests.
+        virtual QString GetItemListOrderBy ( QString /*sColumn*/ = "" )
+                            { return( "" ); }
+
+        bool         GetCachedCount        ( const QString &sKey, int &nCount );
+
         // ------------------------------------------------------------------
 
         virtual UPnpCDSRootInfo *GetRootInfo   ( int nIdx) = 0;
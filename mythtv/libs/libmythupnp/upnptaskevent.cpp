@@ -23,6 +23,12 @@
 
 #include "upnptaskevent.h"
 
+// How long to wait for a subscriber to accept the connection.  The
+// task queue thread is shared, so a dead renderer must not hold it for
+// the kernel's full connect timeout.
+
+static const int g_nConnectTimeoutMS = 3000;
+
 /////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////
 //
@@ -66,10 +72,36 @@ void UPnpEventTask::Execute( TaskQueue * /*pQueue*/ )
     MSocketDevice        *pSockDev = new MSocketDevice( MSocketDevice::Stream );
     BufferedSocketDevice *pSock    = new BufferedSocketDevice( pSockDev );
 
-    pSockDev->setBlocking( true );
+    // ----------------------------------------------------------------------
+    // Start the connect while the socket is still non-blocking, then wait
+    // for it to complete with a bounded timeout.  Re-issuing the connect
+    // afterwards picks up the result (EISCONN on success).
+    // ----------------------------------------------------------------------
+
+    bool bConnected = pSock->Connect( m_PeerAddress, m_nPeerPort );
 
-    if (pSock->Connect( m_PeerAddress, m_nPeerPort ))
+    if (bConnected)
     {
+        fd_set          wfds;
+        struct timeval  tv;
+        int             nFd = pSockDev->socket();
+
+        FD_ZERO( &wfds );
+        FD_SET( nFd, &wfds );
+
+        tv.tv_sec  =  g_nConnectTimeoutMS / 1000;
+        tv.tv_usec = (g_nConnectTimeoutMS % 1000) * 1000;
+
+        if (select( nFd + 1, NULL, &wfds, NULL, &tv ) > 0)
+            bConnected = pSock->Connect( m_PeerAddress, m_nPeerPort );
+        else
+            bConnected = false;
+    }
+
+    if (bConnected)
+    {
+        pSockDev->setBlocking( true );
+
         // ------------------------------------------------------------------
         // Send NOTIFY message
         // ------------------------------------------------------------------
@@ -38,6 +38,7 @@ using namespace std;
 #include "backendutil.h"
 #include "mainserver.h"
 #include "compat.h"
+#include "mythprofile.h"
 
 #define LOC     QString("AutoExpire: ")
 #define LOC_ERR QString("AutoExpire Error: ")
@@ -88,6 +89,7 @@ void AutoExpire::Init(void)
 
     desired_freq       = 15;
     update_pending     = false;
+    candidates_loaded  = false;
 }
 
 /** \fn AutoExpire::~AutoExpire()
@@ -104,11 +106,16 @@ AutoExpire::~AutoExpire()
     {
         gCoreContext->removeListener(this);
         expire_thread_running = false;
+        expire_wait_lock.lock();
+        expire_wait.wakeAll();
+        expire_wait_lock.unlock();
         pthread_kill(expire_thread, SIGALRM); // try to speed up join..
         VERBOSE(VB_IMPORTANT, LOC + "Warning: Stopping auto expire thread "
                 "can take several seconds. Please be patient.");
         pthread_join(expire_thread, NULL);
     }
+
+    ClearExpireCandidates();
 }
 
 /**
@@ -278,6 +285,7 @@ void AutoExpire::RunExpirer(void)
 
     while (expire_thread_running)
     {
+        MYTH_PROFILE_COUNT("wakeups_autoexpire", 1);
         curTime = QDateTime::currentDateTime();
         // recalculate auto expire parameters
         if (curTime >= next_expire)
@@ -300,6 +308,8 @@ void AutoExpire::RunExpirer(void)
             next_expire =
                 QDateTime::currentDateTime().addSecs(desired_freq * 60);
 
+            LoadExpireCandidates();
+
             ExpireLiveTV(emNormalLiveTVPrograms);
 
             if (gCoreContext->GetNumSetting("DeletedMaxAge", 0))
@@ -308,6 +318,8 @@ void AutoExpire::RunExpirer(void)
             ExpireEpisodesOverMax();
 
             ExpireRecordings();
+
+            ClearExpireCandidates();
         }
 
         instance_lock.unlock();
@@ -317,17 +329,23 @@ void AutoExpire::RunExpirer(void)
 }
 
 /** \fn AutoExpire::Sleep(int sleepTime)
- *  \brief Sleeps for sleepTime minutes; unless the expire thread
- *         is told to quit, then stops sleeping within 5 seconds.
+ *  \brief Sleeps for sleepTime seconds; wakes up early if the
+ *         expire thread is told to quit.
  */
 void AutoExpire::Sleep(int sleepTime)
 {
-    int minSleep = 5, timeExpended = 0;
-    while (expire_thread_running && timeExpended < sleepTime)
+    if (sleepTime <= 0)
+        return;
+
+    QDateTime sleepTill = QDateTime::currentDateTime().addSecs(sleepTime);
+
+    QMutexLocker locker(&expire_wait_lock);
+    while (expire_thread_running)
     {
-        if (timeExpended > (sleepTime - minSleep))
-            minSleep = sleepTime - timeExpended;
-        timeExpended += minSleep - (int)sleep(minSleep);
+        int sleep_ms = 1000 * QDateTime::currentDateTime().secsTo(sleepTill);
+        if (sleep_ms <= 0)
+            break;
+        expire_wait.wait(&expire_wait_lock, sleep_ms);
     }
 }
 
@@ -627,7 +645,6 @@ void *AutoExpire::ExpirerThread(void *param)
 void AutoExpire::ExpireEpisodesOverMax(void)
 {
     QMap<QString, int> maxEpisodes;
-    QMap<QString, int>::Iterator maxIter;
     QMap<QString, int> episodeParts;
     QString episodeKey;
 
@@ -655,86 +672,88 @@ void AutoExpire::ExpireEpisodesOverMax(void)
 
     VERBOSE(VB_FILE, LOC + "Checking episode count for each recording "
                            "profile using max episodes");
-    for (maxIter = maxEpisodes.begin(); maxIter != maxEpisodes.end(); ++maxIter)
+
+    query.prepare("SELECT recorded.recordid, chanid, starttime, title, "
+                      "progstart, progend, filesize, duplicate "
+                  "FROM recorded "
+                  "INNER JOIN record ON recorded.recordid = record.recordid "
+                  "WHERE maxepisodes > 0 AND preserve = 0 "
+                  "AND recgroup NOT IN ('LiveTV', 'Deleted') "
+                  "ORDER BY recorded.recordid ASC, starttime DESC;");
+
+    if (!query.exec() || !query.isActive())
     {
-        query.prepare("SELECT chanid, starttime, title, progstart, progend, "
-                          "filesize, duplicate "
-                      "FROM recorded "
-                      "WHERE recordid = :RECID AND preserve = 0 "
-                      "AND recgroup NOT IN ('LiveTV', 'Deleted') "
-                      "ORDER BY starttime DESC;");
-        query.bindValue(":RECID", maxIter.key());
-
-        if (!query.exec() || !query.isActive())
+        MythDB::DBError("AutoExpire query failed!", query);
+        return;
+    }
+
+    QString lastRecid;
+    int found = 1;
+    while (query.next())
+    {
+        QString recid = query.value(0).toString();
+        uint chanid = query.value(1).toUInt();
+        QDateTime startts = query.value(2).toDateTime();
+        QString title = query.value(3).toString();
+        QDateTime progstart = query.value(4).toDateTime();
+        QDateTime progend = query.value(5).toDateTime();
+        int duplicate = query.value(7).toInt();
+
+        if (recid != lastRecid)
         {
-            MythDB::DBError("AutoExpire query failed!", query);
-            continue;
+            lastRecid = recid;
+            found = 1;
         }
 
-        VERBOSE(VB_FILE, QString("    Recordid %1 has %2 recordings.")
-                                 .arg(maxIter.key())
-                                 .arg(query.size()));
-        if (query.size() > 0)
+        int maxNewest = maxEpisodes[recid];
+
+        episodeKey = QString("%1_%2_%3")
+                     .arg(chanid)
+                     .arg(progstart.toString(Qt::ISODate))
+                     .arg(progend.toString(Qt::ISODate));
+
+        if ((!IsInDontExpireSet(chanid, startts)) &&
+            (!episodeParts.contains(episodeKey)) &&
+            (found > maxNewest))
         {
-            int found = 1;
-            while (query.next())
+            long long spaceFreed =
+                query.value(6).toLongLong() >> 20;
+            QString msg =
+                QString("Expiring %1 MBytes for %2 at %3 => %4.  Too "
+                        "many episodes, we only want to keep %5.")
+                    .arg(spaceFreed)
+                    .arg(chanid).arg(startts.toString())
+                    .arg(title).arg(maxNewest);
+
+            if (VERBOSE_LEVEL_CHECK(VB_IMPORTANT))
+                VERBOSE(VB_IMPORTANT, msg);
+            else
+                VERBOSE(VB_FILE, QString("    ") +  msg);
+
+            gCoreContext->LogEntry("autoexpire", LP_NOTICE,
+                               "Expired program", msg);
+
+            msg = QString("AUTO_EXPIRE %1 %2")
+                          .arg(chanid)
+                          .arg(startts.toString(Qt::ISODate));
+
+            MythEvent me(msg);
+            gCoreContext->dispatch(me);
+        }
+        else
+        {
+            // keep track of shows we haven't expired so we can
+            // make sure we don't expire another part of the same
+            // episode.
+            if (episodeParts.contains(episodeKey))
             {
-                uint chanid = query.value(0).toUInt();
-                QDateTime startts = query.value(1).toDateTime();
-                QString title = query.value(2).toString();
-                QDateTime progstart = query.value(3).toDateTime();
-                QDateTime progend = query.value(4).toDateTime();
-                int duplicate = query.value(6).toInt();
-
-                episodeKey = QString("%1_%2_%3")
-                             .arg(chanid)
-                             .arg(progstart.toString(Qt::ISODate))
-                             .arg(progend.toString(Qt::ISODate));
-
-                if ((!IsInDontExpireSet(chanid, startts)) &&
-                    (!episodeParts.contains(episodeKey)) &&
-                    (found > *maxIter))
-                {
-                    long long spaceFreed =
-                        query.value(5).toLongLong() >> 20;
-                    QString msg =
-                        QString("Expiring %1 MBytes for %2 at %3 => %4.  Too "
-                                "many episodes, we only want to keep %5.")
-                            .arg(spaceFreed)
-                            .arg(chanid).arg(startts.toString())
-                            .arg(title).arg(*maxIter);
-
-                    if (VERBOSE_LEVEL_CHECK(VB_IMPORTANT))
-                        VERBOSE(VB_IMPORTANT, msg);
-                    else
-                        VERBOSE(VB_FILE, QString("    ") +  msg);
-
-                    gCoreContext->LogEntry("autoexpire", LP_NOTICE,
-                                       "Expired program", msg);
-
-                    msg = QString("AUTO_EXPIRE %1 %2")
-                                  .arg(chanid)
-                                  .arg(startts.toString(Qt::ISODate));
-
-                    MythEvent me(msg);
-                    gCoreContext->dispatch(me);
-                }
-                else
-                {
-                    // keep track of shows we haven't expired so we can
-                    // make sure we don't expire another part of the same
-                    // episode.
-                    if (episodeParts.contains(episodeKey))
-                    {
-                        episodeParts[episodeKey] = episodeParts[episodeKey] + 1;
-                    }
-                    else
-                    {
-                        episodeParts[episodeKey] = 1;
-                        if( duplicate )
-                            found++;
-                    }
-                }
+                episodeParts[episodeKey] = episodeParts[episodeKey] + 1;
+            }
+            else
+            {
+                episodeParts[episodeKey] = 1;
+                if( duplicate )
+                    found++;
             }
         }
     }
@@ -768,9 +787,12 @@ void AutoExpire::FillExpireList(pginfolist_t &expireList)
  */
 void AutoExpire::PrintExpireList(QString expHost)
 {
+    QMutexLocker lockit(&instance_lock);
     pginfolist_t expireList;
 
+    LoadExpireCandidates();
     FillExpireList(expireList);
+    ClearExpireCandidates();
 
     QString msg = "MythTV AutoExpire List ";
     if (expHost != "ALL")
@@ -814,6 +836,7 @@ void AutoExpire::GetAllExpiring(QStringList &strList)
     pginfolist_t expireList;
 
     UpdateDontExpireSet();
+    LoadExpireCandidates();
 
     FillDBOrdered(expireList, emShortLiveTVPrograms);
     FillDBOrdered(expireList, emNormalLiveTVPrograms);
@@ -821,6 +844,8 @@ void AutoExpire::GetAllExpiring(QStringList &strList)
     FillDBOrdered(expireList, gCoreContext->GetNumSetting("AutoExpireMethod",
                   emOldestFirst));
 
+    ClearExpireCandidates();
+
     strList << QString::number(expireList.size());
 
     pginfolist_t::iterator it = expireList.begin();
@@ -839,6 +864,7 @@ void AutoExpire::GetAllExpiring(pginfolist_t &list)
     pginfolist_t expireList;
 
     UpdateDontExpireSet();
+    LoadExpireCandidates();
 
     FillDBOrdered(expireList, emShortLiveTVPrograms);
     FillDBOrdered(expireList, emNormalLiveTVPrograms);
@@ -846,6 +872,8 @@ void AutoExpire::GetAllExpiring(pginfolist_t &list)
     FillDBOrdered(expireList, gCoreContext->GetNumSetting("AutoExpireMethod",
                   emOldestFirst));
 
+    ClearExpireCandidates();
+
     pginfolist_t::iterator it = expireList.begin();
     for (; it != expireList.end(); ++it)
         list.push_back( new ProgramInfo( *(*it) ));
@@ -956,11 +984,18 @@ void AutoExpire::FillDBOrdered(pginfolist_t &expireList, int expMethod)
     if (!query.exec())
         return;
 
+    QSet<QString> expire_keys;
+    pginfolist_t::const_iterator eit = expireList.begin();
+    for (; eit != expireList.end(); ++eit)
+        expire_keys.insert((*eit)->MakeUniqueKey());
+
     while (query.next())
     {
         uint chanid = query.value(0).toUInt();
         QDateTime recstartts = query.value(1).toDateTime();
 
+        QString key = ProgramInfo::MakeUniqueKey(chanid, recstartts);
+
         if (IsInDontExpireSet(chanid, recstartts))
         {
             VERBOSE(VB_FILE, LOC + QString(
@@ -968,7 +1003,7 @@ void AutoExpire::FillDBOrdered(pginfolist_t &expireList, int expMethod)
                         "because it is in Don't Expire List")
                     .arg(chanid).arg(recstartts.toString(Qt::ISODate)));
         }
-        else if (IsInExpireList(expireList, chanid, recstartts))
+        else if (expire_keys.contains(key))
         {
             VERBOSE(VB_FILE, LOC + QString(
                         "    Skipping %1 at %2 "
@@ -977,13 +1012,31 @@ void AutoExpire::FillDBOrdered(pginfolist_t &expireList, int expMethod)
         }
         else
         {
-            ProgramInfo *pginfo = new ProgramInfo(chanid, recstartts);
-            if (pginfo->GetChanID())
+            ProgramInfo *pginfo = NULL;
+            if (candidates_loaded)
+            {
+                QMap<QString, ProgramInfo*>::const_iterator cit =
+                    expire_candidates.find(key);
+                if (cit != expire_candidates.end())
+                    pginfo = new ProgramInfo(*(*cit));
+            }
+            else
+            {
+                pginfo = new ProgramInfo(chanid, recstartts);
+                if (!pginfo->GetChanID())
+                {
+                    delete pginfo;
+                    pginfo = NULL;
+                }
+            }
+
+            if (pginfo)
             {
                 VERBOSE(VB_FILE, LOC +
                         QString("    Adding   %1 at %2")
                         .arg(chanid).arg(recstartts.toString(Qt::ISODate)));
                 expireList.push_back(pginfo);
+                expire_keys.insert(key);
             }
             else
             {
@@ -991,12 +1044,52 @@ void AutoExpire::FillDBOrdered(pginfolist_t &expireList, int expMethod)
                             "    Skipping %1 at %2 "
                             "because it could not be loaded from the DB")
                         .arg(chanid).arg(recstartts.toString(Qt::ISODate)));
-                delete pginfo;
             }
         }
     }
 }
 
+/** \fn AutoExpire::LoadExpireCandidates(void)
+ *  \brief Loads every recording an expire pass may consider in a
+ *         single query.
+ *
+ *  While the candidates are loaded FillDBOrdered() copies programs
+ *  out of this cache instead of running one query per recording.
+ */
+void AutoExpire::LoadExpireCandidates(void)
+{
+    ClearExpireCandidates();
+
+    ProgramList progList;
+    if (!LoadFromRecorded(
+            progList,
+            "WHERE (r.autoexpire > 0 OR r.recgroup IN ('LiveTV', 'Deleted')) "
+            "AND r.deletepending = 0 ", MSqlBindings()))
+    {
+        return;
+    }
+
+    while (!progList.empty())
+    {
+        ProgramInfo *pginfo = progList.take(0);
+        expire_candidates[pginfo->MakeUniqueKey()] = pginfo;
+    }
+
+    candidates_loaded = true;
+}
+
+/** \fn AutoExpire::ClearExpireCandidates(void)
+ *  \brief Frees the candidate cache loaded by LoadExpireCandidates().
+ */
+void AutoExpire::ClearExpireCandidates(void)
+{
+    QMap<QString, ProgramInfo*>::iterator it = expire_candidates.begin();
+    for (; it != expire_candidates.end(); ++it)
+        delete *it;
+    expire_candidates.clear();
+    candidates_loaded = false;
+}
+
 /** \fn SpawnUpdateThread(void*)
  *  \brief This is used by Update(QMap<int, EncoderLink*> *, bool)
  *         to run CalcParams(vector<EncoderLink*>).
@@ -1117,20 +1210,4 @@ bool AutoExpire::IsInDontExpireSet(
     return (dont_expire_set.find(key) != dont_expire_set.end());
 }
 
-bool AutoExpire::IsInExpireList(
-    const pginfolist_t &expireList, uint chanid, const QDateTime &recstartts)
-{
-    pginfolist_t::const_iterator it;
-
-    for (it = expireList.begin(); it != expireList.end(); ++it)
-    {
-        if (((*it)->GetChanID()             == chanid) &&
-            ((*it)->GetRecordingStartTime() == recstartts))
-        {
-            return true;
-        }
-    }
-    return false;
-}
-
 /* vim: set expandtab tabstop=4 shiftwidth=4: */
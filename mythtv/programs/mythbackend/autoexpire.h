@@ -78,12 +78,16 @@ class AutoExpire : public QObject
 
     void UpdateDontExpireSet(void);
     bool IsInDontExpireSet(uint chanid, const QDateTime &recstartts) const;
-    static bool IsInExpireList(const pginfolist_t &expireList,
-                               uint chanid, const QDateTime &recstartts);
+
+    void LoadExpireCandidates(void);
+    void ClearExpireCandidates(void);
 
     // main expire info
     QSet<QString> dont_expire_set;
     QSet<QString> deleted_set;
+    // all recordings an expire pass may consider, loaded in one query
+    QMap<QString, ProgramInfo*> expire_candidates;
+    bool          candidates_loaded;
     pthread_t     expire_thread;
     uint          desired_freq;
     bool          expire_thread_running;
@@ -94,6 +98,9 @@ class AutoExpire : public QObject
     QMutex         instance_lock;
     QWaitCondition instance_cond;
 
+    QMutex         expire_wait_lock;
+    QWaitCondition expire_wait;
+
     MainServer *mainServer;
 
     // update info
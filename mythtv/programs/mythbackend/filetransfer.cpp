@@ -1,3 +1,11 @@
+// POSIX headers
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#ifdef __linux__
+#include <sys/sendfile.h>
+#endif
+
 #include <QCoreApplication>
 #include <QDateTime>
 #include <QFileInfo>
@@ -6,17 +14,39 @@
 #include "ringbuffer.h"
 #include "util.h"
 #include "mythsocket.h"
+#include "mythcorecontext.h"
+#include "mythverbose.h"
 #include "programinfo.h"
 
+#define LOC QString("FileTransfer: ")
+
 FileTransfer::FileTransfer(QString &filename, MythSocket *remote,
                            bool usereadahead, int timeout_ms) :
     readthreadlive(true), readsLocked(false),
     rbuffer(RingBuffer::Create(filename, false, usereadahead, timeout_ms)),
     sock(remote), ateof(false), lock(QMutex::NonRecursive),
-    refLock(QMutex::NonRecursive), refCount(0), writemode(false)
+    refLock(QMutex::NonRecursive), refCount(0), writemode(false),
+    localfd(-1)
 {
     pginfo = new ProgramInfo(filename);
     pginfo->MarkAsInUse(true, kFileTransferInUseID);
+
+#ifdef __linux__
+    // For the common case of streaming a plain local file to a
+    // frontend, sendfile() the data straight from the page cache to
+    // the socket instead of copying it through the RingBuffer.
+    if (!filename.startsWith("myth://") && QFileInfo(filename).isFile() &&
+        gCoreContext->GetNumSetting("UseFileTransferSendfile", 1))
+    {
+        QByteArray fname = filename.toLocal8Bit();
+        localfd = open(fname.constData(), O_RDONLY | O_LARGEFILE);
+        if (localfd >= 0)
+        {
+            VERBOSE(VB_FILE, LOC +
+                    QString("Using sendfile for '%1'").arg(filename));
+        }
+    }
+#endif // __linux__
 }
 
 FileTransfer::FileTransfer(QString &filename, MythSocket *remote, bool write) :
@@ -36,6 +66,12 @@ FileTransfer::~FileTransfer()
 {
     Stop();
 
+    if (localfd >= 0)
+    {
+        close(localfd);
+        localfd = -1;
+    }
+
     if (rbuffer)
     {
         delete rbuffer;
@@ -128,6 +164,21 @@ int FileTransfer::RequestBlock(int size)
     while (readsLocked)
         readsUnlockedCond.wait(&lock, 100 /*ms*/);
 
+    if (localfd >= 0)
+    {
+        tot = SendfileBlock(size);
+        if (localfd >= 0 || tot)
+        {
+            if (pginfo)
+                pginfo->UpdateInUseMark();
+            return tot;
+        }
+        // sendfile turned out not to work on this file; the ring
+        // buffer has been positioned where the fd left off, stream
+        // the rest the old way
+        tot = 0;
+    }
+
     requestBuffer.resize(max((size_t)max(size,0) + 128, requestBuffer.size()));
     char *buf = &requestBuffer[0];
     while (tot < size && !rbuffer->GetStopReads() && readthreadlive)
@@ -156,6 +207,65 @@ int FileTransfer::RequestBlock(int size)
     return (ret < 0) ? -1 : tot;
 }
 
+/** \fn FileTransfer::SendfileBlock(int)
+ *  \brief Streams up to 'size' bytes from localfd to the socket with
+ *         sendfile(2), avoiding the copy through userspace.
+ *
+ *   Called with 'lock' held. Returns bytes sent, or -1 on a socket
+ *   error. If sendfile fails outright (e.g. a filesystem it can't
+ *   read from), localfd is closed, the ring buffer is seeked to
+ *   where the fd left off, and the caller is expected to continue
+ *   with buffered reads.
+ */
+int FileTransfer::SendfileBlock(int size)
+{
+#ifndef __linux__
+    (void) size;
+    return -1;
+#else
+    int tot = 0;
+    uint zerocnt = 0;
+
+    while (tot < size && !rbuffer->GetStopReads() && readthreadlive)
+    {
+        ssize_t ret = sendfile(sock->socket(), localfd, NULL, size - tot);
+        if (ret > 0)
+        {
+            tot += ret;
+            zerocnt = 0;
+        }
+        else if (ret == 0)
+        {
+            break; // eof
+        }
+        else if ((EAGAIN == errno) || (EINTR == errno))
+        {
+            zerocnt++;
+            if (zerocnt > 5000)
+            {
+                VERBOSE(VB_IMPORTANT, LOC +
+                        "SendfileBlock: Error, zerocnt timeout");
+                return -1;
+            }
+            usleep(1000);
+        }
+        else
+        {
+            VERBOSE(VB_IMPORTANT, LOC +
+                    "sendfile failed, reverting to buffered reads" + ENO);
+            long long pos = lseek(localfd, 0, SEEK_CUR);
+            close(localfd);
+            localfd = -1;
+            if (pos >= 0)
+                rbuffer->Seek(pos, SEEK_SET);
+            return tot;
+        }
+    }
+
+    return tot;
+#endif // __linux__
+}
+
 int FileTransfer::WriteBlock(int size)
 {
     if (!writemode || !rbuffer)
@@ -203,15 +313,36 @@ long long FileTransfer::Seek(long long curpos, long long pos, int whence)
 
     Pause();
 
-    if (whence == SEEK_CUR)
+    long long ret;
+    if (localfd >= 0)
     {
-        long long desired = curpos + pos;
-        long long realpos = rbuffer->GetReadPosition();
+        if (whence == SEEK_CUR)
+        {
+            long long desired = curpos + pos;
+            long long realpos = lseek(localfd, 0, SEEK_CUR);
+
+            pos = desired - realpos;
+        }
+
+        ret = lseek(localfd, pos, whence);
 
-        pos = desired - realpos;
+        // keep the idle ring buffer in step in case sendfile later
+        // fails and we revert to buffered reads
+        if (ret >= 0)
+            rbuffer->Seek(ret, SEEK_SET);
     }
+    else
+    {
+        if (whence == SEEK_CUR)
+        {
+            long long desired = curpos + pos;
+            long long realpos = rbuffer->GetReadPosition();
 
-    long long ret = rbuffer->Seek(pos, whence);
+            pos = desired - realpos;
+        }
+
+        ret = rbuffer->Seek(pos, whence);
+    }
 
     Unpause();
 
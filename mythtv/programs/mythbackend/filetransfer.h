@@ -52,6 +52,8 @@ class FileTransfer
   private:
    ~FileTransfer();
 
+    int SendfileBlock(int size);
+
     volatile bool  readthreadlive;
     bool           readsLocked;
     QWaitCondition readsUnlockedCond;
@@ -68,6 +70,10 @@ class FileTransfer
     int refCount;
 
     bool writemode;
+
+    /// fd used to sendfile() local files straight to the socket,
+    /// bypassing the RingBuffer copies; -1 when not usable
+    int localfd;
 };
 
 #endif
@@ -27,11 +27,9 @@ using namespace std;
 #include "eitcache.h"
 #include "scheduler.h"
 
-static bool HouseKeeper_filldb_running = false;
-
 HouseKeeper::HouseKeeper(bool runthread, bool master, Scheduler *lsched)
-                        : threadrunning(runthread), filldbRunning(false),
-                          isMaster(master),         sched(lsched)
+                        : threadrunning(runthread), isMaster(master),
+                          sched(lsched)
 {
     CleanupMyOldRecordings();
 
@@ -155,6 +153,69 @@ QDateTime HouseKeeper::getLastRun(const QString &dbTag)
     return lastRun;
 }
 
+/** \fn HouseKeeper::StartTask(const QString&,void (HouseKeeper::*)(void))
+ *  \brief Runs a housekeeping task on its own detached thread.
+ *
+ *  Each task runs independently of the scheduling loop and of the
+ *  other tasks, so a cheap periodic task is never queued behind an
+ *  expensive one.  A task that is still running is not started a
+ *  second time, and its housekeeping lastrun time is only updated
+ *  once it completes.
+ */
+bool HouseKeeper::StartTask(const QString &dbTag,
+                            void (HouseKeeper::*task)(void))
+{
+    QMutexLocker locker(&taskLock);
+
+    if (runningTasks.contains(dbTag))
+    {
+        VERBOSE(VB_GENERAL, QString("HouseKeeper: '%1' is still running, "
+                                    "not starting it again.").arg(dbTag));
+        return false;
+    }
+
+    HouseKeepingTask *hkt = new HouseKeepingTask;
+    hkt->keeper = this;
+    hkt->tag = dbTag;
+    hkt->task = task;
+
+    runningTasks.insert(dbTag);
+
+    pthread_t taskThread;
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    pthread_create(&taskThread, &attr, TaskThread, hkt);
+    pthread_attr_destroy(&attr);
+
+    return true;
+}
+
+bool HouseKeeper::IsTaskRunning(const QString &dbTag)
+{
+    QMutexLocker locker(&taskLock);
+    return runningTasks.contains(dbTag);
+}
+
+void *HouseKeeper::TaskThread(void *param)
+{
+    HouseKeepingTask *hkt = (HouseKeepingTask *)param;
+    HouseKeeper *keeper = hkt->keeper;
+    QString tag = hkt->tag;
+    void (HouseKeeper::*task)(void) = hkt->task;
+    delete hkt;
+
+    (keeper->*task)();
+
+    keeper->updateLastrun(tag);
+
+    keeper->taskLock.lock();
+    keeper->runningTasks.remove(tag);
+    keeper->taskLock.unlock();
+
+    return NULL;
+}
+
 void HouseKeeper::RunHouseKeeping(void)
 {
     int period, maxhr, minhr;
@@ -182,15 +243,14 @@ void HouseKeeper::RunHouseKeeping(void)
                 if (wantToRun("LogClean", period, 0, 24))
                 {
                     VERBOSE(VB_GENERAL, "Running LogClean");
-                    flushLogs();
-                    updateLastrun("LogClean");
+                    StartTask("LogClean", &HouseKeeper::flushLogs);
                 }
             }
 
             // Run mythfilldatabase to grab the TV listings
             if (gCoreContext->GetNumSetting("MythFillEnabled", 1))
             {
-                if (HouseKeeper_filldb_running)
+                if (IsTaskRunning("MythFillDB"))
                 {
                     VERBOSE(VB_GENERAL, "mythfilldatabase still running, "
                                         "skipping checks.");
@@ -251,20 +311,20 @@ void HouseKeeper::RunHouseKeeping(void)
                         QString msg = "Running mythfilldatabase";
                         gCoreContext->LogEntry("mythbackend", LP_DEBUG, msg, "");
                         VERBOSE(VB_GENERAL, msg);
-                        runFillDatabase();
-                        updateLastrun("MythFillDB");
+                        StartTask("MythFillDB", &HouseKeeper::RunMFD);
                     }
                 }
             }
 
-            if (wantToRun("DailyCleanup", 1, 0, 24)) {
-                JobQueue::CleanupOldJobsInQueue();
-                CleanupAllOldInUsePrograms();
-                CleanupOrphanedLivetvChains();
-                CleanupRecordedTables();
-                CleanupProgramListings();
-                updateLastrun("DailyCleanup");
-            }
+            // The recorded table cleanup can churn through millions of
+            // recordedseek rows, so it gets its own task and never holds
+            // up the cheap daily cleanups or a guide data update.
+            if (wantToRun("RecordedCleanup", 1, 0, 24))
+                StartTask("RecordedCleanup",
+                          &HouseKeeper::CleanupRecordedTables);
+
+            if (wantToRun("DailyCleanup", 1, 0, 24))
+                StartTask("DailyCleanup", &HouseKeeper::RunDailyCleanup);
         }
 
         dbTag = QString("JobQueueRecover-%1").arg(gCoreContext->GetHostName());
@@ -313,13 +373,6 @@ void HouseKeeper::flushLogs()
     }
 }
 
-void *HouseKeeper::runMFDThread(void *param)
-{
-    HouseKeeper *keep = static_cast<HouseKeeper *>(param);
-    keep->RunMFD();
-    return NULL;
-}
-
 void HouseKeeper::RunMFD(void)
 {
     QString mfpath = gCoreContext->GetSetting("MythFillDatabasePath",
@@ -367,20 +420,17 @@ void HouseKeeper::RunMFD(void)
         VERBOSE(VB_IMPORTANT, QString("MythFillDatabase command '%1' failed")
                                         .arg(command));
     }
-
-    HouseKeeper_filldb_running = false;
 }
 
-void HouseKeeper::runFillDatabase()
+/** \fn HouseKeeper::RunDailyCleanup(void)
+ *  \brief Bundles the cheap once-a-day database cleanups.
+ */
+void HouseKeeper::RunDailyCleanup(void)
 {
-    if (HouseKeeper_filldb_running)
-        return;
-
-    HouseKeeper_filldb_running = true;
-
-    pthread_t housekeep_thread;
-    pthread_create(&housekeep_thread, NULL, runMFDThread, this);
-    pthread_detach(housekeep_thread);
+    JobQueue::CleanupOldJobsInQueue();
+    CleanupAllOldInUsePrograms();
+    CleanupOrphanedLivetvChains();
+    CleanupProgramListings();
 }
 
 void HouseKeeper::CleanupMyOldRecordings(void)
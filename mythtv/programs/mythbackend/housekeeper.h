@@ -2,31 +2,42 @@
 #define HOUSEKEEPER_H_
 
 #include <QDateTime>
+#include <QString>
+#include <QMutex>
+#include <QSet>
 
 class Scheduler;
-class QString;
 class HouseKeeper
 {
   public:
     HouseKeeper(bool runthread, bool master, Scheduler *lsched = NULL);
    ~HouseKeeper();
 
-    
+
   protected:
     void RunHouseKeeping(void);
     static void *doHouseKeepingThread(void *param);
 
-    void RunMFD(void);
-    static void *runMFDThread(void *param);
-
   private:
+    typedef struct hktaskstruct
+    {
+        HouseKeeper *keeper;
+        QString      tag;
+        void (HouseKeeper::*task)(void);
+    } HouseKeepingTask;
 
     bool wantToRun(const QString &dbTag, int period, int minhour, int maxhour,
                    bool nowIfPossible = false);
     void updateLastrun(const QString &dbTag);
     QDateTime getLastRun(const QString &dbTag);
+
+    bool StartTask(const QString &dbTag, void (HouseKeeper::*task)(void));
+    bool IsTaskRunning(const QString &dbTag);
+    static void *TaskThread(void *param);
+
     void flushLogs();
-    void runFillDatabase();
+    void RunMFD(void);
+    void RunDailyCleanup(void);
     void CleanupMyOldRecordings(void);
     void CleanupAllOldInUsePrograms(void);
     void CleanupOrphanedLivetvChains(void);
@@ -35,9 +46,11 @@ class HouseKeeper
     void RunStartupTasks(void);
 
     bool threadrunning;
-    bool filldbRunning;
     bool isMaster;
 
+    QMutex taskLock;
+    QSet<QString> runningTasks;
+
     Scheduler *sched;
 };
 
@@ -26,6 +26,8 @@
 #include "mythxml.h"
 
 #include "mythcorecontext.h"
+#include "mythevent.h"
+#include "mythprofile.h"
 #include "decodeencode.h"
 #include "mythdbcon.h"
 #include "compat.h"
@@ -53,6 +55,10 @@ HttpStatus::HttpStatus( QMap<int, EncoderLink *> *tvList, Scheduler *sched,
     m_nPreRollSeconds = gCoreContext->GetNumSetting("RecordPreRoll", 0);
 
     m_pMainServer = NULL;
+
+    m_statusDocDirty = true;
+
+    gCoreContext->addListener(this);
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -61,6 +67,7 @@ HttpStatus::HttpStatus( QMap<int, EncoderLink *> *tvList, Scheduler *sched,
 
 HttpStatus::~HttpStatus()
 {
+    gCoreContext->removeListener(this);
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -73,6 +80,8 @@ HttpStatusMethod HttpStatus::GetMethod( const QString &sURI )
     if (sURI == "GetStatusHTML"        ) return( HSM_GetStatusHTML   );
     if (sURI == "GetStatus"            ) return( HSM_GetStatusXML    );
     if (sURI == "xml"                  ) return( HSM_GetStatusXML    );
+    if (sURI == "Metrics"              ) return( HSM_GetMetrics      );
+    if (sURI == "metrics"              ) return( HSM_GetMetrics      );
 
     return( HSM_Unknown );
 }
@@ -95,6 +104,7 @@ bool HttpStatus::ProcessRequest( HttpWorkerThread * /* pThread */,
             {
                 case HSM_GetStatusXML   : GetStatusXML   ( pRequest ); return true;
                 case HSM_GetStatusHTML  : GetStatusHTML  ( pRequest ); return true;
+                case HSM_GetMetrics     : GetMetrics     ( pRequest ); return true;
 
                 default:
                 {
@@ -120,13 +130,110 @@ bool HttpStatus::ProcessRequest( HttpWorkerThread * /* pThread */,
 
 void HttpStatus::GetStatusXML( HTTPRequest *pRequest )
 {
-    QDomDocument doc( "Status" );
+    QMutexLocker locker( &m_statusDocLock );
 
-    FillStatusXML( &doc );
+    RefreshStatusXML();
 
     pRequest->m_eResponseType   = ResponseTypeXML;
     pRequest->m_mapRespHeaders[ "Cache-Control" ] = "no-cache=\"Ext\", max-age = 5000";
-    pRequest->m_response << doc.toString();
+    pRequest->m_response << m_statusDoc.toString();
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////
+
+// number of seconds after which the next request rebuilds the cached
+// status document even without an invalidating event, picking up disk,
+// load, job queue and guide changes
+static const int kStatusDocMaxAgeSecs = 30;
+
+void HttpStatus::RefreshStatusXML( void )
+{
+    QDateTime qdtNow = QDateTime::currentDateTime();
+
+    if (m_statusDocDirty || m_statusDocBuilt.isNull() ||
+        (m_statusDocBuilt.secsTo(qdtNow) >= kStatusDocMaxAgeSecs))
+    {
+        QDomDocument doc( "Status" );
+
+        FillStatusXML( &doc );
+
+        m_statusDoc      = doc;
+        m_statusDocBuilt = qdtNow;
+        m_statusDocDirty = false;
+    }
+    else
+    {
+        // only the timestamps go stale within the refresh window
+        QString dateFormat = gCoreContext->GetSetting("DateFormat",
+                                                      "M/d/yyyy");
+        if (dateFormat.indexOf(QRegExp("yyyy")) < 0)
+            dateFormat += " yyyy";
+
+        QString timeformat = gCoreContext->GetSetting("TimeFormat",
+                                                      "h:mm AP");
+
+        QDomElement root = m_statusDoc.documentElement();
+        root.setAttribute("date"   , qdtNow.toString(dateFormat));
+        root.setAttribute("time"   , qdtNow.toString(timeformat));
+        root.setAttribute("ISODate", qdtNow.toString(Qt::ISODate));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////
+
+void HttpStatus::customEvent( QEvent *event )
+{
+    if ((MythEvent::Type)(event->type()) == MythEvent::MythEventMessage)
+    {
+        MythEvent *me = (MythEvent *)event;
+        QString message = me->Message();
+
+        // Anything changing what the status page shows about encoders
+        // or upcoming recordings invalidates the cached document; disk,
+        // job queue and guide changes ride on the periodic refresh.
+        // The flag is set without the document lock so a rebuild on a
+        // slow filesystem can not stall the main event loop; an event
+        // racing the end of a rebuild is caught by the periodic
+        // refresh at the latest.
+        if ((message == "SCHEDULE_CHANGE") ||
+            message.startsWith("RECORDING_LIST_CHANGE"))
+        {
+            m_statusDocDirty = true;
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////
+
+void HttpStatus::GetMetrics( HTTPRequest *pRequest )
+{
+    pRequest->m_eResponseType     = ResponseTypeOther;
+    pRequest->m_sResponseTypeText = "text/plain";
+    pRequest->m_nResponseStatus   = 200;
+    pRequest->m_mapRespHeaders[ "Cache-Control" ] = "no-cache";
+
+    // Everything below comes from the passively maintained counters
+    // and profile zones in libmythdb; nothing is queried or recomputed
+    // here, so this can be scraped every few seconds without putting
+    // any measurable load on the backend, unlike the full status page.
+
+    QString counters = MythProfileCounter::GetReport();
+    if (!counters.isEmpty())
+        pRequest->m_response << counters << "\n";
+
+    QString zones = MythProfileZone::GetReport();
+    if (!zones.isEmpty())
+    {
+        pRequest->m_response
+            << "# zones: name count total avg min max histogram\n"
+            << zones << "\n";
+    }
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -135,14 +242,14 @@ void HttpStatus::GetStatusXML( HTTPRequest *pRequest )
 
 void HttpStatus::GetStatusHTML( HTTPRequest *pRequest )
 {
-    pRequest->m_eResponseType = ResponseTypeHTML;
-    pRequest->m_mapRespHeaders[ "Cache-Control" ] = "no-cache=\"Ext\", max-age = 5000";
+    QMutexLocker locker( &m_statusDocLock );
 
-    QDomDocument doc( "Status" );
+    RefreshStatusXML();
 
-    FillStatusXML( &doc );
+    pRequest->m_eResponseType = ResponseTypeHTML;
+    pRequest->m_mapRespHeaders[ "Cache-Control" ] = "no-cache=\"Ext\", max-age = 5000";
 
-    PrintStatus( pRequest->m_response, &doc );
+    PrintStatus( pRequest->m_response, &m_statusDoc );
 }
 
 void HttpStatus::FillStatusXML( QDomDocument *pDoc )
@@ -12,8 +12,10 @@
 #define HTTPSTATUS_H_
 
 #include <QDomDocument>
+#include <QDateTime>
 #include <QMutex>
 #include <QMap>
+#include <QObject>
 
 #include "httpserver.h"
 
@@ -21,7 +23,8 @@ typedef enum
 {
     HSM_Unknown         =  0,
     HSM_GetStatusHTML   =  1,
-    HSM_GetStatusXML    =  2
+    HSM_GetStatusXML    =  2,
+    HSM_GetMetrics      =  3
 
 } HttpStatusMethod;
 
@@ -38,8 +41,10 @@ class AutoExpire;
 class EncoderLink;
 class MainServer;
 
-class HttpStatus : public HttpServerExtension
+class HttpStatus : public QObject, public HttpServerExtension
 {
+    Q_OBJECT
+
     private:
 
         Scheduler                   *m_pSched;
@@ -50,14 +55,24 @@ class HttpStatus : public HttpServerExtension
         int                          m_nPreRollSeconds;
         QMutex                       m_settingLock;
 
+        // The status document is cached between requests; events mark
+        // it dirty and a periodic refresh picks up disk, job queue and
+        // guide changes that have no events.
+        QMutex                       m_statusDocLock;
+        QDomDocument                 m_statusDoc;
+        QDateTime                    m_statusDocBuilt;
+        bool                         m_statusDocDirty;
+
     private:
 
         HttpStatusMethod GetMethod( const QString &sURI );
 
         void    GetStatusXML      ( HTTPRequest *pRequest );
         void    GetStatusHTML     ( HTTPRequest *pRequest );
+        void    GetMetrics        ( HTTPRequest *pRequest );
 
         void    FillStatusXML     ( QDomDocument *pDoc);
+        void    RefreshStatusXML  ( void ); // m_statusDocLock must be held
     
         void    PrintStatus       ( QTextStream &os, QDomDocument *pDoc );
         int     PrintEncoderStatus( QTextStream &os, QDomElement encoders );
@@ -76,6 +91,11 @@ class HttpStatus : public HttpServerExtension
 
         bool     ProcessRequest( HttpWorkerThread *pThread,
                                  HTTPRequest *pRequest );
+
+    protected:
+
+        // Receives the events which invalidate the cached document
+        virtual void customEvent( QEvent *event );
 };
 
 #endif
@@ -18,6 +18,9 @@ using namespace std;
 #include <sys/stat.h>
 #ifdef __linux__
 #  include <sys/vfs.h>
+#  ifdef HAVE_LINUX_FALLOC_H
+#    include <linux/falloc.h>
+#  endif
 #else // if !__linux__
 #  include <sys/param.h>
 #  ifndef USING_MINGW
@@ -41,6 +44,7 @@ using namespace std;
 #include "exitcodes.h"
 #include "mythcontext.h"
 #include "mythverbose.h"
+#include "mythprofile.h"
 #include "mythversion.h"
 #include "decodeencode.h"
 #include "mythdb.h"
@@ -54,6 +58,7 @@ using namespace std;
 #include "scheduledrecording.h"
 #include "jobqueue.h"
 #include "autoexpire.h"
+#include "channelutil.h"
 #include "storagegroup.h"
 #include "compat.h"
 #include "ringbuffer.h"
@@ -183,8 +188,15 @@ MainServer::MainServer(bool master, int port,
     m_sched(sched), m_expirer(expirer), deferredDeleteTimer(NULL),
     autoexpireUpdateTimer(NULL), m_exitCode(BACKEND_EXIT_OK)
 {
-    PreviewGeneratorQueue::CreatePreviewGeneratorQueue(
-        PreviewGenerator::kLocalAndRemote, ~0, 0);
+    // Generate previews with the backend's own warm decoder rather than
+    // paying process startup and DB connect for a mythpreviewgen run per
+    // preview.  PreviewGeneratorSeparateProcess restores the old behavior
+    // for those who want decoder crashes isolated from the backend.
+    PreviewGenerator::Mode pmode = PreviewGenerator::kLocalAndRemote;
+    if (!gCoreContext->GetNumSetting("PreviewGeneratorSeparateProcess", 0))
+        pmode = (PreviewGenerator::Mode)
+            (pmode | PreviewGenerator::kInProcess);
+    PreviewGeneratorQueue::CreatePreviewGeneratorQueue(pmode, ~0, 0);
     PreviewGeneratorQueue::AddListener(this);
 
     for (int i = 0; i < PRT_STARTUP_THREAD_COUNT; i++)
@@ -303,6 +315,8 @@ void MainServer::readyRead(MythSocket *sock)
 
 void MainServer::ProcessRequest(MythSocket *sock)
 {
+    MYTH_PROFILE_SCOPE("MainServer::ProcessRequest");
+
     sock->Lock();
 
     if (sock->bytesAvailable() > 0)
@@ -360,7 +374,7 @@ void MainServer::ProcessRequestWork(MythSocket *sock)
         if (tokens.size() != 2)
             VERBOSE(VB_IMPORTANT, "Bad QUERY_RECORDINGS query");
         else
-            HandleQueryRecordings(tokens[1], pbs);
+            HandleQueryRecordings(tokens[1], listline, pbs);
     }
     else if (command == "QUERY_RECORDING")
     {
@@ -402,6 +416,10 @@ void MainServer::ProcessRequestWork(MythSocket *sock)
     {
         HandleQueryTimeZone(pbs);
     }
+    else if (command == "QUERY_PROFILE")
+    {
+        HandleQueryProfile(listline, pbs);
+    }
     else if (command == "QUERY_CHECKFILE")
     {
         HandleQueryCheckFile(listline, pbs);
@@ -539,6 +557,13 @@ void MainServer::ProcessRequestWork(MythSocket *sock)
         else
             HandleRemoteEncoder(listline, tokens, pbs);
     }
+    else if (command == "QUERY_REMOTEENCODERS")
+    {
+        if (tokens.size() != 2)
+            VERBOSE(VB_IMPORTANT, "Bad QUERY_REMOTEENCODERS");
+        else
+            HandleRemoteEncoderStates(tokens, pbs);
+    }
     else if (command == "GET_RECORDER_FROM_NUM")
     {
         HandleGetRecorderFromNum(listline, pbs);
@@ -639,6 +664,13 @@ void MainServer::ProcessRequestWork(MythSocket *sock)
         else
             HandleSettingQuery(tokens, pbs);
     }
+    else if (command == "QUERY_SETTINGS")
+    {
+        if (tokens.size() < 3)
+            VERBOSE(VB_IMPORTANT, "Bad QUERY_SETTINGS");
+        else
+            HandleSettingsQuery(tokens, pbs);
+    }
     else if (command == "SET_SETTING")
     {
         if (tokens.size() != 4)
@@ -993,6 +1025,9 @@ void MainServer::customEvent(QEvent *e)
         if (me->Message() == "CLEAR_SETTINGS_CACHE")
             gCoreContext->ClearSettingsCache();
 
+        if (me->Message() == "CHANNEL_CHANGED")
+            ChannelUtil::ClearChannelCache();
+
         if (me->Message().left(14) == "RESET_IDLETIME" && m_sched)
             m_sched->ResetIdleTime();
 
@@ -1034,6 +1069,31 @@ void MainServer::customEvent(QEvent *e)
             }
         }
 
+        if (me->Message().left(25) == "RECORDING_LIST_CHANGE ADD")
+        {
+            QStringList tokens = me->Message().simplified().split(" ");
+            uint chanid = 0;
+            QDateTime recstartts;
+            if (tokens.size() >= 4)
+            {
+                chanid     = tokens[2].toUInt();
+                recstartts = QDateTime::fromString(tokens[3], Qt::ISODate);
+            }
+
+            // Hydrate the event with the program data so each
+            // frontend doesn't have to query the DB for it.
+            ProgramInfo evinfo(chanid, recstartts);
+            if (evinfo.GetChanID())
+            {
+                evinfo.SetRecordingStatus(rsRecording);
+
+                QStringList list;
+                evinfo.ToStringList(list);
+                mod_me = MythEvent(me->Message(), list);
+                me = &mod_me;
+            }
+        }
+
         if (me->Message().left(13) == "DOWNLOAD_FILE")
         {
             QStringList extraDataList = me->ExtraDataList();
@@ -1105,7 +1165,8 @@ void MainServer::customEvent(QEvent *e)
 
             bool reallysendit = false;
 
-            if (broadcast[1] == "CLEAR_SETTINGS_CACHE")
+            if ((broadcast[1] == "CLEAR_SETTINGS_CACHE") ||
+                (broadcast[1] == "CHANNEL_CHANGED"))
             {
                 if ((ismaster) &&
                     (pbs->isSlaveBackend() || pbs->wantsEvents()))
@@ -1164,11 +1225,15 @@ void MainServer::customEvent(QEvent *e)
 
 /**
  * \addtogroup myth_network_protocol
- * \par        MYTH_PROTO_VERSION \e version \e token
+ * \par        MYTH_PROTO_VERSION \e version \e token [\e BINARY] [\e DEFLATE]
  * Checks that \e version and \e token match the backend's version.
  * If it matches, the stringlist of "ACCEPT" \e "version" is returned.
  * If it does not, "REJECT" \e "version" is returned,
  * and the socket is closed (for this client)
+ * A client appending \e BINARY offers the binary string list
+ * encoding, \e DEFLATE offers compression of large payloads; each
+ * accepted capability is echoed in the ACCEPT reply and both sides
+ * use it for the rest of the session.
  */
 void MainServer::HandleVersion(MythSocket *socket, const QStringList &slist)
 {
@@ -1209,7 +1274,29 @@ void MainServer::HandleVersion(MythSocket *socket, const QStringList &slist)
     }
 
     retlist << "ACCEPT" << MYTH_PROTO_VERSION;
+
+    // Echo any capabilities the client offered that we support, and
+    // switch this socket over once the ACCEPT itself has gone out in
+    // the classic encoding. Old clients never send the extra tokens
+    // and are served as before.
+    bool binary  = false;
+    bool deflate = false;
+    for (int i = 3; i < slist.size(); i++)
+    {
+        binary  |= (slist[i] == "BINARY");
+        deflate |= (slist[i] == "DEFLATE");
+    }
+    if (binary)
+        retlist << "BINARY";
+    if (deflate)
+        retlist << "DEFLATE";
+
     socket->writeStringList(retlist);
+
+    if (binary)
+        socket->setBinaryMode(true);
+    if (deflate)
+        socket->setCompressedMode(true);
 }
 
 /**
@@ -1526,12 +1613,34 @@ void MainServer::SendResponse(MythSocket *socket, QStringList &commands)
  * The \e type parameter can be either "Play", "Recording" or "Delete".
  * Returns programinfo (title, subtitle, description, category, chanid,
  * channum, callsign, channel.name, fileURL, \e et \e cetera)
+ *
+ * The command may be followed by four more list entries -- \e offset,
+ * \e count, \e recgroup and \e title -- requesting a paged response:
+ * only \e count recordings starting at \e offset of those matching
+ * the (possibly empty) recording group and title filters are
+ * returned, preceded by the total match count and the page size.
  */
-void MainServer::HandleQueryRecordings(QString type, PlaybackSock *pbs)
+void MainServer::HandleQueryRecordings(QString type, QStringList &slist,
+                                       PlaybackSock *pbs)
 {
     MythSocket *pbssock = pbs->getSocket();
     QString playbackhost = pbs->getHostname();
 
+    bool paged  = (slist.size() >= 3);
+    int  offset = 0;
+    int  limit  = -1;
+    QString fgroup;
+    QString ftitle;
+    if (paged)
+    {
+        offset = slist[1].toInt();
+        limit  = slist[2].toInt();
+        if (slist.size() >= 4)
+            fgroup = slist[3];
+        if (slist.size() >= 5)
+            ftitle = slist[4];
+    }
+
     QMap<QString,ProgramInfo*> recMap;
     if (m_sched)
         recMap = m_sched->GetRecording();
@@ -1540,23 +1649,94 @@ void MainServer::HandleQueryRecordings(QString type, PlaybackSock *pbs)
     QMap<QString,bool> isJobRunning =
         ProgramInfo::QueryJobsRunning(JOB_COMMFLAG);
 
+    // A paged query only serializes one screenful, so load the slim
+    // recording index eagerly and hydrate just the visible window
+    // below.  Unpaged queries return every field of every recording
+    // and are better off with the single full query.
     ProgramList destination;
-    LoadFromRecorded(
-        destination, (type == "Recording"),
-        inUseMap, isJobRunning, recMap);
+    if (paged)
+    {
+        LoadIndexFromRecorded(destination, (type == "Recording"));
+    }
+    else
+    {
+        LoadFromRecorded(
+            destination, (type == "Recording"),
+            inUseMap, isJobRunning, recMap);
+    }
+
+    // Select the requested window before the per-recording pathname
+    // and filesize work below, so a paged query only pays for the
+    // recordings the frontend will actually show.
+    vector<ProgramInfo*> window;
+    int matched = 0;
+    ProgramList::iterator pit = destination.begin();
+    for (; pit != destination.end(); ++pit)
+    {
+        ProgramInfo *p = *pit;
+        if (!fgroup.isEmpty() && p->GetRecordingGroup() != fgroup)
+            continue;
+        if (!ftitle.isEmpty() && p->GetTitle() != ftitle)
+            continue;
+        if (!paged ||
+            ((matched >= offset) &&
+             ((limit < 0) || ((int)window.size() < limit))))
+        {
+            window.push_back(p);
+        }
+        matched++;
+    }
+
+    if (paged)
+    {
+        // Hydrate the windowed records and apply the in use and job
+        // state the full loader would have applied to everything.
+        QDateTime rectime = QDateTime::currentDateTime().addSecs(
+            -gCoreContext->GetNumSetting("RecordOverTime"));
+
+        vector<ProgramInfo*>::iterator wit = window.begin();
+        for (; wit != window.end(); ++wit)
+        {
+            ProgramInfo *p = *wit;
+            if (!p->LoadFullDetails())
+                continue;
+
+            QString key = p->MakeUniqueKey();
+            if (p->GetRecordingEndTime() > rectime && recMap.contains(key))
+                p->SetRecordingStatus(rsRecording);
+
+            uint32_t flags = p->GetProgramFlags();
+            if (inUseMap.contains(key))
+                flags |= inUseMap[key];
+
+            if ((flags & FL_COMMPROCESSING) &&
+                (isJobRunning.find(key) == isJobRunning.end()))
+            {
+                flags &= ~FL_COMMPROCESSING;
+                if (!(flags & FL_REALLYEDITING))
+                    flags &= ~FL_EDITING;
+                p->SaveCommFlagged(COMM_FLAG_NOT_FLAGGED);
+            }
+
+            p->SetProgramFlags(flags);
+        }
+    }
 
     QMap<QString,ProgramInfo*>::iterator mit = recMap.begin();
     for (; mit != recMap.end(); mit = recMap.erase(mit))
         delete *mit;
 
-    QStringList outputlist(QString::number(destination.size()));
+    QStringList outputlist(QString::number(matched));
+    if (paged)
+        outputlist << QString::number(window.size());
+
     QMap<QString, QString> backendIpMap;
     QMap<QString, QString> backendPortMap;
     QString ip   = gCoreContext->GetSetting("BackendServerIP");
     QString port = gCoreContext->GetSetting("BackendServerPort");
 
-    ProgramList::iterator it = destination.begin();
-    for (it = destination.begin(); it != destination.end(); ++it)
+    vector<ProgramInfo*>::iterator it = window.begin();
+    for (; it != window.end(); ++it)
     {
         ProgramInfo *proginfo = *it;
         PlaybackSock *slave = NULL;
@@ -1889,6 +2069,8 @@ void MainServer::DoDeleteThread(const DeleteStruct *ds)
 
     if (slowDeletes && fd >= 0)
         TruncateAndClose(&pginfo, fd, ds->filename, size);
+
+    InvalidateDiskSpaceCache();
 }
 
 void MainServer::DeleteRecordedFiles(const DeleteStruct *ds)
@@ -2113,7 +2295,17 @@ int MainServer::OpenAndUnlink(const QString &filename)
 }
 
 /**
- *  \brief Repeatedly truncate an open file in small increments.
+ *  \brief Repeatedly release the space of an open file in small increments.
+ *
+ *   When the filesystem supports it the blocks are released by punching
+ *   holes into the file, which avoids rewriting the inode size on every
+ *   step the way repeated truncation does, so far less metadata has to
+ *   be journaled while a recording is writing to the same filesystem.
+ *   Filesystems without hole punching fall back to truncation.
+ *
+ *   The deletion rate is subordinate to recording I/O; while any
+ *   recorder is writing, space is released at the minimum reserved
+ *   rate, and only an idle backend deletes at full speed.
  *
  *   When the file is small enough this closes the file and returns.
  *
@@ -2138,36 +2330,79 @@ bool MainServer::TruncateAndClose(ProgramInfo *pginfo, int fd,
     if (query.exec() && query.isActive() && query.size() && query.next())
         cards = query.value(0).toInt();
 
-    // Time between truncation steps in milliseconds
+    // Time between deletion steps in milliseconds
     const size_t sleep_time = 500;
     const size_t min_tps    = 8 * 1024 * 1024;
     const size_t calc_tps   = (size_t) (cards * 1.2 * (22200000LL / 8));
     const size_t tps = max(min_tps, calc_tps);
     const size_t increment  = (size_t) (tps * (sleep_time * 0.001f));
+    // With no recording in progress the deletion competes with
+    // nothing, so release space eight times faster.
+    const size_t idle_increment = increment * 8;
+
+    bool punch = false;
+#if defined(__linux__) && defined(FALLOC_FL_PUNCH_HOLE)
+    punch = (fallocate(fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+                       0, sysconf(_SC_PAGESIZE)) == 0);
+    if (!punch)
+        VERBOSE(VB_FILE, QString("Filesystem holding '%1' does not "
+                "support hole punching, truncating instead").arg(filename));
+#endif
 
     VERBOSE(VB_FILE,
-            QString("Truncating '%1' by %2 MB every %3 milliseconds")
+            QString("%1 '%2' by %3 MB every %4 milliseconds")
+            .arg(punch ? "Hole punching" : "Truncating")
             .arg(filename)
             .arg(increment / (1024.0 * 1024.0), 0, 'f', 2)
             .arg(sleep_time));
 
     int count = 0;
+    size_t step = increment;
     while (fsize > 0)
     {
-        //VERBOSE(VB_FILE, QString("Truncating '%1' to %2 MB")
-        //        .arg(filename).arg(fsize / (1024.0 * 1024.0), 0, 'f', 2));
+        if ((count % 60) == 0)
+        {
+            // Check every 30 seconds whether any recorder is writing
+            // and if so throttle back down to the reserved rate, so
+            // deletes never steal bandwidth from an active recording.
+            QDateTime oneHourAgo =
+                QDateTime::currentDateTime().addSecs(-61 * 60);
+            query.prepare("SELECT COUNT(*) FROM inuseprograms "
+                          " WHERE recusage = :RECUSAGE "
+                          " AND lastupdatetime > :ONEHOURAGO ;");
+            query.bindValue(":RECUSAGE", kRecorderInUseID);
+            query.bindValue(":ONEHOURAGO", oneHourAgo);
+
+            bool recording = true;
+            if (query.exec() && query.isActive() && query.next())
+                recording = query.value(0).toInt() > 0;
+
+            step = (recording) ? increment : idle_increment;
+        }
+
+        off_t newsize = fsize - step;
+        if (newsize < 0)
+            newsize = 0;
+
+        int err = 0;
+#if defined(__linux__) && defined(FALLOC_FL_PUNCH_HOLE)
+        if (punch)
+            err = fallocate(fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+                            newsize, fsize - newsize);
+        else
+#endif
+            err = ftruncate(fd, newsize);
 
-        int err = ftruncate(fd, fsize);
         if (err)
         {
-            VERBOSE(VB_IMPORTANT, QString("Error truncating '%1'")
+            VERBOSE(VB_IMPORTANT, QString("Error deleting '%1'")
                     .arg(filename) + ENO);
             if (pginfo)
                 pginfo->MarkAsInUse(false, kTruncatingDeleteInUseID);
             return 0 == close(fd);
         }
 
-        fsize -= increment;
+        fsize = newsize;
 
         if (pginfo && ((count % 100) == 0))
             pginfo->UpdateInUseMark(true);
@@ -2182,7 +2417,7 @@ bool MainServer::TruncateAndClose(ProgramInfo *pginfo, int fd,
     if (pginfo)
         pginfo->MarkAsInUse(false, kTruncatingDeleteInUseID);
 
-    VERBOSE(VB_FILE, QString("Finished truncating '%1'").arg(filename));
+    VERBOSE(VB_FILE, QString("Finished deleting '%1'").arg(filename));
 
     return ok;
 }
@@ -2776,6 +3011,37 @@ void MainServer::HandleQueryTimeZone(PlaybackSock *pbs)
     SendResponse(pbssock, strlist);
 }
 
+/**
+ * \addtogroup myth_network_protocol
+ * \par        QUERY_PROFILE \e [ENABLE|DISABLE|RESET]
+ * Returns the profile zone collection state followed by one line of
+ * timing statistics per zone, optionally changing the collection
+ * state or zeroing the statistics first
+ */
+void MainServer::HandleQueryProfile(QStringList &slist, PlaybackSock *pbs)
+{
+    MythSocket *pbssock = pbs->getSocket();
+    QStringList strlist;
+
+    if (slist.size() > 1)
+    {
+        if (slist[1] == "ENABLE")
+            MythProfileZone::SetEnabled(true);
+        else if (slist[1] == "DISABLE")
+            MythProfileZone::SetEnabled(false);
+        else if (slist[1] == "RESET")
+            MythProfileZone::ResetAll();
+    }
+
+    strlist << (MythProfileZone::IsEnabled() ? "ENABLED" : "DISABLED");
+
+    QString report = MythProfileZone::GetReport();
+    if (!report.isEmpty())
+        strlist << report.split('\n');
+
+    SendResponse(pbssock, strlist);
+}
+
 /**
  * \addtogroup myth_network_protocol
  * \par        QUERY_CHECKFILE \e checkslaves \e programinfo
@@ -4050,6 +4316,39 @@ void MainServer::HandleRemoteEncoder(QStringList &slist, QStringList &commands,
     SendResponse(pbssock, retlist);
 }
 
+/** \fn MainServer::HandleRemoteEncoderStates(QStringList&, PlaybackSock*)
+ *  \brief Returns the state of every local encoder in one response.
+ *
+ *  The response holds one record per encoder: cardid, state, the
+ *  busy flag and the tuned input the busy check returned, so the
+ *  master needs a single round trip instead of one per tuner.
+ */
+void MainServer::HandleRemoteEncoderStates(QStringList &commands,
+                                           PlaybackSock *pbs)
+{
+    MythSocket *pbssock = pbs->getSocket();
+
+    int time_buffer = commands[1].toInt();
+    QStringList retlist;
+
+    retlist << QString::number(encoderList->size());
+
+    QMap<int, EncoderLink *>::Iterator iter = encoderList->begin();
+    for (; iter != encoderList->end(); ++iter)
+    {
+        EncoderLink *elink = *iter;
+        TunedInputInfo busy_input;
+
+        retlist << QString::number(iter.key());
+        retlist << QString::number((int)elink->GetState());
+        retlist << QString::number(
+            (int)elink->IsBusy(&busy_input, time_buffer));
+        busy_input.ToStringList(retlist);
+    }
+
+    SendResponse(pbssock, retlist);
+}
+
 void MainServer::HandleIsActiveBackendQuery(QStringList &slist,
                                             PlaybackSock *pbs)
 {
@@ -4110,8 +4409,18 @@ size_t MainServer::GetCurrentMaxBitrate(void)
     return totalKBperMin;
 }
 
-void MainServer::BackendQueryDiskSpace(QStringList &strlist, bool consolidated,
-                                       bool allHosts)
+// How long one round of statfs() calls and slave free space queries
+// is reused.  Kept shorter than the five seconds of recording the
+// shared-filesystem consolidation below tolerates as drift.
+static const int kDiskSpaceCacheSecs = 5;
+
+/** \brief Rebuilds the raw disk space lists served from the cache.
+ *
+ *  m_diskSpaceCacheLock must be held.  The slave queries are made
+ *  while holding it, which also means concurrent requesters wait for
+ *  one shared round trip instead of each making their own.
+ */
+void MainServer::FillDiskSpaceCache(void)
 {
     QString allHostList = gCoreContext->GetHostName();
     long long totalKB = -1, usedKB = -1;
@@ -4119,6 +4428,7 @@ void MainServer::BackendQueryDiskSpace(QStringList &strlist, bool consolidated,
     QString driveKey;
     QString localStr = "1";
     struct statfs statbuf;
+    QStringList strlist;
     QStringList groups(StorageGroup::kSpecialGroups);
     groups.removeAll("LiveTV");
     QString specialGroups = groups.join("', '");
@@ -4207,7 +4517,9 @@ void MainServer::BackendQueryDiskSpace(QStringList &strlist, bool consolidated,
         }
     }
 
-    if (allHosts)
+    m_localDiskSpaceCache = strlist;
+    strlist.clear();
+
     {
         QMap <QString, bool> backendsCounted;
         QString pbsHost;
@@ -4242,6 +4554,43 @@ void MainServer::BackendQueryDiskSpace(QStringList &strlist, bool consolidated,
         }
     }
 
+    m_slaveDiskSpaceCache = strlist;
+    m_diskSpaceAllHostList = allHostList;
+    m_diskSpaceCacheTime = QDateTime::currentDateTime();
+}
+
+/// Marks the disk space cache stale, the next query refreshes it.
+/// Called whenever we delete or truncate something ourselves.
+void MainServer::InvalidateDiskSpaceCache(void)
+{
+    QMutexLocker cacheLocker(&m_diskSpaceCacheLock);
+    m_diskSpaceCacheTime = QDateTime();
+}
+
+void MainServer::BackendQueryDiskSpace(QStringList &strlist, bool consolidated,
+                                       bool allHosts)
+{
+    QString allHostList = gCoreContext->GetHostName();
+    long long totalKB = -1, usedKB = -1;
+
+    {
+        QMutexLocker cacheLocker(&m_diskSpaceCacheLock);
+
+        if (m_diskSpaceCacheTime.isNull() ||
+            (m_diskSpaceCacheTime.secsTo(QDateTime::currentDateTime()) >=
+             kDiskSpaceCacheSecs))
+        {
+            FillDiskSpaceCache();
+        }
+
+        strlist = m_localDiskSpaceCache;
+        if (allHosts)
+        {
+            strlist += m_slaveDiskSpaceCache;
+            allHostList = m_diskSpaceAllHostList;
+        }
+    }
+
     if (!consolidated)
         return;
 
@@ -4524,6 +4873,8 @@ bool MainServer::HandleDeleteFile(QString filename, QString storagegroup,
         SendResponse(pbs->getSocket(), retlist);
     }
 
+    InvalidateDiskSpaceCache();
+
     // DeleteFile() opened up a file for us to delete
     if (fd >= 0)
     {
@@ -4714,6 +5065,34 @@ void MainServer::HandleSettingQuery(QStringList &tokens, PlaybackSock *pbs)
     return;
 }
 
+void MainServer::HandleSettingsQuery(QStringList &tokens, PlaybackSock *pbs)
+{
+// Format: QUERY_SETTINGS <hostname> <setting1> [<setting2> ...]
+// Returns one value per requested setting, "-1" when unset, so a
+// client can load its whole startup set in a single round trip.
+
+    MythSocket *pbssock = NULL;
+    if (pbs)
+        pbssock = pbs->getSocket();
+
+    QString hostname = tokens[1];
+
+    QMap<QString,QString> kv;
+    for (int i = 2; i < tokens.size(); i++)
+        kv[tokens[i]] = "-1";
+
+    gCoreContext->GetSettingsOnHost(kv, hostname);
+
+    QStringList retlist;
+    for (int i = 2; i < tokens.size(); i++)
+        retlist << kv[tokens[i]];
+
+    if (pbssock)
+        SendResponse(pbssock, retlist);
+
+    return;
+}
+
 void MainServer::HandleDownloadFile(const QStringList &command,
                                     PlaybackSock *pbs)
 {
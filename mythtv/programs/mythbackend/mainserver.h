@@ -60,6 +60,7 @@ class MainServer : public QObject, public MythSocketCBs
     void BackendQueryDiskSpace(QStringList &strlist, bool consolidated,
                                bool allHosts);
     void GetFilesystemInfos(vector <FileSystemInfo> &fsInfos);
+    void InvalidateDiskSpaceCache(void);
 
     int GetExitCode() const { return m_exitCode; }
 
@@ -95,7 +96,8 @@ class MainServer : public QObject, public MythSocketCBs
     bool HandleDeleteFile(QStringList &slist, PlaybackSock *pbs);
     bool HandleDeleteFile(QString filename, QString storagegroup,
                           PlaybackSock *pbs = NULL);
-    void HandleQueryRecordings(QString type, PlaybackSock *pbs);
+    void HandleQueryRecordings(QString type, QStringList &slist,
+                               PlaybackSock *pbs);
     void HandleQueryRecording(QStringList &slist, PlaybackSock *pbs);
     void HandleStopRecording(QStringList &slist, PlaybackSock *pbs);
     void DoHandleStopRecording(RecordingInfo &recinfo, PlaybackSock *pbs);
@@ -147,6 +149,7 @@ class MainServer : public QObject, public MythSocketCBs
     void HandleSetChannelInfo(QStringList &slist, PlaybackSock *pbs);
     void HandleRemoteEncoder(QStringList &slist, QStringList &commands,
                              PlaybackSock *pbs);
+    void HandleRemoteEncoderStates(QStringList &commands, PlaybackSock *pbs);
     void HandleLockTuner(PlaybackSock *pbs, int cardid = -1);
     void HandleFreeTuner(int cardid, PlaybackSock *pbs);
     void HandleCutMapQuery(const QString &chanid, const QString &starttime,
@@ -159,6 +162,7 @@ class MainServer : public QObject, public MythSocketCBs
                              PlaybackSock *pbs);
     void HandleSetBookmark(QStringList &tokens, PlaybackSock *pbs);
     void HandleSettingQuery(QStringList &tokens, PlaybackSock *pbs);
+    void HandleSettingsQuery(QStringList &tokens, PlaybackSock *pbs);
     void HandleSetSetting(QStringList &tokens, PlaybackSock *pbs);
     void HandleScanVideos(PlaybackSock *pbs);
     void HandleVersion(MythSocket *socket, const QStringList &slist);
@@ -168,6 +172,7 @@ class MainServer : public QObject, public MythSocketCBs
     void HandleQueryHostname(PlaybackSock *pbs);
     void HandleQueryMemStats(PlaybackSock *pbs);
     void HandleQueryTimeZone(PlaybackSock *pbs);
+    void HandleQueryProfile(QStringList &slist, PlaybackSock *pbs);
     void HandleBlockShutdown(bool blockShutdown, PlaybackSock *pbs);
     void HandleDownloadFile(const QStringList &command, PlaybackSock *pbs);
 
@@ -188,6 +193,7 @@ class MainServer : public QObject, public MythSocketCBs
     void DoTruncateThread(const DeleteStruct *ds);
     static void *SpawnDeleteThread(void *param);
     void DoDeleteThread(const DeleteStruct *ds);
+    void FillDiskSpaceCache(void); // m_diskSpaceCacheLock must be held
     void DeleteRecordedFiles(const DeleteStruct *ds);
     void DoDeleteInDB(const DeleteStruct *ds);
 
@@ -249,6 +255,15 @@ class MainServer : public QObject, public MythSocketCBs
     QMap<QString, int> fsIDcache;
     QMutex fsIDcacheLock;
 
+    // Raw BackendQueryDiskSpace() results, so several frontends asking
+    // for free space within a few seconds cost one round of statfs()
+    // calls and slave queries instead of one per request.
+    QMutex      m_diskSpaceCacheLock;
+    QStringList m_localDiskSpaceCache;
+    QStringList m_slaveDiskSpaceCache;
+    QString     m_diskSpaceAllHostList;
+    QDateTime   m_diskSpaceCacheTime; // null == invalidated
+
     QMutex                     m_downloadURLsLock;
     QMap<QString, QString>     m_downloadURLs;
 
@@ -27,7 +27,10 @@ PlaybackSock::PlaybackSock(MainServer *parent, MythSocket *lsock,
     m_eventsMode = eventsMode;
     ip = "";
     backend = false;
-    expectingreply = false;
+    expectingreplies = 0;
+    nextticket = 0;
+    servingticket = 0;
+    encoderStateTimeBuffer = -1;
 
     disconnected = false;
     blockshutdown = true;
@@ -94,14 +97,31 @@ bool PlaybackSock::SendReceiveStringList(
 {
     bool ok = false;
 
-    sock->Lock();
     sock->UpRef();
 
+    // Requests are pipelined: take a ticket and send under sockLock,
+    // then wait for our turn to read. The peer processes requests on
+    // a socket one at a time, so the replies come back in send order,
+    // and MainServer::readyRead() leaves the socket alone while any
+    // reply is outstanding. A slow query (say, preview generation on
+    // a slave) therefore no longer serializes every other caller's
+    // round trip behind its own.
+    quint64 ticket;
     {
         QMutexLocker locker(&sockLock);
-        expectingreply = true;
+        ticket = nextticket++;
+        expectingreplies++;
 
+        sock->Lock();
         sock->writeStringList(strlist);
+        sock->Unlock();
+    }
+
+    {
+        QMutexLocker locker(&replylock);
+        while (servingticket != ticket)
+            replywait.wait(&replylock);
+
         ok = sock->readStringList(strlist);
 
         while (ok && strlist[0] == "BACKEND_MESSAGE")
@@ -119,10 +139,15 @@ bool PlaybackSock::SendReceiveStringList(
             ok = sock->readStringList(strlist);
         }
 
-        expectingreply = false;
+        servingticket++;
+        replywait.wakeAll();
+    }
+
+    {
+        QMutexLocker locker(&sockLock);
+        expectingreplies--;
     }
 
-    sock->Unlock();
     sock->DownRef();
 
     if (!ok)
@@ -189,6 +214,8 @@ int PlaybackSock::DeleteFile(const QString &filename, const QString &sgroup)
 
 int PlaybackSock::StopRecording(const ProgramInfo *pginfo)
 {
+    InvalidateEncoderStateCache();
+
     QStringList strlist( QString("STOP_RECORDING"));
     pginfo->ToStringList(strlist);
 
@@ -326,9 +353,101 @@ bool PlaybackSock::CheckFile(ProgramInfo *pginfo)
     return false;
 }
 
+/** \fn PlaybackSock::UpdateEncoderStateCache(int)
+ *  \brief Fetches the state of all of the slave's encoders in a
+ *         single QUERY_REMOTEENCODERS round trip.
+ *
+ *  The scheduler and LiveTV paths check every encoder in a row, so
+ *  querying them one QUERY_REMOTEENCODER call at a time costs one
+ *  round trip per tuner.  Must be called with encoderStateLock held.
+ */
+bool PlaybackSock::UpdateEncoderStateCache(int time_buffer)
+{
+    QStringList strlist( QString("QUERY_REMOTEENCODERS %1").arg(time_buffer) );
+
+    encoderStateTime = QDateTime();
+    encoderStateCache.clear();
+
+    if (!SendReceiveStringList(strlist, 1))
+        return false;
+
+    bool ok = false;
+    int count = strlist[0].toInt(&ok);
+    if (!ok)
+        return false;
+
+    QStringList::const_iterator it = strlist.begin() + 1;
+    for (int i = 0; i < count; i++)
+    {
+        SlaveEncoderState es;
+
+        if (it == strlist.end())
+            return false;
+        int cardid = (*it).toInt(); ++it;
+
+        if (it == strlist.end())
+            return false;
+        es.state = (*it).toInt(); ++it;
+
+        if (it == strlist.end())
+            return false;
+        es.busy = (*it).toInt(); ++it;
+
+        TunedInputInfo busy_input;
+        if (!busy_input.FromStringList(it, strlist.end()))
+            return false;
+        busy_input.ToStringList(es.businput);
+
+        encoderStateCache[cardid] = es;
+    }
+
+    encoderStateTime = QDateTime::currentDateTime();
+    encoderStateTimeBuffer = time_buffer;
+
+    return true;
+}
+
+/** \fn PlaybackSock::InvalidateEncoderStateCache(void)
+ *  \brief Discards the batched encoder states after a command that
+ *         can change them.
+ */
+void PlaybackSock::InvalidateEncoderStateCache(void)
+{
+    QMutexLocker locker(&encoderStateLock);
+    encoderStateTime = QDateTime();
+}
+
 bool PlaybackSock::IsBusy(
     int capturecardnum, InputInfo *busy_input, int time_buffer)
 {
+    encoderStateLock.lock();
+
+    bool cachevalid =
+        (!encoderStateTime.isNull()) &&
+        (encoderStateTimeBuffer == time_buffer) &&
+        (encoderStateTime.secsTo(QDateTime::currentDateTime()) < 1);
+
+    if (!cachevalid)
+        cachevalid = UpdateEncoderStateCache(time_buffer);
+
+    if (cachevalid && encoderStateCache.contains(capturecardnum))
+    {
+        const SlaveEncoderState &es = encoderStateCache[capturecardnum];
+        bool state = es.busy;
+
+        if (busy_input)
+        {
+            QStringList::const_iterator it = es.businput.begin();
+            if (!busy_input->FromStringList(it, es.businput.end()))
+                state = false;
+        }
+
+        encoderStateLock.unlock();
+        return state;
+    }
+
+    encoderStateLock.unlock();
+
     QStringList strlist( QString("QUERY_REMOTEENCODER %1").arg(capturecardnum) );
 
     strlist << "IS_BUSY";
@@ -370,6 +489,17 @@ bool PlaybackSock::IsBusy(
  */
 int PlaybackSock::GetEncoderState(int capturecardnum)
 {
+    encoderStateLock.lock();
+    if ((!encoderStateTime.isNull()) &&
+        (encoderStateTime.secsTo(QDateTime::currentDateTime()) < 1) &&
+        (encoderStateCache.contains(capturecardnum)))
+    {
+        int state = encoderStateCache[capturecardnum].state;
+        encoderStateLock.unlock();
+        return state;
+    }
+    encoderStateLock.unlock();
+
     QStringList strlist( QString("QUERY_REMOTEENCODER %1").arg(capturecardnum) );
     strlist << "GET_STATE";
 
@@ -433,6 +563,8 @@ bool PlaybackSock::EncoderIsRecording(int capturecardnum, const ProgramInfo *pgi
 RecStatusType PlaybackSock::StartRecording(int capturecardnum,
                                            const ProgramInfo *pginfo)
 {
+    InvalidateEncoderStateCache();
+
     QStringList strlist( QString("QUERY_REMOTEENCODER %1").arg(capturecardnum) );
     strlist << "START_RECORDING";
     pginfo->ToStringList(strlist);
@@ -525,6 +657,8 @@ vector<InputInfo> PlaybackSock::GetFreeInputs(int capturecardnum,
 
 void PlaybackSock::CancelNextRecording(int capturecardnum, bool cancel)
 {
+    InvalidateEncoderStateCache();
+
     QStringList strlist(QString("QUERY_REMOTEENCODER %1")
                         .arg(capturecardnum));
 
@@ -7,7 +7,9 @@ using namespace std;
 #include <QStringList>
 #include <QDateTime>
 #include <QMutex>
+#include <QWaitCondition>
 #include <QSize>
+#include <QMap>
 
 #include "programinfo.h" // For RecStatusType
 #include "inputinfo.h"
@@ -53,7 +55,7 @@ class PlaybackSock
     bool isSlaveBackend(void) const { return backend; }
     void setAsSlaveBackend(void) { backend = true; }
 
-    bool isExpectingReply(void) const { return expectingreply; }
+    bool isExpectingReply(void) const { return expectingreplies > 0; }
 
     void setIP(QString &lip) { ip = lip; }
     QString getIP(void) const { return ip; }
@@ -85,6 +87,7 @@ class PlaybackSock
                 InputInfo *busy_input  = NULL,
                 int        time_buffer = 5);
     int GetEncoderState(int capturecardnum);
+    void InvalidateEncoderStateCache(void);
     long long GetMaxBitrate(int capturecardnum);
     ProgramInfo *GetRecording(uint cardid);
     bool EncoderIsRecording(int capturecardnum, const ProgramInfo *pginfo);
@@ -102,7 +105,15 @@ class PlaybackSock
     QStringList ForwardRequest(const QStringList&);
 
   private:
+    typedef struct slaveencoderstate
+    {
+        int         state;
+        bool        busy;
+        QStringList businput; ///< serialized TunedInputInfo
+    } SlaveEncoderState;
+
     bool SendReceiveStringList(QStringList &strlist, uint min_reply_length = 0);
+    bool UpdateEncoderStateCache(int time_buffer);
 
     MythSocket *sock;
     QString hostname;
@@ -115,8 +126,23 @@ class PlaybackSock
 
     QMutex refLock;
     QMutex sockLock;
+    QMutex replylock;
+    QWaitCondition replywait;
+
+    /// Batched encoder state cache, fetched for all of a slave's
+    /// encoders in one QUERY_REMOTEENCODERS round trip.
+    QMutex encoderStateLock;
+    QMap<int, SlaveEncoderState> encoderStateCache;
+    QDateTime encoderStateTime;
+    int encoderStateTimeBuffer;
+
+    /// number of requests sent but not yet answered
+    uint expectingreplies;
+    /// ticket handed to the next request sent
+    quint64 nextticket;
+    /// ticket whose reply is next on the socket
+    quint64 servingticket;
 
-    bool expectingreply;
     bool disconnected;
 
     int refCount;
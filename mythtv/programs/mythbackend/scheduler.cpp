@@ -2,6 +2,7 @@
 
 #include <iostream>
 #include <algorithm>
+#include <functional>
 #include <list>
 using namespace std;
 
@@ -20,6 +21,7 @@ using namespace std;
 
 #include <QStringList>
 #include <QDateTime>
+#include <QThread>
 #include <QRegExp>
 #include <QMutex>
 #include <QFile>
@@ -41,6 +43,7 @@ using namespace std;
 #include "cardutil.h"
 #include "mythdb.h"
 #include "mythsystemevent.h"
+#include "mythprofile.h"
 
 #define LOC QString("Scheduler: ")
 #define LOC_WARN QString("Scheduler, Warning: ")
@@ -52,6 +55,7 @@ Scheduler::Scheduler(bool runthread, QMap<int, EncoderLink *> *tvList,
     priorityTable("powerpriority"),
     schedLock(),
     reclist_changed(false),
+    lastPlaceHash(0),
     specsched(master_sched),
     schedMoveHigher(false),
     schedulingEnabled(true),
@@ -336,8 +340,177 @@ static bool comp_timechannel(RecordingInfo *a, RecordingInfo *b)
     return a->GetChanNum() < b->GetChanNum();
 }
 
+/** \brief One entry of the packed key sort used by SortRecList().
+ *
+ *  The comp_* functions re-derive timestamps and priorities from the
+ *  RecordingInfo on every comparison, which dominates the sort phases
+ *  on large worklists.  The key packs the leading comparison criteria
+ *  of the ordering into one integer computed once per entry; entries
+ *  with equal keys fall back to the original comparator, with the
+ *  pre-sort position as the final tie break, so the result matches
+ *  what SORT_RECLIST() over the comparator alone would produce.
+ */
+struct SchedSortElem
+{
+    quint64        key;
+    uint           idx;
+    RecordingInfo *prog;
+};
+
+typedef bool (*RecCompFn)(RecordingInfo*, RecordingInfo*);
+typedef quint64 (*RecKeyFn)(const RecordingInfo*);
+
+class SchedSortLess
+{
+  public:
+    explicit SchedSortLess(RecCompFn tiebreak) : m_tiebreak(tiebreak) {}
+    bool operator()(const SchedSortElem &a, const SchedSortElem &b) const
+    {
+        if (a.key != b.key)
+            return a.key < b.key;
+        if (m_tiebreak(a.prog, b.prog))
+            return true;
+        if (m_tiebreak(b.prog, a.prog))
+            return false;
+        return a.idx < b.idx;
+    }
+  private:
+    RecCompFn m_tiebreak;
+};
+
+static inline quint64 pack_times(const QDateTime &start, const QDateTime &end)
+{
+    return ((quint64)start.toTime_t() << 32) | end.toTime_t();
+}
+
+/// Leading criteria of both comp_overlap() and comp_redundant().
+static quint64 key_scheduled(const RecordingInfo *p)
+{
+    return pack_times(p->GetScheduledStartTime(), p->GetScheduledEndTime());
+}
+
+/// Leading criteria of comp_recstart().
+static quint64 key_recstart(const RecordingInfo *p)
+{
+    return pack_times(p->GetRecordingStartTime(), p->GetRecordingEndTime());
+}
+
+/// Leading criteria of comp_priority().
+static quint64 key_priority(const RecordingInfo *p)
+{
+    quint64 key = 0;
+
+    if (p->GetRecordingStatus() != rsRecording &&
+        p->GetRecordingStatus() != rsTuning)
+        key |= Q_UINT64_C(1) << 63;
+
+    // Higher priorities sort first, so map the signed priority to an
+    // order preserving unsigned value and invert it.
+    quint32 upri = ~(0x80000000u ^ (quint32)p->GetRecordingPriority());
+    key |= (quint64)upri << 31;
+
+    if (p->GetRecordingStartTime() < schedTime.addSecs(-30) &&
+        !p->IsReactivated())
+        key |= Q_UINT64_C(1) << 30;
+
+    key |= ((quint64)RecTypePriority(p->GetRecordingRuleType()) & 0x3f) << 24;
+
+    return key;
+}
+
+static inline void hash_mix(quint64 &hash, quint64 val)
+{
+    // FNV-1a style mixing, good enough to compare passes.
+    hash = (hash ^ val) * Q_UINT64_C(1099511628211);
+}
+
+static void SortRecList(RecList &list, RecKeyFn keyfn, RecCompFn tiebreak)
+{
+    vector<SchedSortElem> elems;
+    elems.reserve(list.size());
+
+    SchedSortElem elem;
+    elem.idx = 0;
+    RecIter it = list.begin();
+    for (; it != list.end(); ++it, ++elem.idx)
+    {
+        elem.key  = keyfn(*it);
+        elem.prog = *it;
+        elems.push_back(elem);
+    }
+
+    sort(elems.begin(), elems.end(), SchedSortLess(tiebreak));
+
+    RecIter dst = list.begin();
+    vector<SchedSortElem>::const_iterator sit = elems.begin();
+    for (; sit != elems.end(); ++sit, ++dst)
+        *dst = (*sit).prog;
+}
+
+/** \fn Scheduler::ComputePlacementHash(void) const
+ *  \brief Hashes everything the placement phase depends on.
+ *
+ *  Covers the sorted worklist as it stands before SchedNewRecords()
+ *  plus the encoder configuration and the placement settings.  Two
+ *  passes with equal hashes resolve their conflicts identically, so
+ *  the outcome of the previous pass, the current reclist, can be
+ *  carried forward without redoing the placement.  Returns 0 when
+ *  the outcome must not be cached; LiveTV tuning state isn't covered
+ *  here, so any active LiveTV session disables the cache rather than
+ *  risking a stale SchedPreserveLiveTV() decision.
+ */
+quint64 Scheduler::ComputePlacementHash(void) const
+{
+    quint64 hash = Q_UINT64_C(14695981039346656037);
+
+    hash_mix(hash, schedMoveHigher);
+    hash_mix(hash, gCoreContext->GetNumSetting("SchedOpenEnd", 0));
+    hash_mix(hash, gCoreContext->GetNumSetting("LiveTVPriority", 0));
+
+    QMap<int, EncoderLink *>::const_iterator enciter = m_tvList->begin();
+    for (; enciter != m_tvList->end(); ++enciter)
+    {
+        EncoderLink *enc = *enciter;
+        if (kState_WatchingLiveTV == enc->GetState())
+            return 0;
+        hash_mix(hash, enc->GetCardID());
+        hash_mix(hash, enc->IsConnected());
+        hash_mix(hash, enc->IsAsleep());
+    }
+
+    RecConstIter i = worklist.begin();
+    for (; i != worklist.end(); ++i)
+    {
+        const RecordingInfo *p = *i;
+        hash_mix(hash, p->GetRecordingRuleID());
+        hash_mix(hash, p->GetParentRecordingRuleID());
+        hash_mix(hash, p->GetRecordingRuleType());
+        hash_mix(hash, p->GetChanID());
+        hash_mix(hash, p->GetInputID());
+        hash_mix(hash, p->GetCardID());
+        hash_mix(hash, p->GetSourceID());
+        hash_mix(hash, p->GetRecordingStartTime().toTime_t());
+        hash_mix(hash, p->GetRecordingEndTime().toTime_t());
+        hash_mix(hash, p->GetScheduledStartTime().toTime_t());
+        hash_mix(hash, p->GetScheduledEndTime().toTime_t());
+        hash_mix(hash, p->GetRecordingPriority());
+        hash_mix(hash, p->GetRecordingPriority2());
+        hash_mix(hash, p->GetRecordingStatus());
+        hash_mix(hash, p->IsReactivated());
+        hash_mix(hash, p->GetFindID());
+        hash_mix(hash, qHash(p->GetTitle()));
+        hash_mix(hash, qHash(p->GetSubtitle()));
+        hash_mix(hash, qHash(p->GetDescription()));
+        hash_mix(hash, qHash(p->GetProgramID()));
+    }
+
+    return hash;
+}
+
 bool Scheduler::FillRecordList(bool doLock)
 {
+    MYTH_PROFILE_SCOPE("Scheduler::FillRecordList");
+
     schedMoveHigher = (bool)gCoreContext->GetNumSetting("SchedMoveHigher");
     schedTime = QDateTime::currentDateTime();
 
@@ -351,12 +524,51 @@ bool Scheduler::FillRecordList(bool doLock)
     AddNotListed();
 
     VERBOSE(VB_SCHEDULE, "Sort by time...");
-    SORT_RECLIST(worklist, comp_overlap);
+    SortRecList(worklist, key_scheduled, comp_overlap);
     VERBOSE(VB_SCHEDULE, "PruneOverlaps...");
     PruneOverlaps();
 
     VERBOSE(VB_SCHEDULE, "Sort by priority...");
-    SORT_RECLIST(worklist, comp_priority);
+    SortRecList(worklist, key_priority, comp_priority);
+
+    quint64 placehash = ComputePlacementHash();
+    if (placehash && placehash == lastPlaceHash)
+    {
+        // Nothing the placement depends on has changed since the
+        // last completed pass, so the current reclist is already the
+        // outcome this pass would compute.  Keep it and only refresh
+        // the pending bookkeeping SchedNewRecords() would have done.
+        VERBOSE(VB_SCHEDULE,
+                "Placement inputs unchanged, keeping schedule");
+
+        while (!worklist.empty())
+        {
+            delete worklist.front();
+            worklist.pop_front();
+        }
+
+        if (doLock)
+            schedLock.lock();
+
+        RecIter pend = reclist.begin();
+        for (; pend != reclist.end(); ++pend)
+        {
+            RecordingInfo *p = *pend;
+            if (p->GetRecordingStatus() == rsWillRecord &&
+                p->GetRecordingStartTime() < schedTime.addSecs(90))
+            {
+                QString id = p->MakeUniqueSchedulerKey();
+                if (!recPendingList.contains(id))
+                    recPendingList[id] = false;
+
+                livetvTime = (livetvTime < schedTime) ?
+                    schedTime : livetvTime;
+            }
+        }
+
+        return true;
+    }
+
     VERBOSE(VB_SCHEDULE, "BuildListMaps...");
     BuildListMaps();
     VERBOSE(VB_SCHEDULE, "SchedNewRecords...");
@@ -369,15 +581,19 @@ bool Scheduler::FillRecordList(bool doLock)
         schedLock.lock();
 
     VERBOSE(VB_SCHEDULE, "Sort by time...");
-    SORT_RECLIST(worklist, comp_redundant);
+    SortRecList(worklist, key_scheduled, comp_redundant);
     VERBOSE(VB_SCHEDULE, "PruneRedundants...");
     PruneRedundants();
 
     VERBOSE(VB_SCHEDULE, "Sort by time...");
-    SORT_RECLIST(worklist, comp_recstart);
+    SortRecList(worklist, key_recstart, comp_recstart);
     VERBOSE(VB_SCHEDULE, "ClearWorkList...");
     bool res = ClearWorkList();
 
+    // Remember what this placement was computed from so that a pass
+    // with identical inputs can reuse it.
+    lastPlaceHash = res ? placehash : 0;
+
     return res;
 }
 
@@ -763,6 +979,13 @@ void Scheduler::BuildWorkList(void)
         if (p->GetRecordingStatus() == rsRecording ||
             p->GetRecordingStatus() == rsTuning)
             worklist.push_back(new RecordingInfo(*p));
+        else if (!schedAffectedMap.empty() &&
+                 !schedAffectedMap.contains(p->GetRecordingRuleID()))
+        {
+            // Incremental reschedule; this rule can't be affected by
+            // the change, so keep its showings exactly as they are.
+            worklist.push_back(new RecordingInfo(*p));
+        }
     }
 }
 
@@ -1738,7 +1961,28 @@ void Scheduler::RunScheduler(void)
         else
         {
             if (reschedQueue.empty())
-                reschedWait.wait(&schedLock, 1000);
+            {
+                MYTH_PROFILE_COUNT("wakeups_scheduler", 1);
+
+                // With nothing needing attention for a long while
+                // there is no point in waking every second; sleep
+                // longer and let reschedWait signal new work.  The
+                // short tick is kept while a recording start is
+                // anywhere near or an idle shutdown countdown may be
+                // running, both want second resolution.
+                int sched_sleep = 1000;
+                if (!idleTimeoutSecs)
+                {
+                    sched_sleep = 15000;
+                    if (startIter != reclist.end() &&
+                        (curtime.secsTo((*startIter)->GetRecordingStartTime()) -
+                         prerollseconds - wakeThreshold) < 75)
+                    {
+                        sched_sleep = 1000;
+                    }
+                }
+                reschedWait.wait(&schedLock, sched_sleep);
+            }
 
             if (!reschedQueue.empty())
             {
@@ -1748,6 +1992,8 @@ void Scheduler::RunScheduler(void)
 
                 gettimeofday(&fillstart, NULL);
                 QString msg;
+                QList<int> changedids;
+                bool fullpass = false;
 
                 while (!reschedQueue.empty())
                 {
@@ -1757,6 +2003,11 @@ void Scheduler::RunScheduler(void)
                             QString("Reschedule requested for id %1.")
                             .arg(recordid));
 
+                    if (recordid > 0)
+                        changedids.push_back(recordid);
+                    else
+                        fullpass = true;
+
                     if (recordid != 0)
                     {
                         if (recordid == -1)
@@ -1770,6 +2021,11 @@ void Scheduler::RunScheduler(void)
                     }
                 }
 
+                if (!fullpass && !changedids.empty())
+                    ComputeAffectedRules(changedids);
+                else
+                    schedAffectedMap.clear();
+
                 gettimeofday(&fillend, NULL);
 
                 matchTime = ((fillend.tv_sec - fillstart.tv_sec ) * 1000000 +
@@ -3065,6 +3321,436 @@ void Scheduler::UpdateMatches(int recordid) {
     VERBOSE(VB_SCHEDULE, " +-- Done.");
 }
 
+/// Showing of one recording rule, used by ComputeAffectedRules().
+struct SchedInterval
+{
+    SchedInterval(int id, const QDateTime &s, const QDateTime &e) :
+        recordid(id), start(s), end(e) {}
+    int       recordid;
+    QDateTime start;
+    QDateTime end;
+};
+
+static bool comp_interval_start(const SchedInterval &a,
+                                const SchedInterval &b)
+{
+    return a.start < b.start;
+}
+
+static int find_root(QMap<int,int> &parent, int id)
+{
+    while (parent[id] != id)
+    {
+        parent[id] = parent[parent[id]];
+        id = parent[id];
+    }
+    return id;
+}
+
+/** \fn Scheduler::ComputeAffectedRules(const QList<int>&)
+ *  \brief Works out which recording rules a change to the given rules
+ *         can possibly affect, so that FillRecordList() only has to
+ *         re-place those and can keep the rest of the schedule.
+ *
+ *  A changed rule can only alter the placement of showings that
+ *  overlap one of its own showings in time, and resolving a conflict
+ *  may in turn move any rule involved to any other of its showings.
+ *  The affected set is therefore the transitive closure of rule time
+ *  overlap, computed over the new recordmatch contents plus the
+ *  showings currently in reclist (which still reflect the changed
+ *  rules' old timeslots).  Rules that AddNotListed() has to invent
+ *  showings for have no recordmatch rows to reason about and are
+ *  included unconditionally.
+ *
+ *  Fills schedAffectedMap; leaves it empty, forcing a full placement
+ *  pass, if the closure can not be computed.
+ *
+ *  Must be called with schedLock held.
+ */
+void Scheduler::ComputeAffectedRules(const QList<int> &changedids)
+{
+    schedAffectedMap.clear();
+
+    vector<SchedInterval> intervals;
+
+    RecIter ri = reclist.begin();
+    for (; ri != reclist.end(); ++ri)
+    {
+        RecordingInfo *p = *ri;
+        intervals.push_back(SchedInterval(p->GetRecordingRuleID(),
+                                          p->GetRecordingStartTime(),
+                                          p->GetRecordingEndTime()));
+    }
+
+    schedLock.unlock();
+    recordmatchLock.lock();
+
+    MSqlQuery query(dbConn);
+    QString thequery = QString(
+        "SELECT recordmatch.recordid, "
+        "   program.starttime - INTERVAL RECTABLE.startoffset MINUTE, "
+        "   program.endtime + INTERVAL RECTABLE.endoffset MINUTE "
+        "FROM recordmatch "
+        "INNER JOIN RECTABLE ON (recordmatch.recordid = RECTABLE.recordid) "
+        "INNER JOIN program ON "
+        "  ( recordmatch.chanid    = program.chanid    AND "
+        "    recordmatch.starttime = program.starttime AND "
+        "    recordmatch.manualid  = program.manualid ) "
+        "WHERE program.endtime >= NOW() - INTERVAL 1 DAY;");
+    thequery.replace("RECTABLE", recordTable);
+
+    query.prepare(thequery);
+    bool ok = query.exec();
+    if (ok)
+    {
+        while (query.next())
+        {
+            intervals.push_back(SchedInterval(query.value(0).toInt(),
+                                              query.value(1).toDateTime(),
+                                              query.value(2).toDateTime()));
+        }
+    }
+    else
+        MythDB::DBError("ComputeAffectedRules", query);
+
+    QList<int> notlisted;
+    if (ok)
+    {
+        thequery = QString(
+            "SELECT RECTABLE.recordid FROM RECTABLE "
+            "LEFT JOIN recordmatch on "
+            "    RECTABLE.recordid = recordmatch.recordid "
+            "WHERE (type = %1 OR type = %2 OR type = %3 OR type = %4) AND "
+            "      recordmatch.chanid IS NULL;")
+            .arg(kSingleRecord)
+            .arg(kTimeslotRecord)
+            .arg(kWeekslotRecord)
+            .arg(kOverrideRecord);
+        thequery.replace("RECTABLE", recordTable);
+
+        query.prepare(thequery);
+        ok = query.exec();
+        if (ok)
+        {
+            while (query.next())
+                notlisted.push_back(query.value(0).toInt());
+        }
+        else
+            MythDB::DBError("ComputeAffectedRules notlisted", query);
+    }
+
+    recordmatchLock.unlock();
+    schedLock.lock();
+
+    if (!ok)
+        return;
+
+    // Group the showings into runs of transitively overlapping
+    // intervals and union the rules within each run.
+    stable_sort(intervals.begin(), intervals.end(), comp_interval_start);
+
+    QMap<int,int> parent;
+    int runrep = -1;
+    QDateTime runend;
+    vector<SchedInterval>::const_iterator it = intervals.begin();
+    for (; it != intervals.end(); ++it)
+    {
+        int id = (*it).recordid;
+        if (!parent.contains(id))
+            parent[id] = id;
+
+        if (runrep < 0 || (*it).start >= runend)
+        {
+            runrep = id;
+            runend = (*it).end;
+        }
+        else
+        {
+            parent[find_root(parent, id)] = find_root(parent, runrep);
+            if ((*it).end > runend)
+                runend = (*it).end;
+        }
+    }
+
+    QMap<int, bool> changedroots;
+    QList<int>::const_iterator cit = changedids.begin();
+    for (; cit != changedids.end(); ++cit)
+    {
+        schedAffectedMap[*cit] = true;
+        if (parent.contains(*cit))
+            changedroots[find_root(parent, *cit)] = true;
+    }
+    for (cit = notlisted.begin(); cit != notlisted.end(); ++cit)
+    {
+        schedAffectedMap[*cit] = true;
+        if (parent.contains(*cit))
+            changedroots[find_root(parent, *cit)] = true;
+    }
+
+    QMap<int,int>::iterator pit = parent.begin();
+    for (; pit != parent.end(); ++pit)
+    {
+        if (changedroots.contains(find_root(parent, pit.key())))
+            schedAffectedMap[pit.key()] = true;
+    }
+
+    VERBOSE(VB_SCHEDULE, QString("Reschedule affects %1 of %2 rules")
+            .arg(schedAffectedMap.size()).arg(parent.size()));
+}
+
+/** \class SchedNewRecordsWorker
+ *  \brief Materializes one partition of the candidate showings for
+ *         Scheduler::AddNewRecords() on its own database connection.
+ *
+ *  TEMPORARY tables are only visible on the connection that created
+ *  them, so each worker builds its own copy of sched_temp_record
+ *  before running its partition of the query.
+ */
+class SchedNewRecordsWorker : public QThread
+{
+  public:
+    SchedNewRecordsWorker(
+        Scheduler *sched, const QString &query, bool tmprecord,
+        const QMap<int, bool> &cardMap, const QMap<int, bool> &tooManyMap,
+        bool checkTooMany, int autopriority, int autostrata) :
+        m_sched(sched),               m_query(query),
+        m_tmprecord(tmprecord),       m_cardMap(cardMap),
+        m_tooManyMap(tooManyMap),     m_checkTooMany(checkTooMany),
+        m_autopriority(autopriority), m_autostrata(autostrata) {}
+
+    virtual void run(void)
+    {
+        MSqlQueryInfo conn = MSqlQuery::InitCon();
+
+        // All of this worker's queries share the one connection, so
+        // hand it back to the pool once here rather than letting each
+        // MSqlQuery destructor return it (cf. SchedCon()/DDCon()).
+        conn.returnConnection = false;
+
+        RunQueries(conn);
+
+        if (conn.db)
+            GetMythDB()->GetDBManager()->pushConnection(conn.db);
+    }
+
+  private:
+    void RunQueries(MSqlQueryInfo &conn)
+    {
+        if (m_tmprecord)
+        {
+            MSqlQuery setup(conn);
+            setup.prepare("DROP TABLE IF EXISTS sched_temp_record;");
+            if (!setup.exec())
+            {
+                MythDB::DBError("Dropping worker sched_temp_record", setup);
+                return;
+            }
+            setup.prepare("CREATE TEMPORARY TABLE sched_temp_record "
+                          "LIKE record;");
+            if (!setup.exec())
+            {
+                MythDB::DBError("Creating worker sched_temp_record", setup);
+                return;
+            }
+            setup.prepare("INSERT sched_temp_record SELECT * from record;");
+            if (!setup.exec())
+            {
+                MythDB::DBError("Populating worker sched_temp_record", setup);
+                return;
+            }
+        }
+
+        m_sched->AddNewRecordsQuery(conn, m_query, reclist,
+                                    recTypeRecPriorityMap,
+                                    m_cardMap, m_tooManyMap, m_checkTooMany,
+                                    m_autopriority, m_autostrata);
+
+        if (m_tmprecord)
+        {
+            MSqlQuery setup(conn);
+            setup.prepare("DROP TABLE IF EXISTS sched_temp_record;");
+            if (!setup.exec())
+                MythDB::DBError("Dropping worker sched_temp_record", setup);
+        }
+    }
+
+  public:
+    /// Materialized showings for this partition.
+    RecList reclist;
+    /// Per-worker RecordingInfo::GetRecordingTypeRecPriority() cache.
+    QMap<RecordingType, int> recTypeRecPriorityMap;
+
+  private:
+    Scheduler      *m_sched;
+    QString         m_query;
+    bool            m_tmprecord;
+    QMap<int, bool> m_cardMap;
+    QMap<int, bool> m_tooManyMap;
+    bool            m_checkTooMany;
+    int             m_autopriority;
+    int             m_autostrata;
+};
+
+/** \fn Scheduler::AddNewRecordsQuery(MSqlQueryInfo,const QString&,RecList&,QMap<RecordingType,int>&,const QMap<int,bool>&,const QMap<int,bool>&,bool,int,int)
+ *  \brief Runs one, possibly partitioned, candidate query for
+ *         AddNewRecords() and materializes the results into tmpList.
+ *
+ *  Runs on worker threads during a parallel pass, so it must not
+ *  touch worklist or any other mutable scheduler state; duplicate
+ *  checking against the existing worklist is done by the caller
+ *  once the partitions have been merged.
+ */
+void Scheduler::AddNewRecordsQuery(
+    MSqlQueryInfo conn, const QString &query, RecList &tmpList,
+    QMap<RecordingType, int> &recTypeRecPriorityMap,
+    const QMap<int, bool> &cardMap, const QMap<int, bool> &tooManyMap,
+    bool checkTooMany, int autopriority, int autostrata)
+{
+    struct timeval dbstart, dbend;
+
+    VERBOSE(VB_SCHEDULE, QString(" |-- Start DB Query..."));
+
+    gettimeofday(&dbstart, NULL);
+    MSqlQuery result(conn);
+    result.prepare(query);
+    if (!result.exec())
+    {
+        MythDB::DBError("AddNewRecords", result);
+        return;
+    }
+    gettimeofday(&dbend, NULL);
+
+    VERBOSE(VB_SCHEDULE, QString(" |-- %1 results in %2 sec. Processing...")
+            .arg(result.size())
+            .arg(((dbend.tv_sec  - dbstart.tv_sec) * 1000000 +
+                  (dbend.tv_usec - dbstart.tv_usec)) / 1000000.0));
+
+    while (result.next())
+    {
+        RecordingInfo *p = new RecordingInfo(
+            result.value(4).toString(),//title
+            result.value(5).toString(),//subtitle
+            result.value(6).toString(),//description
+            result.value(11).toString(),//category
+
+            result.value(0).toUInt(),//chanid
+            result.value(7).toString(),//channum
+            result.value(8).toString(),//chansign
+            result.value(9).toString(),//channame
+
+            result.value(21).toString(),//recgroup
+            result.value(35).toString(),//playgroup
+
+            result.value(42).toString(),//hostname
+            result.value(41).toString(),//storagegroup
+
+            result.value(29).toUInt(),//year
+
+            result.value(26).toString(),//seriesid
+            result.value(27).toString(),//programid
+            result.value(28).toString(),//catType
+
+            result.value(12).toInt(),//recpriority
+
+            result.value(2).toDateTime(),//startts
+            result.value(3).toDateTime(),//endts
+            result.value(18).toDateTime(),//recstartts
+            result.value(19).toDateTime(),//recendts
+
+            result.value(30).toDouble(),//stars
+            (result.value(31).isNull()) ? QDate() :
+            QDate::fromString(result.value(31).toString(), Qt::ISODate),
+            //originalAirDate
+
+            result.value(20).toInt(),//repeat
+
+            RecStatusType(result.value(36).toInt()),//oldrecstatus
+            result.value(37).toInt(),//reactivate
+
+            result.value(17).toUInt(),//recordid
+            result.value(33).toUInt(),//parentid
+            RecordingType(result.value(16).toInt()),//rectype
+            RecordingDupInType(result.value(13).toInt()),//dupin
+            RecordingDupMethodType(result.value(22).toInt()),//dupmethod
+
+            result.value(1).toUInt(),//sourceid
+            result.value(25).toUInt(),//inputid
+            result.value(24).toUInt(),//cardid
+
+            result.value(34).toUInt(),//findid
+
+            result.value(23).toInt() == COMM_DETECT_COMMFREE,//commfree
+            result.value(39).toUInt(),//subtitleType
+            result.value(38).toUInt(),//videoproperties
+            result.value(40).toUInt());//audioproperties
+
+        if (!recTypeRecPriorityMap.contains(p->GetRecordingRuleType()))
+        {
+            recTypeRecPriorityMap[p->GetRecordingRuleType()] =
+                p->GetRecordingTypeRecPriority(p->GetRecordingRuleType());
+        }
+
+        p->SetRecordingPriority(
+            p->GetRecordingPriority() + recTypeRecPriorityMap[p->GetRecordingRuleType()] +
+            result.value(45).toInt() +
+            ((autopriority) ?
+             autopriority - (result.value(44).toInt() * autostrata / 200) : 0));
+
+        RecStatusType newrecstatus = p->GetRecordingStatus();
+        // Check for rsOffLine
+        if ((threadrunning || specsched) && !cardMap.contains(p->GetCardID()))
+            newrecstatus = rsOffLine;
+
+        // Check for rsTooManyRecordings
+        if (checkTooMany && tooManyMap[p->GetRecordingRuleID()] &&
+            !p->IsReactivated())
+        {
+            newrecstatus = rsTooManyRecordings;
+        }
+
+        // Check for rsCurrentRecording and rsPreviousRecording
+        if (p->GetRecordingRuleType() == kDontRecord)
+            newrecstatus = rsDontRecord;
+        else if (result.value(15).toInt() && !p->IsReactivated())
+            newrecstatus = rsPreviousRecording;
+        else if (p->GetRecordingRuleType() != kSingleRecord &&
+                 p->GetRecordingRuleType() != kOverrideRecord &&
+                 !p->IsReactivated() &&
+                 !(p->GetDuplicateCheckMethod() & kDupCheckNone))
+        {
+            const RecordingDupInType dupin = p->GetDuplicateCheckSource();
+
+            if ((dupin & kDupsNewEpi) && p->IsRepeat())
+                newrecstatus = rsRepeat;
+
+            if ((dupin & kDupsInOldRecorded) && result.value(10).toInt())
+            {
+                if (result.value(43).toInt() == rsNeverRecord)
+                    newrecstatus = rsNeverRecord;
+                else
+                    newrecstatus = rsPreviousRecording;
+            }
+
+            if ((dupin & kDupsInRecorded) && result.value(14).toInt())
+                newrecstatus = rsCurrentRecording;
+        }
+
+        bool inactive = result.value(32).toInt();
+        if (inactive)
+            newrecstatus = rsInactive;
+
+        // Mark anything that has already passed as missed.  If it
+        // survives PruneOverlaps, it will get deleted or have its old
+        // status restored in PruneRedundants.
+        if (p->GetRecordingEndTime() < schedTime)
+            newrecstatus = rsMissed;
+
+        p->SetRecordingStatus(newrecstatus);
+
+        tmpList.push_back(p);
+    }
+}
+
 void Scheduler::AddNewRecords(void)
 {
     struct timeval dbstart, dbend;
@@ -3082,6 +3768,7 @@ void Scheduler::AddNewRecords(void)
     }
 
     QMap<int, bool> tooManyMap;
+    QList<int> allids;
     bool checkTooMany = false;
     schedAfterStartMap.clear();
 
@@ -3101,6 +3788,7 @@ void Scheduler::AddNewRecords(void)
         int maxEpisodes = rlist.value(2).toInt();
         int maxNewest = rlist.value(3).toInt();
 
+        allids.push_back(recid);
         tooManyMap[recid] = false;
         schedAfterStartMap[recid] = false;
 
@@ -3280,6 +3968,20 @@ void Scheduler::AddNewRecords(void)
         .arg(kFindWeeklyRecord)
         .arg(kOverrideRecord);
 
+    // When an incremental reschedule is running, only pull showings
+    // for the rules the change can affect; BuildWorkList() carries
+    // everything else over from the last pass.
+    QString affectedfilter;
+    if (!schedAffectedMap.empty())
+    {
+        QStringList ids;
+        QMap<int, bool>::const_iterator ait = schedAffectedMap.begin();
+        for (; ait != schedAffectedMap.end(); ++ait)
+            ids << QString::number(ait.key());
+        affectedfilter = QString(" AND recordmatch.recordid IN (%1) ")
+            .arg(ids.join(","));
+    }
+
     QString rmquery = QString(
 "UPDATE recordmatch "
 " INNER JOIN RECTABLE ON (recordmatch.recordid = RECTABLE.recordid) "
@@ -3357,7 +4059,7 @@ void Scheduler::AddNewRecords(void)
 "      findduplicate = (oldfind.findid IS NOT NULL), "
 "      oldrecstatus = oldrecorded.recstatus "
 " WHERE program.endtime >= NOW() - INTERVAL 1 DAY "
-);
+) + affectedfilter;
     rmquery.replace("RECTABLE", schedTmpRecord);
 
     pwrpri.replace("program.","p.");
@@ -3403,11 +4105,10 @@ void Scheduler::AddNewRecords(void)
         "     oldrecstatus.starttime = p.starttime AND "
         "     oldrecstatus.title     = p.title ) "
         "WHERE p.endtime >= NOW() - INTERVAL 1 DAY "
+        "FILTERCLAUSE "
         "ORDER BY RECTABLE.recordid DESC ");
     query.replace("RECTABLE", schedTmpRecord);
 
-    VERBOSE(VB_SCHEDULE, QString(" |-- Start DB Query..."));
-
     gettimeofday(&dbstart, NULL);
     result.prepare(rmquery);
     if (!result.exec())
@@ -3415,99 +4116,100 @@ void Scheduler::AddNewRecords(void)
         MythDB::DBError("AddNewRecords recordmatch", result);
         return;
     }
-    result.prepare(query);
-    if (!result.exec())
-    {
-        MythDB::DBError("AddNewRecords", result);
-        return;
-    }
     gettimeofday(&dbend, NULL);
 
-    VERBOSE(VB_SCHEDULE, QString(" |-- %1 results in %2 sec. Processing...")
-            .arg(result.size())
+    VERBOSE(VB_SCHEDULE, QString(" |-- Duplicate check %1 sec.")
             .arg(((dbend.tv_sec  - dbstart.tv_sec) * 1000000 +
                   (dbend.tv_usec - dbstart.tv_usec)) / 1000000.0));
 
-    while (result.next())
+    // Partition the candidate rules across worker threads, each with
+    // its own database connection, so that the big join and the
+    // per-row RecordingInfo construction scale with core count.
+    // TEMPORARY tables are only visible on the connection that
+    // created them, so this is only done on the real scheduler
+    // thread where recordmatch is a regular table.
+    QList<int> partids;
+    if (!schedAffectedMap.empty())
     {
-        RecordingInfo *p = new RecordingInfo(
-            result.value(4).toString(),//title
-            result.value(5).toString(),//subtitle
-            result.value(6).toString(),//description
-            result.value(11).toString(),//category
-
-            result.value(0).toUInt(),//chanid
-            result.value(7).toString(),//channum
-            result.value(8).toString(),//chansign
-            result.value(9).toString(),//channame
-
-            result.value(21).toString(),//recgroup
-            result.value(35).toString(),//playgroup
-
-            result.value(42).toString(),//hostname
-            result.value(41).toString(),//storagegroup
-
-            result.value(29).toUInt(),//year
-
-            result.value(26).toString(),//seriesid
-            result.value(27).toString(),//programid
-            result.value(28).toString(),//catType
-
-            result.value(12).toInt(),//recpriority
-
-            result.value(2).toDateTime(),//startts
-            result.value(3).toDateTime(),//endts
-            result.value(18).toDateTime(),//recstartts
-            result.value(19).toDateTime(),//recendts
-
-            result.value(30).toDouble(),//stars
-            (result.value(31).isNull()) ? QDate() :
-            QDate::fromString(result.value(31).toString(), Qt::ISODate),
-            //originalAirDate
-
-            result.value(20).toInt(),//repeat
-
-            RecStatusType(result.value(36).toInt()),//oldrecstatus
-            result.value(37).toInt(),//reactivate
-
-            result.value(17).toUInt(),//recordid
-            result.value(33).toUInt(),//parentid
-            RecordingType(result.value(16).toInt()),//rectype
-            RecordingDupInType(result.value(13).toInt()),//dupin
-            RecordingDupMethodType(result.value(22).toInt()),//dupmethod
+        QMap<int, bool>::const_iterator ait = schedAffectedMap.begin();
+        for (; ait != schedAffectedMap.end(); ++ait)
+            partids.push_back(ait.key());
+    }
+    else
+        partids = allids;
+    sort(partids.begin(), partids.end(), greater<int>());
 
-            result.value(1).toUInt(),//sourceid
-            result.value(25).toUInt(),//inputid
-            result.value(24).toUInt(),//cardid
+    int matthreads = gCoreContext->GetNumSetting(
+        "SchedulerMaterializeThreads", QThread::idealThreadCount());
+    matthreads = max(matthreads, 1);
+    matthreads = min(matthreads, (int)partids.size());
+    if (!threadrunning || specsched)
+        matthreads = 1;
 
-            result.value(34).toUInt(),//findid
+    if (matthreads > 1)
+    {
+        vector<SchedNewRecordsWorker*> workers;
+        int chunk = (partids.size() + matthreads - 1) / matthreads;
+        for (int i = 0; i < (int)partids.size(); i += chunk)
+        {
+            QStringList ids;
+            for (int j = i; j < min(i + chunk, (int)partids.size()); j++)
+                ids << QString::number(partids[j]);
+
+            QString workerquery = query;
+            workerquery.replace(
+                "FILTERCLAUSE",
+                QString("AND recordmatch.recordid IN (%1)")
+                .arg(ids.join(",")));
+
+            workers.push_back(new SchedNewRecordsWorker(
+                this, workerquery, schedTmpRecord == "sched_temp_record",
+                cardMap, tooManyMap, checkTooMany,
+                autopriority, autostrata));
+        }
 
-            result.value(23).toInt() == COMM_DETECT_COMMFREE,//commfree
-            result.value(39).toUInt(),//subtitleType
-            result.value(38).toUInt(),//videoproperties
-            result.value(40).toUInt());//audioproperties
+        for (uint i = 0; i < workers.size(); i++)
+            workers[i]->start();
 
-        if (!recTypeRecPriorityMap.contains(p->GetRecordingRuleType()))
+        // Concatenating the partitions in descending recordid order
+        // preserves the ORDER BY of the single query version.
+        for (uint i = 0; i < workers.size(); i++)
         {
-            recTypeRecPriorityMap[p->GetRecordingRuleType()] =
-                p->GetRecordingTypeRecPriority(p->GetRecordingRuleType());
+            workers[i]->wait();
+            RecIter it = workers[i]->reclist.begin();
+            for (; it != workers[i]->reclist.end(); ++it)
+                tmpList.push_back(*it);
+            workers[i]->reclist.clear();
+            delete workers[i];
         }
+    }
+    else
+    {
+        QString singlequery = query;
+        singlequery.replace("FILTERCLAUSE", affectedfilter);
+        AddNewRecordsQuery(dbConn, singlequery, tmpList,
+                           recTypeRecPriorityMap, cardMap, tooManyMap,
+                           checkTooMany, autopriority, autostrata);
+    }
 
-        p->SetRecordingPriority(
-            p->GetRecordingPriority() + recTypeRecPriorityMap[p->GetRecordingRuleType()] +
-            result.value(45).toInt() +
-            ((autopriority) ?
-             autopriority - (result.value(44).toInt() * autostrata / 200) : 0));
+    VERBOSE(VB_SCHEDULE, " +-- Cleanup...");
+    uint norig = worklist.size();
+    RecIter tmp = tmpList.begin();
+    for ( ; tmp != tmpList.end(); ++tmp)
+    {
+        RecordingInfo *p = *tmp;
 
         // Check to see if the program is currently recording and if
         // the end time was changed.  Ideally, checking for a new end
         // time should be done after PruneOverlaps, but that would
         // complicate the list handling.  Do it here unless it becomes
-        // problematic.
-        RecIter rec = worklist.begin();
-        for ( ; rec != worklist.end(); ++rec)
+        // problematic.  Only the entries carried over from reclist
+        // are checked, matching the single query version where the
+        // new showings were not yet in the worklist.
+        bool dup = false;
+        for (uint j = 0; j < norig; j++)
         {
-            RecordingInfo *r = *rec;
+            RecordingInfo *r = worklist[j];
             if (p->IsSameTimeslot(*r))
             {
                 if (r->GetInputID() == p->GetInputID() &&
@@ -3516,72 +4218,14 @@ void Scheduler::AddNewRecords(void)
                      p->GetRecordingRuleType() == kOverrideRecord))
                     ChangeRecordingEnd(r, p);
                 delete p;
-                p = NULL;
+                dup = true;
                 break;
             }
         }
-        if (p == NULL)
-            continue;
-
-        RecStatusType newrecstatus = p->GetRecordingStatus();
-        // Check for rsOffLine
-        if ((threadrunning || specsched) && !cardMap.contains(p->GetCardID()))
-            newrecstatus = rsOffLine;
-
-        // Check for rsTooManyRecordings
-        if (checkTooMany && tooManyMap[p->GetRecordingRuleID()] &&
-            !p->IsReactivated())
-        {
-            newrecstatus = rsTooManyRecordings;
-        }
-
-        // Check for rsCurrentRecording and rsPreviousRecording
-        if (p->GetRecordingRuleType() == kDontRecord)
-            newrecstatus = rsDontRecord;
-        else if (result.value(15).toInt() && !p->IsReactivated())
-            newrecstatus = rsPreviousRecording;
-        else if (p->GetRecordingRuleType() != kSingleRecord &&
-                 p->GetRecordingRuleType() != kOverrideRecord &&
-                 !p->IsReactivated() &&
-                 !(p->GetDuplicateCheckMethod() & kDupCheckNone))
-        {
-            const RecordingDupInType dupin = p->GetDuplicateCheckSource();
-
-            if ((dupin & kDupsNewEpi) && p->IsRepeat())
-                newrecstatus = rsRepeat;
-
-            if ((dupin & kDupsInOldRecorded) && result.value(10).toInt())
-            {
-                if (result.value(43).toInt() == rsNeverRecord)
-                    newrecstatus = rsNeverRecord;
-                else
-                    newrecstatus = rsPreviousRecording;
-            }
-
-            if ((dupin & kDupsInRecorded) && result.value(14).toInt())
-                newrecstatus = rsCurrentRecording;
-        }
-
-        bool inactive = result.value(32).toInt();
-        if (inactive)
-            newrecstatus = rsInactive;
-
-        // Mark anything that has already passed as missed.  If it
-        // survives PruneOverlaps, it will get deleted or have its old
-        // status restored in PruneRedundants.
-        if (p->GetRecordingEndTime() < schedTime)
-            newrecstatus = rsMissed;
-
-        p->SetRecordingStatus(newrecstatus);
-
-        tmpList.push_back(p);
+        if (!dup)
+            worklist.push_back(p);
     }
 
-    VERBOSE(VB_SCHEDULE, " +-- Cleanup...");
-    RecIter tmp = tmpList.begin();
-    for ( ; tmp != tmpList.end(); ++tmp)
-        worklist.push_back(*tmp);
-
     if (schedTmpRecord == "sched_temp_record")
     {
         result.prepare("DROP TABLE IF EXISTS sched_temp_record;");
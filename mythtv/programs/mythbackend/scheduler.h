@@ -37,6 +37,8 @@ class Scheduler : public QObject
 {
     Q_OBJECT
 
+    friend class SchedNewRecordsWorker;
+
   public:
     Scheduler(bool runthread, QMap<int, EncoderLink *> *tvList,
               QString recordTbl = "record", Scheduler *master_sched = NULL);
@@ -97,15 +99,24 @@ class Scheduler : public QObject
     bool FillRecordList(bool doLock);
     void UpdateMatches(int recordid);
     void UpdateManuals(int recordid);
+    void ComputeAffectedRules(const QList<int> &changedids);
     void BuildWorkList(void);
     bool ClearWorkList(void);
     void AddNewRecords(void);
+    void AddNewRecordsQuery(MSqlQueryInfo conn, const QString &query,
+                            RecList &tmpList,
+                            QMap<RecordingType, int> &recTypeRecPriorityMap,
+                            const QMap<int, bool> &cardMap,
+                            const QMap<int, bool> &tooManyMap,
+                            bool checkTooMany,
+                            int autopriority, int autostrata);
     void AddNotListed(void);
     void BuildNewRecordsQueries(int recordid, QStringList &from, QStringList &where,
                                 MSqlBindings &bindings);
     void PruneOverlaps(void);
     void BuildListMaps(void);
     void ClearListMaps(void);
+    quint64 ComputePlacementHash(void) const;
 
     bool IsBusyRecording(const RecordingInfo *rcinfo);
 
@@ -162,10 +173,19 @@ class Scheduler : public QObject
 
     bool reclist_changed;
 
+    // Hash of the placement inputs of the last completed pass, or 0
+    // when its outcome can not be reused.
+    // \sa ComputePlacementHash(void)
+    quint64 lastPlaceHash;
+
     bool specsched;
     bool schedMoveHigher;
     bool schedulingEnabled;
     QMap<int, bool> schedAfterStartMap;
+    // Rules a pending reschedule can possibly affect.  When non-empty,
+    // FillRecordList() re-places only these rules and carries the rest
+    // of reclist over unchanged.  \sa ComputeAffectedRules(const QList<int>&)
+    QMap<int, bool> schedAffectedMap;
 
     QMap<int, EncoderLink *> *m_tvList;
     AutoExpire *expirer;
@@ -156,6 +156,19 @@ QString UPnpCDSTv::GetItemListSQL( QString /* sColumn */ )
 //
 /////////////////////////////////////////////////////////////////////////////
 
+QString UPnpCDSTv::GetItemListOrderBy( QString /* sColumn */ )
+{
+    // Paged Browse requests turn into LIMIT queries, which are only
+    // stable with a deterministic order.  Match the "All Recordings"
+    // presentation order.
+
+    return "ORDER BY starttime DESC";
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////
+
 void UPnpCDSTv::BuildItemQuery( MSqlQuery &query, const QStringMap &mapParams )
 {
     int     nChanId    = mapParams[ "ChanId"    ].toInt();
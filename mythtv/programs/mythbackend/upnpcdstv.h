@@ -36,6 +36,7 @@ class UPnpCDSTv : public UPnpCDSExtension
         virtual int              GetRootCount  ( );
         virtual QString          GetTableName  ( QString sColumn );
         virtual QString          GetItemListSQL( QString sColumn = "" );
+        virtual QString          GetItemListOrderBy( QString sColumn = "" );
 
         virtual void             BuildItemQuery( MSqlQuery        &query,
                                                  const QStringMap &mapParams );
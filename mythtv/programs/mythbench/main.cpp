@@ -0,0 +1,439 @@
+/*  mythbench
+ *  Performance regression benchmarks for library hot paths.
+ *
+ *  Exercises MPEGStreamData TS demultiplexing, MythSocket string
+ *  list messaging (text and binary encodings) and, when a database
+ *  is available, the recordedseek position-map operations.  Each
+ *  benchmark prints a human readable line and a machine readable
+ *  "key value" result; --save records the results and --baseline
+ *  compares a run against a saved file, flagging any benchmark
+ *  that slowed by more than the threshold.
+ *
+ *  Decoder, scheduler and painter benchmarks are not included:
+ *  AvFormatDecoder needs sample media, the scheduler is built into
+ *  mythbackend rather than a library, and MythPainter needs a
+ *  window.  "make bench" in this directory builds and runs the
+ *  suite; see also mythiobench for the file I/O paths.
+ */
+
+// POSIX headers
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+
+// C++ headers
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#include <iostream>
+using namespace std;
+
+// Qt headers
+#include <QCoreApplication>
+#include <QStringList>
+#include <QString>
+#include <QFile>
+#include <QMap>
+
+// MythTV headers
+#include "exitcodes.h"
+#include "mythcontext.h"
+#include "mythverbose.h"
+#include "mythversion.h"
+#include "mythsocket.h"
+#include "programinfo.h"
+#include "compat.h"
+#include "mpeg/tspacket.h"
+#include "mpeg/mpegstreamdata.h"
+#include "mpeg/streamlisteners.h"
+
+#define LOC QString("Bench: ")
+
+static const uint kDefaultMB       = 256;
+static const uint kDefaultMsgs     = 100000;
+static const uint kDemuxPID        = 0x1001;
+static const uint kPacketsPerChunk = 1024;
+static const uint kPosMapEntries   = 7200; // ~2 hours of GOPs
+static const uint kBenchChanId     = 987654;
+
+static double now_ms(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (tv.tv_sec * 1000.0) + (tv.tv_usec / 1000.0);
+}
+
+///////////////////////////////////////////////////////////////////////
+// result collection and baseline comparison
+
+/// Benchmark results, higher is always better.
+static vector<pair<QString, double> > results;
+
+static void record(const QString &key, double value)
+{
+    results.push_back(make_pair(key, value));
+}
+
+static bool load_baseline(const QString &fname, QMap<QString, double> &vals)
+{
+    QFile f(fname);
+    if (!f.open(QIODevice::ReadOnly))
+    {
+        VERBOSE(VB_IMPORTANT, LOC +
+                QString("Failed to open baseline '%1'").arg(fname));
+        return false;
+    }
+
+    while (!f.atEnd())
+    {
+        QStringList parts = QString(f.readLine()).simplified().split(" ");
+        if (parts.size() >= 2)
+            vals[parts[0]] = parts[1].toDouble();
+    }
+    return true;
+}
+
+static bool save_results(const QString &fname)
+{
+    QFile f(fname);
+    if (!f.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        VERBOSE(VB_IMPORTANT, LOC +
+                QString("Failed to write results to '%1'").arg(fname));
+        return false;
+    }
+
+    for (uint i = 0; i < results.size(); i++)
+    {
+        f.write(qPrintable(QString("%1 %2\n")
+                           .arg(results[i].first)
+                           .arg(results[i].second, 0, 'f', 1)));
+    }
+    return true;
+}
+
+/// Prints the machine readable results, returns the regression count.
+static uint print_results(const QMap<QString, double> &baseline,
+                          double threshold)
+{
+    uint regressions = 0;
+    for (uint i = 0; i < results.size(); i++)
+    {
+        QString line = QString("%1 %2")
+            .arg(results[i].first)
+            .arg(results[i].second, 0, 'f', 1);
+
+        QMap<QString, double>::const_iterator it =
+            baseline.find(results[i].first);
+        if (it != baseline.end() && *it > 0.0)
+        {
+            double delta = 100.0 * (results[i].second - *it) / (*it);
+            line += QString(" baseline %1 delta %2%")
+                .arg(*it, 0, 'f', 1).arg(delta, 0, 'f', 1);
+            if (delta < -threshold)
+            {
+                line += " REGRESSION";
+                regressions++;
+            }
+        }
+
+        cout << qPrintable(line) << endl;
+    }
+    return regressions;
+}
+
+///////////////////////////////////////////////////////////////////////
+// MPEGStreamData demux benchmark
+
+class BenchPacketCounter : public TSPacketListener
+{
+  public:
+    BenchPacketCounter() : m_count(0) {}
+    virtual bool ProcessTSPacket(const TSPacket&) { m_count++; return true; }
+    uint64_t m_count;
+};
+
+static bool bench_demux(uint mbytes)
+{
+    // Synthesize a chunk of payload packets on a single PID with
+    // valid continuity counters, the shape of a video elementary
+    // stream as seen by the recorders.
+    uint chunk_size = kPacketsPerChunk * TSPacket::SIZE;
+    unsigned char *chunk = new unsigned char[chunk_size];
+    memset(chunk, 0xA5, chunk_size);
+    for (uint i = 0; i < kPacketsPerChunk; i++)
+    {
+        unsigned char *pkt = chunk + (i * TSPacket::SIZE);
+        pkt[0] = SYNC_BYTE;
+        pkt[1] = (kDemuxPID >> 8) & 0x1f;
+        pkt[2] = kDemuxPID & 0xff;
+        pkt[3] = 0x10 | (i & 0xf); // payload only + continuity
+    }
+
+    MPEGStreamData sd(-1, false);
+    BenchPacketCounter counter;
+    sd.AddListeningPID(kDemuxPID);
+    sd.AddWritingPID(kDemuxPID);
+    sd.AddWritingListener(&counter);
+
+    uint chunks = (mbytes * 1024 * 1024) / chunk_size;
+    double start = now_ms();
+    for (uint i = 0; i < chunks; i++)
+        sd.ProcessData(chunk, chunk_size);
+    double elapsed = now_ms() - start;
+
+    sd.RemoveWritingListener(&counter);
+    delete [] chunk;
+
+    if (counter.m_count != (uint64_t)chunks * kPacketsPerChunk)
+    {
+        VERBOSE(VB_IMPORTANT, LOC + "Demux dropped packets, aborting");
+        return false;
+    }
+
+    double mb = (counter.m_count * TSPacket::SIZE) / (1024.0 * 1024.0);
+    double per_sec = counter.m_count / (elapsed / 1000.0);
+    cout << qPrintable(QString("%1: %2 MB in %3 s, %4 MB/s")
+                       .arg("MPEGStreamData demux", -24)
+                       .arg(mb, 0, 'f', 1)
+                       .arg(elapsed / 1000.0, 0, 'f', 2)
+                       .arg(mb / (elapsed / 1000.0), 0, 'f', 1))
+         << endl;
+
+    record("demux_packets_per_sec", per_sec);
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////
+// MythSocket string list benchmark
+
+struct SocketWriterArgs
+{
+    MythSocket *sock;
+    uint        msgs;
+    bool        ok;
+};
+
+static void *run_socket_writer(void *arg)
+{
+    SocketWriterArgs *swa = (SocketWriterArgs*) arg;
+    swa->ok = false;
+
+    // the shape of a QUERY_RECORDINGS response row
+    QStringList msg;
+    for (uint i = 0; i < 16; i++)
+        msg.push_back(QString("benchmark field %1 0123456789").arg(i));
+
+    for (uint i = 0; i < swa->msgs; i++)
+    {
+        if (!swa->sock->writeStringList(msg))
+            return NULL;
+    }
+
+    swa->ok = true;
+    return NULL;
+}
+
+static bool bench_socket(uint msgs, bool binary)
+{
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) < 0)
+    {
+        VERBOSE(VB_IMPORTANT, LOC + "Failed to create socket pair" + ENO);
+        return false;
+    }
+
+    MythSocket *writer = new MythSocket(fds[0]);
+    MythSocket *reader = new MythSocket(fds[1]);
+    writer->UpRef();
+    reader->UpRef();
+    if (binary)
+    {
+        writer->setBinaryMode(true);
+        reader->setBinaryMode(true);
+    }
+
+    SocketWriterArgs swa;
+    swa.sock = writer;
+    swa.msgs = msgs;
+    pthread_t thread;
+    pthread_create(&thread, NULL, run_socket_writer, &swa);
+
+    QStringList list;
+    uint received = 0;
+    double start = now_ms();
+    for (; received < msgs; received++)
+    {
+        if (!reader->readStringList(list))
+            break;
+    }
+    double elapsed = now_ms() - start;
+
+    pthread_join(thread, NULL);
+    writer->DownRef();
+    reader->DownRef();
+
+    if (!swa.ok || received != msgs)
+    {
+        VERBOSE(VB_IMPORTANT, LOC +
+                QString("Socket benchmark failed after %1 of %2 messages")
+                .arg(received).arg(msgs));
+        return false;
+    }
+
+    QString name = binary ? "MythSocket binary" : "MythSocket text";
+    double per_sec = msgs / (elapsed / 1000.0);
+    cout << qPrintable(QString("%1: %2 msgs in %3 s, %4 msgs/s")
+                       .arg(name, -24)
+                       .arg(msgs)
+                       .arg(elapsed / 1000.0, 0, 'f', 2)
+                       .arg(per_sec, 0, 'f', 0))
+         << endl;
+
+    record(binary ? "socket_binary_msgs_per_sec" : "socket_text_msgs_per_sec",
+           per_sec);
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////
+// position map benchmark (needs a database)
+
+static bool bench_posmap(void)
+{
+    // A synthetic recording key well away from real chanids; the
+    // rows are removed again before returning.
+    ProgramInfo pginfo;
+    pginfo.SetChanID(kBenchChanId);
+    pginfo.SetRecordingStartTime(QDateTime::currentDateTime());
+
+    frm_pos_map_t posMap;
+    for (uint i = 0; i < kPosMapEntries; i++)
+        posMap[(uint64_t)i * 15] = (uint64_t)i * 2000000;
+
+    pginfo.ClearPositionMap(MARK_GOP_BYFRAME);
+
+    double start = now_ms();
+    pginfo.SavePositionMap(posMap, MARK_GOP_BYFRAME);
+    double save_ms = now_ms() - start;
+
+    uint queries = 100;
+    frm_pos_map_t readback;
+    start = now_ms();
+    for (uint i = 0; i < queries; i++)
+        pginfo.QueryPositionMap(readback, MARK_GOP_BYFRAME);
+    double query_ms = now_ms() - start;
+
+    pginfo.ClearPositionMap(MARK_GOP_BYFRAME);
+
+    if (readback.size() != posMap.size())
+    {
+        VERBOSE(VB_IMPORTANT, LOC + "Position map readback mismatch");
+        return false;
+    }
+
+    cout << qPrintable(QString("%1: save %2 ms, query %3 ms "
+                               "(%4 entries)")
+                       .arg("Position map", -24)
+                       .arg(save_ms, 0, 'f', 1)
+                       .arg(query_ms / queries, 0, 'f', 2)
+                       .arg(kPosMapEntries))
+         << endl;
+
+    record("posmap_save_entries_per_sec",
+           kPosMapEntries / (save_ms / 1000.0));
+    record("posmap_queries_per_sec", queries / (query_ms / 1000.0));
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////
+
+static void usage(const char *progname)
+{
+    cerr << "Usage: " << progname << " [options]" << endl
+         << "Options:" << endl
+         << "  --mb <size>        MB demultiplexed "
+            "(default: " << kDefaultMB << ")" << endl
+         << "  --msgs <n>         socket messages per encoding "
+            "(default: " << kDefaultMsgs << ")" << endl
+         << "  --db               also run the database benchmarks" << endl
+         << "  --save <file>      save results for later comparison" << endl
+         << "  --baseline <file>  compare against saved results" << endl
+         << "  --threshold <pct>  regression threshold in percent "
+            "(default: 10)" << endl
+         << "  -v, --verbose      enable verbose messages" << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+
+    uint    mbytes    = kDefaultMB;
+    uint    msgs      = kDefaultMsgs;
+    bool    use_db    = false;
+    double  threshold = 10.0;
+    QString savefile;
+    QString basefile;
+
+    for (int argpos = 1; argpos < a.argc(); ++argpos)
+    {
+        QString arg = a.argv()[argpos];
+        if (arg == "--mb" && (argpos + 1) < a.argc())
+            mbytes = QString(a.argv()[++argpos]).toUInt();
+        else if (arg == "--msgs" && (argpos + 1) < a.argc())
+            msgs = QString(a.argv()[++argpos]).toUInt();
+        else if (arg == "--db")
+            use_db = true;
+        else if (arg == "--save" && (argpos + 1) < a.argc())
+            savefile = a.argv()[++argpos];
+        else if (arg == "--baseline" && (argpos + 1) < a.argc())
+            basefile = a.argv()[++argpos];
+        else if (arg == "--threshold" && (argpos + 1) < a.argc())
+            threshold = QString(a.argv()[++argpos]).toDouble();
+        else if (arg == "-v" || arg == "--verbose")
+            print_verbose_messages |= VB_GENERAL;
+        else
+        {
+            usage(a.argv()[0]);
+            return GENERIC_EXIT_INVALID_CMDLINE;
+        }
+    }
+
+    if (!mbytes || !msgs)
+    {
+        usage(a.argv()[0]);
+        return GENERIC_EXIT_INVALID_CMDLINE;
+    }
+
+    QMap<QString, double> baseline;
+    if (!basefile.isEmpty() && !load_baseline(basefile, baseline))
+        return GENERIC_EXIT_INVALID_CMDLINE;
+
+    gContext = new MythContext(MYTH_BINARY_VERSION);
+    if (!gContext->Init(
+            false/*use gui*/, NULL/*upnp*/, false/*prompt for backend*/,
+            false/*bypass auto discovery*/, !use_db/*ignoreDB*/))
+    {
+        VERBOSE(VB_IMPORTANT, "Failed to init MythContext, exiting.");
+        return GENERIC_EXIT_NO_MYTHCONTEXT;
+    }
+
+    bool ok = bench_demux(mbytes);
+    ok &= bench_socket(msgs, false);
+    ok &= bench_socket(msgs, true);
+    if (use_db)
+        ok &= bench_posmap();
+
+    uint regressions = 0;
+    if (ok)
+    {
+        regressions = print_results(baseline, threshold);
+        if (!savefile.isEmpty())
+            ok &= save_results(savefile);
+    }
+
+    delete gContext;
+    return (ok && !regressions) ? GENERIC_EXIT_OK : GENERIC_EXIT_NOT_OK;
+}
+
+/* vim: set expandtab tabstop=4 shiftwidth=4: */
@@ -0,0 +1,22 @@
+include ( ../../settings.pro )
+include ( ../../version.pro )
+include ( ../programs-libs.pro )
+
+QT += network xml sql
+
+TEMPLATE = app
+CONFIG += thread
+TARGET = mythbench
+target.path = $${PREFIX}/bin
+INSTALLS = target
+
+QMAKE_CLEAN += $(TARGET)
+
+# "make bench" builds and runs the suite
+bench.target   = bench
+bench.depends  = $(TARGET)
+bench.commands = ./$(TARGET)
+QMAKE_EXTRA_TARGETS += bench
+
+# Input
+SOURCES += main.cpp
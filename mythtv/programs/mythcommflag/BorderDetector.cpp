@@ -59,6 +59,119 @@ BorderDetector::setLogoState(TemplateFinder *finder)
     }
 }
 
+bool
+BorderDetector::lineIsUniform(const AVPicture *pgm, bool isrow, int line,
+        int p0, int p1, int maxrange, int maxoutliers) const
+{
+    /*
+     * Same uniformity criterion as the full border scan, applied to a
+     * single row (isrow) or column, with the min/max range local to the
+     * line.
+     */
+    const int       pgmwidth = pgm->linesize[0];
+    unsigned char   minval = UCHAR_MAX;
+    unsigned char   maxval = 0;
+    unsigned char   val;
+    int             outliers = 0;
+
+    for (int pp = p0; pp < p1; pp++)
+    {
+        const int rr = isrow ? line : pp;
+        const int cc = isrow ? pp : line;
+
+        if (logo && rrccinrect(rr, cc, logorow, logocol,
+                    logowidth, logoheight))
+            continue;   /* Exclude logo area from analysis. */
+
+        val = pgm->data[0][rr * pgmwidth + cc];
+        if (max(maxval, val) - min(minval, val) + 1 > maxrange)
+        {
+            if (outliers++ < maxoutliers)
+                continue;
+            return false;
+        }
+        if (val < minval)
+            minval = val;
+        if (val > maxval)
+            maxval = val;
+    }
+    return true;
+}
+
+bool
+BorderDetector::cachedGeometryValid(const AVPicture *pgm,
+        int minrow, int maxrow1, int mincol, int maxcol1,
+        int maxrange, int maxoutliers, int vertslop, int horizslop) const
+{
+    /*
+     * Check whether the previous frame's geometry still fits this
+     * frame: each detected bar is sampled at its outer, middle and
+     * inner lines, and the content edges must not look like bars
+     * themselves.  A failed check falls back to the full scan, so a
+     * stale match can only survive if the bars and content edges all
+     * still pass the scan's own uniformity test.
+     */
+    const int   crow1 = row + height;           /* content bottom + 1 */
+    const int   ccol1 = col + width;            /* content right + 1 */
+    const int   lsaved = col - horizslop - 1;   /* last uniform lines */
+    const int   rsaved = ccol1 + horizslop;
+    const int   tsaved = row - vertslop - 1;
+    const int   bsaved = crow1 + vertslop;
+
+    if (width <= 0 || height <= 0)
+        return false;
+
+    /*
+     * Content must still reach its edges. (Fails on very dark scenes,
+     * which then take the full scan, as before.)
+     */
+    if (lineIsUniform(pgm, false, col, row, crow1, maxrange, maxoutliers) ||
+        lineIsUniform(pgm, false, ccol1 - 1, row, crow1,
+            maxrange, maxoutliers) ||
+        lineIsUniform(pgm, true, row, col, ccol1, maxrange, maxoutliers) ||
+        lineIsUniform(pgm, true, crow1 - 1, col, ccol1,
+            maxrange, maxoutliers))
+        return false;
+
+    if (lsaved > mincol &&
+            (!lineIsUniform(pgm, false, mincol, row, crow1,
+                    maxrange, maxoutliers) ||
+             !lineIsUniform(pgm, false, (mincol + lsaved) / 2, row, crow1,
+                    maxrange, maxoutliers) ||
+             !lineIsUniform(pgm, false, lsaved, row, crow1,
+                    maxrange, maxoutliers)))
+        return false;
+
+    if (rsaved < maxcol1 - 1 &&
+            (!lineIsUniform(pgm, false, rsaved, row, crow1,
+                    maxrange, maxoutliers) ||
+             !lineIsUniform(pgm, false, (rsaved + maxcol1 - 1) / 2,
+                    row, crow1, maxrange, maxoutliers) ||
+             !lineIsUniform(pgm, false, maxcol1 - 1, row, crow1,
+                    maxrange, maxoutliers)))
+        return false;
+
+    if (tsaved > minrow &&
+            (!lineIsUniform(pgm, true, minrow, col, ccol1,
+                    maxrange, maxoutliers) ||
+             !lineIsUniform(pgm, true, (minrow + tsaved) / 2, col, ccol1,
+                    maxrange, maxoutliers) ||
+             !lineIsUniform(pgm, true, tsaved, col, ccol1,
+                    maxrange, maxoutliers)))
+        return false;
+
+    if (bsaved < maxrow1 - 1 &&
+            (!lineIsUniform(pgm, true, bsaved, col, ccol1,
+                    maxrange, maxoutliers) ||
+             !lineIsUniform(pgm, true, (bsaved + maxrow1 - 1) / 2,
+                    col, ccol1, maxrange, maxoutliers) ||
+             !lineIsUniform(pgm, true, maxrow1 - 1, col, ccol1,
+                    maxrange, maxoutliers)))
+        return false;
+
+    return true;
+}
+
 int
 BorderDetector::getDimensions(const AVPicture *pgm, int pgmheight,
         long long _frameno, int *prow, int *pcol, int *pwidth, int *pheight)
@@ -150,6 +263,19 @@ BorderDetector::getDimensions(const AVPicture *pgm, int pgmheight,
     mincol = HORIZMARGIN;
     maxcol1 = pgmwidth - HORIZMARGIN;   /* maxcol + 1 */
 
+    /*
+     * Letterbox geometry changes maybe twice per program, so validate
+     * the previous frame's geometry against a few sampled lines and
+     * reuse it rather than rescanning the whole border every frame.
+     */
+    if (frameno != -1 && !ismonochromatic &&
+            cachedGeometryValid(pgm, minrow, maxrow1, mincol, maxcol1,
+                MAXRANGE, MAXOUTLIERS, VERTSLOP, HORIZSLOP))
+    {
+        frameno = _frameno;
+        goto done;
+    }
+
     newrow = minrow - 1;
     newcol = mincol - 1;
     newwidth = maxcol1 + 1 - mincol;
@@ -32,6 +32,13 @@ public:
     int reportTime(void);
 
 private:
+    bool lineIsUniform(const AVPicture *pgm, bool isrow, int line,
+            int p0, int p1, int maxrange, int maxoutliers) const;
+    bool cachedGeometryValid(const AVPicture *pgm,
+            int minrow, int maxrow1, int mincol, int maxcol1,
+            int maxrange, int maxoutliers,
+            int vertslop, int horizslop) const;
+
     TemplateFinder          *logoFinder;
     const struct AVPicture  *logo;
     int                     logorow, logocol;
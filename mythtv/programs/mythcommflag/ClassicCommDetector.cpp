@@ -11,6 +11,7 @@ using namespace std;
 
 // Qt headers
 #include <QString>
+#include <QRunnable>
 
 // MythTV headers
 #include "mythcontext.h"
@@ -145,6 +146,7 @@ ClassicCommDetector::ClassicCommDetector(SkipType commDetectMethod_in,
     recordingStartedAt(recordingStartedAt_in),
     recordingStopsAt(recordingStopsAt_in),     aggressiveDetection(false),
     stillRecording(recordingStopsAt > QDateTime::currentDateTime()),
+    reducedAnalysis(false),
     fullSpeed(fullSpeed_in),                   showProgress(showProgress_in),
     fps(0.0),                                  framesProcessed(0),
     preRoll(0),                                postRoll(0)
@@ -533,7 +535,18 @@ bool ClassicCommDetector::go()
             }
         }
 
-        ProcessFrame(currentFrame, currentFrameNumber);
+        /*
+         * When we have fallen too far behind an in-progress recording,
+         * analyze only every other frame until we catch back up.  The
+         * skipped frames still have to be decoded, but they bypass the
+         * blank/scene/logo pixel scans and inherit the previous frame's
+         * results instead.
+         */
+        if (reducedAnalysis && (currentFrameNumber & 1) &&
+            frameInfo.contains(currentFrameNumber - 1))
+            ProcessFrameShallow(currentFrameNumber);
+        else
+            ProcessFrame(currentFrame, currentFrameNumber);
 
         if (stillRecording)
         {
@@ -560,7 +573,28 @@ bool ClassicCommDetector::go()
             }
             else if (secondsBehind < requiredBuffer)
                 usecSleep = (long)(usecPerFrame * 1.5);
-            
+
+            /*
+             * If the host is too loaded to keep up with the recorder even
+             * at full speed, shed analysis work rather than disk work.
+             * The gap between the entry and exit thresholds keeps us from
+             * toggling on every pass through the loop.
+             */
+            if (!reducedAnalysis && (secondsBehind > (2 * requiredBuffer)))
+            {
+                reducedAnalysis = true;
+                VERBOSE(VB_COMMFLAG,
+                        QString("Flagging is %1 seconds behind the "
+                                "recording, analyzing every other frame "
+                                "until it catches up.").arg(secondsBehind));
+            }
+            else if (reducedAnalysis && (secondsBehind <= requiredBuffer))
+            {
+                reducedAnalysis = false;
+                VERBOSE(VB_COMMFLAG, "Flagging caught up to the recording, "
+                                     "resuming full analysis.");
+            }
+
             if (usecSleep > 0)
                 usleep(usecSleep);
         }
@@ -683,6 +717,7 @@ void ClassicCommDetector::recordingFinished(long long totalFileSize)
     (void)totalFileSize;
 
     stillRecording = false;
+    reducedAnalysis = false;
 }
 
 void ClassicCommDetector::requestCommBreakMapUpdate(void)
@@ -728,23 +763,49 @@ void ClassicCommDetector::SetVideoParams(float aspect)
     }
 }
 
+/// Runs ClassicCommDetector's blank frame scan on a pool thread.
+class BlankFramePass : public QRunnable
+{
+  public:
+    BlankFramePass(ClassicCommDetector *parent, unsigned char *buf,
+                   FrameInfoEntry *info) :
+        m_parent(parent), m_buf(buf), m_info(info)
+    {
+    }
+
+    void run(void)
+    {
+        m_parent->AnalyzeBlankFrame(m_buf, m_info);
+    }
+
+  private:
+    ClassicCommDetector *m_parent;
+    unsigned char       *m_buf;
+    FrameInfoEntry      *m_info;
+};
+
+/// Runs ClassicCommDetector's logo presence check on a pool thread.
+class LogoCheckPass : public QRunnable
+{
+  public:
+    LogoCheckPass(ClassicCommDetector *parent, unsigned char *buf) :
+        m_parent(parent), m_buf(buf)
+    {
+    }
+
+    void run(void)
+    {
+        m_parent->AnalyzeLogo(m_buf);
+    }
+
+  private:
+    ClassicCommDetector *m_parent;
+    unsigned char       *m_buf;
+};
+
 void ClassicCommDetector::ProcessFrame(VideoFrame *frame,
                                        long long frame_number)
 {
-    int max = 0;
-    int min = 255;
-    int avg = 0;
-    unsigned char pixel;
-    int blankPixelsChecked = 0;
-    long long totBrightness = 0;
-    unsigned char *rowMax = new unsigned char[height];
-    unsigned char *colMax = new unsigned char[width];
-    memset(rowMax, 0, sizeof(*rowMax)*height);
-    memset(colMax, 0, sizeof(*colMax)*width);
-    int topDarkRow = commDetectBorder;
-    int bottomDarkRow = height - commDetectBorder - 1;
-    int leftDarkCol = commDetectBorder;
-    int rightDarkCol = width - commDetectBorder - 1;
     FrameInfoEntry fInfo;
 
     if (!frame || frame_number == -1 || frame->codec != FMT_YV12)
@@ -794,142 +855,27 @@ void ClassicCommDetector::ProcessFrame(VideoFrame *frame,
 
     frameInfo[curFrameNumber] = fInfo;
 
-    if (commDetectMethod & COMM_DETECT_BLANKS)
-        frameIsBlank = false;
-
-    if (commDetectMethod & COMM_DETECT_SCENE)
-    {
-        sceneChangeDetector->processFrame(framePtr);
-    }
-
+    frameIsBlank = false;
     stationLogoPresent = false;
 
-    for(int y = commDetectBorder; y < (height - commDetectBorder);
-            y += vertSpacing)
-    {
-        for(int x = commDetectBorder; x < (width - commDetectBorder);
-                x += horizSpacing)
-        {
-            pixel = framePtr[y * width + x];
-
-            if (commDetectMethod & COMM_DETECT_BLANKS)
-            {
-                 bool checkPixel = false;
-                 if (!commDetectBlankCanHaveLogo)
-                     checkPixel = true;
-
-                 if (!logoInfoAvailable)
-                     checkPixel = true;
-                 else if (!logoDetector->pixelInsideLogo(x,y))
-                     checkPixel=true;
-
-                 if (checkPixel)
-                 {
-                     blankPixelsChecked++;
-                     totBrightness += pixel;
-  
-                     if (pixel < min)
-                          min = pixel;
-
-                     if (pixel > max)
-                          max = pixel;
-
-                     if (pixel > rowMax[y])
-                         rowMax[y] = pixel;
-
-                     if (pixel > colMax[x])
-                         colMax[x] = pixel;
-                 }
-            }
-        }
-    }
+    // Fan the independent pixel passes out to the pool; the scene
+    // change detector runs here in the meantime because its results
+    // come back through a signal that must fire on this thread
+    FrameInfoEntry *info = &frameInfo[curFrameNumber];
 
     if (commDetectMethod & COMM_DETECT_BLANKS)
-    {
-        for(int y = commDetectBorder; y < (height - commDetectBorder);
-                y += vertSpacing)
-        {
-            if (rowMax[y] > commDetectBoxBrightness)
-                break;
-            else
-                topDarkRow = y;
-        }
-
-        for(int y = commDetectBorder; y < (height - commDetectBorder);
-                y += vertSpacing)
-            if (rowMax[y] >= commDetectBoxBrightness)
-                bottomDarkRow = y;
-
-        delete[] rowMax;
-
-        for(int x = commDetectBorder; x < (width - commDetectBorder);
-                x += horizSpacing)
-        {
-            if (colMax[x] > commDetectBoxBrightness)
-                break;
-            else
-                leftDarkCol = x;
-        }
-
-        for(int x = commDetectBorder; x < (width - commDetectBorder);
-                x += horizSpacing)
-            if (colMax[x] >= commDetectBoxBrightness)
-                rightDarkCol = x;
-
-        delete[] colMax;
-
-        if ((topDarkRow > commDetectBorder) &&
-            (topDarkRow < (height * .20)) &&
-            (bottomDarkRow < (height - commDetectBorder)) &&
-            (bottomDarkRow > (height * .80)))
-        {
-            frameInfo[curFrameNumber].format = COMM_FORMAT_LETTERBOX;
-        }
-        else if ((leftDarkCol > commDetectBorder) &&
-                 (leftDarkCol < (width * .20)) &&
-                 (rightDarkCol < (width - commDetectBorder)) &&
-                 (rightDarkCol > (width * .80)))
-        {
-            frameInfo[curFrameNumber].format = COMM_FORMAT_PILLARBOX;
-        }
-        else
-        {
-            frameInfo[curFrameNumber].format = COMM_FORMAT_NORMAL;
-        }
-
-        avg = totBrightness / blankPixelsChecked;
-
-        frameInfo[curFrameNumber].minBrightness = min;
-        frameInfo[curFrameNumber].maxBrightness = max;
-        frameInfo[curFrameNumber].avgBrightness = avg;
-
-        totalMinBrightness += min;
-        commDetectDimAverage = min + 10;
-
-        // Is the frame really dark
-        if (((max - min) <= commDetectBlankFrameMaxDiff) &&
-            (max < commDetectDimBrightness))
-            frameIsBlank = true;
-
-        // Are we non-strict and the frame is blank
-        if ((!aggressiveDetection) &&
-            ((max - min) <= commDetectBlankFrameMaxDiff))
-            frameIsBlank = true;
-
-        // Are we non-strict and the frame is dark
-        //                   OR the frame is dim and has a low avg brightness
-        if ((!aggressiveDetection) &&
-            ((max < commDetectDarkBrightness) ||
-             ((max < commDetectDimBrightness) && (avg < commDetectDimAverage))))
-            frameIsBlank = true;
-    }
+        analyzePool.start(new BlankFramePass(this, framePtr, info));
 
     if ((logoInfoAvailable) && (commDetectMethod & COMM_DETECT_LOGO))
+        analyzePool.start(new LogoCheckPass(this, framePtr));
+
+    if (commDetectMethod & COMM_DETECT_SCENE)
     {
-        stationLogoPresent =
-            logoDetector->doesThisFrameContainTheFoundLogo(framePtr);
+        sceneChangeDetector->processFrame(framePtr);
     }
 
+    analyzePool.waitForDone();
+
 #if 0
     if ((commDetectMethod == COMM_DETECT_ALL) &&
         (CheckRatingSymbol()))
@@ -976,6 +922,181 @@ void ClassicCommDetector::ProcessFrame(VideoFrame *frame,
     framesProcessed++;
 }
 
+/** \fn ClassicCommDetector::ProcessFrameShallow(long long)
+ *  \brief Records a frame without analyzing its pixels.
+ *
+ *   Used when flagging a recording in progress falls too far behind the
+ *   recorder.  The frame inherits the previous frame's blank, logo and
+ *   format information; the scene change flag is not carried over since
+ *   duplicating it would inflate the scene change rate.
+ */
+void ClassicCommDetector::ProcessFrameShallow(long long frame_number)
+{
+    FrameInfoEntry fInfo = frameInfo[frame_number - 1];
+
+    fInfo.flagMask &= ~COMM_FRAME_SCENE_CHANGE;
+    fInfo.flagMask |= COMM_FRAME_SKIPPED;
+    fInfo.sceneChangePercent = -1;
+
+    curFrameNumber = frame_number;
+    lastFrameNumber = frame_number;
+    frameInfo[frame_number] = fInfo;
+
+    if (fInfo.flagMask & COMM_FRAME_BLANK)
+    {
+        blankFrameMap[frame_number] = MARK_BLANK_FRAME;
+        blankFrameCount++;
+    }
+
+    framesProcessed++;
+}
+
+/** \fn ClassicCommDetector::AnalyzeBlankFrame(unsigned char*,FrameInfoEntry*)
+ *  \brief Scans a frame for blankness and letterbox/pillarbox format.
+ *
+ *   Runs on a pool thread while the scene change detector has the
+ *   decode thread.  Everything written here is either local, the frame's
+ *   own FrameInfoEntry, or members no other analysis pass touches.
+ */
+void ClassicCommDetector::AnalyzeBlankFrame(unsigned char *buf,
+                                            FrameInfoEntry *info)
+{
+    int max = 0;
+    int min = 255;
+    int avg = 0;
+    unsigned char pixel;
+    int blankPixelsChecked = 0;
+    long long totBrightness = 0;
+    unsigned char *rowMax = new unsigned char[height];
+    unsigned char *colMax = new unsigned char[width];
+    memset(rowMax, 0, sizeof(*rowMax)*height);
+    memset(colMax, 0, sizeof(*colMax)*width);
+    int topDarkRow = commDetectBorder;
+    int bottomDarkRow = height - commDetectBorder - 1;
+    int leftDarkCol = commDetectBorder;
+    int rightDarkCol = width - commDetectBorder - 1;
+
+    for(int y = commDetectBorder; y < (height - commDetectBorder);
+            y += vertSpacing)
+    {
+        for(int x = commDetectBorder; x < (width - commDetectBorder);
+                x += horizSpacing)
+        {
+            pixel = buf[y * width + x];
+
+            bool checkPixel = false;
+            if (!commDetectBlankCanHaveLogo)
+                checkPixel = true;
+
+            if (!logoInfoAvailable)
+                checkPixel = true;
+            else if (!logoDetector->pixelInsideLogo(x,y))
+                checkPixel=true;
+
+            if (checkPixel)
+            {
+                blankPixelsChecked++;
+                totBrightness += pixel;
+
+                if (pixel < min)
+                     min = pixel;
+
+                if (pixel > max)
+                     max = pixel;
+
+                if (pixel > rowMax[y])
+                    rowMax[y] = pixel;
+
+                if (pixel > colMax[x])
+                    colMax[x] = pixel;
+            }
+        }
+    }
+
+    for(int y = commDetectBorder; y < (height - commDetectBorder);
+            y += vertSpacing)
+    {
+        if (rowMax[y] > commDetectBoxBrightness)
+            break;
+        else
+            topDarkRow = y;
+    }
+
+    for(int y = commDetectBorder; y < (height - commDetectBorder);
+            y += vertSpacing)
+        if (rowMax[y] >= commDetectBoxBrightness)
+            bottomDarkRow = y;
+
+    delete[] rowMax;
+
+    for(int x = commDetectBorder; x < (width - commDetectBorder);
+            x += horizSpacing)
+    {
+        if (colMax[x] > commDetectBoxBrightness)
+            break;
+        else
+            leftDarkCol = x;
+    }
+
+    for(int x = commDetectBorder; x < (width - commDetectBorder);
+            x += horizSpacing)
+        if (colMax[x] >= commDetectBoxBrightness)
+            rightDarkCol = x;
+
+    delete[] colMax;
+
+    if ((topDarkRow > commDetectBorder) &&
+        (topDarkRow < (height * .20)) &&
+        (bottomDarkRow < (height - commDetectBorder)) &&
+        (bottomDarkRow > (height * .80)))
+    {
+        info->format = COMM_FORMAT_LETTERBOX;
+    }
+    else if ((leftDarkCol > commDetectBorder) &&
+             (leftDarkCol < (width * .20)) &&
+             (rightDarkCol < (width - commDetectBorder)) &&
+             (rightDarkCol > (width * .80)))
+    {
+        info->format = COMM_FORMAT_PILLARBOX;
+    }
+    else
+    {
+        info->format = COMM_FORMAT_NORMAL;
+    }
+
+    avg = totBrightness / blankPixelsChecked;
+
+    info->minBrightness = min;
+    info->maxBrightness = max;
+    info->avgBrightness = avg;
+
+    totalMinBrightness += min;
+    commDetectDimAverage = min + 10;
+
+    // Is the frame really dark
+    if (((max - min) <= commDetectBlankFrameMaxDiff) &&
+        (max < commDetectDimBrightness))
+        frameIsBlank = true;
+
+    // Are we non-strict and the frame is blank
+    if ((!aggressiveDetection) &&
+        ((max - min) <= commDetectBlankFrameMaxDiff))
+        frameIsBlank = true;
+
+    // Are we non-strict and the frame is dark
+    //                   OR the frame is dim and has a low avg brightness
+    if ((!aggressiveDetection) &&
+        ((max < commDetectDarkBrightness) ||
+         ((max < commDetectDimBrightness) && (avg < commDetectDimAverage))))
+        frameIsBlank = true;
+}
+
+/// Checks a frame for the detected station logo on a pool thread.
+void ClassicCommDetector::AnalyzeLogo(unsigned char *buf)
+{
+    stationLogoPresent = logoDetector->doesThisFrameContainTheFoundLogo(buf);
+}
+
 void ClassicCommDetector::ClearAllMaps(void)
 {
     VERBOSE(VB_COMMFLAG, "CommDetect::ClearAllMaps()");
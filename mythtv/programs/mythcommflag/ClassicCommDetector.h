@@ -8,6 +8,7 @@
 #include <QObject>
 #include <QMap>
 #include <QDateTime>
+#include <QThreadPool>
 
 // MythTV headers
 #include "programinfo.h"
@@ -68,6 +69,8 @@ class ClassicCommDetector : public CommDetectorBase
         void logoDetectorBreathe();
 
         friend class ClassicLogoDetector;
+        friend class BlankFramePass;
+        friend class LogoCheckPass;
 
     protected:
         virtual ~ClassicCommDetector() {}
@@ -111,6 +114,8 @@ class ClassicCommDetector : public CommDetectorBase
             frm_dir_map_t &out, const show_map_t &in);
         void CleanupFrameInfo(void);
         void GetLogoCommBreakMap(show_map_t &map);
+        void AnalyzeBlankFrame(unsigned char *buf, FrameInfoEntry *info);
+        void AnalyzeLogo(unsigned char *buf);
 
         enum SkipTypes commDetectMethod;
         frm_dir_map_t lastSentCommBreakMap;
@@ -173,12 +178,17 @@ class ClassicCommDetector : public CommDetectorBase
 
         SceneChangeDetectorBase* sceneChangeDetector;
 
+        // runs the blank and logo passes for a frame while the scene
+        // change detector works on the decode thread
+        QThreadPool analyzePool;
+
 protected:
         MythPlayer *player;
         QDateTime startedAt, stopsAt;
         QDateTime recordingStartedAt, recordingStopsAt;
         bool aggressiveDetection;
         bool stillRecording;
+        bool reducedAnalysis;
         bool fullSpeed;
         bool showProgress;
         double fps;
@@ -190,6 +200,7 @@ protected:
         void Init();
         void SetVideoParams(float aspect);
         void ProcessFrame(VideoFrame *frame, long long frame_number);
+        void ProcessFrameShallow(long long frame_number);
         QMap<long long, FrameInfoEntry> frameInfo;
 
 public slots:
@@ -20,10 +20,68 @@ extern "C" {
 #include "FrameAnalyzer.h"
 #include "EdgeDetector.h"
 
+#ifdef MMX
+extern "C" {
+// from libavcodec/dsputil.h, which is not C++ clean
+int mm_support(void);
+}
+#define ASM(code) __asm__ __volatile__(code);
+#endif
+
 namespace edgeDetector {
 
 using namespace frameAnalyzer;
 
+static void
+sgm_row(unsigned int *sgmrow, const unsigned char *rr0,
+        const unsigned char *rr1, int c0, int c1)
+{
+    /* SGM of the columns [c0,c1) of one row given that row and the next. */
+    int     cc = c0;
+    int     dx, dy;
+
+#ifdef MMX
+    if (mm_support() & FF_MM_SSE2)
+    {
+        for (; cc + 8 <= c1; cc += 8)
+        {
+            /* dx = SE - NW, dy = SW - NE for eight pixels; the squares
+             * fit in words (255^2), the sums are widened to dwords */
+            ASM("pxor %xmm7, %xmm7")
+            ASM("movq %0, %%xmm0"::"m"(rr1[cc + 1]))
+            ASM("movq %0, %%xmm1"::"m"(rr0[cc]))
+            ASM("movq %0, %%xmm2"::"m"(rr1[cc]))
+            ASM("movq %0, %%xmm3"::"m"(rr0[cc + 1]))
+            ASM("punpcklbw %xmm7, %xmm0")
+            ASM("punpcklbw %xmm7, %xmm1")
+            ASM("punpcklbw %xmm7, %xmm2")
+            ASM("punpcklbw %xmm7, %xmm3")
+            ASM("psubw %xmm1, %xmm0")               /* dx */
+            ASM("psubw %xmm3, %xmm2")               /* dy */
+            ASM("pmullw %xmm0, %xmm0")              /* dx * dx */
+            ASM("pmullw %xmm2, %xmm2")              /* dy * dy */
+            ASM("movdqa %xmm0, %xmm1")
+            ASM("punpcklwd %xmm7, %xmm0")
+            ASM("punpckhwd %xmm7, %xmm1")
+            ASM("movdqa %xmm2, %xmm3")
+            ASM("punpcklwd %xmm7, %xmm2")
+            ASM("punpckhwd %xmm7, %xmm3")
+            ASM("paddd %xmm2, %xmm0")
+            ASM("paddd %xmm3, %xmm1")
+            ASM("movdqu %%xmm0, %0":"=m"(sgmrow[cc]):)
+            ASM("movdqu %%xmm1, %0":"=m"(sgmrow[cc + 4]):)
+        }
+    }
+#endif
+
+    for (; cc < c1; cc++)
+    {
+        dx = rr1[cc + 1] - rr0[cc];     /* southeast - northwest */
+        dy = rr1[cc] - rr0[cc + 1];     /* southwest - northeast */
+        sgmrow[cc] = dx * dx + dy * dy;
+    }
+}
+
 unsigned int *
 sgm_init_exclude(unsigned int *sgm, const AVPicture *src, int srcheight,
         int excluderow, int excludecol, int excludewidth, int excludeheight)
@@ -35,27 +93,33 @@ sgm_init_exclude(unsigned int *sgm, const AVPicture *src, int srcheight,
      * Intuitively, the SGM of a pixel is a measure of the "edge intensity" of
      * that pixel: how much it differs from its neighbors.
      */
-    const int       srcwidth = src->linesize[0];
-    int             rr, cc, dx, dy, rr2, cc2;
-    unsigned char   *rr0, *rr1;
+    const int           srcwidth = src->linesize[0];
+    int                 rr, rr2, cc2;
+    const unsigned char *rr0, *rr1;
 
     memset(sgm, 0, srcwidth * srcheight * sizeof(*sgm));
     rr2 = srcheight - 1;
     cc2 = srcwidth - 1;
     for (rr = 0; rr < rr2; rr++)
     {
-        for (cc = 0; cc < cc2; cc++)
+        /*
+         * The exclusion rectangle covers at most one contiguous span of
+         * this row; clip it once here so the pixel kernel stays
+         * branch-free.
+         */
+        int exc0 = cc2;
+        int exc1 = cc2;
+
+        if (rr >= excluderow && rr < excluderow + excludeheight)
         {
-            if (!rrccinrect(rr, cc, excluderow, excludecol,
-                        excludewidth, excludeheight))
-            {
-                rr0 = &src->data[0][rr * srcwidth + cc];
-                rr1 = &src->data[0][(rr + 1) * srcwidth + cc];
-                dx = rr1[1] - rr0[0];   /* southeast - northwest */
-                dy = rr1[0] - rr0[1];   /* southwest - northeast */
-                sgm[rr * srcwidth + cc] = dx * dx + dy * dy;
-            }
+            exc0 = min(max(0, excludecol), cc2);
+            exc1 = min(max(0, excludecol + excludewidth), cc2);
         }
+
+        rr0 = &src->data[0][rr * srcwidth];
+        rr1 = &src->data[0][(rr + 1) * srcwidth];
+        sgm_row(sgm + rr * srcwidth, rr0, rr1, 0, exc0);
+        sgm_row(sgm + rr * srcwidth, rr0, rr1, exc1, cc2);
     }
     return sgm;
 }
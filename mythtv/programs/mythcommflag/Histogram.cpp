@@ -20,21 +20,44 @@ void Histogram::generateFromImage(unsigned char* frame, unsigned int frameWidth,
          unsigned int minScanY, unsigned int maxScanY, unsigned int XSpacing,
          unsigned int YSpacing)
 {
-    memset(data,0,sizeof(data));
-    numberOfSamples = 0;
-
     if (maxScanX > frameWidth-1)
         maxScanX = frameWidth-1;
 
     if (maxScanY > frameHeight-1)
         maxScanY = frameHeight-1;
 
+    /*
+     * Four interleaved tallies keep a run of equal pixels (flat frames
+     * are the common case here) from serializing on a single counter;
+     * they are folded into "data" below.
+     */
+    unsigned int tally[4][256];
+    memset(tally,0,sizeof(tally));
+
     for(unsigned int y = minScanY; y < maxScanY; y += YSpacing)
-        for(unsigned int x = minScanX; x < maxScanX; x += XSpacing)
+    {
+        const unsigned char *row = frame + y * frameWidth;
+        unsigned int x = minScanX;
+
+        for(; x + 3*XSpacing < maxScanX; x += 4*XSpacing)
         {
-            data[frame[y * frameWidth + x]]++;
-            numberOfSamples++;
+            tally[0][row[x]]++;
+            tally[1][row[x + XSpacing]]++;
+            tally[2][row[x + 2*XSpacing]]++;
+            tally[3][row[x + 3*XSpacing]]++;
         }
+        for(; x < maxScanX; x += XSpacing)
+            tally[0][row[x]]++;
+    }
+
+    for(unsigned int i = 0; i < 256; i++)
+        data[i] = tally[0][i] + tally[1][i] + tally[2][i] + tally[3][i];
+
+    unsigned int rows = minScanY < maxScanY ?
+        (maxScanY - minScanY + YSpacing - 1) / YSpacing : 0;
+    unsigned int cols = minScanX < maxScanX ?
+        (maxScanX - minScanX + XSpacing - 1) / XSpacing : 0;
+    numberOfSamples = rows * cols;
 }
 
 unsigned int Histogram::getAverageIntensity(void) const
@@ -4,6 +4,10 @@
 // ANSI C headers
 #include <cmath>
 
+// C++ headers
+#include <algorithm>
+using namespace std;
+
 // MythTV headers
 #include "mythcorecontext.h"
 #include "mythplayer.h"
@@ -13,7 +17,6 @@
 #include "FrameAnalyzer.h"
 #include "PGMConverter.h"
 #include "BorderDetector.h"
-#include "quickselect.h"
 #include "TemplateFinder.h"
 #include "HistogramAnalyzer.h"
 
@@ -131,6 +134,50 @@ writeData(QString filename, float *mean, unsigned char *median, float *stddev,
     return true;
 }
 
+unsigned int
+hist_span(const unsigned char *src, int c0, int c1, int cinc,
+        unsigned int (*hist)[UCHAR_MAX + 1],
+        unsigned long long *psumval, unsigned long long *psumsquares)
+{
+    /*
+     * Accumulate one span of sampled pixels; returns the sample count.
+     * Four interleaved partial histograms break the read-modify-write
+     * dependence on popular bins (a flat or dark frame otherwise
+     * serializes on one counter); analyzeFrame merges them afterwards.
+     */
+    unsigned long long  sumval = 0;
+    unsigned long long  sumsquares = 0;
+    int                 cc = c0;
+
+    for (; cc + 3 * cinc < c1; cc += 4 * cinc)
+    {
+        const unsigned int v0 = src[cc];
+        const unsigned int v1 = src[cc + cinc];
+        const unsigned int v2 = src[cc + 2 * cinc];
+        const unsigned int v3 = src[cc + 3 * cinc];
+
+        sumval += v0 + v1 + v2 + v3;
+        sumsquares += v0 * v0 + v1 * v1 + v2 * v2 + v3 * v3;
+        hist[0][v0]++;
+        hist[1][v1]++;
+        hist[2][v2]++;
+        hist[3][v3]++;
+    }
+
+    for (; cc < c1; cc += cinc)
+    {
+        const unsigned int val = src[cc];
+
+        sumval += val;
+        sumsquares += val * val;
+        hist[0][val]++;
+    }
+
+    *psumval += sumval;
+    *psumsquares += sumsquares;
+    return c0 < c1 ? (c1 - c0 + cinc - 1) / cinc : 0;
+}
+
 };  /* namespace */
 
 HistogramAnalyzer::HistogramAnalyzer(PGMConverter *pgmc, BorderDetector *bd,
@@ -154,7 +201,6 @@ HistogramAnalyzer::HistogramAnalyzer(PGMConverter *pgmc, BorderDetector *bd,
     , fheight(NULL)
     , histogram(NULL)
     , monochromatic(NULL)
-    , buf(NULL)
     , lastframeno(-1)
     , debugLevel(0)
 #ifdef PGM_CONVERT_GREYSCALE
@@ -203,8 +249,6 @@ HistogramAnalyzer::~HistogramAnalyzer()
         delete []fheight;
     if (histogram)
         delete []histogram;
-    if (buf)
-        delete []buf;
 }
 
 enum FrameAnalyzer::analyzeFrameResult
@@ -260,9 +304,6 @@ HistogramAnalyzer::MythPlayerInited(MythPlayer *player, long long nframes)
     memset(histogram, 0, nframes * sizeof(*histogram));
     memset(monochromatic, 0, nframes * sizeof(*monochromatic));
 
-    unsigned int npixels = width * height;
-    buf = new unsigned char[npixels];
-
     if (debug_histval)
     {
         if (readData(debugdata, mean, median, stddev, frow, fcol,
@@ -304,16 +345,24 @@ HistogramAnalyzer::analyzeFrame(const VideoFrame *frame, long long frameno)
      */
     static const int    RINC = 4;
     static const int    CINC = 4;
+
+    /*
+     * High-resolution sources get double the sampling stride so the
+     * per-frame cost stays roughly that of SD content.
+     */
+    static const int    HIRES_WIDTH = 1280;
 #define ROUNDUP(a,b)    (((a) + (b) - 1) / (b) * (b))
 
     const AVPicture     *pgm;
     int                 pgmwidth, pgmheight;
     bool                ismonochromatic;
     int                 croprow, cropcol, cropwidth, cropheight;
+    int                 rinc, cinc;
     unsigned int        borderpixels, livepixels, npixels, halfnpixels;
-    unsigned char       *pp, bordercolor;
+    unsigned int        hist[4][UCHAR_MAX + 1];
+    unsigned char       bordercolor;
     unsigned long long  sumval, sumsquares;
-    int                 rr, cc, rr1, cc1, rr2, cc2, rr3, cc3;
+    int                 rr, rr1, cc1, rr2, cc2, rr3, cc3;
     struct timeval      start, end, elapsed;
 
     if (lastframeno != UNCACHED && lastframeno == frameno)
@@ -341,44 +390,55 @@ HistogramAnalyzer::analyzeFrame(const VideoFrame *frame, long long frameno)
         cropwidth = pgmwidth / 4;
     }
 
-    rr1 = ROUNDUP(croprow, RINC);
-    cc1 = ROUNDUP(cropcol, CINC);
-    rr2 = ROUNDUP(croprow + cropheight, RINC);
-    cc2 = ROUNDUP(cropcol + cropwidth, CINC);
-    rr3 = ROUNDUP(pgmheight, RINC);
-    cc3 = ROUNDUP(pgmwidth, CINC);
+    rinc = pgmwidth >= HIRES_WIDTH ? 2 * RINC : RINC;
+    cinc = pgmwidth >= HIRES_WIDTH ? 2 * CINC : CINC;
 
-    borderpixels = (rr1 / RINC) * (cc3 / CINC) +        /* top */
-        ((rr2 - rr1) / RINC) * (cc1 / CINC) +           /* left */
-        ((rr2 - rr1) / RINC) * ((cc3 - cc2) / CINC) +   /* right */
-        ((rr3 - rr2) / RINC) * (cc3 / CINC);            /* bottom */
+    rr1 = ROUNDUP(croprow, rinc);
+    cc1 = ROUNDUP(cropcol, cinc);
+    rr2 = ROUNDUP(croprow + cropheight, rinc);
+    cc2 = ROUNDUP(cropcol + cropwidth, cinc);
+    rr3 = ROUNDUP(pgmheight, rinc);
+    cc3 = ROUNDUP(pgmwidth, cinc);
+
+    borderpixels = (rr1 / rinc) * (cc3 / cinc) +        /* top */
+        ((rr2 - rr1) / rinc) * (cc1 / cinc) +           /* left */
+        ((rr2 - rr1) / rinc) * ((cc3 - cc2) / cinc) +   /* right */
+        ((rr3 - rr2) / rinc) * (cc3 / cinc);            /* bottom */
 
     sumval = 0;
     sumsquares = 0;
     livepixels = 0;
-    pp = &buf[borderpixels];
-    memset(histval, 0, sizeof(histval));
-    histval[DEFAULT_COLOR] += borderpixels;
-    for (rr = rr1; rr < rr2; rr += RINC)
+    memset(hist, 0, sizeof(hist));
+    for (rr = rr1; rr < rr2; rr += rinc)
     {
-        int rroffset = rr * pgmwidth;
+        const unsigned char *src = &pgm->data[0][rr * pgmwidth];
+        int exc0 = cc2;
+        int exc1 = cc2;
 
-        for (cc = cc1; cc < cc2; cc += CINC)
+        if (logo && rr >= logorr1 && rr <= logorr2)
         {
-            if (logo && rr >= logorr1 && rr <= logorr2 &&
-                    cc >= logocc1 && cc <= logocc2)
-                continue; /* Exclude logo area from analysis. */
-
-            unsigned char val = pgm->data[0][rroffset + cc];
-            *pp++ = val;
-            sumval += val;
-            sumsquares += val * val;
-            livepixels++;
-            histval[val]++;
+            /*
+             * Exclude logo area from analysis. The logo rectangle
+             * covers at most one contiguous run of sample columns, so
+             * clip it here and keep the pixel kernel branch-free.
+             */
+            exc0 = min(cc2, max(cc1, ROUNDUP(logocc1, cinc)));
+            exc1 = min(cc2, max(cc1, ROUNDUP(logocc2 + 1, cinc)));
         }
+
+        livepixels += hist_span(src, cc1, exc0, cinc, hist,
+                &sumval, &sumsquares);
+        livepixels += hist_span(src, exc1, cc2, cinc, hist,
+                &sumval, &sumsquares);
     }
     npixels = borderpixels + livepixels;
 
+    memset(histval, 0, sizeof(histval));
+    histval[DEFAULT_COLOR] += borderpixels;
+    for (unsigned int color = 0; color < UCHAR_MAX + 1; color++)
+        histval[color] += hist[0][color] + hist[1][color] +
+            hist[2][color] + hist[3][color];
+
     /* Scale scores down to [0..255]. */
     halfnpixels = npixels / 2;
     for (unsigned int color = 0; color < UCHAR_MAX + 1; color++)
@@ -397,10 +457,35 @@ HistogramAnalyzer::analyzeFrame(const VideoFrame *frame, long long frameno)
         sumsquares += borderpixels * bordercolor * bordercolor;
     }
 
-    memset(buf, bordercolor, borderpixels * sizeof(*buf));
     monochromatic[frameno] = ismonochromatic ? 1 : 0;
     mean[frameno] = (float)sumval / npixels;
-    median[frameno] = quick_select_median(buf, npixels);
+
+    /*
+     * Median via a 256-bin prefix scan over the histogram we already
+     * have, instead of quickselect over a copy of the sampled pixels.
+     * The border pixels count as "bordercolor" here, as they did in
+     * the copied buffer.
+     */
+    {
+        const unsigned int  target = (npixels - 1) / 2;  /* sorted index */
+        unsigned int        cumulative = 0;
+        unsigned int        color;
+
+        for (color = 0; color < UCHAR_MAX; color++)
+        {
+            unsigned int count = histval[color];
+
+            if (color == DEFAULT_COLOR)
+                count -= borderpixels;
+            if (color == bordercolor)
+                count += borderpixels;
+            cumulative += count;
+            if (cumulative > target)
+                break;
+        }
+        median[frameno] = color;
+    }
+
     stddev[frameno] = npixels > 1 ?
         sqrt((sumsquares - (float)sumval * sumval / npixels) / (npixels - 1)) :
             0;
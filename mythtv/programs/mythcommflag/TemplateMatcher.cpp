@@ -1,7 +1,9 @@
 // POSIX headers
+#include <stdint.h>
 #include <sys/time.h>      /* gettimeofday */
 
 // ANSI C headers
+#include <climits>
 #include <cstdlib>
 #include <cmath>
 
@@ -30,6 +32,14 @@ using namespace std;
 using namespace commDetector2;
 using namespace frameAnalyzer;
 
+#ifdef MMX
+extern "C" {
+// from libavcodec/dsputil.h, which is not C++ clean
+int mm_support(void);
+}
+#define ASM(code) __asm__ __volatile__(code);
+#endif
+
 namespace {
 
 int
@@ -62,6 +72,44 @@ pgm_match(const AVPicture *tmpl, const AVPicture *test, int height,
     }
 
     score = 0;
+
+#ifdef MMX
+    if (!radius && (mm_support() & FF_MM_SSE2))
+    {
+        /*
+         * Edge maps only hold 0 or UCHAR_MAX, so with no jitter radius
+         * the score is the population count of "tmpl AND test": psadbw
+         * sums sixteen bytes per iteration and the factor of UCHAR_MAX
+         * divides back out of the total.
+         */
+        const unsigned char *tp = tmpl->data[0];
+        const unsigned char *sp = test->data[0];
+        const int           size = height * width;
+        uint64_t            sums[2] __attribute__ ((aligned (16)));
+        int                 ii = 0;
+
+        ASM("pxor %xmm7, %xmm7")
+        ASM("pxor %xmm6, %xmm6")
+        for (; ii + 16 <= size; ii += 16)
+        {
+            ASM("movdqu %0, %%xmm0"::"m"(tp[ii]))
+            ASM("movdqu %0, %%xmm1"::"m"(sp[ii]))
+            ASM("pand %xmm1, %xmm0")
+            ASM("psadbw %xmm7, %xmm0")
+            ASM("paddq %xmm0, %xmm6")
+        }
+        ASM("movdqa %%xmm6, %0":"=m"(sums[0]):)
+        score = (int)((sums[0] + sums[1]) / UCHAR_MAX);
+
+        for (; ii < size; ii++)
+            if (tp[ii] && sp[ii])
+                score++;
+
+        *pscore = score;
+        return 0;
+    }
+#endif
+
     for (rr = 0; rr < height; rr++)
     {
         for (cc = 0; cc < width; cc++)
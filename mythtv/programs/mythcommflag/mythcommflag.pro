@@ -48,6 +48,13 @@ SOURCES += PrePostRollFlagger.cpp
 
 SOURCES += main.cpp
 
+# Benchmark the detectors against an annotated reference clip corpus:
+#   make bench CLIPDIR=/path/to/clips
+bench.target = bench
+bench.depends = $(TARGET)
+bench.commands = PATH=.:$(PATH) $${PWD}/mythcommflag-bench $(CLIPDIR)
+QMAKE_EXTRA_TARGETS += bench
+
 #The following line was inserted by qt3to4
 QT += xml sql
 
@@ -1,4 +1,5 @@
 #include <climits>
+#include <cstring>
 
 extern "C" {
 #include "libavcodec/avcodec.h"
@@ -8,6 +9,14 @@ extern "C" {
 #include "myth_imgconvert.h"
 #include "pgm.h"
 
+#ifdef MMX
+extern "C" {
+// from libavcodec/dsputil.h, which is not C++ clean
+int mm_support(void);
+}
+#define ASM(code) __asm__ __volatile__(code);
+#endif
+
 /*
  * N.B.: this is really C code, but VERBOSE, #define'd in mythverbose.h, is in
  * a C++ header file, so this has to be compiled with a C++ compiler, which
@@ -38,6 +47,27 @@ pgm_fill(AVPicture *dst, const VideoFrame *frame)
         return -1;
     }
 
+    /*
+     * For planar YUV sources the greyscale image is the luma plane, so
+     * copy it row by row rather than paying for a swscale colorspace
+     * conversion of the whole frame. The copy is purely memory-bandwidth
+     * bound; memcpy already uses the widest loads the CPU has.
+     */
+    if (srcfmt == PIX_FMT_YUV420P)
+    {
+        const unsigned char *srcrow = frame->buf + frame->offsets[0];
+        unsigned char *dstrow = dst->data[0];
+
+        for (int row = 0; row < frame->height; row++)
+        {
+            memcpy(dstrow, srcrow, frame->width);
+            srcrow += frame->pitches[0];
+            dstrow += dst->linesize[0];
+        }
+
+        return 0;
+    }
+
     if (avpicture_fill(&src, frame->buf, srcfmt, frame->width,
                 frame->height) < 0)
     {
@@ -235,6 +265,88 @@ pgm_overlay(AVPicture *dst, const AVPicture *s1, int s1height,
     return 0;
 }
 
+/* 8.8 fixed-point representation of the normalized convolution mask. */
+static const int CONVOLVE_BITS = 8;
+static const int CONVOLVE_SCALE = 1 << CONVOLVE_BITS;
+static const int CONVOLVE_ROUND = CONVOLVE_SCALE / 2;
+static const int CONVOLVE_MAX_WIDTH = 33;   /* taps; plenty for any caller */
+
+static void
+convolve_pass(unsigned char *dst, const unsigned char *src, int width,
+        int r0, int r1, int c0, int c1, int step,
+        const unsigned short *imask, const unsigned short (*xmask)[8],
+        int mask_radius)
+{
+    /*
+     * One single-dimensional convolution pass with the fixed-point mask
+     * "imask": "step" selects the direction, 1 for a row pass or the
+     * image width for a column pass.  "xmask" holds the same weights
+     * pre-broadcast for the SSE2 kernel.
+     */
+    int     rr, cc, ii;
+
+#ifdef MMX
+    if (mm_support() & FF_MM_SSE2)
+    {
+        static const uint64_t XMM_ROUND[2] __attribute__ ((aligned (16))) =
+            { 0x0080008000800080ULL, 0x0080008000800080ULL };
+
+        for (rr = r0; rr < r1; rr++)
+        {
+            const unsigned char *sp = src + rr * width + c0;
+            unsigned char       *dp = dst + rr * width + c0;
+
+            for (cc = c0; cc + 16 <= c1; cc += 16, sp += 16, dp += 16)
+            {
+                /* sixteen pixels; weights sum to CONVOLVE_SCALE so the
+                 * word accumulators cannot overflow */
+                ASM("pxor %xmm7, %xmm7")
+                ASM("movdqa %0, %%xmm0"::"m"(XMM_ROUND[0]))
+                ASM("movdqa %xmm0, %xmm1")
+                for (ii = -mask_radius; ii <= mask_radius; ii++)
+                {
+                    ASM("movdqu %0, %%xmm2"::"m"(sp[ii * step]))
+                    ASM("movdqa %xmm2, %xmm3")
+                    ASM("punpcklbw %xmm7, %xmm2")
+                    ASM("punpckhbw %xmm7, %xmm3")
+                    ASM("pmullw %0, %%xmm2"::"m"(xmask[ii + mask_radius][0]))
+                    ASM("pmullw %0, %%xmm3"::"m"(xmask[ii + mask_radius][0]))
+                    ASM("paddusw %xmm2, %xmm0")
+                    ASM("paddusw %xmm3, %xmm1")
+                }
+                ASM("psrlw $8, %xmm0")  /* CONVOLVE_BITS */
+                ASM("psrlw $8, %xmm1")
+                ASM("packuswb %xmm1, %xmm0")
+                ASM("movdqu %%xmm0, %0":"=m"(*dp):)
+            }
+
+            for (; cc < c1; cc++, sp++, dp++)
+            {
+                unsigned int sum = CONVOLVE_ROUND;
+                for (ii = -mask_radius; ii <= mask_radius; ii++)
+                    sum += imask[ii + mask_radius] * sp[ii * step];
+                *dp = (unsigned char)(sum >> CONVOLVE_BITS);
+            }
+        }
+        return;
+    }
+#else
+    (void)xmask;    /* gcc */
+#endif
+
+    for (rr = r0; rr < r1; rr++)
+    {
+        for (cc = c0; cc < c1; cc++)
+        {
+            unsigned int sum = CONVOLVE_ROUND;
+            for (ii = -mask_radius; ii <= mask_radius; ii++)
+                sum += imask[ii + mask_radius] *
+                    src[rr * width + cc + ii * step];
+            dst[rr * width + cc] = (unsigned char)(sum >> CONVOLVE_BITS);
+        }
+    }
+}
+
 int
 pgm_convolve_radial(AVPicture *dst, AVPicture *s1, AVPicture *s2,
         const AVPicture *src, int srcheight,
@@ -252,12 +364,26 @@ pgm_convolve_radial(AVPicture *dst, AVPicture *s1, AVPicture *s2,
      * Optimization for radially-symmetric masks: implement a single
      * two-dimensional convolution with two commutative single-dimensional
      * convolutions.
+     *
+     * The passes run in 8.8 fixed point (and under SSE2 where available);
+     * forcing the integer weights to sum to exactly CONVOLVE_SCALE keeps
+     * the worst-case accumulator inside sixteen bits.
      */
     const int       srcwidth = src->linesize[0];
     const int       newwidth = srcwidth + 2 * mask_radius;
     const int       newheight = srcheight + 2 * mask_radius;
-    int             ii, rr, cc, rr2, cc2;
-    double          sum;
+    const int       mask_width = 2 * mask_radius + 1;
+    unsigned short  imask[CONVOLVE_MAX_WIDTH];
+    unsigned short  xmask[CONVOLVE_MAX_WIDTH][8]
+                        __attribute__ ((aligned (16)));
+    int             ii, jj, isum;
+
+    if (mask_width > CONVOLVE_MAX_WIDTH)
+    {
+        VERBOSE(VB_COMMFLAG, QString("pgm_convolve_radial mask width %1 > %2")
+                .arg(mask_width).arg(CONVOLVE_MAX_WIDTH));
+        return -1;
+    }
 
     /* Get a padded copy of the src image for use by the convolutions. */
     if (pgm_expand_uniform(s1, src, srcheight, mask_radius))
@@ -267,37 +393,28 @@ pgm_convolve_radial(AVPicture *dst, AVPicture *s1, AVPicture *s2,
     av_picture_copy(s2, s1, PIX_FMT_GRAY8, newwidth, newheight);
     av_picture_copy(dst, s1, PIX_FMT_GRAY8, newwidth, newheight);
 
-    /* "s1" convolve with column vector => "s2" */
-    rr2 = mask_radius + srcheight;
-    cc2 = mask_radius + srcwidth;
-    for (rr = mask_radius; rr < rr2; rr++)
+    isum = 0;
+    for (ii = 0; ii < mask_width; ii++)
     {
-        for (cc = mask_radius; cc < cc2; cc++)
-        {
-            sum = 0;
-            for (ii = -mask_radius; ii <= mask_radius; ii++)
-            {
-                sum += mask[ii + mask_radius] *
-                    s1->data[0][(rr + ii) * newwidth + cc];
-            }
-            s2->data[0][rr * newwidth + cc] = (unsigned char)(sum + 0.5);
-        }
+        imask[ii] = (unsigned short)(mask[ii] * CONVOLVE_SCALE + 0.5);
+        isum += imask[ii];
     }
+    imask[mask_radius] += CONVOLVE_SCALE - isum;    /* absorb rounding */
+    for (ii = 0; ii < mask_width; ii++)
+        for (jj = 0; jj < 8; jj++)
+            xmask[ii][jj] = imask[ii];
+
+    /* "s1" convolve with column vector => "s2" */
+    convolve_pass(s2->data[0], s1->data[0], newwidth,
+            mask_radius, mask_radius + srcheight,
+            mask_radius, mask_radius + srcwidth,
+            newwidth, imask, xmask, mask_radius);
 
     /* "s2" convolve with row vector => "dst" */
-    for (rr = mask_radius; rr < rr2; rr++)
-    {
-        for (cc = mask_radius; cc < cc2; cc++)
-        {
-            sum = 0;
-            for (ii = -mask_radius; ii <= mask_radius; ii++)
-            {
-                sum += mask[ii + mask_radius] *
-                    s2->data[0][rr * newwidth + cc + ii];
-            }
-            dst->data[0][rr * newwidth + cc] = (unsigned char)(sum + 0.5);
-        }
-    }
+    convolve_pass(dst->data[0], s2->data[0], newwidth,
+            mask_radius, mask_radius + srcheight,
+            mask_radius, mask_radius + srcwidth,
+            1, imask, xmask, mask_radius);
 
     return 0;
 }
@@ -6,6 +6,7 @@
 #include <QRegExp>
 #include <QDir>
 #include <QFile>
+#include <QMap>
 
 // libmythdb headers
 #include "httpcomms.h"
@@ -25,6 +26,62 @@
 #include "channeldata.h"
 #include "fillutil.h"
 
+// An existing channel table row, as far as handleChannels() cares.
+class ExistingChannel
+{
+  public:
+    QString chanid;
+    QString name;
+    QString callsign;
+    QString channum;
+    QString finetune;
+    QString icon;
+    QString freqid;
+    QString tvformat;
+};
+typedef QMap<QString, ExistingChannel> ExistingChannelMap;
+
+// Loads every channel of a video source in one query, keyed by
+// xmltvid, so the lineup can be diffed without a query per channel.
+static bool load_existing_channels(int sourceid, ExistingChannelMap &chanmap)
+{
+    MSqlQuery query(MSqlQuery::InitCon());
+    query.prepare(
+        "SELECT xmltvid,  chanid, name,   callsign, channum, "
+        "       finetune, icon,   freqid, tvformat "
+        "FROM channel "
+        "WHERE sourceid = :SOURCEID");
+    query.bindValue(":SOURCEID", sourceid);
+
+    if (!query.exec())
+    {
+        MythDB::DBError("load_existing_channels", query);
+        return false;
+    }
+
+    while (query.next())
+    {
+        QString xmltvid = query.value(0).toString();
+
+        // keep the first row per xmltvid, as the old per-channel
+        // lookup did
+        if (chanmap.contains(xmltvid))
+            continue;
+
+        ExistingChannel &chan = chanmap[xmltvid];
+        chan.chanid   = query.value(1).toString();
+        chan.name     = query.value(2).toString();
+        chan.callsign = query.value(3).toString();
+        chan.channum  = query.value(4).toString();
+        chan.finetune = query.value(5).toString();
+        chan.icon     = query.value(6).toString();
+        chan.freqid   = query.value(7).toString();
+        chan.tvformat = query.value(8).toString();
+    }
+
+    return true;
+}
+
 static void get_atsc_stuff(QString channum, int sourceid, int freqid,
                            int &major, int &minor, long long &freq)
 {
@@ -129,6 +186,9 @@ unsigned int ChannelData::promptForChannelUpdates(
 
 void ChannelData::handleChannels(int id, QList<ChanInfo> *chanlist)
 {
+    ExistingChannelMap chanmap;
+    load_existing_channels(id, chanmap);
+
     QString fileprefix = SetupIconCacheDirectory();
 
     QDir::setCurrent(fileprefix);
@@ -156,10 +216,11 @@ void ChannelData::handleChannels(int id, QList<ChanInfo> *chanlist)
             }
         }
 
-        MSqlQuery query(MSqlQuery::InitCon());
-
         if (!(*i).old_xmltvid.isEmpty())
         {
+            // This can touch channels of other sources, so it stays a
+            // direct query rather than a snapshot lookup.
+            MSqlQuery query(MSqlQuery::InitCon());
             query.prepare(
                 "SELECT xmltvid "
                 "FROM channel "
@@ -186,34 +247,26 @@ void ChannelData::handleChannels(int id, QList<ChanInfo> *chanlist)
                 {
                     MythDB::DBError("xmltvid conversion 2", query);
                 }
+
+                if (chanmap.contains((*i).old_xmltvid))
+                    chanmap.insert((*i).xmltvid,
+                                   chanmap.take((*i).old_xmltvid));
             }
         }
 
-        query.prepare(
-            "SELECT chanid,   name, callsign, channum, "
-            "       finetune, icon, freqid,   tvformat "
-            "FROM channel "
-            "WHERE xmltvid  = :XMLTVID AND "
-            "      sourceid = :SOURCEID");
-        query.bindValue(":XMLTVID",  (*i).xmltvid);
-        query.bindValue(":SOURCEID", id);
-
-        if (!query.exec())
-        {
-            MythDB::DBError("handleChannels", query);
-        }
-        else if (query.next())
+        ExistingChannelMap::iterator it = chanmap.find((*i).xmltvid);
+        if (it != chanmap.end())
         {
-            QString chanid = query.value(0).toString();
+            QString chanid = (*it).chanid;
             if (interactive)
             {
-                QString name     = query.value(1).toString();
-                QString callsign = query.value(2).toString();
-                QString chanstr  = query.value(3).toString();
-                QString finetune = query.value(4).toString();
-                QString icon     = query.value(5).toString();
-                QString freqid   = query.value(6).toString();
-                QString tvformat = query.value(7).toString();
+                QString name     = (*it).name;
+                QString callsign = (*it).callsign;
+                QString chanstr  = (*it).channum;
+                QString finetune = (*it).finetune;
+                QString icon     = (*it).icon;
+                QString freqid   = (*it).freqid;
+                QString tvformat = (*it).tvformat;
 
                 cout << "### " << endl;
                 cout << "### Existing channel found" << endl;
@@ -286,6 +339,14 @@ void ChannelData::handleChannels(int id, QList<ChanInfo> *chanlist)
                     }
                     else
                     {
+                        (*it).name     = (*i).name;
+                        (*it).callsign = (*i).callsign;
+                        (*it).channum  = (*i).chanstr;
+                        (*it).finetune = (*i).finetune;
+                        (*it).icon     = localfile;
+                        (*it).freqid   = (*i).freqid;
+                        (*it).tvformat = (*i).tvformat;
+
                         cout << "### " << endl;
                         cout << "### Change performed" << endl;
                         cout << "### " << endl;
@@ -300,7 +361,10 @@ void ChannelData::handleChannels(int id, QList<ChanInfo> *chanlist)
             }
             else
             {
-                if (!non_us_updating && !localfile.isEmpty())
+                // leave the channel alone if the icon already matches,
+                // so a no-change run writes nothing at all
+                if (!non_us_updating && !localfile.isEmpty() &&
+                    (*it).icon != localfile)
                 {
                     MSqlQuery subquery(MSqlQuery::InitCon());
                     subquery.prepare("UPDATE channel SET icon = :ICON WHERE "
@@ -310,6 +374,8 @@ void ChannelData::handleChannels(int id, QList<ChanInfo> *chanlist)
 
                     if (!subquery.exec())
                         MythDB::DBError("Channel icon change", subquery);
+                    else
+                        (*it).icon = localfile;
                 }
             }
         }
@@ -17,6 +17,8 @@ using namespace std;
 
 // MythTV headers
 #include "mythcorecontext.h"
+#include "mythdownloadmanager.h"
+#include "mythevent.h"
 #include "mythtimer.h"
 #include "mythdb.h"
 
@@ -155,7 +157,7 @@ static void RunSimpleQuery(const QString &query)
 
 IconData::~IconData()
 {
-    MythHttpPool::GetSingleton()->RemoveListener(this);
+    GetMythDownloadManager()->removeListener(this);
 }
 
 void IconData::UpdateSourceIcons(uint sourceid)
@@ -208,14 +210,11 @@ void IconData::UpdateSourceIcons(uint sourceid)
                 m_u2fl[icon_url].push_back(fi);
             }
 
+            // The download manager fetches these concurrently from its
+            // own thread; all we do here is queue them.
             if (add_request)
-                MythHttpPool::GetSingleton()->AddUrlRequest(icon_url, this);
-
-            // HACK -- begin
-            // This hack is needed because we don't enter the event loop
-            // before running this code via qApp->exec()
-            qApp->processEvents();
-            // HACK -- end
+                GetMythDownloadManager()->queueDownload(
+                    icon_url, localfile.fileName(), this);
         }
     }
 
@@ -224,7 +223,8 @@ void IconData::UpdateSourceIcons(uint sourceid)
     {
         // HACK -- begin
         // This hack is needed because we don't enter the event loop
-        // before running this code via qApp->exec()
+        // before running this code via qApp->exec(), so the finished
+        // notifications posted by the download manager need a pump.
         qApp->processEvents();
         // HACK -- end
 
@@ -242,26 +242,35 @@ void IconData::UpdateSourceIcons(uint sourceid)
     }
 }
 
-void IconData::Update(
-    QHttp::Error      error,
-    const QString    &error_str,
-    const QUrl       &url,
-    uint              http_status_id,
-    const QString    &http_status_str,
-    const QByteArray &data)
+void IconData::customEvent(QEvent *event)
 {
+    if ((MythEvent::Type)(event->type()) != MythEvent::MythEventMessage)
+        return;
+
+    MythEvent *me = (MythEvent *)event;
+    QStringList tokens = me->Message().split(" ", QString::SkipEmptyParts);
+
+    if ((tokens.size() != 2) ||
+        (tokens[0] != "DOWNLOAD_FILE") || (tokens[1] != "FINISHED"))
+        return;
+
+    QStringList args = me->ExtraDataList();
+    QString   url       = args[0];
+    long long file_size = args[2].toLongLong();
+    int       error     = args[4].toInt();
+
     bool http_error = false;
-    if (QHttp::NoError != error)
+    if (error)
     {
-        VERBOSE(VB_IMPORTANT, LOC_ERR + QString("fetching '%1'\n\t\t\t%2")
-                .arg(url.toString()).arg(error_str));
+        VERBOSE(VB_IMPORTANT, LOC_ERR + QString("fetching '%1', error %2")
+                .arg(url).arg(error));
         http_error = true;
     }
 
-    if (!data.size())
+    if (file_size <= 0)
     {
         VERBOSE(VB_IMPORTANT, LOC_ERR + QString("Did not get any data from '%1'")
-                .arg((url.toString())));
+                .arg(url));
         http_error = true;
     }
 
@@ -274,7 +283,7 @@ void IconData::Update(
             VERBOSE(VB_IMPORTANT, LOC_ERR +
                     QString("Programmer Error, got data for '%1',"
                             "but have no record of requesting it.")
-                    .arg(url.toString()));
+                    .arg(url));
             return;
         }
 
@@ -284,31 +293,13 @@ void IconData::Update(
 
     while (!http_error && !fil.empty())
     {
-        Save(fil.back(), data);
+        UpdateChannelIcon(fil.back());
         fil.pop_back();
     }
 }
 
-bool IconData::Save(const FI &fi, const QByteArray &data)
+bool IconData::UpdateChannelIcon(const FI &fi)
 {
-    QFile file(fi.filename);
-    if (!file.open(QIODevice::WriteOnly))
-    {
-        VERBOSE(VB_IMPORTANT, LOC_ERR + QString("Failed to open '%1' for writing")
-                .arg(fi.filename));
-        return false;
-    }
-
-    if (file.write(data) < data.size())
-    {
-        VERBOSE(VB_IMPORTANT, LOC_ERR + QString("Failed to write icon data to '%1'")
-                .arg(fi.filename));
-        file.remove();
-        return false;
-    }
-
-    file.flush();
-
     VERBOSE(VB_GENERAL, LOC +
             QString("Updating channel icon for chanid: %1").arg(fi.chanid));
 
@@ -4,13 +4,14 @@
 #include <vector>
 using namespace std;
 
-#include <QUrl>
+#include <QObject>
 #include <QString>
+#include <QMutex>
 #include <QMap>
 
-#include "mythhttppool.h"
+class QEvent;
 
-class IconData : private MythHttpListener
+class IconData : public QObject
 {
   public:
     IconData() {}
@@ -21,20 +22,16 @@ class IconData : private MythHttpListener
     void ExportIconMap(const QString &filename);
     void ResetIconMap(bool reset_icons);
 
+  protected:
+    // Receives DOWNLOAD_FILE events from the MythDownloadManager
+    virtual void customEvent(QEvent *event);
+
   private:
     class FI { public: QString filename; uint chanid; };
     typedef vector<FI> FIL;
-    typedef QMap<QUrl,FIL> Url2FIL;
-
-    // Implements MythHttpListener
-    virtual void Update(QHttp::Error      error,
-                        const QString    &error_str,
-                        const QUrl       &url,
-                        uint              http_status_id,
-                        const QString    &http_status_str,
-                        const QByteArray &data);
+    typedef QMap<QString,FIL> Url2FIL;
 
-    bool Save(const FI &fi, const QByteArray &data);
+    bool UpdateChannelIcon(const FI &fi);
 
     QMutex  m_u2fl_lock;
     Url2FIL m_u2fl;
@@ -5,6 +5,7 @@
 #include <QStringList>
 #include <QDateTime>
 #include <QDomDocument>
+#include <QXmlStreamReader>
 #include <QUrl>
 
 // C++ headers
@@ -576,11 +577,42 @@ ProgInfo *XMLTVParser::parseProgram(
     return pginfo;
 }
 
+/* Builds a QDomElement for the element the reader is positioned on,
+   consuming everything up to its end tag.  This lets us parse the file
+   incrementally (one channel/programme in memory at a time) while
+   reusing the existing QDom based element parsers.  As with
+   QDomDocument::setContent(), whitespace-only text is stripped. */
+static QDomElement readElement(QXmlStreamReader &xml, QDomDocument &doc)
+{
+    QDomElement e = doc.createElement(xml.name().toString());
+
+    QXmlStreamAttributes attrs = xml.attributes();
+    for (int i = 0; i < attrs.count(); i++)
+        e.setAttribute(attrs[i].name().toString(),
+                       attrs[i].value().toString());
+
+    while (!xml.atEnd())
+    {
+        QXmlStreamReader::TokenType token = xml.readNext();
+
+        if (token == QXmlStreamReader::StartElement)
+            e.appendChild(readElement(xml, doc));
+        else if (token == QXmlStreamReader::Characters)
+        {
+            if (!xml.isWhitespace())
+                e.appendChild(doc.createTextNode(xml.text().toString()));
+        }
+        else if (token == QXmlStreamReader::EndElement)
+            break;
+    }
+
+    return e;
+}
+
 bool XMLTVParser::parseFile(
     QString filename, QList<ChanInfo> *chanlist,
     QMap<QString, QList<ProgInfo> > *proglist)
 {
-    QDomDocument doc;
     QFile f;
 
     if (!dash_open(f, filename, QIODevice::ReadOnly))
@@ -590,21 +622,6 @@ bool XMLTVParser::parseFile(
         return false;
     }
 
-    QString errorMsg = "unknown";
-    int errorLine = 0;
-    int errorColumn = 0;
-
-    if (!doc.setContent(&f, &errorMsg, &errorLine, &errorColumn))
-    {
-        VERBOSE(VB_IMPORTANT, QString("Error in %1:%2: %3")
-            .arg(errorLine).arg(errorColumn).arg(errorMsg));
-
-        f.close();
-        return true;
-    }
-
-    f.close();
-
     // now we calculate the localTimezoneOffset, so that we can fix
     // the programdata if needed
     QString config_offset = gCoreContext->GetSetting("TimeOffset", "None");
@@ -627,103 +644,134 @@ bool XMLTVParser::parseFile(
         }
     }
 
-    QDomElement docElem = doc.documentElement();
+    // Parse the file incrementally; only the channel/programme element
+    // currently being processed is ever held in memory.
 
-    QUrl baseUrl(docElem.attribute("source-data-url", ""));
+    QXmlStreamReader xml(&f);
 
-    QUrl sourceUrl(docElem.attribute("source-info-url", ""));
-    if (sourceUrl.toString() == "http://labs.zap2it.com/")
-    {
-        VERBOSE(VB_IMPORTANT, "Don't use tv_grab_na_dd, use the"
-            "internal datadirect grabber.");
-        exit(FILLDB_BUGGY_EXIT_SRC_IS_DD);
-    }
+    QUrl baseUrl;
+    bool foundRoot = false;
 
     QString aggregatedTitle;
     QString aggregatedDesc;
     QString groupingTitle;
     QString groupingDesc;
 
-    QDomNode n = docElem.firstChild();
-    while (!n.isNull())
+    while (!xml.atEnd())
     {
-        QDomElement e = n.toElement();
-        if (!e.isNull())
+        if (xml.readNext() != QXmlStreamReader::StartElement)
+            continue;
+
+        if (!foundRoot)
         {
-            if (e.tagName() == "channel")
+            // This is the document element (<tv>).
+
+            baseUrl = QUrl(
+                xml.attributes().value("source-data-url").toString());
+
+            QUrl sourceUrl(
+                xml.attributes().value("source-info-url").toString());
+            if (sourceUrl.toString() == "http://labs.zap2it.com/")
             {
-                ChanInfo *chinfo = parseChannel(e, baseUrl);
-                chanlist->push_back(*chinfo);
-                delete chinfo;
+                VERBOSE(VB_IMPORTANT, "Don't use tv_grab_na_dd, use the"
+                    "internal datadirect grabber.");
+                exit(FILLDB_BUGGY_EXIT_SRC_IS_DD);
             }
-            else if (e.tagName() == "programme")
+
+            foundRoot = true;
+            continue;
+        }
+
+        // Nested elements are consumed by readElement(), so anything seen
+        // here is a direct child of the document element.
+
+        QDomDocument doc;
+        QDomElement  e = readElement(xml, doc);
+
+        if (e.tagName() == "channel")
+        {
+            ChanInfo *chinfo = parseChannel(e, baseUrl);
+            chanlist->push_back(*chinfo);
+            delete chinfo;
+        }
+        else if (e.tagName() == "programme")
+        {
+            ProgInfo *pginfo = parseProgram(e, localTimezoneOffset);
+
+            if (pginfo->startts == pginfo->endts)
             {
-                ProgInfo *pginfo = parseProgram(e, localTimezoneOffset);
+                /* Not a real program : just a grouping marker */
+                if (!pginfo->title.isEmpty())
+                    groupingTitle = pginfo->title + " : ";
 
-                if (pginfo->startts == pginfo->endts)
+                if (!pginfo->description.isEmpty())
+                    groupingDesc = pginfo->description + " : ";
+            }
+            else
+            {
+                if (pginfo->clumpidx.isEmpty())
                 {
-                    /* Not a real program : just a grouping marker */
-                    if (!pginfo->title.isEmpty())
-                        groupingTitle = pginfo->title + " : ";
+                    if (!groupingTitle.isEmpty())
+                    {
+                        pginfo->title.prepend(groupingTitle);
+                        groupingTitle.clear();
+                    }
 
-                    if (!pginfo->description.isEmpty())
-                        groupingDesc = pginfo->description + " : ";
+                    if (!groupingDesc.isEmpty())
+                    {
+                        pginfo->description.prepend(groupingDesc);
+                        groupingDesc.clear();
+                    }
+
+                    (*proglist)[pginfo->channel].push_back(*pginfo);
                 }
                 else
                 {
-                    if (pginfo->clumpidx.isEmpty())
+                    /* append all titles/descriptions from one clump */
+                    if (pginfo->clumpidx.toInt() == 0)
                     {
-                        if (!groupingTitle.isEmpty())
-                        {
-                            pginfo->title.prepend(groupingTitle);
-                            groupingTitle.clear();
-                        }
+                        aggregatedTitle.clear();
+                        aggregatedDesc.clear();
+                    }
 
-                        if (!groupingDesc.isEmpty())
-                        {
-                            pginfo->description.prepend(groupingDesc);
-                            groupingDesc.clear();
-                        }
+                    if (!pginfo->title.isEmpty())
+                    {
+                        if (!aggregatedTitle.isEmpty())
+                            aggregatedTitle.append(" | ");
+                        aggregatedTitle.append(pginfo->title);
+                    }
 
-                        (*proglist)[pginfo->channel].push_back(*pginfo);
+                    if (!pginfo->description.isEmpty())
+                    {
+                        if (!aggregatedDesc.isEmpty())
+                            aggregatedDesc.append(" | ");
+                        aggregatedDesc.append(pginfo->description);
                     }
-                    else
+                    if (pginfo->clumpidx.toInt() ==
+                        pginfo->clumpmax.toInt() - 1)
                     {
-                        /* append all titles/descriptions from one clump */
-                        if (pginfo->clumpidx.toInt() == 0)
-                        {
-                            aggregatedTitle.clear();
-                            aggregatedDesc.clear();
-                        }
-
-                        if (!pginfo->title.isEmpty())
-                        {
-                            if (!aggregatedTitle.isEmpty())
-                                aggregatedTitle.append(" | ");
-                            aggregatedTitle.append(pginfo->title);
-                        }
-
-                        if (!pginfo->description.isEmpty())
-                        {
-                            if (!aggregatedDesc.isEmpty())
-                                aggregatedDesc.append(" | ");
-                            aggregatedDesc.append(pginfo->description);
-                        }
-                        if (pginfo->clumpidx.toInt() ==
-                            pginfo->clumpmax.toInt() - 1)
-                        {
-                            pginfo->title = aggregatedTitle;
-                            pginfo->description = aggregatedDesc;
-                            (*proglist)[pginfo->channel].push_back(*pginfo);
-                        }
+                        pginfo->title = aggregatedTitle;
+                        pginfo->description = aggregatedDesc;
+                        (*proglist)[pginfo->channel].push_back(*pginfo);
                     }
                 }
-                delete pginfo;
             }
+            delete pginfo;
         }
-        n = n.nextSibling();
     }
 
+    if (xml.hasError())
+    {
+        VERBOSE(VB_IMPORTANT, QString("Error in %1:%2: %3")
+            .arg(xml.lineNumber()).arg(xml.columnNumber())
+            .arg(xml.errorString()));
+
+        f.close();
+        return true;
+    }
+
+    f.close();
+
     return true;
 }
 
@@ -1680,6 +1680,12 @@ PlaybackProfileConfigs::PlaybackProfileConfigs(const QString &str) :
         profiles = VideoDisplayProfile::GetProfiles(host);
     }
 
+    if (!profiles.contains("Auto Benchmark"))
+    {
+        VideoDisplayProfile::CreateAutoBenchmarkProfile(host);
+        profiles = VideoDisplayProfile::GetProfiles(host);
+    }
+
     QString profile = VideoDisplayProfile::GetDefaultProfileName(host);
     if (!profiles.contains(profile))
     {
@@ -12,6 +12,9 @@ using namespace std;
 #include <QCoreApplication>
 #include <QKeyEvent>
 #include <QDateTime>
+#include <QRunnable>
+#include <QThreadPool>
+#include <QVector>
 
 // myth
 #include "mythcorecontext.h"
@@ -41,6 +44,126 @@ QWaitCondition epgIsVisibleCond;
 const QString kUnknownTitle = QObject::tr("Unknown");
 const QString kUnknownCategory = QObject::tr("Unknown");
 
+/// Number of screens of guide data to keep fetched beyond the
+/// visible window in each scroll direction.
+static const int kPrefetchScreens = 2;
+
+/** \class GuideDataReadyEvent
+ *  \brief Posted by a GuideDataPrefetcher with the guide data it
+ *         loaded; consumed by GuideGrid::customEvent().
+ */
+class GuideDataReadyEvent : public QEvent
+{
+  public:
+    GuideDataReadyEvent(const QDateTime &start, const QDateTime &end,
+                        const QMap<uint,ProgramList*> &proglists) :
+        QEvent(kEventType),
+        m_start(start), m_end(end), m_proglists(proglists)
+    {
+    }
+    ~GuideDataReadyEvent()
+    {
+        // delete whatever customEvent() did not take
+        QMap<uint,ProgramList*>::iterator it = m_proglists.begin();
+        for (; it != m_proglists.end(); ++it)
+            delete *it;
+    }
+
+    QDateTime m_start;
+    QDateTime m_end;
+    QMap<uint,ProgramList*> m_proglists;
+
+    static QEvent::Type kEventType;
+};
+QEvent::Type GuideDataReadyEvent::kEventType =
+    (QEvent::Type) QEvent::registerEventType();
+
+/** \fn LoadGuideData(const QVector<uint>&,const QDateTime&,
+                      const QDateTime&,const ProgramList&,
+                      QMap<uint,ProgramList*>&)
+ *  \brief Loads the guide data for several channels in one query.
+ */
+static void LoadGuideData(const QVector<uint> &chanids,
+                          const QDateTime &start, const QDateTime &end,
+                          const ProgramList &schedList,
+                          QMap<uint,ProgramList*> &proglists)
+{
+    if (chanids.empty())
+        return;
+
+    QString chanlist;
+    for (int i = 0; i < chanids.size(); i++)
+    {
+        if (i)
+            chanlist += ",";
+        chanlist += QString::number(chanids[i]);
+    }
+
+    MSqlBindings bindings;
+    QString querystr = QString(
+        "WHERE program.chanid IN (%1) "
+        "  AND program.endtime >= :STARTTS "
+        "  AND program.starttime <= :ENDTS "
+        "  AND program.manualid = 0 ").arg(chanlist);
+    bindings[":STARTTS"] = start.toString("yyyy-MM-ddThh:mm:00");
+    bindings[":ENDTS"] = end.toString("yyyy-MM-ddThh:mm:00");
+
+    ProgramList proglist;
+    LoadFromProgram(proglist, querystr, bindings, schedList, false);
+
+    for (int i = 0; i < chanids.size(); i++)
+        proglists[chanids[i]] = new ProgramList();
+
+    // The results are ordered by start time, so each channel's
+    // list remains time ordered after the split.
+    ProgramList::iterator it = proglist.begin();
+    for (; it != proglist.end(); ++it)
+    {
+        QMap<uint,ProgramList*>::iterator pit =
+            proglists.find((*it)->GetChanID());
+        if (pit != proglists.end())
+            (*pit)->push_back(new ProgramInfo(**it));
+    }
+}
+
+/** \class GuideDataPrefetcher
+ *  \brief Fetches guide data in a thread pool thread and posts it
+ *         back to the GuideGrid as a GuideDataReadyEvent.
+ */
+class GuideDataPrefetcher : public QRunnable
+{
+  public:
+    GuideDataPrefetcher(GuideGrid *parent, const QVector<uint> &chanids,
+                        const QDateTime &start, const QDateTime &end,
+                        const ProgramList &schedList) :
+        m_parent(parent), m_chanids(chanids),
+        m_start(start), m_end(end)
+    {
+        // The guide may reload its schedule list while we are
+        // queued or running, so work from a copy.
+        ProgramList::const_iterator it = schedList.begin();
+        for (; it != schedList.end(); ++it)
+            m_schedList.push_back(new ProgramInfo(**it));
+    }
+
+    void run(void)
+    {
+        QMap<uint,ProgramList*> proglists;
+        LoadGuideData(m_chanids, m_start, m_end, m_schedList, proglists);
+
+        QCoreApplication::postEvent(
+            m_parent, new GuideDataReadyEvent(m_start, m_end, proglists));
+        m_parent->m_prefetchersRunning.deref();
+    }
+
+  private:
+    GuideGrid    *m_parent;
+    QVector<uint> m_chanids;
+    QDateTime     m_start;
+    QDateTime     m_end;
+    ProgramList   m_schedList;
+};
+
 JumpToChannel::JumpToChannel(
     JumpToChannelListener *parent, const QString &start_entry,
     int start_chan_idx, int cur_chan_idx, uint rows_disp) :
@@ -368,6 +491,13 @@ GuideGrid::~GuideGrid()
 {
     gCoreContext->removeListener(this);
 
+    // Wait for any prefetchers; their unconsumed results are deleted
+    // with the events Qt removes when this object is destroyed.
+    while (m_prefetchersRunning != 0)
+        usleep(1000);
+
+    clearGuideDataCache();
+
     while (!m_programs.empty())
     {
         if (m_programs.back())
@@ -825,6 +955,7 @@ DBChanList GuideGrid::GetSelection(void) const
 void GuideGrid::updateTimeout(void)
 {
     m_updateTimer->stop();
+    clearGuideDataCache();
     fillProgramInfos();
     m_updateTimer->start((int)(60 * 1000));
 }
@@ -1028,6 +1159,8 @@ void GuideGrid::fillProgramInfos(bool useExistingData)
     {
         fillProgramRowInfos(y, useExistingData);
     }
+
+    prefetchGuideData();
 }
 
 ProgramList *GuideGrid::getProgramListFromProgram(int chanNum)
@@ -1036,12 +1169,37 @@ ProgramList *GuideGrid::getProgramListFromProgram(int chanNum)
 
     if (proglist)
     {
+        uint chanid = GetChannelInfo(chanNum)->chanid;
+
+        // Use the prefetched guide data when it covers the current
+        // window.  The rows mutate their lists, so they get a copy
+        // trimmed to the window and the cache keeps the original.
+        if (m_guideDataStart.isValid() &&
+            m_guideDataStart <= m_currentStartTime &&
+            m_currentEndTime <= m_guideDataEnd)
+        {
+            QMap<uint,ProgramList*>::iterator it =
+                m_guideDataCache.find(chanid);
+            if (it != m_guideDataCache.end())
+            {
+                ProgramList::iterator pit = (*it)->begin();
+                for (; pit != (*it)->end(); ++pit)
+                {
+                    if ((*pit)->GetScheduledEndTime() < m_currentStartTime ||
+                        (*pit)->GetScheduledStartTime() > m_currentEndTime)
+                        continue;
+                    proglist->push_back(new ProgramInfo(**pit));
+                }
+                return proglist;
+            }
+        }
+
         MSqlBindings bindings;
         QString querystr = "WHERE program.chanid = :CHANID "
                            "  AND program.endtime >= :STARTTS "
                            "  AND program.starttime <= :ENDTS "
                            "  AND program.manualid = 0 ";
-        bindings[":CHANID"]  = GetChannelInfo(chanNum)->chanid;
+        bindings[":CHANID"]  = chanid;
         bindings[":STARTTS"] = m_currentStartTime.toString("yyyy-MM-ddThh:mm:00");
         bindings[":ENDTS"] = m_currentEndTime.toString("yyyy-MM-ddThh:mm:00");
 
@@ -1051,6 +1209,107 @@ ProgramList *GuideGrid::getProgramListFromProgram(int chanNum)
     return proglist;
 }
 
+/** \fn GuideGrid::clearGuideDataCache(void)
+ *  \brief Discards all prefetched guide data.
+ */
+void GuideGrid::clearGuideDataCache(void)
+{
+    QMap<uint,ProgramList*>::iterator it = m_guideDataCache.begin();
+    for (; it != m_guideDataCache.end(); ++it)
+        delete *it;
+    m_guideDataCache.clear();
+    m_guideDataPending.clear();
+    m_guideDataStart = QDateTime();
+    m_guideDataEnd = QDateTime();
+}
+
+/** \fn GuideGrid::prefetchGuideData(void)
+ *  \brief Keeps kPrefetchScreens screens of guide data beyond the
+ *         visible window fetched in each scroll direction.
+ *
+ *   The data is loaded in the thread pool, one batched query per
+ *   request, and cached per channel until the visible window gets
+ *   near the edge of the cached time range.
+ *   getProgramListFromProgram() fills rows from the cache instead
+ *   of querying the database on every scroll.
+ */
+void GuideGrid::prefetchGuideData(void)
+{
+    int chanCount = (int)GetChannelCount();
+    if (!chanCount || !m_channelCount || !m_timeCount)
+        return;
+
+    int pageSecs = m_timeCount * 5 * 60;
+
+    // Recenter the cached time range before sequential paging
+    // can reach its edge.
+    if (!m_guideDataStart.isValid() ||
+        m_currentStartTime < m_guideDataStart.addSecs(pageSecs) ||
+        m_currentEndTime   > m_guideDataEnd.addSecs(-pageSecs))
+    {
+        clearGuideDataCache();
+        m_guideDataStart =
+            m_currentStartTime.addSecs(-kPrefetchScreens * pageSecs);
+        m_guideDataEnd =
+            m_currentEndTime.addSecs(kPrefetchScreens * pageSecs);
+    }
+
+    // The channels wanted are the visible rows plus kPrefetchScreens
+    // screens above and below.
+    int rows = (2 * kPrefetchScreens + 1) * m_channelCount;
+    rows = min(rows, chanCount);
+    int first = (int)m_currentStartChannel -
+        kPrefetchScreens * m_channelCount;
+
+    QSet<uint> wanted;
+    QVector<uint> fetch;
+    for (int i = 0; i < rows; i++)
+    {
+        int idx = (first + i) % chanCount;
+        if (idx < 0)
+            idx += chanCount;
+
+        PixmapChannel *chinfo = GetChannelInfo(idx);
+        if (!chinfo)
+            continue;
+
+        uint chanid = chinfo->chanid;
+        if (wanted.contains(chanid))
+            continue;
+        wanted.insert(chanid);
+
+        if (!m_guideDataCache.contains(chanid) &&
+            !m_guideDataPending.contains(chanid))
+            fetch.push_back(chanid);
+    }
+
+    // Bound the cache to the wanted channels.
+    QMap<uint,ProgramList*>::iterator it = m_guideDataCache.begin();
+    while (it != m_guideDataCache.end())
+    {
+        if (!wanted.contains(it.key()))
+        {
+            delete *it;
+            it = m_guideDataCache.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    if (fetch.empty())
+        return;
+
+    for (int i = 0; i < fetch.size(); i++)
+        m_guideDataPending.insert(fetch[i]);
+
+    m_prefetchersRunning.ref();
+    QThreadPool::globalInstance()->start(
+        new GuideDataPrefetcher(this, fetch, m_guideDataStart,
+                                m_guideDataEnd, m_recList));
+}
+
 void GuideGrid::fillProgramRowInfos(unsigned int row, bool useExistingData)
 {
     m_guideGrid->ResetRow(row);
@@ -1320,6 +1579,7 @@ void GuideGrid::customEvent(QEvent *event)
         if (message == "SCHEDULE_CHANGE")
         {
             LoadFromScheduler(m_recList);
+            clearGuideDataCache();
             fillProgramInfos();
             updateInfo();
         }
@@ -1332,6 +1592,29 @@ void GuideGrid::customEvent(QEvent *event)
             m_previewVideoRefreshTimer->start(66);
         }
     }
+    else if (event->type() == GuideDataReadyEvent::kEventType)
+    {
+        GuideDataReadyEvent *ge = (GuideDataReadyEvent*) event;
+
+        QMap<uint,ProgramList*>::iterator it = ge->m_proglists.begin();
+        for (; it != ge->m_proglists.end(); ++it)
+        {
+            m_guideDataPending.remove(it.key());
+
+            // discard results fetched for a window we have left
+            if (ge->m_start != m_guideDataStart ||
+                ge->m_end   != m_guideDataEnd)
+            {
+                delete *it;
+                continue;
+            }
+
+            if (m_guideDataCache.contains(it.key()))
+                delete m_guideDataCache[it.key()];
+            m_guideDataCache[it.key()] = *it;
+        }
+        ge->m_proglists.clear();
+    }
     else if (event->type() == DialogCompletionEvent::kEventType)
     {
         DialogCompletionEvent *dce = (DialogCompletionEvent*)(event);
@@ -1616,6 +1899,7 @@ void GuideGrid::generateListings()
     m_channelCount = min(m_guideGrid->getChannelCount(), maxchannel + 1);
 
     LoadFromScheduler(m_recList);
+    clearGuideDataCache();
     fillProgramInfos();
 }
 
@@ -1998,6 +2282,7 @@ void GuideGrid::quickRecord()
     *pginfo = ri;
 
     LoadFromScheduler(m_recList);
+    clearGuideDataCache();
     fillProgramInfos();
     updateInfo();
 }
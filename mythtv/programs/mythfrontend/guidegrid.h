@@ -10,6 +10,8 @@ using namespace std;
 #include <QString>
 #include <QDateTime>
 #include <QEvent>
+#include <QSet>
+#include <QAtomicInt>
 
 // myth
 #include "mythscreentype.h"
@@ -35,6 +37,7 @@ typedef vector<PixmapChannel>   pix_chan_list_t;
 typedef vector<pix_chan_list_t> pix_chan_list_list_t;
 
 class JumpToChannel;
+class GuideDataPrefetcher;
 class JumpToChannelListener
 {
   public:
@@ -169,6 +172,8 @@ class GuideGrid : public ScheduleCommon, public JumpToChannelListener
     void fillProgramInfos(bool useExistingData = false);
     void fillProgramRowInfos(unsigned int row, bool useExistingData = false);
     ProgramList *getProgramListFromProgram(int chanNum);
+    void prefetchGuideData(void);
+    void clearGuideDataCache(void);
 
     void setStartChannel(int newStartChannel);
 
@@ -192,6 +197,15 @@ class GuideGrid : public ScheduleCommon, public JumpToChannelListener
     ProgramInfo *m_programInfos[MAX_DISPLAY_CHANS][MAX_DISPLAY_TIMES];
     ProgramList  m_recList;
 
+    // Guide data prefetched a few screens beyond the visible window
+    // in each scroll direction, so paging does not wait on the DB.
+    QMap<uint,ProgramList*> m_guideDataCache; // keyed by chanid
+    QSet<uint>  m_guideDataPending;
+    QDateTime   m_guideDataStart;
+    QDateTime   m_guideDataEnd;
+    QAtomicInt  m_prefetchersRunning;
+    friend class GuideDataPrefetcher;
+
     QDateTime m_originalStartTime;
     QDateTime m_currentStartTime;
     QDateTime m_currentEndTime;
@@ -697,6 +697,42 @@ static bool RunMenu(QString themedir, QString themename)
 
 // If any settings are missing from the database, this will write
 // the default values
+/** \brief Loads settings that are used early in startup with one query.
+ *
+ *  The values land in the settings cache, so the normal per key
+ *  lookups that follow cost nothing instead of one database round
+ *  trip each -- which adds up quickly for frontends far from their
+ *  database.  Defaults here must match the ones at the real call
+ *  sites, since unset keys are cached with the value given; keys
+ *  read without an explicit default are prefetched with "".
+ */
+static void PrefetchSettings(void)
+{
+    QMap<QString,QString> kv;
+
+    kv["Theme"]                 = DEFAULT_UI_THEME;
+    kv["MenuTheme"]             = "defaultmenu";
+    kv["ThemePainter"]          = "qt";
+
+    kv["GuiResolution"]         = "";
+    kv["GuiWidth"]              = "";
+    kv["GuiHeight"]             = "";
+    kv["GuiOffsetX"]            = "";
+    kv["GuiOffsetY"]            = "";
+    kv["RunFrontendInWindow"]   = "0";
+    kv["UseVideoModes"]         = "0";
+    kv["HideMouseCursor"]       = "0";
+    kv["UIImageCacheSize"]      = "20";
+
+    kv["RealtimePriority"]      = "1";
+    kv["NetworkControlEnabled"] = "0";
+    kv["NetworkControlPort"]    = "6545";
+    kv["NoPromptOnExit"]        = "1";
+    kv["DefaultTVChannel"]      = "";
+
+    gCoreContext->GetSettings(kv);
+}
+
 static void WriteDefaults()
 {
     PlaybackSettings ps;
@@ -1252,6 +1288,8 @@ int main(int argc, char **argv)
 
     gCoreContext->SetAppName(binname);
 
+    PrefetchSettings();
+
     for(int argpos = 1; argpos < a.argc(); ++argpos)
     {
         if (!strcmp(a.argv()[argpos],"-l") ||
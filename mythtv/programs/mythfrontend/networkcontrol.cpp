@@ -17,6 +17,7 @@
 #include "previewgenerator.h"
 #include "compat.h"
 #include "mythverbose.h"
+#include "mythprofile.h"
 #include "mythsystemevent.h"
 #include "mythdirs.h"
 
@@ -891,6 +892,52 @@ QString NetworkControl::processQuery(NetworkCommand *nc)
 
         return str;
     }
+    else if (is_abbrev("jitter", nc->getArg(1)))
+    {
+        QString location = GetMythUI()->GetCurrentLocation(false, false);
+
+        if (location != "Playback")
+            return QString("ERROR: Timing data is only available "
+                           "during playback");
+
+        gotAnswer = false;
+        QString message = QString("NETWORK_CONTROL QUERY JITTER");
+        MythEvent me(message);
+        gCoreContext->dispatch(me);
+
+        QTime timer;
+        timer.start();
+        while (timer.elapsed() < 2000  && !gotAnswer)
+            usleep(10000);
+
+        if (gotAnswer)
+            return answer;
+
+        return QString("ERROR: Timed out waiting for reply from player");
+    }
+    else if (is_abbrev("profile", nc->getArg(1)))
+    {
+        if (nc->getArgCount() == 3)
+        {
+            if (is_abbrev("enable", nc->getArg(2)))
+                MythProfileZone::SetEnabled(true);
+            else if (is_abbrev("disable", nc->getArg(2)))
+                MythProfileZone::SetEnabled(false);
+            else if (is_abbrev("reset", nc->getArg(2)))
+                MythProfileZone::ResetAll();
+            else
+                return QString("ERROR: See 'help %1' for usage information")
+                               .arg(nc->getArg(0));
+        }
+
+        QString str = MythProfileZone::IsEnabled() ? "ENABLED" : "DISABLED";
+
+        QString report = MythProfileZone::GetReport();
+        if (!report.isEmpty())
+            str += "\r\n" + report.replace("\n", "\r\n");
+
+        return str;
+    }
     else if ((nc->getArgCount() == 4) &&
              is_abbrev("recording", nc->getArg(1)) &&
              (nc->getArg(2).contains(QRegExp("^\\d+$"))) &&
@@ -1045,6 +1092,10 @@ QString NetworkControl::processHelp(NetworkCommand *nc)
         helpText +=
             "query location        - Query current screen or location\r\n"
             "query volume          - Query the current playback volume\r\n"
+            "query jitter          - Query player pipeline timing statistics\r\n"
+            "query profile [enable|disable|reset]\r\n"
+            "                      - Query the hot path profile zones,\r\n"
+            "                        optionally changing collection state\r\n"
             "query recordings      - List currently available recordings\r\n"
             "query recording CHANID STARTTIME\r\n"
             "                      - List info about the specified program\r\n"
@@ -354,6 +354,7 @@ PlaybackBox::PlaybackBox(MythScreenStack *parent, QString name, BoxType ltype,
       m_programInfoCache(this),           m_playingSomething(false),
       // Selection state variables
       m_needUpdate(false),
+      m_updateUIListQueued(false),
       // Other
       m_player(NULL),
       m_helper(this)
@@ -3786,11 +3787,22 @@ void PlaybackBox::customEvent(QEvent *event)
             }
             else if (chanid && recstartts.isValid() && (tokens[1] == "ADD"))
             {
-                ProgramInfo evinfo(chanid, recstartts);
-                if (evinfo.GetChanID())
+                if (me->ExtraDataCount())
                 {
-                    evinfo.SetRecordingStatus(rsRecording);
-                    HandleRecordingAddEvent(evinfo);
+                    // The backend hydrated the event with the program
+                    // data, saving us a DB query per add.
+                    ProgramInfo evinfo(me->ExtraDataList());
+                    if (evinfo.GetChanID())
+                        HandleRecordingAddEvent(evinfo);
+                }
+                else
+                {
+                    ProgramInfo evinfo(chanid, recstartts);
+                    if (evinfo.GetChanID())
+                    {
+                        evinfo.SetRecordingStatus(rsRecording);
+                        HandleRecordingAddEvent(evinfo);
+                    }
                 }
             }
             else if (chanid && recstartts.isValid() && (tokens[1] == "DELETE"))
@@ -3852,6 +3864,7 @@ void PlaybackBox::customEvent(QEvent *event)
         }
         else if (message == "UPDATE_UI_LIST")
         {
+            m_updateUIListQueued = false;
             UpdateUILists();
             m_helper.ForceFreeSpaceUpdate();
         }
@@ -4184,6 +4197,10 @@ void PlaybackBox::HandleUpdateProgramInfoFileSizeEvent(
 
 void PlaybackBox::ScheduleUpdateUIList(void)
 {
+    if (m_updateUIListQueued)
+        return;
+    m_updateUIListQueued = true;
+
     if (!m_programInfoCache.IsLoadInProgress())
         QCoreApplication::postEvent(this, new MythEvent("UPDATE_UI_LIST"));
 }
@@ -424,6 +424,10 @@ class PlaybackBox : public ScheduleCommon
     /// Does the recording list need to be refilled
     bool m_needUpdate;
 
+    /// Set while an UPDATE_UI_LIST event is queued, so that a burst
+    /// of recording change events triggers a single list rebuild.
+    bool m_updateUIListQueued;
+
     // Selection state variables
     bool                m_haveGroupInfoSet;
 
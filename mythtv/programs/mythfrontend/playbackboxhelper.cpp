@@ -67,6 +67,16 @@ QString toSG(ArtworkType t)
     return QString();
 }
 
+class AvailabilityCacheEntry
+{
+  public:
+    AvailabilityCacheEntry() : status(asAvailable), filesize(0) {}
+    AvailableStatusType status;
+    QString             pathname;
+    uint64_t            filesize;
+    QTime               checked;
+};
+
 class PBHEventHandler : public QObject
 {
   public:
@@ -82,11 +92,18 @@ class PBHEventHandler : public QObject
     int m_freeSpaceTimerId;
     int m_checkAvailabilityTimerId;
     static const uint kUpdateFreeSpaceInterval;
+    static const uint kAvailabilityCacheAgeMax;
     QMap<QString, QStringList> m_fileListCache;
     QHash<QString, QStringList> m_checkAvailability;
+    /// Keys of m_checkAvailability, most recently requested first.
+    QStringList m_checkAvailabilityOrder;
+    /// Recent availability results, so scrolling back and forth does
+    /// not repeat the file checks for items we just verified.
+    QHash<QString, AvailabilityCacheEntry> m_availabilityCache;
 };
 
 const uint PBHEventHandler::kUpdateFreeSpaceInterval = 15000; // 15 seconds
+const uint PBHEventHandler::kAvailabilityCacheAgeMax = 30000; // 30 seconds
 
 AvailableStatusType PBHEventHandler::CheckAvailability(const QStringList &slist)
 {
@@ -111,6 +128,42 @@ AvailableStatusType PBHEventHandler::CheckAvailability(const QStringList &slist)
     if (cats.empty())
         return asFileNotFound;
 
+    QString key = evinfo.MakeUniqueKey();
+
+    // Answer pure cache checks from the recent results rather than
+    // re-checking the file; actions always get a fresh check.
+    if (cats.size() == 1 && cats.contains(kCheckForCache))
+    {
+        QHash<QString, AvailabilityCacheEntry>::iterator cit =
+            m_availabilityCache.find(key);
+        if (cit != m_availabilityCache.end())
+        {
+            if ((*cit).checked.elapsed() < (int)kAvailabilityCacheAgeMax)
+            {
+                QStringList list;
+                list.push_back(key);
+                list.push_back((*cit).pathname);
+                MythEvent *e0 = new MythEvent("SET_PLAYBACK_URL", list);
+                QCoreApplication::postEvent(m_pbh.m_listener, e0);
+
+                list.clear();
+                list.push_back(key);
+                list.push_back(QString::number((int)kCheckForCache));
+                list.push_back(QString::number((int)(*cit).status));
+                list.push_back(QString::number((*cit).filesize));
+                list.push_back(QString::number(tm.hour()));
+                list.push_back(QString::number(tm.minute()));
+                list.push_back(QString::number(tm.second()));
+                list.push_back(QString::number(tm.msec()));
+                MythEvent *e = new MythEvent("AVAILABILITY", list);
+                QCoreApplication::postEvent(m_pbh.m_listener, e);
+
+                return (*cit).status;
+            }
+            m_availabilityCache.erase(cit);
+        }
+    }
+
     AvailableStatusType availableStatus = asAvailable;
     if (!evinfo.HasPathname() && !evinfo.GetChanID())
         availableStatus = asFileNotFound;
@@ -138,6 +191,14 @@ AvailableStatusType PBHEventHandler::CheckAvailability(const QStringList &slist)
         }
     }
 
+    if (m_availabilityCache.size() > 1000)
+        m_availabilityCache.clear();
+    AvailabilityCacheEntry &entry = m_availabilityCache[key];
+    entry.status   = availableStatus;
+    entry.pathname = evinfo.GetPathname();
+    entry.filesize = evinfo.GetFilesize();
+    entry.checked.start();
+
     QStringList list;
     list.push_back(evinfo.MakeUniqueKey());
     list.push_back(evinfo.GetPathname());
@@ -177,17 +238,31 @@ bool PBHEventHandler::event(QEvent *e)
             UpdateFreeSpaceEvent();
         if (timer_id == m_checkAvailabilityTimerId)
         {
+            // Process the whole batch, most recently requested first,
+            // so the items the user is looking at are checked before
+            // the items scrolled past to get there.
             QStringList slist;
+            do
             {
-                QMutexLocker locker(&m_pbh.m_lock);
-                QHash<QString, QStringList>::iterator it =
-                    m_checkAvailability.begin();
-                if (it != m_checkAvailability.end())
-                    slist = *it;
-            }
+                slist.clear();
+                {
+                    QMutexLocker locker(&m_pbh.m_lock);
+                    while (!m_checkAvailabilityOrder.empty() &&
+                           slist.empty())
+                    {
+                        QString key = m_checkAvailabilityOrder.front();
+                        m_checkAvailabilityOrder.pop_front();
+                        QHash<QString, QStringList>::iterator it =
+                            m_checkAvailability.find(key);
+                        if (it != m_checkAvailability.end())
+                            slist = *it;
+                    }
+                }
 
-            if (slist.size() >= 1 + NUMPROGRAMLINES)
-                CheckAvailability(slist);
+                if (slist.size() >= 1 + NUMPROGRAMLINES)
+                    CheckAvailability(slist);
+            }
+            while (!slist.empty());
         }
         return true;
     }
@@ -563,6 +638,8 @@ void PlaybackBoxHelper::CheckAvailability(
         pginfo.ToStringList(list);
         list += catstr;
         m_eventHandler->m_checkAvailability[pginfo.MakeUniqueKey()] = list;
+        m_eventHandler->m_checkAvailabilityOrder
+            .push_front(pginfo.MakeUniqueKey());
     }
     else
     {
@@ -0,0 +1,380 @@
+/*  mythiobench
+ *  Microbenchmarks for the capture-to-disk-to-playback I/O path.
+ *
+ *  Exercises ThreadedFileWriter sustained writes (optionally with
+ *  several concurrent writers), RingBuffer sequential reads, and
+ *  DeviceReadBuffer fed from a synthetic TS source over a pipe,
+ *  reporting MB/s and p99 per-call latency for each. Run this on a
+ *  recording filesystem before and after storage or I/O changes.
+ */
+
+// POSIX headers
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/time.h>
+
+// C++ headers
+#include <algorithm>
+#include <cstring>
+#include <cerrno>
+#include <vector>
+#include <iostream>
+using namespace std;
+
+// Qt headers
+#include <QCoreApplication>
+#include <QString>
+#include <QDir>
+#include <QFile>
+
+// MythTV headers
+#include "exitcodes.h"
+#include "mythcontext.h"
+#include "mythverbose.h"
+#include "mythversion.h"
+#include "compat.h"
+#include "ringbuffer.h"
+#include "ThreadedFileWriter.h"
+#include "DeviceReadBuffer.h"
+#include "mpeg/tspacket.h"
+
+#define LOC QString("IOBench: ")
+
+static const uint kChunkSize    = 64 * 1024;
+static const uint kDefaultMB    = 256;
+static const uint kDRBSeconds   = 5;
+
+static double now_ms(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (tv.tv_sec * 1000.0) + (tv.tv_usec / 1000.0);
+}
+
+/// Returns the p'th percentile of the samples, sorting them.
+static double percentile(vector<double> &samples, double p)
+{
+    if (samples.empty())
+        return 0.0;
+    sort(samples.begin(), samples.end());
+    uint i = (uint)(p * (samples.size() - 1));
+    return samples[i];
+}
+
+static void report(const QString &name, double mbytes, double elapsed_ms,
+                   vector<double> &latencies)
+{
+    cout << qPrintable(QString("%1: %2 MB in %3 s, %4 MB/s, "
+                               "p99 %5 ms, max %6 ms")
+                       .arg(name, -24)
+                       .arg(mbytes, 0, 'f', 1)
+                       .arg(elapsed_ms / 1000.0, 0, 'f', 2)
+                       .arg(mbytes / (elapsed_ms / 1000.0), 0, 'f', 1)
+                       .arg(percentile(latencies, 0.99), 0, 'f', 3)
+                       .arg(percentile(latencies, 1.00), 0, 'f', 3))
+         << endl;
+}
+
+///////////////////////////////////////////////////////////////////////
+// ThreadedFileWriter benchmark
+
+struct WriterArgs
+{
+    QString         fname;
+    uint            mbytes;
+    double          elapsed_ms;
+    vector<double>  latencies;
+    bool            ok;
+};
+
+static void *run_writer(void *arg)
+{
+    WriterArgs *wa = (WriterArgs*) arg;
+    wa->ok = false;
+
+    ThreadedFileWriter tfw(wa->fname, O_WRONLY|O_TRUNC|O_CREAT|O_LARGEFILE,
+                           0644);
+    if (!tfw.Open())
+    {
+        VERBOSE(VB_IMPORTANT, LOC +
+                QString("Failed to open '%1' for writing").arg(wa->fname));
+        return NULL;
+    }
+
+    char *chunk = new char[kChunkSize];
+    memset(chunk, 0xA5, kChunkSize);
+
+    uint chunks = (wa->mbytes * 1024 * 1024) / kChunkSize;
+    wa->latencies.reserve(chunks);
+
+    double start = now_ms();
+    for (uint i = 0; i < chunks; i++)
+    {
+        double t0 = now_ms();
+        if (tfw.Write(chunk, kChunkSize) != kChunkSize)
+        {
+            VERBOSE(VB_IMPORTANT, LOC + "Short write, aborting benchmark");
+            delete [] chunk;
+            return NULL;
+        }
+        wa->latencies.push_back(now_ms() - t0);
+    }
+    tfw.Flush();
+    tfw.Sync();
+    wa->elapsed_ms = now_ms() - start;
+
+    delete [] chunk;
+    wa->ok = true;
+    return NULL;
+}
+
+static bool bench_writers(const QString &dir, uint mbytes, uint nwriters)
+{
+    vector<WriterArgs> args(nwriters);
+    vector<pthread_t>  threads(nwriters);
+
+    for (uint i = 0; i < nwriters; i++)
+    {
+        args[i].fname  = QString("%1/iobench_w%2.dat").arg(dir).arg(i);
+        args[i].mbytes = mbytes;
+        pthread_create(&threads[i], NULL, run_writer, &args[i]);
+    }
+
+    bool ok = true;
+    double elapsed = 0.0;
+    vector<double> all_lat;
+    for (uint i = 0; i < nwriters; i++)
+    {
+        pthread_join(threads[i], NULL);
+        ok &= args[i].ok;
+        elapsed = max(elapsed, args[i].elapsed_ms);
+        all_lat.insert(all_lat.end(),
+                       args[i].latencies.begin(), args[i].latencies.end());
+    }
+
+    if (ok)
+    {
+        report(QString("TFW write x%1").arg(nwriters),
+               (double)mbytes * nwriters, elapsed, all_lat);
+    }
+    return ok;
+}
+
+///////////////////////////////////////////////////////////////////////
+// RingBuffer benchmark
+
+static bool bench_ringbuffer(const QString &dir, uint mbytes)
+{
+    // read back the first writer's file through the readahead thread
+    QString fname = QString("%1/iobench_w0.dat").arg(dir);
+    RingBuffer *rb = RingBuffer::Create(fname, false);
+    if (!rb || !rb->IsOpen())
+    {
+        VERBOSE(VB_IMPORTANT, LOC +
+                QString("Failed to open '%1' for reading").arg(fname));
+        delete rb;
+        return false;
+    }
+    rb->Start();
+
+    char *chunk = new char[kChunkSize];
+    uint chunks = (mbytes * 1024 * 1024) / kChunkSize;
+    vector<double> latencies;
+    latencies.reserve(chunks);
+
+    double start = now_ms();
+    long long total = 0;
+    for (uint i = 0; i < chunks; i++)
+    {
+        double t0 = now_ms();
+        int len = rb->Read(chunk, kChunkSize);
+        if (len <= 0)
+            break;
+        total += len;
+        latencies.push_back(now_ms() - t0);
+    }
+    double elapsed = now_ms() - start;
+
+    report("RingBuffer read", total / (1024.0 * 1024.0), elapsed, latencies);
+
+    delete [] chunk;
+    delete rb;
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////
+// DeviceReadBuffer benchmark
+
+class IOBenchReaderCB : public ReaderPausedCB
+{
+  public:
+    virtual void ReaderPaused(int /*fd*/) { }
+};
+
+struct FeederArgs
+{
+    int  fd;
+    bool run;
+};
+
+/// Pumps sync-byte aligned junk TS packets into the pipe as fast as
+/// the consumer drains them, standing in for a capture device.
+static void *run_feeder(void *arg)
+{
+    FeederArgs *fa = (FeederArgs*) arg;
+
+    unsigned char packets[TSPacket::SIZE * 7];
+    memset(packets, 0xFF, sizeof(packets));
+    for (uint i = 0; i < 7; i++)
+        packets[i * TSPacket::SIZE] = SYNC_BYTE;
+
+    while (fa->run)
+    {
+        int ret = write(fa->fd, packets, sizeof(packets));
+        if (ret < 0)
+        {
+            if ((EAGAIN == errno) || (EINTR == errno))
+                continue;
+            break;
+        }
+    }
+    return NULL;
+}
+
+static bool bench_devicereadbuffer(void)
+{
+    int pipefd[2];
+    if (pipe(pipefd) < 0)
+    {
+        VERBOSE(VB_IMPORTANT, LOC + "Failed to create pipe" + ENO);
+        return false;
+    }
+
+    IOBenchReaderCB cb;
+    DeviceReadBuffer drb(&cb);
+    if (!drb.Setup("iobench", pipefd[0]))
+    {
+        VERBOSE(VB_IMPORTANT, LOC + "Failed to set up DeviceReadBuffer");
+        close(pipefd[0]);
+        close(pipefd[1]);
+        return false;
+    }
+
+    FeederArgs fa;
+    fa.fd  = pipefd[1];
+    fa.run = true;
+    pthread_t feeder;
+    pthread_create(&feeder, NULL, run_feeder, &fa);
+
+    drb.Start();
+
+    char *chunk = new char[kChunkSize];
+    vector<double> latencies;
+    long long total = 0;
+
+    double start = now_ms();
+    while ((now_ms() - start) < (kDRBSeconds * 1000.0))
+    {
+        double t0 = now_ms();
+        uint len = drb.Read((unsigned char*)chunk, kChunkSize);
+        if (drb.IsErrored())
+            break;
+        if (!len)
+        {
+            usleep(500);
+            continue;
+        }
+        total += len;
+        latencies.push_back(now_ms() - t0);
+    }
+    double elapsed = now_ms() - start;
+
+    fa.run = false;
+    drb.Stop();
+    pthread_join(feeder, NULL);
+    close(pipefd[0]);
+    close(pipefd[1]);
+
+    report("DeviceReadBuffer", total / (1024.0 * 1024.0), elapsed, latencies);
+
+    delete [] chunk;
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////
+
+static void usage(const char *progname)
+{
+    cerr << "Usage: " << progname << " [options]" << endl
+         << "Options:" << endl
+         << "  --dir <path>     directory for benchmark files "
+            "(default: current dir)" << endl
+         << "  --mb <size>      MB written/read per benchmark "
+            "(default: " << kDefaultMB << ")" << endl
+         << "  --writers <n>    concurrent ThreadedFileWriters "
+            "(default: 1)" << endl
+         << "  --keep           don't delete benchmark files" << endl
+         << "  -v, --verbose    enable verbose messages" << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+
+    QString dir      = ".";
+    uint    mbytes   = kDefaultMB;
+    uint    nwriters = 1;
+    bool    keep     = false;
+
+    for (int argpos = 1; argpos < a.argc(); ++argpos)
+    {
+        QString arg = a.argv()[argpos];
+        if (arg == "--dir" && (argpos + 1) < a.argc())
+            dir = a.argv()[++argpos];
+        else if (arg == "--mb" && (argpos + 1) < a.argc())
+            mbytes = QString(a.argv()[++argpos]).toUInt();
+        else if (arg == "--writers" && (argpos + 1) < a.argc())
+            nwriters = QString(a.argv()[++argpos]).toUInt();
+        else if (arg == "--keep")
+            keep = true;
+        else if (arg == "-v" || arg == "--verbose")
+            print_verbose_messages |= VB_FILE;
+        else
+        {
+            usage(a.argv()[0]);
+            return GENERIC_EXIT_INVALID_CMDLINE;
+        }
+    }
+
+    if (!mbytes || !nwriters || !QDir(dir).exists())
+    {
+        usage(a.argv()[0]);
+        return GENERIC_EXIT_INVALID_CMDLINE;
+    }
+
+    gContext = new MythContext(MYTH_BINARY_VERSION);
+    if (!gContext->Init(
+            false/*use gui*/, NULL/*upnp*/, false/*prompt for backend*/,
+            false/*bypass auto discovery*/, true/*ignoreDB*/))
+    {
+        VERBOSE(VB_IMPORTANT, "Failed to init MythContext, exiting.");
+        return GENERIC_EXIT_NO_MYTHCONTEXT;
+    }
+
+    bool ok = bench_writers(dir, mbytes, nwriters);
+    if (ok)
+        ok &= bench_ringbuffer(dir, mbytes);
+    ok &= bench_devicereadbuffer();
+
+    if (!keep)
+    {
+        for (uint i = 0; i < nwriters; i++)
+            QFile::remove(QString("%1/iobench_w%2.dat").arg(dir).arg(i));
+    }
+
+    delete gContext;
+    return ok ? GENERIC_EXIT_OK : GENERIC_EXIT_NOT_OK;
+}
+
+/* vim: set expandtab tabstop=4 shiftwidth=4: */
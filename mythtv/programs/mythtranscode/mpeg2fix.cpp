@@ -250,6 +250,12 @@ MPEG2fixup::MPEG2fixup(const QString &inf, const QString &outf,
     av_register_all();
     av_log_set_callback(my_av_print);
 
+    reader_running = false;
+    reader_eof = false;
+    reader_done = false;
+    pthread_mutex_init(&reader_mutex, NULL);
+    pthread_cond_init(&reader_cond, NULL);
+
     pthread_mutex_init(&rx.mutex, NULL);
     pthread_cond_init(&rx.cond, NULL);
 
@@ -282,6 +288,8 @@ MPEG2fixup::MPEG2fixup(const QString &inf, const QString &outf,
 
 MPEG2fixup::~MPEG2fixup()
 {
+    StopReader();
+
     mpeg2_close(header_decoder);
     mpeg2_close(img_decoder);
 
@@ -1239,13 +1247,111 @@ MPEG2frame *MPEG2fixup::GetPoolFrame(MPEG2frame *f)
     return tmpFrame;
 }
 
-int MPEG2fixup::GetFrame(AVPacket *pkt)
+//how far the reader thread may get ahead of the processing loop
+#define MAX_READAHEAD 128
+
+void *MPEG2fixup::ReaderStart(void *data)
 {
-    int ret;
+    ((MPEG2fixup *)data)->ReaderLoop();
+    return NULL;
+}
+
+//Demultiplexes the input file ahead of the processing loop, so that the
+//file reads overlap the PTS fixup and multiplex stages.
+void MPEG2fixup::ReaderLoop()
+{
+    AVPacket pkt;
+    QList<int> audioIds = aFrame.keys();
+
+    av_init_packet(&pkt);
 
     while (1)
     {
-        bool done = 0;
+        pkt.pts = AV_NOPTS_VALUE;
+        pkt.dts = AV_NOPTS_VALUE;
+
+        if (av_read_frame(inputFC, &pkt) < 0)
+            break;
+
+        if (pkt.stream_index != vid_id &&
+            !audioIds.contains(pkt.stream_index))
+        {
+            av_free_packet(&pkt);
+            continue;
+        }
+
+        //make the packet data independent of the demuxer
+        av_dup_packet(&pkt);
+
+        pthread_mutex_lock(&reader_mutex);
+        while (pktQueue.count() >= MAX_READAHEAD && !reader_done)
+            pthread_cond_wait(&reader_cond, &reader_mutex);
+        if (reader_done)
+        {
+            pthread_mutex_unlock(&reader_mutex);
+            av_free_packet(&pkt);
+            return;
+        }
+        pktQueue.append(pkt);
+        pthread_cond_signal(&reader_cond);
+        pthread_mutex_unlock(&reader_mutex);
+    }
+
+    pthread_mutex_lock(&reader_mutex);
+    reader_eof = true;
+    pthread_cond_signal(&reader_cond);
+    pthread_mutex_unlock(&reader_mutex);
+}
+
+void MPEG2fixup::StartReader()
+{
+    reader_eof = false;
+    reader_done = false;
+    pthread_create(&reader_thread, NULL, ReaderStart, this);
+    reader_running = true;
+}
+
+void MPEG2fixup::StopReader()
+{
+    if (! reader_running)
+        return;
+
+    pthread_mutex_lock(&reader_mutex);
+    reader_done = true;
+    pthread_cond_broadcast(&reader_cond);
+    pthread_mutex_unlock(&reader_mutex);
+    pthread_join(reader_thread, NULL);
+    reader_running = false;
+
+    while (! pktQueue.isEmpty())
+    {
+        AVPacket pkt = pktQueue.takeFirst();
+        av_free_packet(&pkt);
+    }
+}
+
+//Returns false once the reader has delivered the last packet.
+//The caller owns the returned packet data.
+bool MPEG2fixup::DequeuePacket(AVPacket *pkt)
+{
+    pthread_mutex_lock(&reader_mutex);
+    while (pktQueue.isEmpty() && !reader_eof)
+        pthread_cond_wait(&reader_cond, &reader_mutex);
+
+    bool got = !pktQueue.isEmpty();
+    if (got)
+    {
+        *pkt = pktQueue.takeFirst();
+        pthread_cond_signal(&reader_cond);
+    }
+    pthread_mutex_unlock(&reader_mutex);
+    return got;
+}
+
+int MPEG2fixup::GetFrame(AVPacket *pkt)
+{
+    while (1)
+    {
         if (unreadFrames.count())
         {
             vFrame.append(unreadFrames.dequeue());
@@ -1253,35 +1359,24 @@ int MPEG2fixup::GetFrame(AVPacket *pkt)
                 file_end = true;
             return (file_end == true);
         }
-        while (! done)
-        {
-            pkt->pts = AV_NOPTS_VALUE;
-            pkt->dts = AV_NOPTS_VALUE;
-            ret = av_read_frame(inputFC, pkt);
 
-            if (ret < 0)
+        //the reader thread has already filtered out other streams
+        if (! DequeuePacket(pkt))
+        {
+            //insert a bogus frame (this won't be written out)
+            if(vFrame.isEmpty())
             {
-                //insert a bogus frame (this won't be written out)
-                if(vFrame.isEmpty())
-                {
-                    VERBOSE(MPF_IMPORTANT, "Found end of file without finding "
-                                           " any frames");
-                    return TRANSCODE_EXIT_UNKNOWN_ERROR;
-                }
-                MPEG2frame *tmpFrame = GetPoolFrame(&vFrame.last()->pkt);
-                if (tmpFrame == NULL)
-                    return TRANSCODE_EXIT_UNKNOWN_ERROR;
-                vFrame.append(tmpFrame);
-                real_file_end = true;
-                file_end = true;
-                return 1;
+                VERBOSE(MPF_IMPORTANT, "Found end of file without finding "
+                                       " any frames");
+                return TRANSCODE_EXIT_UNKNOWN_ERROR;
             }
-
-            if (pkt->stream_index == vid_id ||
-                    aFrame.contains(pkt->stream_index))
-                done = 1;
-            else 
-                av_free_packet(pkt);
+            MPEG2frame *tmpFrame = GetPoolFrame(&vFrame.last()->pkt);
+            if (tmpFrame == NULL)
+                return TRANSCODE_EXIT_UNKNOWN_ERROR;
+            vFrame.append(tmpFrame);
+            real_file_end = true;
+            file_end = true;
+            return 1;
         }
         pkt->duration = framenum++;
         if ((showprogress || update_status) &&
@@ -1882,6 +1977,8 @@ int MPEG2fixup::Start()
         return (TRANSCODE_EXIT_UNKNOWN_ERROR);
     }
 
+    StartReader();
+
     if (! FindStart())
         return (TRANSCODE_EXIT_UNKNOWN_ERROR);
 
@@ -2446,6 +2543,8 @@ int MPEG2fixup::Start()
     pthread_mutex_unlock( &rx.mutex );
     pthread_join(thread, NULL);
 
+    StopReader();
+
     av_close_input_file(inputFC);
     inputFC = NULL;
     return REENCODE_OK;
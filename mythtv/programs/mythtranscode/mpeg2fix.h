@@ -166,6 +166,11 @@ class MPEG2fixup
     MPEG2replex rx;
 
   private:
+    static void *ReaderStart(void *data);
+    void ReaderLoop();
+    void StartReader();
+    void StopReader();
+    bool DequeuePacket(AVPacket *pkt);
     int FindMPEG2Header(uint8_t *buf, int size, uint8_t code);
     void InitReplex();
     void FrameInfo(MPEG2frame *f);
@@ -244,6 +249,15 @@ class MPEG2fixup
 
     pthread_t thread;
 
+    //demux readahead
+    pthread_t reader_thread;
+    pthread_mutex_t reader_mutex;
+    pthread_cond_t reader_cond;
+    QList<AVPacket> pktQueue;
+    bool reader_running;
+    bool reader_eof;
+    bool reader_done;
+
     AVFormatContext *inputFC;
     int vid_id;
     int ext_count;
@@ -266,11 +266,11 @@ static void writeout_video(multiplex_t *mx)
 					   mx->SCR, outbuf, &nlength,
 					   ptsdts, mx->vrbuffer);
 	else
-		written = write_video_pes( mx->pack_size, mx->extcnt, 
-					   viu->pts+mx->video_delay, 
-					   viu->dts+mx->video_delay, 
+		written = write_video_pes( mx->pack_size, mx->extcnt,
+					   viu->pts+mx->video_delay,
+					   viu->dts+mx->video_delay,
 					   mx->SCR, mx->muxr, outbuf, &nlength,
-					   ptsdts, mx->vrbuffer);
+					   ptsdts, mx->vrbuffer, mx->fd_out);
 
 	// something bad happened with the PES or TS write, bail
 	if (written == -1)
@@ -284,7 +284,9 @@ static void writeout_video(multiplex_t *mx)
 	//estimate next pts based on bitrate of this stream and data written
 	viu->dts = uptsdiff(viu->dts + ((nlength*viu->ptsrate)>>8), 0);
 
-	write(mx->fd_out, outbuf, written);
+	// the PES writer sends the pack itself via a gather write
+	if (mx->is_ts)
+		write(mx->fd_out, outbuf, written);
 
 #ifdef OUT_DEBUG
 	fprintf(stderr,"VPTS");
@@ -408,7 +410,7 @@ static void writeout_ext(multiplex_t *mx, int n)
 			written = write_audio_pes( mx->pack_size, mx->extcnt,
 					mx->ext[n].strmnum, pts, mx->SCR,
 					mx->muxr, outbuf, &nlength, PTS_ONLY,
-					&mx->extrbuffer[n]);
+					&mx->extrbuffer[n], mx->fd_out);
 		break;
 	case AC3:
 		if(mx->is_ts)
@@ -420,7 +422,7 @@ static void writeout_ext(multiplex_t *mx, int n)
 					mx->ext[n].strmnum, pts, mx->SCR,
 					mx->muxr, outbuf, &nlength, PTS_ONLY,
 					nframes, ac3_off,
-					&mx->extrbuffer[n]);
+					&mx->extrbuffer[n], mx->fd_out);
 		break;
 	}
 
@@ -430,7 +432,9 @@ static void writeout_ext(multiplex_t *mx, int n)
 		return;
 
 	length -= nlength;
-	write(mx->fd_out, outbuf, written);
+	// the PES writers send the pack themselves via a gather write
+	if (mx->is_ts)
+		write(mx->fd_out, outbuf, written);
 
 	dummy_add(dbuf, dpts, aiu->length-length);
 	aiu->length = length;
@@ -693,10 +693,10 @@ void write_padding_pes( int pack_size, int extcnt,
 
 }
 
-int write_video_pes( int pack_size, int extcnt, uint64_t vpts, 
-		     uint64_t vdts, uint64_t SCR, uint64_t muxr, 
-		     uint8_t *buf, int *vlength, 
-		     uint8_t ptsdts, ringbuffer *vrbuffer)
+int write_video_pes( int pack_size, int extcnt, uint64_t vpts,
+		     uint64_t vdts, uint64_t SCR, uint64_t muxr,
+		     uint8_t *buf, int *vlength,
+		     uint8_t ptsdts, ringbuffer *vrbuffer, int fd)
 {
 	int add;
 	int pos = 0;
@@ -733,22 +733,23 @@ int write_video_pes( int pack_size, int extcnt, uint64_t vpts,
 			*vlength);
 	}
 
-	add = ring_read( vrbuffer, buf+pos, length-pos);
+	add = ring_read_filev( vrbuffer, fd, buf, pos, length-pos);
 	*vlength = add;
 	if (add < 0) return -1;
 	pos += add;
 
 	if (pos+PES_MIN < pack_size){
-		pos += write_pes_header( PADDING_STREAM, pack_size-pos, 0, 0,
-					 buf+pos, 0, 0);
+		add = write_pes_header( PADDING_STREAM, pack_size-pos, 0, 0,
+					buf, 0, 0);
+		if (write(fd, buf, add) < 0) return -1;
 		pos = pack_size;
-	}		
+	}
 	return pos;
 }
 
-int write_audio_pes(  int pack_size, int extcnt, int n, uint64_t pts, 
-		      uint64_t SCR, uint32_t muxr, uint8_t *buf, int *alength, 
-		      uint8_t ptsdts, 	ringbuffer *arbuffer)
+int write_audio_pes(  int pack_size, int extcnt, int n, uint64_t pts,
+		      uint64_t SCR, uint32_t muxr, uint8_t *buf, int *alength,
+		      uint8_t ptsdts, 	ringbuffer *arbuffer, int fd)
 {
 	int add;
 	int pos = 0;
@@ -776,16 +777,17 @@ int write_audio_pes(  int pack_size, int extcnt, int n, uint64_t pts,
 			      1, 0);
 	pos += write_pes_header( 0xC0+n, length-pos, pts, 0, buf+pos, stuff, 
 				 ptsdts);
-	add = ring_read( arbuffer, buf+pos, length-pos);
+	add = ring_read_filev( arbuffer, fd, buf, pos, length-pos);
 	*alength = add;
 	if (add < 0) return -1;
 	pos += add;
 
 	if (pos+PES_MIN < pack_size){
-		pos += write_pes_header( PADDING_STREAM, pack_size-pos, 0,0,
-					 buf+pos, 0, 0);
+		add = write_pes_header( PADDING_STREAM, pack_size-pos, 0,0,
+					buf, 0, 0);
+		if (write(fd, buf, add) < 0) return -1;
 		pos = pack_size;
-	}		
+	}
 	if (pos != pack_size) {
 		fprintf(stderr,"apos: %d\n",pos);
 		exit(1);
@@ -795,9 +797,9 @@ int write_audio_pes(  int pack_size, int extcnt, int n, uint64_t pts,
 }
 
 int write_ac3_pes(  int pack_size, int extcnt, int n,
-		    uint64_t pts, uint64_t SCR, 
+		    uint64_t pts, uint64_t SCR,
 		    uint32_t muxr, uint8_t *buf, int *alength, uint8_t ptsdts,
-		    int nframes,int ac3_off, ringbuffer *ac3rbuffer)
+		    int nframes,int ac3_off, ringbuffer *ac3rbuffer, int fd)
 {
 	int add;
 	int pos = 0;
@@ -832,16 +834,17 @@ int write_ac3_pes(  int pack_size, int extcnt, int n,
 	buf[pos+3] = (ac3_off)& 0xFF;
 	pos += 4;
 
-	add = ring_read( ac3rbuffer, buf+pos, length-pos);
+	add = ring_read_filev( ac3rbuffer, fd, buf, pos, length-pos);
 	*alength = add;
 	if (add < 0) return -1;
 	pos += add;
 
 	if (pos+PES_MIN < pack_size){
-		pos += write_pes_header( PADDING_STREAM, pack_size-pos, 0,0,
-					 buf+pos, 0, 0);
+		add = write_pes_header( PADDING_STREAM, pack_size-pos, 0,0,
+					buf, 0, 0);
+		if (write(fd, buf, add) < 0) return -1;
 		pos = pack_size;
-	}		
+	}
 	if (pos != pack_size) {
 		fprintf(stderr,"apos: %d\n",pos);
 		exit(1);
@@ -29,6 +29,28 @@
 #include "ringbuffer.h"
 #include "pes.h"
 
+#ifdef USING_MINGW
+struct iovec {
+	void *iov_base;
+	size_t iov_len;
+};
+
+static int writev(int fd, const struct iovec *iov, int iovcnt)
+{
+	int i, rr, total = 0;
+
+	for (i = 0; i < iovcnt; i++){
+		rr = write (fd, iov[i].iov_base, iov[i].iov_len);
+		if (rr < 0) return total ? total : rr;
+		total += rr;
+		if ((size_t)rr < iov[i].iov_len) break;
+	}
+	return total;
+}
+#else
+#include <sys/uio.h>
+#endif
+
 #define DEBUG 1
 int ring_init (ringbuffer *rbuf, int size)
 {
@@ -291,7 +313,59 @@ int ring_read_file(ringbuffer *rbuf, int fd, int count)
 	}
 
 
-	if (DEBUG>1) fprintf(stderr,"Buffer empty %.2f%%\n", 
+	if (DEBUG>1) fprintf(stderr,"Buffer empty %.2f%%\n",
+			     ring_free(rbuf)*100.0/rbuf->size);
+	return rr;
+}
+
+/* write a pre-assembled header followed by count bytes of ring data
+   to fd in one gather write, without copying the data out of the ring */
+int ring_read_filev(ringbuffer *rbuf, int fd, uint8_t *head, int hlen,
+		    int count)
+{
+
+	int avail, pos, rest, rr, n;
+	struct iovec iov[3];
+
+	if (count <=0 ) return -1;
+	pos  = rbuf->read_pos;
+	rest = rbuf->size - pos;
+	avail = ring_avail(rbuf);
+
+	if ( avail < count ){
+//		if (DEBUG) fprintf(stderr,"ringbuffer underflow %d<%d %d %d\n",
+//				   avail, count, pos, rbuf->write_pos);
+		return EMPTY_BUFFER;
+	}
+
+	n = 0;
+	if (hlen > 0){
+		iov[n].iov_base = head;
+		iov[n].iov_len  = hlen;
+		n++;
+	}
+	if (count >= rest){
+		iov[n].iov_base = rbuf->buffer+pos;
+		iov[n].iov_len  = rest;
+		n++;
+		if (count - rest){
+			iov[n].iov_base = rbuf->buffer;
+			iov[n].iov_len  = count - rest;
+			n++;
+		}
+	} else {
+		iov[n].iov_base = rbuf->buffer+pos;
+		iov[n].iov_len  = count;
+		n++;
+	}
+
+	rr = writev (fd, iov, n);
+	if (rr < 0) return rr;
+	rr -= hlen;
+	if (rr < 0) rr = 0;
+	rbuf->read_pos = (pos + rr) % rbuf->size;
+
+	if (DEBUG>1) fprintf(stderr,"Buffer empty %.2f%%\n",
 			     ring_free(rbuf)*100.0/rbuf->size);
 	return rr;
 }
@@ -63,6 +63,8 @@ extern "C" {
 	int ring_read(ringbuffer *rbuf, uint8_t *data, int count);
 	int ring_write_file(ringbuffer *rbuf, int fd, int count);
 	int ring_read_file(ringbuffer *rbuf, int fd, int count);
+	int ring_read_filev(ringbuffer *rbuf, int fd, uint8_t *head,
+			    int hlen, int count);
 	int ring_peek(ringbuffer *rbuf, uint8_t *data, unsigned int count,
                       uint32_t off);
 	int ring_poke(ringbuffer *rbuf, uint8_t *data, unsigned int count,
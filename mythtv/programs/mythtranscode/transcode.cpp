@@ -1,9 +1,14 @@
 #include <fcntl.h>
 #include <math.h>
+#include <unistd.h>
 
 #include <QStringList>
 #include <QMap>
 #include <QRegExp>
+#include <QThread>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QWaitCondition>
 
 #include "mythconfig.h"
 
@@ -16,8 +21,11 @@
 
 #include "NuppelVideoRecorder.h"
 #include "mythplayer.h"
+#include "mythcommflagplayer.h"
 #include "programinfo.h"
 #include "mythdbcon.h"
+#include "remoteencoder.h"
+#include "tvremoteutil.h"
 
 
 extern "C" {
@@ -216,6 +224,315 @@ class AudioReencodeBuffer : public AudioOutput
     long long last_audiotime;
 };
 
+// This class runs the scale and video re-encode stages on their own
+// thread so that they overlap decode and audio encoding.  The decode
+// loop hands filled frame buffers over through a small ring; the
+// frame-parallel threading inside libavcodec (the "encodingthreadcount"
+// profile setting) then fans the encode itself out across cores.
+//
+// Audio, text and video all funnel into the NuppelVideoRecorder, which
+// is not thread safe, so writes from both threads are serialized on a
+// shared lock.  Audio may now lead or trail video in the output by up
+// to the depth of the ring, the same sort of skew a real recording
+// produces.
+
+class VideoReencodeThread : public QThread
+{
+ public:
+    struct Frame
+    {
+        unsigned char *buf;
+        int bufsize;
+        int width, height;    // source dimensions, pre-scale
+        long long timecode;
+        long long frameNumber;
+        float newaspect;      // > 0 on an aspect change
+    };
+
+    VideoReencodeThread(NuppelVideoRecorder *_nvr, QMutex *_nvrlock,
+                        bool _forcekeys, int _outwidth, int _outheight,
+                        int inbufsize)
+        : nvr(_nvr), nvrlock(_nvrlock), forcekeys(_forcekeys),
+          outwidth(_outwidth), outheight(_outheight),
+          head(0), tail(0), count(0), done(false), errored(false),
+          scontext(NULL)
+    {
+        for (int ii = 0; ii < kRingDepth; ii++)
+        {
+            ring[ii].buf = new unsigned char[inbufsize];
+            ring[ii].bufsize = inbufsize;
+        }
+        scalebuf = new unsigned char[outwidth * outheight * 3 / 2];
+    }
+
+    ~VideoReencodeThread()
+    {
+        for (int ii = 0; ii < kRingDepth; ii++)
+            delete [] ring[ii].buf;
+        delete [] scalebuf;
+        sws_freeContext(scontext);
+    }
+
+    // Returns a free frame with room for at least "size" bytes,
+    // blocking until the encoder has caught up enough to provide one.
+    Frame *GetBuffer(int size)
+    {
+        QMutexLocker locker(&lock);
+        while (count == kRingDepth)
+            hasSpace.wait(&lock);
+
+        Frame *frame = &ring[head];
+        if (frame->bufsize < size)
+        {
+            delete [] frame->buf;
+            frame->buf = new unsigned char[size];
+            frame->bufsize = size;
+        }
+        return frame;
+    }
+
+    // Commits the frame returned by GetBuffer to the encoder.
+    void Enqueue(void)
+    {
+        QMutexLocker locker(&lock);
+        head = (head + 1) % kRingDepth;
+        count++;
+        hasData.wakeAll();
+    }
+
+    // Encodes everything already queued, then ends the thread.
+    void Finish(void)
+    {
+        lock.lock();
+        done = true;
+        hasData.wakeAll();
+        lock.unlock();
+        wait();
+    }
+
+    bool IsErrored(void) const { return errored; }
+
+ protected:
+    virtual void run(void)
+    {
+        while (true)
+        {
+            lock.lock();
+            while (!count && !done)
+                hasData.wait(&lock);
+            if (!count)
+            {
+                lock.unlock();
+                break;
+            }
+            Frame *frame = &ring[tail];
+            lock.unlock();
+
+            Encode(frame);
+
+            lock.lock();
+            tail = (tail + 1) % kRingDepth;
+            count--;
+            hasSpace.wakeAll();
+            lock.unlock();
+        }
+    }
+
+ private:
+    void Encode(const Frame *inframe)
+    {
+        VideoFrame frame;
+        frame.codec = FMT_YV12;
+        frame.width = outwidth;
+        frame.height = outheight;
+        frame.size = outwidth * outheight * 3 / 2;
+        frame.timecode = inframe->timecode;
+        frame.frameNumber = inframe->frameNumber;
+
+        if (inframe->width == outwidth && inframe->height == outheight)
+        {
+            frame.buf = inframe->buf;
+        }
+        else
+        {
+            AVPicture imageIn, imageOut;
+
+            frame.buf = scalebuf;
+            avpicture_fill(&imageIn, inframe->buf, PIX_FMT_YUV420P,
+                           inframe->width, inframe->height);
+            avpicture_fill(&imageOut, frame.buf, PIX_FMT_YUV420P,
+                           outwidth, outheight);
+
+            int bottomBand = (inframe->height == 1088) ? 8 : 0;
+            scontext = sws_getCachedContext(scontext, inframe->width,
+                           inframe->height, PIX_FMT_YUV420P, outwidth,
+                           outheight, PIX_FMT_YUV420P,
+                           SWS_FAST_BILINEAR, NULL, NULL, NULL);
+
+            sws_scale(scontext, imageIn.data, imageIn.linesize, 0,
+                      inframe->height - bottomBand,
+                      imageOut.data, imageOut.linesize);
+        }
+
+        QMutexLocker locker(nvrlock);
+        if (inframe->newaspect > 0.0f)
+            nvr->SetNewVideoParams(inframe->newaspect);
+
+        if (forcekeys)
+            nvr->WriteVideo(&frame, true, true);
+        else
+            nvr->WriteVideo(&frame);
+
+        if (nvr->IsErrored())
+            errored = true;
+    }
+
+    // Frames of decode the encoder may fall behind before the decode
+    // loop blocks; enough to ride out keyframes without much memory.
+    static const int kRingDepth = 4;
+
+    NuppelVideoRecorder *nvr;
+    QMutex *nvrlock;
+    bool forcekeys;
+    int outwidth, outheight;
+
+    Frame ring[kRingDepth];
+    int head, tail, count;
+    bool done;
+    bool errored;
+    QMutex lock;
+    QWaitCondition hasData;
+    QWaitCondition hasSpace;
+
+    unsigned char *scalebuf;
+    struct SwsContext *scontext;
+};
+
+// The same arrangement for audio: the decode loop queues the raw chunks
+// the AudioReencodeBuffer collected and this thread feeds them through
+// NVR::WriteAudio, so the MP3 encode runs beside video work instead of
+// between frames of it.  The stream stays ordered because WriteAudio
+// stamps each chunk with the timecode queued here; chunks only ever
+// trail video by the depth of the ring.
+
+class AudioReencodeThread : public QThread
+{
+ public:
+    struct Chunk
+    {
+        unsigned char *buf;
+        int bufsize;
+        int len;
+        int frameNumber;
+        long long timecode;
+    };
+
+    AudioReencodeThread(NuppelVideoRecorder *_nvr, QMutex *_nvrlock)
+        : nvr(_nvr), nvrlock(_nvrlock),
+          head(0), tail(0), count(0), done(false), errored(false)
+    {
+        for (int ii = 0; ii < kRingDepth; ii++)
+        {
+            ring[ii].buf = new unsigned char[4096];
+            ring[ii].bufsize = 4096;
+        }
+    }
+
+    ~AudioReencodeThread()
+    {
+        for (int ii = 0; ii < kRingDepth; ii++)
+            delete [] ring[ii].buf;
+    }
+
+    // Returns a free chunk with room for at least "size" bytes,
+    // blocking until the encoder has caught up enough to provide one.
+    Chunk *GetBuffer(int size)
+    {
+        QMutexLocker locker(&lock);
+        while (count == kRingDepth)
+            hasSpace.wait(&lock);
+
+        Chunk *chunk = &ring[head];
+        if (chunk->bufsize < size)
+        {
+            delete [] chunk->buf;
+            chunk->buf = new unsigned char[size];
+            chunk->bufsize = size;
+        }
+        return chunk;
+    }
+
+    // Commits the chunk returned by GetBuffer to the encoder.
+    void Enqueue(void)
+    {
+        QMutexLocker locker(&lock);
+        head = (head + 1) % kRingDepth;
+        count++;
+        hasData.wakeAll();
+    }
+
+    // Encodes everything already queued, then ends the thread.
+    void Finish(void)
+    {
+        lock.lock();
+        done = true;
+        hasData.wakeAll();
+        lock.unlock();
+        wait();
+    }
+
+    bool IsErrored(void) const { return errored; }
+
+ protected:
+    virtual void run(void)
+    {
+        while (true)
+        {
+            lock.lock();
+            while (!count && !done)
+                hasData.wait(&lock);
+            if (!count)
+            {
+                lock.unlock();
+                break;
+            }
+            Chunk *chunk = &ring[tail];
+            lock.unlock();
+
+            {
+                QMutexLocker locker(nvrlock);
+                nvr->SetOption("audioframesize", chunk->len);
+                nvr->WriteAudio(chunk->buf, chunk->frameNumber,
+                                chunk->timecode);
+                if (nvr->IsErrored())
+                    errored = true;
+            }
+
+            lock.lock();
+            tail = (tail + 1) % kRingDepth;
+            count--;
+            hasSpace.wakeAll();
+            lock.unlock();
+        }
+    }
+
+ private:
+    // Audio chunks arrive several per video frame, so the ring is
+    // deeper than the video one but holds far less memory.
+    static const int kRingDepth = 32;
+
+    NuppelVideoRecorder *nvr;
+    QMutex *nvrlock;
+
+    Chunk ring[kRingDepth];
+    int head, tail, count;
+    bool done;
+    bool errored;
+    QMutex lock;
+    QWaitCondition hasData;
+    QWaitCondition hasSpace;
+};
+
 Transcode::Transcode(ProgramInfo *pginfo) :
     m_proginfo(pginfo),
     keyframedist(30),
@@ -374,6 +691,37 @@ int Transcode::TranscodeFile(
     if (jobID >= 0)
         JobQueue::ChangeJobComment(jobID, "0% " + QObject::tr("Completed"));
 
+    // If the recording is still in progress, transcode it as it is
+    // written instead of waiting for it to finish: the main loop below
+    // then follows a safe distance behind the write head, so the output
+    // is complete shortly after the recording is and every read is of
+    // data the recorder wrote moments earlier, straight out of the page
+    // cache.  This is modeled on mythcommflag's realtime flagging.  A
+    // cutlist cannot exist for an unfinished recording, so jobs that
+    // honor one run the old way.
+    QDateTime recordingStartsAt;
+    QDateTime recordingStopsAt;
+    bool stillRecording = false;
+    const int requiredBuffer = 30; // seconds to stay behind the recorder
+    if (m_proginfo && !honorCutList &&
+        m_proginfo->GetRecordingEndTime() > QDateTime::currentDateTime())
+    {
+        recordingStartsAt = m_proginfo->GetRecordingStartTime();
+        recordingStopsAt  = m_proginfo->GetRecordingEndTime();
+        stillRecording    = true;
+
+        // give the recorder a head start so that the file opens
+        // cleanly and we never catch the write head up
+        int secsSince =
+            recordingStartsAt.secsTo(QDateTime::currentDateTime());
+        while ((secsSince < requiredBuffer) &&
+               (QDateTime::currentDateTime() < recordingStopsAt))
+        {
+            sleep(2);
+            secsSince = recordingStartsAt.secsTo(QDateTime::currentDateTime());
+        }
+    }
+
     nvr = new NuppelVideoRecorder(NULL, NULL);
 
     // Input setup
@@ -397,6 +745,29 @@ int Transcode::TranscodeFile(
     player->GetAudio()->SetAudioOutput(audioOutput);
     player->SetTranscoding(true);
 
+    if (stillRecording)
+    {
+        // attach to the recorder so the decoder keeps resyncing the
+        // growing seek table and we can see how far the write head is
+        gCoreContext->ConnectToMasterServer();
+        RemoteEncoder *recorder = RemoteGetExistingRecorder(m_proginfo);
+        if (recorder && (recorder->GetRecorderNumber() != -1))
+        {
+            player_ctx->SetRecorder(recorder);
+            player->SetWatchingRecording(true);
+
+            VERBOSE(VB_GENERAL, QString("Transcoding recording currently "
+                    "in progress on cardid %1, following the write head")
+                    .arg(recorder->GetRecorderNumber()));
+        }
+        else
+        {
+            delete recorder;
+            VERBOSE(VB_IMPORTANT, "Unable to find active recorder for this "
+                    "recording, following it by wall clock instead.");
+        }
+    }
+
     if (player->OpenFile(false) < 0)
     {
         VERBOSE(VB_IMPORTANT, "Transcoding aborted, error opening file.");
@@ -450,6 +821,39 @@ int Transcode::TranscodeFile(
             return REENCODE_CUTLIST_CHANGE;
         }
         m_proginfo->ClearMarkupFlag(MARK_UPDATED_CUT);
+
+        // Without a seek table every cut jump degenerates into decoding
+        // frame by frame through the skipped material.  Rebuild it with
+        // a parse-only pass first; it is saved, so this cost is paid at
+        // most once per recording.
+        if (deleteMap.size() > 0 && !player->HasFullPositionMap())
+        {
+            VERBOSE(VB_GENERAL, "Recording has no seek table, rebuilding "
+                                "it so cut jumps can seek directly");
+
+            RingBuffer *rebuildRB = RingBuffer::Create(inputname,
+                                                       false, false);
+            if (rebuildRB->IsOpen())
+            {
+                MythCommFlagPlayer *cfp = new MythCommFlagPlayer();
+                PlayerContext *rebuild_ctx =
+                    new PlayerContext("seektable rebuilder");
+                rebuild_ctx->SetSpecialDecode(kAVSpecialDecode_NoDecode);
+                rebuild_ctx->SetPlayingInfo(m_proginfo);
+                rebuild_ctx->SetRingBuffer(rebuildRB);
+                rebuild_ctx->SetPlayer(cfp);
+                cfp->SetPlayerInfo(NULL, NULL, true, rebuild_ctx);
+                cfp->RebuildSeekTable(showprogress);
+                delete rebuild_ctx;
+
+                player->ReloadPositionMap();
+            }
+            else
+            {
+                delete rebuildRB;
+            }
+        }
+
         curtime = curtime.addSecs(60);
     }
 
@@ -474,6 +878,14 @@ int Transcode::TranscodeFile(
     int newWidth = video_width;
     int newHeight = video_height;
 
+    if (stillRecording)
+    {
+        // the seek table is still growing, so estimate the final length
+        // from the scheduled end time for the progress display
+        total_frame_count = (long long)
+            (recordingStartsAt.secsTo(recordingStopsAt) * video_frame_rate);
+    }
+
     kfa_table = new vector<struct kfatable_entry>;
 
     if (fifodir.isEmpty())
@@ -783,6 +1195,11 @@ int Transcode::TranscodeFile(
     AVPicture imageIn, imageOut;
     struct SwsContext  *scontext = NULL;
 
+    // created on the first fully re-encoded frame
+    VideoReencodeThread *encoder = NULL;
+    AudioReencodeThread *audioenc = NULL;
+    QMutex nvrlock;
+
     if (fifow)
         VERBOSE(VB_GENERAL, "Dumping Video and Audio data to fifos");
     else if (copyaudio)
@@ -995,6 +1412,15 @@ int Transcode::TranscodeFile(
         }
         else
         {
+            if (!encoder)
+            {
+                encoder = new VideoReencodeThread(nvr, &nvrlock,
+                                                  forceKeyFrames,
+                                                  newWidth, newHeight,
+                                                  vidSize);
+                encoder->start();
+            }
+
             if (did_ff == 1)
             {
                 did_ff = 2;
@@ -1002,13 +1428,15 @@ int Transcode::TranscodeFile(
                     (frame.timecode - lasttimecode - (int)vidFrameTime);
             }
 
+            float newAspect = 0.0f;
             if (video_aspect != player->GetVideoAspect())
             {
+                // the encoder thread switches the output stream over
+                // just ahead of the frame carrying the new aspect
                 video_aspect = player->GetVideoAspect();
-                nvr->SetNewVideoParams(video_aspect);
+                newAspect = video_aspect;
             }
 
-
             QSize buf_size = player->GetVideoBufferSize();
 
             if (video_width != buf_size.width() ||
@@ -1022,64 +1450,85 @@ int Transcode::TranscodeFile(
                         .arg(newWidth).arg(newHeight));
             }
 
-            if ((video_width == newWidth) && (video_height == newHeight))
-            {
-                frame.buf = lastDecode->buf;
-            }
-            else
-            {
-                frame.buf = newFrame;
-                avpicture_fill(&imageIn, lastDecode->buf, PIX_FMT_YUV420P,
-                               video_width, video_height);
-                avpicture_fill(&imageOut, frame.buf, PIX_FMT_YUV420P,
-                               newWidth, newHeight);
-
-                int bottomBand = (video_height == 1088) ? 8 : 0;
-                scontext = sws_getCachedContext(scontext, video_width,
-                               video_height, PIX_FMT_YUV420P, newWidth,
-                               newHeight, PIX_FMT_YUV420P,
-                               SWS_FAST_BILINEAR, NULL, NULL, NULL);
-
-                sws_scale(scontext, imageIn.data, imageIn.linesize, 0,
-                          video_height - bottomBand,
-                          imageOut.data, imageOut.linesize);
-            }
-
             // audio is fully decoded, so we need to reencode it
             audioframesize = arb->audiobuffer_len;
             if (arb->ab_count)
             {
-                for (int loop = 0; loop < arb->ab_count; loop++)
+                if (!audioenc)
                 {
-                    nvr->SetOption("audioframesize", arb->ab_len[loop]);
-                    nvr->WriteAudio(arb->audiobuffer + arb->ab_offset[loop],
-                                    audioFrame++,
-                                    arb->ab_time[loop] - timecodeOffset);
-                    if (nvr->IsErrored())
-                    {
-                        VERBOSE(VB_IMPORTANT, "Transcode: Encountered "
-                                "irrecoverable error in NVR::WriteAudio");
+                    audioenc = new AudioReencodeThread(nvr, &nvrlock);
+                    audioenc->start();
+                }
 
-                        delete [] newFrame;
-                        if (player_ctx)
-                            delete player_ctx;
-                        return REENCODE_ERROR;
-                    }
+                // hand the decoded chunks over to the audio encode stage
+                for (int loop = 0; loop < arb->ab_count; loop++)
+                {
+                    AudioReencodeThread::Chunk *chunk =
+                        audioenc->GetBuffer(arb->ab_len[loop]);
+                    memcpy(chunk->buf, arb->audiobuffer + arb->ab_offset[loop],
+                           arb->ab_len[loop]);
+                    chunk->len = arb->ab_len[loop];
+                    chunk->frameNumber = audioFrame++;
+                    chunk->timecode = arb->ab_time[loop] - timecodeOffset;
+                    audioenc->Enqueue();
                 }
                 arb->ab_count = 0;
                 arb->audiobuffer_len = 0;
+
+                if (audioenc->IsErrored())
+                {
+                    VERBOSE(VB_IMPORTANT, "Transcode: Encountered "
+                            "irrecoverable error in NVR::WriteAudio");
+
+                    audioenc->Finish();
+                    delete audioenc;
+                    encoder->Finish();
+                    delete encoder;
+                    delete [] newFrame;
+                    if (player_ctx)
+                        delete player_ctx;
+                    return REENCODE_ERROR;
+                }
             }
 
-            player->GetCC608Reader()->TranscodeWriteText(&TranscodeWriteText,
-                                                   (void *)(nvr));
+            {
+                QMutexLocker locker(&nvrlock);
+                player->GetCC608Reader()->TranscodeWriteText(
+                    &TranscodeWriteText, (void *)(nvr));
+            }
 
             lasttimecode = frame.timecode;
-            frame.timecode -= timecodeOffset;
 
-            if (forceKeyFrames)
-                nvr->WriteVideo(&frame, true, true);
-            else
-                nvr->WriteVideo(&frame);
+            // hand the decoded frame over to the scale/encode stage
+            VideoReencodeThread::Frame *encFrame =
+                encoder->GetBuffer(video_width * video_height * 3 / 2);
+            memcpy(encFrame->buf, lastDecode->buf,
+                   video_width * video_height * 3 / 2);
+            encFrame->width = video_width;
+            encFrame->height = video_height;
+            encFrame->timecode = frame.timecode - timecodeOffset;
+            encFrame->frameNumber = frame.frameNumber;
+            encFrame->newaspect = newAspect;
+            encoder->Enqueue();
+
+            if (encoder->IsErrored())
+            {
+                VERBOSE(VB_IMPORTANT, "Transcode: Encountered "
+                        "irrecoverable error in NVR::WriteVideo");
+
+                if (audioenc)
+                {
+                    audioenc->Finish();
+                    delete audioenc;
+                }
+                encoder->Finish();
+                delete encoder;
+                unlink(outputname.toLocal8Bit().constData());
+                delete [] newFrame;
+                if (player_ctx)
+                    delete player_ctx;
+                return REENCODE_ERROR;
+            }
         }
         if (showprogress && QDateTime::currentDateTime() > statustime)
         {
@@ -1096,6 +1545,16 @@ int Transcode::TranscodeFile(
             {
                 VERBOSE(VB_IMPORTANT, "Transcoding aborted, cutlist updated");
 
+                if (audioenc)
+                {
+                    audioenc->Finish();
+                    delete audioenc;
+                }
+                if (encoder)
+                {
+                    encoder->Finish();
+                    delete encoder;
+                }
                 unlink(outputname.toLocal8Bit().constData());
                 delete [] newFrame;
                 if (player_ctx)
@@ -1109,6 +1568,16 @@ int Transcode::TranscodeFile(
                 {
                     VERBOSE(VB_IMPORTANT, "Transcoding STOPped by JobQueue");
 
+                    if (audioenc)
+                    {
+                        audioenc->Finish();
+                        delete audioenc;
+                    }
+                    if (encoder)
+                    {
+                        encoder->Finish();
+                        delete encoder;
+                    }
                     unlink(outputname.toLocal8Bit().constData());
                     delete [] newFrame;
                     if (player_ctx)
@@ -1137,12 +1606,89 @@ int Transcode::TranscodeFile(
             curtime = curtime.addSecs(20);
         }
 
+        if (stillRecording)
+        {
+            // Pace ourselves a safe distance behind the write head so
+            // the decoder never runs into a transient end-of-file, and
+            // drop out of follow mode once the recording has finished.
+            if (QDateTime::currentDateTime() > recordingStopsAt)
+                stillRecording = false;
+            else
+            {
+                int secondsRecorded;
+                if (player_ctx->recorder &&
+                    player_ctx->recorder->IsValidRecorder())
+                {
+                    secondsRecorded = (int)
+                        (player_ctx->recorder->GetFramesWritten() /
+                         video_frame_rate);
+                }
+                else
+                {
+                    secondsRecorded = recordingStartsAt.secsTo(
+                        QDateTime::currentDateTime());
+                }
+                int secondsTranscoded =
+                    (int)(curFrameNum / video_frame_rate);
+
+                if ((secondsRecorded - secondsTranscoded) < requiredBuffer)
+                    usleep((long)(vidFrameTime * 1500));
+            }
+        }
+
         curFrameNum++;
         frame.frameNumber = 1 + (curFrameNum << 1);
     }
 
     sws_freeContext(scontext);
 
+    if (audioenc)
+    {
+        // flush the chunks still queued for the audio encode stage
+        audioenc->Finish();
+        bool auderror = audioenc->IsErrored();
+        delete audioenc;
+        audioenc = NULL;
+
+        if (auderror)
+        {
+            VERBOSE(VB_IMPORTANT, "Transcode: Encountered irrecoverable "
+                    "error in NVR::WriteAudio");
+
+            if (encoder)
+            {
+                encoder->Finish();
+                delete encoder;
+            }
+            unlink(outputname.toLocal8Bit().constData());
+            delete [] newFrame;
+            if (player_ctx)
+                delete player_ctx;
+            return REENCODE_ERROR;
+        }
+    }
+
+    if (encoder)
+    {
+        // flush the frames still queued for the encode stage
+        encoder->Finish();
+        bool encerror = encoder->IsErrored();
+        delete encoder;
+        encoder = NULL;
+
+        if (encerror)
+        {
+            VERBOSE(VB_IMPORTANT, "Transcode: Encountered irrecoverable "
+                    "error in NVR::WriteVideo");
+
+            unlink(outputname.toLocal8Bit().constData());
+            delete [] newFrame;
+            if (player_ctx)
+                delete player_ctx;
+            return REENCODE_ERROR;
+        }
+    }
+
     if (! fifow)
     {
         if (m_proginfo)
@@ -607,6 +607,22 @@ static GlobalCheckBox *AutoCommflagWhileRecording()
     return gc;
 };
 
+static GlobalCheckBox *AutoTranscodeWhileRecording()
+{
+    GlobalCheckBox *gc = new GlobalCheckBox("AutoTranscodeWhileRecording");
+    gc->setLabel(QObject::tr("Start auto-transcode jobs when the "
+                             "recording starts"));
+    gc->setValue(false);
+    gc->setHelpText(QObject::tr("If enabled, and Auto Transcode is ON for "
+                                "a recording, the transcode job will be "
+                                "started as soon as the recording starts "
+                                "and will follow along behind it, so the "
+                                "result is ready shortly after the "
+                                "recording ends. NOT recommended on "
+                                "underpowered systems."));
+    return gc;
+};
+
 static GlobalLineEdit *UserJob(uint job_num)
 {
     GlobalLineEdit *gc = new GlobalLineEdit(QString("UserJob%1").arg(job_num));
@@ -1090,6 +1106,7 @@ BackendSettings::BackendSettings() {
     group6->addChild(AutoCommflagWhileRecording());
     group6->addChild(JobQueueCommFlagCommand());
     group6->addChild(JobQueueTranscodeCommand());
+    group6->addChild(AutoTranscodeWhileRecording());
     group6->addChild(AutoTranscodeBeforeAutoCommflag());
     group6->addChild(SaveTranscoding());
     addChild(group6);
@@ -13,6 +13,7 @@ using_frontend {
 
 using_backend {
     SUBDIRS += mythbackend mythfilldatabase mythtv-setup scripts
+    !mingw: SUBDIRS += mythiobench mythbench
 }
 
 using_mythtranscode: SUBDIRS += mythtranscode